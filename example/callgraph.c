@@ -0,0 +1,376 @@
+/* Call graph profiler for the simulator.
+ *
+ * The CPU reports every jsr, bsr, return and exception through the call
+ * hook (M68K_CALL_HOOK), and a shadow of the call stack is kept from them.
+ * Cycles between two events go to the function on top of it; when a call
+ * returns, the cycles since it was made go to the call and, unless it is a
+ * recursive one, to the function called.
+ *
+ * Returns are matched by the stack pointer rather than the return address:
+ * an rts pops every call whose return address was pushed below where A7
+ * now is, so code that drops frames (longjmp and the like) or pushes an
+ * address to rts to stays in step.  An rte pops up to the latest exception.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "m68k.h"
+#include "callgraph.h"
+#include "pcsample.h"
+
+#define MAX_CALL_DEPTH   0x100000
+#define MIN_TABLE_SLOTS  1024     /* Power of 2 */
+
+typedef struct
+{
+	unsigned int       address;     /* Entry point */
+	unsigned long long calls;
+	unsigned long long self_cycles;
+	unsigned long long cycles;      /* With the functions it called */
+	unsigned int       active;      /* Frames of it on the shadow stack */
+	int                named;       /* Name written to the output */
+} function;
+
+typedef struct
+{
+	unsigned int       caller;      /* Function indices */
+	unsigned int       callee;
+	unsigned int       site;        /* Address of the calling instruction */
+	unsigned long long calls;
+	unsigned long long cycles;
+} call_arc;
+
+typedef struct
+{
+	unsigned int       function;
+	unsigned int       arc;
+	unsigned int       sp;          /* A7 with the return address pushed */
+	int                exception;
+	int                outermost;   /* Not a recursive call */
+	unsigned long long start;       /* Cycle count at the call */
+} frame;
+
+static function*          g_functions;
+static unsigned int       g_function_count;
+static unsigned int       g_function_capacity;
+static unsigned int*      g_function_slots;   /* Index + 1, or 0 */
+static unsigned int       g_function_slot_count;
+static call_arc*          g_arcs;
+static unsigned int       g_arc_count;
+static unsigned int       g_arc_capacity;
+static unsigned int*      g_arc_slots;
+static unsigned int       g_arc_slot_count;
+static frame*             g_frames;
+static unsigned int       g_depth;
+static unsigned int       g_frame_slots;
+static unsigned int       g_max_depth;
+static unsigned long      g_dropped;          /* Calls beyond MAX_CALL_DEPTH or without memory */
+static unsigned long long g_last_cycles;      /* Cycle count at the last event */
+static int                g_running;
+
+
+/* ----------------------------- Hash tables ------------------------------ */
+
+static unsigned int hash_address(unsigned int address)
+{
+	return (address >> 1) * 2654435761u;
+}
+
+static unsigned int hash_arc(unsigned int caller, unsigned int site, unsigned int callee)
+{
+	return hash_address(site) ^ (caller * 40503u) ^ (callee * 2246822519u);
+}
+
+/* Rebuild slots for count entries in twice as many slots as needed */
+static unsigned int* rehash(unsigned int* slots, unsigned int* slot_count, unsigned int count, int arcs)
+{
+	unsigned int new_count = *slot_count ? *slot_count * 2 : MIN_TABLE_SLOTS;
+	unsigned int* new_slots = calloc(new_count, sizeof(*new_slots));
+	unsigned int i;
+
+	if(new_slots == NULL)
+		return NULL;
+	for(i = 0; i < count; i++)
+	{
+		unsigned int h = arcs ? hash_arc(g_arcs[i].caller, g_arcs[i].site, g_arcs[i].callee)
+							  : hash_address(g_functions[i].address);
+
+		while(new_slots[h & (new_count - 1)])
+			h++;
+		new_slots[h & (new_count - 1)] = i + 1;
+	}
+	free(slots);
+	*slot_count = new_count;
+	return new_slots;
+}
+
+/* Make room for one more entry in an array of count entries of size bytes.
+ * Returns NULL, leaving array as it is, if there is no memory.
+ */
+static void* grow(void* array, unsigned int* capacity, unsigned int count, size_t size)
+{
+	unsigned int new_capacity = *capacity ? *capacity * 2 : MIN_TABLE_SLOTS / 2;
+
+	if(count < *capacity)
+		return array;
+	if((array = realloc(array, new_capacity * size)) != NULL)
+		*capacity = new_capacity;
+	return array;
+}
+
+/* Index of the function at address, added if need be, or -1 */
+static int find_function(unsigned int address)
+{
+	unsigned int h = hash_address(address);
+	unsigned int i;
+	function* functions;
+
+	if(g_function_slot_count)
+		for(; (i = g_function_slots[h & (g_function_slot_count - 1)]) != 0; h++)
+			if(g_functions[i - 1].address == address)
+				return i - 1;
+
+	if((g_function_count + 1) * 2 > g_function_slot_count)
+	{
+		unsigned int* slots = rehash(g_function_slots, &g_function_slot_count, g_function_count, 0);
+
+		if(slots == NULL)
+			return -1;
+		g_function_slots = slots;
+	}
+	if((functions = grow(g_functions, &g_function_capacity, g_function_count, sizeof(*functions))) == NULL)
+		return -1;
+	g_functions = functions;
+	memset(&g_functions[g_function_count], 0, sizeof(*g_functions));
+	g_functions[g_function_count].address = address;
+	for(h = hash_address(address); g_function_slots[h & (g_function_slot_count - 1)]; h++)
+		;
+	g_function_slots[h & (g_function_slot_count - 1)] = ++g_function_count;
+	return g_function_count - 1;
+}
+
+/* Index of the call from site in caller to callee, added if need be, or -1 */
+static int find_arc(unsigned int caller, unsigned int site, unsigned int callee)
+{
+	unsigned int h = hash_arc(caller, site, callee);
+	unsigned int i;
+	call_arc* arcs;
+
+	if(g_arc_slot_count)
+		for(; (i = g_arc_slots[h & (g_arc_slot_count - 1)]) != 0; h++)
+			if(g_arcs[i - 1].site == site && g_arcs[i - 1].caller == caller && g_arcs[i - 1].callee == callee)
+				return i - 1;
+
+	if((g_arc_count + 1) * 2 > g_arc_slot_count)
+	{
+		unsigned int* slots = rehash(g_arc_slots, &g_arc_slot_count, g_arc_count, 1);
+
+		if(slots == NULL)
+			return -1;
+		g_arc_slots = slots;
+	}
+	if((arcs = grow(g_arcs, &g_arc_capacity, g_arc_count, sizeof(*arcs))) == NULL)
+		return -1;
+	g_arcs = arcs;
+	memset(&g_arcs[g_arc_count], 0, sizeof(*g_arcs));
+	g_arcs[g_arc_count].caller = caller;
+	g_arcs[g_arc_count].site = site;
+	g_arcs[g_arc_count].callee = callee;
+	for(h = hash_arc(caller, site, callee); g_arc_slots[h & (g_arc_slot_count - 1)]; h++)
+		;
+	g_arc_slots[h & (g_arc_slot_count - 1)] = ++g_arc_count;
+	return g_arc_count - 1;
+}
+
+
+/* ----------------------------- Shadow stack ----------------------------- */
+
+static void push_frame(unsigned int pc, unsigned int target, unsigned int sp, int exception, unsigned long long cycles)
+{
+	int callee;
+	int arc;
+	frame* f;
+
+	if(g_depth == g_frame_slots)
+	{
+		frame* frames = g_depth < MAX_CALL_DEPTH ? realloc(g_frames, g_depth * 2 * sizeof(*frames)) : NULL;
+
+		if(frames == NULL)
+		{
+			g_dropped++;
+			return;
+		}
+		g_frames = frames;
+		g_frame_slots = g_depth * 2;
+	}
+	if((callee = find_function(target)) < 0 || (arc = find_arc(g_frames[g_depth - 1].function, pc, callee)) < 0)
+	{
+		g_dropped++;
+		return;
+	}
+	g_functions[callee].calls++;
+	g_arcs[arc].calls++;
+
+	f = &g_frames[g_depth++];
+	f->function = callee;
+	f->arc = arc;
+	f->sp = sp;
+	f->exception = exception;
+	f->outermost = g_functions[callee].active++ == 0;
+	f->start = cycles;
+	if(g_depth - 1 > g_max_depth)
+		g_max_depth = g_depth - 1;
+}
+
+static void pop_frame(unsigned long long cycles)
+{
+	frame* f = &g_frames[--g_depth];
+	unsigned long long elapsed = cycles - f->start;
+
+	g_arcs[f->arc].cycles += elapsed;
+	g_functions[f->function].active--;
+	if(f->outermost)
+		g_functions[f->function].cycles += elapsed;
+}
+
+void call_graph_start(unsigned int pc, unsigned long long cycles)
+{
+	int root;
+
+	g_running = 0;
+	if(g_frames == NULL && (g_frames = malloc(MIN_TABLE_SLOTS * sizeof(*g_frames))) == NULL)
+		return;
+	g_frame_slots = MIN_TABLE_SLOTS;
+	if((root = find_function(pc)) < 0)
+		return;
+	g_frames[0].function = root;
+	g_frames[0].sp = 0xffffffff;
+	g_frames[0].exception = 0;
+	g_frames[0].outermost = g_functions[root].active++ == 0;
+	g_frames[0].start = cycles;
+	g_depth = 1;
+	g_last_cycles = cycles;
+	g_running = 1;
+}
+
+void call_graph_event(int type, unsigned int pc, unsigned int target, unsigned int sp, unsigned long long cycles)
+{
+	unsigned int i;
+
+	if(!g_running)
+		return;
+	g_functions[g_frames[g_depth - 1].function].self_cycles += cycles - g_last_cycles;
+	g_last_cycles = cycles;
+
+	switch(type)
+	{
+		case M68K_CALL_SUBROUTINE:
+			push_frame(pc, target, sp, 0, cycles);
+			break;
+		case M68K_CALL_EXCEPTION:
+			push_frame(pc, target, sp, 1, cycles);
+			break;
+		case M68K_CALL_RETURN:
+			while(g_depth > 1 && !g_frames[g_depth - 1].exception && g_frames[g_depth - 1].sp < sp)
+				pop_frame(cycles);
+			break;
+		case M68K_CALL_EXCEPTION_RETURN:
+			for(i = g_depth - 1; i > 0 && !g_frames[i].exception; i--)
+				;
+			while(i > 0 && g_depth > i)
+				pop_frame(cycles);
+			break;
+	}
+}
+
+
+/* -------------------------------- Output -------------------------------- */
+
+static const char* function_name(unsigned int index, char* buff)
+{
+	static char name[256];
+
+	if(g_functions[index].named)
+	{
+		sprintf(buff, "(%u)", index + 1);
+		return buff;
+	}
+	g_functions[index].named = 1;
+	sprintf(buff, "(%u) %.240s", index + 1, pc_sample_location_name(g_functions[index].address, name));
+	return buff;
+}
+
+static int compare_arcs(const void* a, const void* b)
+{
+	const call_arc* x = a;
+	const call_arc* y = b;
+
+	if(x->caller != y->caller)
+		return x->caller < y->caller ? -1 : 1;
+	return x->site < y->site ? -1 : x->site > y->site;
+}
+
+int call_graph_write(const char* filename, const char* command, unsigned long long cycles)
+{
+	FILE* file;
+	unsigned long long total = 0;
+	unsigned long long calls = 0;
+	unsigned int a = 0;
+	unsigned int i;
+	char buff[256];
+	int ok;
+
+	if(!g_running)
+		return 0;
+	g_functions[g_frames[g_depth - 1].function].self_cycles += cycles - g_last_cycles;
+	g_last_cycles = cycles;
+	while(g_depth > 0)
+	{
+		if(g_depth == 1)
+		{
+			g_functions[g_frames[0].function].active--;
+			g_functions[g_frames[0].function].cycles += cycles - g_frames[0].start;
+			g_depth = 0;
+		}
+		else
+			pop_frame(cycles);
+	}
+	g_running = 0;
+
+	for(i = 0; i < g_function_count; i++)
+	{
+		total += g_functions[i].self_cycles;
+		calls += g_functions[i].calls;
+		g_functions[i].named = 0;
+	}
+	/* The arcs of each caller together; the hash table is not used again */
+	qsort(g_arcs, g_arc_count, sizeof(*g_arcs), compare_arcs);
+
+	if((file = fopen(filename, "w")) == NULL)
+		return 0;
+	fprintf(file, "# callgrind format\n"
+				  "version: 1\n"
+				  "creator: Musashi sim\n"
+				  "cmd: %s\n"
+				  "# %llu calls, deepest call stack %u\n", command, calls, g_max_depth);
+	if(g_dropped)
+		fprintf(file, "# %lu calls dropped for lack of memory or too deep\n", g_dropped);
+	fprintf(file, "positions: instr\n"
+				  "events: Cycles\n"
+				  "summary: %llu\n", total);
+
+	for(i = 0; i < g_function_count; i++)
+	{
+		fprintf(file, "\nfn=%s\n", function_name(i, buff));
+		fprintf(file, "0x%x %llu\n", g_functions[i].address, g_functions[i].self_cycles);
+		for(; a < g_arc_count && g_arcs[a].caller == i; a++)
+		{
+			fprintf(file, "cfn=%s\n", function_name(g_arcs[a].callee, buff));
+			fprintf(file, "calls=%llu 0x%x\n", g_arcs[a].calls, g_functions[g_arcs[a].callee].address);
+			fprintf(file, "0x%x %llu\n", g_arcs[a].site, g_arcs[a].cycles);
+		}
+	}
+	ok = !ferror(file);
+	return fclose(file) == 0 && ok;
+}
@@ -0,0 +1,21 @@
+#ifndef CALLGRAPH__HEADER
+#define CALLGRAPH__HEADER
+
+/* Start following calls, with the code at pc running and the cycle count
+ * at cycles.
+ */
+void call_graph_start(unsigned int pc, unsigned long long cycles);
+
+/* Follow a M68K_CALL_xxx event from the call hook.  sp is A7 after the
+ * event and cycles the cycle count.
+ */
+void call_graph_event(int type, unsigned int pc, unsigned int target, unsigned int sp, unsigned long long cycles);
+
+/* Close the calls still open at cycles and write the call graph in the
+ * format callgrind_annotate and KCachegrind read, naming functions after
+ * the symbols loaded with pc_sample_load_symbols().  command is the name of
+ * the profiled program.  Returns 0 if the file could not be written.
+ */
+int call_graph_write(const char* filename, const char* command, unsigned long long cycles);
+
+#endif /* CALLGRAPH__HEADER */
@@ -0,0 +1,847 @@
+/* Whole image disassembler for the simulator.
+ *
+ * Code is told apart from data by recursive descent: decoding starts at the
+ * exception vectors and the bodies of the Forth dictionary words, and
+ * follows branches, subroutine calls and jump tables from there.  Anything
+ * the control flow never reaches is listed as data.
+ *
+ * Every even address of the image is decoded up front, and the listing is
+ * formatted afterwards, both split across all host cores with one
+ * disassembler context per thread.  Only the walk over the decoded
+ * instructions, which is cheap, runs on a single thread.
+ */
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "m68k.h"
+#include "disasm.h"
+
+#define MAX_THREADS       64
+#define MAX_TABLE_ENTRIES 256    /* Most entries read from one jump table */
+#define MAX_TRIAL_LENGTH  64     /* Instructions checked before trusting a Forth word body */
+#define MAX_FORTH_WORDS   8192
+#define VECTOR_TABLE_END  0x400
+#define DATA_LINE_BYTES   8
+
+/* Dictionary pointers of the Forth system, see _find() in sim.c */
+#define FORTH_LAST_ADDRESS 0x2004
+
+#define READ_WORD(BASE, ADDR) (((BASE)[ADDR]<<8) |			\
+							  (BASE)[(ADDR)+1])
+#define READ_LONG(BASE, ADDR) (((unsigned int)(BASE)[ADDR]<<24) |	\
+							  ((BASE)[(ADDR)+1]<<16) |		\
+							  ((BASE)[(ADDR)+2]<<8) |		\
+							  (BASE)[(ADDR)+3])
+
+/* What each byte of the image holds */
+enum
+{
+	KIND_DATA,      /* Not reached by the control flow, listed as dc.b */
+	KIND_CODE,      /* First byte of an instruction */
+	KIND_POINTER,   /* Exception vector or jump table entry holding a code address */
+	KIND_OFFSET,    /* Jump table entry holding a code address less the table address */
+	KIND_HEADER,    /* Length and name of a Forth word */
+	KIND_LINK,      /* Address of the previous Forth word */
+	KIND_CONTINUED  /* Later byte of one of the above */
+};
+
+/* Why an address is referred to */
+#define LABEL_VECTOR 0x01
+#define LABEL_CALL   0x02
+#define LABEL_JUMP   0x04
+#define LABEL_TABLE  0x08
+#define LABEL_HEADER 0x10
+#define LABEL_DATA   0x20
+#define LABEL_ANY    0x3f
+#define LABEL_QUEUED 0x40        /* On the stack of code still to walk */
+#define LABEL_BROKEN 0x80        /* The control flow runs into something that is not code */
+
+typedef struct
+{
+	const unsigned char*   image;
+	const unsigned char*   loaded;
+	unsigned int           size;
+	unsigned int           cpu_type;
+	m68k_dasm_instruction* insns;   /* Decoded at every even address, length 0 if invalid */
+	unsigned char*         kind;    /* KIND_xxx of every byte */
+	unsigned char*         labels;  /* LABEL_xxx of every byte */
+	unsigned int*          table;   /* Table address of each KIND_OFFSET entry */
+	char**                 names;   /* Label of an exception handler */
+	char**                 words;   /* Name of the Forth word with its header or body here */
+	unsigned int*          stack;
+	unsigned int           stack_size;
+	unsigned int           entries;
+	unsigned int           instructions;
+	unsigned int           tables;
+	unsigned int           broken;
+} image_state;
+
+/* Listing text of one thread */
+typedef struct
+{
+	char*  text;
+	size_t length;
+	size_t capacity;
+	int    failed;
+} text_buffer;
+
+typedef struct
+{
+	image_state* state;
+	unsigned int start;
+	unsigned int end;
+	text_buffer  output;
+} worker;
+
+static const char* const g_vector_names[] =
+{
+	"initial_ssp", "reset", "bus_error", "address_error",
+	"illegal_instruction", "zero_divide", "chk_exception", "trapv_exception",
+	"privilege_violation", "trace", "line_a", "line_f",
+	NULL, NULL, "format_error", "uninitialized_interrupt",
+	NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+	"spurious_interrupt"
+};
+
+
+/* ======================================================================== */
+/* ================================ HELPERS =============================== */
+/* ======================================================================== */
+
+static int is_loaded(const image_state* state, unsigned int address, unsigned int length)
+{
+	if(address >= state->size || length > state->size - address)
+		return 0;
+	while(length--)
+		if(!state->loaded[address++])
+			return 0;
+	return 1;
+}
+
+/* Check that length bytes at address are loaded and not claimed yet */
+static int is_free(const image_state* state, unsigned int address, unsigned int length)
+{
+	unsigned int i;
+
+	if(!is_loaded(state, address, length))
+		return 0;
+	for(i = 0;i < length;i++)
+		if(state->kind[address + i] != KIND_DATA)
+			return 0;
+	return 1;
+}
+
+static void claim(image_state* state, unsigned int address, unsigned int length, unsigned int kind)
+{
+	state->kind[address] = kind;
+	memset(state->kind + address + 1, KIND_CONTINUED, length - 1);
+}
+
+static void set_name(char** names, unsigned int address, const char* name, unsigned int length)
+{
+	char* copy;
+
+	if(names[address] != NULL || (copy = malloc(length + 1)) == NULL)
+		return;
+	memcpy(copy, name, length);
+	copy[length] = 0;
+	names[address] = copy;
+}
+
+/* An instruction after which execution never continues at the next one */
+static int ends_flow(const m68k_dasm_instruction* insn)
+{
+	if(insn->flags & M68K_DASM_FLAG_RETURN)
+		return 1;
+	if((insn->flags & (M68K_DASM_FLAG_BRANCH|M68K_DASM_FLAG_CONDITIONAL|M68K_DASM_FLAG_CALL)) == M68K_DASM_FLAG_BRANCH)
+		return 1;
+	return insn->mnemonic == M68K_INSN_ILLEGAL || insn->mnemonic == M68K_INSN_LINE_A || insn->mnemonic == M68K_INSN_LINE_F;
+}
+
+/* (d8,PC,Xn) with the table address in reach of the displacement */
+static unsigned int pc_index_base(const m68k_dasm_instruction* insn)
+{
+	const m68k_dasm_operand* operand = &insn->operands[0];
+
+	if(insn->operand_count == 0 || operand->type != M68K_DASM_OPERAND_PCIX ||
+		(operand->flags & (M68K_DASM_OPFLAG_NO_BASE|M68K_DASM_OPFLAG_INDIRECT)))
+		return 0xffffffff;
+	return insn->pc + 2 + operand->displacement;
+}
+
+static void run_workers(worker* workers, unsigned int count, void* (*function)(void*))
+{
+	pthread_t threads[MAX_THREADS];
+	unsigned int started[MAX_THREADS];
+	unsigned int i;
+
+	for(i = 1;i < count;i++)
+		started[i] = pthread_create(&threads[i], NULL, function, &workers[i]) == 0;
+	function(&workers[0]);
+	for(i = 1;i < count;i++)
+	{
+		if(started[i])
+			pthread_join(threads[i], NULL);
+		else
+			function(&workers[i]);
+	}
+}
+
+
+/* ======================================================================== */
+/* =============================== DECODING =============================== */
+/* ======================================================================== */
+
+static void* decode_range(void* arg)
+{
+	worker* w = arg;
+	image_state* state = w->state;
+	m68k_dasm_context ctx;
+	unsigned int pc;
+
+	m68k_dasm_init_context(&ctx, state->cpu_type);
+	m68k_dasm_set_buffer(&ctx, state->image, 0, state->size);
+	for(pc = w->start;pc < w->end;pc += 2)
+	{
+		m68k_dasm_instruction* insn = &state->insns[pc >> 1];
+
+		if(!is_loaded(state, pc, 2) || !m68k_is_valid_instruction(READ_WORD(state->image, pc), state->cpu_type))
+			continue;
+		m68k_dasm_decode(&ctx, pc, insn, NULL);
+		if(!is_loaded(state, pc, insn->length))
+			insn->length = 0;
+	}
+	return NULL;
+}
+
+
+/* ======================================================================== */
+/* ============================ CODE DISCOVERY ============================ */
+/* ======================================================================== */
+
+/* Queue code at address to be walked.  Returns 0 if it cannot be code. */
+static int add_code(image_state* state, unsigned int address, unsigned int label)
+{
+	if((address & 1) || !is_loaded(state, address, 2))
+		return 0;
+	state->labels[address] |= label;
+	if(state->kind[address] == KIND_DATA && !(state->labels[address] & LABEL_QUEUED))
+	{
+		state->labels[address] |= LABEL_QUEUED;
+		state->stack[state->stack_size++] = address;
+	}
+	return 1;
+}
+
+/* Check that a table at address was not read before */
+static int start_table(image_state* state, unsigned int address)
+{
+	if((address & 1) || !is_free(state, address, 2) || (state->labels[address] & LABEL_TABLE))
+		return 0;
+	state->labels[address] |= LABEL_TABLE;
+	state->tables++;
+	return 1;
+}
+
+/* Table entries end where the code of the first case starts */
+static void limit_table(unsigned int table, unsigned int target, unsigned int* end)
+{
+	if(target > table && target < *end)
+		*end = target;
+}
+
+/* move.w table(PC,Dn), Dn; jmp table(PC,Dn): offsets from the table */
+static void read_offset_table(image_state* state, unsigned int table)
+{
+	unsigned int address, end = state->size;
+	unsigned int count;
+
+	if(!start_table(state, table))
+		return;
+	for(address = table, count = 0;count < MAX_TABLE_ENTRIES && address + 2 <= end && is_free(state, address, 2);address += 2, count++)
+	{
+		unsigned int target = table + (short)READ_WORD(state->image, address);
+
+		if((target >= table && target < address + 2) || !add_code(state, target, LABEL_JUMP))
+			break;
+		claim(state, address, 2, KIND_OFFSET);
+		state->table[address] = table;
+		limit_table(table, target, &end);
+	}
+}
+
+/* movea.l table(PC,Dn), An; jmp (An): code addresses */
+static void read_pointer_table(image_state* state, unsigned int table)
+{
+	unsigned int address, end = state->size;
+	unsigned int count;
+
+	if(!start_table(state, table))
+		return;
+	for(address = table, count = 0;count < MAX_TABLE_ENTRIES && address + 4 <= end && is_free(state, address, 4);address += 4, count++)
+	{
+		unsigned int target = READ_LONG(state->image, address);
+
+		if((target >= table && target < address + 4) || !add_code(state, target, LABEL_JUMP))
+			break;
+		claim(state, address, 4, KIND_POINTER);
+		limit_table(table, target, &end);
+	}
+}
+
+/* jmp table(PC,Dn) straight into a row of bra instructions */
+static void read_branch_table(image_state* state, unsigned int table)
+{
+	unsigned int address = table;
+	unsigned int count;
+
+	if(!add_code(state, table, LABEL_TABLE))
+		return;
+	for(count = 0;count < MAX_TABLE_ENTRIES && address < state->size && !(address & 1);count++)
+	{
+		const m68k_dasm_instruction* insn = &state->insns[address >> 1];
+
+		if(insn->length == 0 || insn->mnemonic != M68K_INSN_BRA)
+			break;
+		add_code(state, address, LABEL_JUMP);
+		address += insn->length;
+	}
+}
+
+/* Find where a jmp or jsr with a computed address can go, from the
+ * instruction that set up the address.
+ */
+static void read_jump_table(image_state* state, const m68k_dasm_instruction* insn, const m68k_dasm_instruction* prev)
+{
+	const m68k_dasm_operand* operand = &insn->operands[0];
+	unsigned int table = pc_index_base(insn);
+
+	if(table != 0xffffffff)
+	{
+		if(prev != NULL && prev->mnemonic == M68K_INSN_MOVE && prev->size == 2 &&
+			pc_index_base(prev) == table && prev->operands[1].type == M68K_DASM_OPERAND_DREG)
+			read_offset_table(state, table);
+		else
+			read_branch_table(state, table);
+		return;
+	}
+
+	if(insn->operand_count == 0 || operand->type != M68K_DASM_OPERAND_AI || prev == NULL ||
+		prev->operand_count != 2 || prev->operands[1].type != M68K_DASM_OPERAND_AREG ||
+		prev->operands[1].reg != operand->reg)
+		return;
+	if(prev->mnemonic == M68K_INSN_LEA && prev->operands[0].type == M68K_DASM_OPERAND_PCDI)
+		add_code(state, prev->operands[0].value, LABEL_JUMP);
+	else if(prev->mnemonic == M68K_INSN_MOVEA && prev->size == 4 && pc_index_base(prev) != 0xffffffff)
+		read_pointer_table(state, pc_index_base(prev));
+}
+
+/* Label the data an instruction refers to by address */
+static void mark_data_references(image_state* state, const m68k_dasm_instruction* insn)
+{
+	unsigned int i;
+
+	for(i = 0;i < insn->operand_count;i++)
+	{
+		const m68k_dasm_operand* operand = &insn->operands[i];
+
+		if(!(operand->flags & M68K_DASM_OPFLAG_ADDRESS) || operand->type == M68K_DASM_OPERAND_TARGET)
+			continue;
+		if(i == 0 && (insn->flags & M68K_DASM_FLAG_TARGET))
+			continue;
+		if(is_loaded(state, operand->value, 1))
+			state->labels[operand->value] |= LABEL_DATA;
+	}
+}
+
+/* Claim the instructions from pc on up to the end of the flow */
+static void walk(image_state* state, unsigned int pc)
+{
+	const m68k_dasm_instruction* prev = NULL;
+
+	for(;;)
+	{
+		const m68k_dasm_instruction* insn;
+
+		if(pc >= state->size || (pc & 1))
+			return;
+		if(state->kind[pc] == KIND_CODE)
+			return;
+		insn = &state->insns[pc >> 1];
+		if(insn->length == 0 || !is_free(state, pc, insn->length))
+		{
+			if(!(state->labels[pc] & LABEL_BROKEN))
+				state->broken++;
+			state->labels[pc] |= LABEL_BROKEN;
+			return;
+		}
+		claim(state, pc, insn->length, KIND_CODE);
+		state->instructions++;
+
+		if(insn->flags & M68K_DASM_FLAG_TARGET)
+			add_code(state, insn->target, (insn->flags & M68K_DASM_FLAG_CALL) ? LABEL_CALL : LABEL_JUMP);
+		else if((insn->flags & M68K_DASM_FLAG_BRANCH) && !(insn->flags & M68K_DASM_FLAG_RETURN))
+			read_jump_table(state, insn, prev);
+		mark_data_references(state, insn);
+
+		if(ends_flow(insn))
+			return;
+		prev = insn;
+		pc += insn->length;
+	}
+}
+
+static void walk_all(image_state* state)
+{
+	while(state->stack_size > 0)
+		walk(state, state->stack[--state->stack_size]);
+}
+
+static void add_vectors(image_state* state)
+{
+	unsigned int end = VECTOR_TABLE_END;
+	unsigned int vector;
+	char name[32];
+
+	for(vector = 0;vector * 4 + 4 <= end;vector++)
+	{
+		unsigned int address = vector * 4;
+		unsigned int target;
+
+		if(!is_free(state, address, 4))
+			continue;
+		target = READ_LONG(state->image, address);
+		if(vector > 1 && target == 0)
+			continue;
+		/* The table is over once a vector is no code address */
+		if(vector > 0 && ((target & 1) || !is_loaded(state, target, 2)))
+			break;
+		claim(state, address, 4, KIND_POINTER);
+		if(vector == 0)
+			continue;
+
+		if(vector < sizeof(g_vector_names) / sizeof(g_vector_names[0]) && g_vector_names[vector] != NULL)
+			strcpy(name, g_vector_names[vector]);
+		else if(vector >= 25 && vector <= 31)
+			sprintf(name, "autovector_%u", vector - 24);
+		else if(vector >= 32 && vector <= 47)
+			sprintf(name, "trap_%u", vector - 32);
+		else
+			sprintf(name, "vector_%u", vector);
+		set_name(state->names, target, name, strlen(name));
+		add_code(state, target, LABEL_VECTOR);
+		state->entries++;
+		if(target < end)
+			end = target;
+	}
+}
+
+/* Check that a Forth word body decodes up to the end of its flow before
+ * taking it for code, since the body of a high level word is no code.
+ */
+static int is_plausible_code(const image_state* state, unsigned int pc)
+{
+	unsigned int count;
+
+	for(count = 0;count < MAX_TRIAL_LENGTH && pc < state->size && !(pc & 1);count++)
+	{
+		const m68k_dasm_instruction* insn = &state->insns[pc >> 1];
+
+		if(state->kind[pc] == KIND_CODE)
+			return 1;
+		if(insn->length == 0 || !is_free(state, pc, insn->length))
+			return 0;
+		if(ends_flow(insn))
+			return insn->mnemonic != M68K_INSN_ILLEGAL && insn->mnemonic != M68K_INSN_LINE_A && insn->mnemonic != M68K_INSN_LINE_F;
+		pc += insn->length;
+	}
+	return 0;
+}
+
+/* Walk the dictionary from the latest word back, like _find() in sim.c.
+ * A header is the name length, the name, padding to an even address and
+ * the address of the previous header; the word body follows.
+ */
+static void add_forth_words(image_state* state)
+{
+	unsigned int header, previous = 0xffffffff;
+	unsigned int count;
+
+	if(!is_loaded(state, FORTH_LAST_ADDRESS, 2))
+		return;
+	header = READ_WORD(state->image, FORTH_LAST_ADDRESS);
+	for(count = 0;count < MAX_FORTH_WORDS && header != 0 && header < previous;count++)
+	{
+		unsigned int length = state->image[header] & 0x1f;
+		unsigned int link = (header + 1 + length + 1) & ~1;
+		unsigned int body = link + 2;
+
+		if(!is_free(state, header, link - header) || !is_free(state, link, 2))
+			break;
+		claim(state, header, link - header, KIND_HEADER);
+		claim(state, link, 2, KIND_LINK);
+		state->labels[header] |= LABEL_HEADER;
+		set_name(state->words, header, (const char*)state->image + header + 1, length);
+		set_name(state->words, body, (const char*)state->image + header + 1, length);
+		if(is_plausible_code(state, body))
+		{
+			add_code(state, body, LABEL_CALL);
+			state->entries++;
+			walk_all(state);
+		}
+
+		previous = header;
+		header = READ_WORD(state->image, link);
+	}
+}
+
+
+/* ======================================================================== */
+/* ================================ LISTING =============================== */
+/* ======================================================================== */
+
+static void buffer_printf(text_buffer* buffer, const char* format, ...)
+{
+	va_list args;
+	int length;
+
+	for(;;)
+	{
+		size_t space = buffer->capacity - buffer->length;
+		char* text;
+
+		va_start(args, format);
+		length = vsnprintf(space ? buffer->text + buffer->length : NULL, space, format, args);
+		va_end(args);
+		if(length < 0 || buffer->failed)
+			return;
+		if((size_t)length < space)
+			break;
+		if((text = realloc(buffer->text, buffer->capacity * 2 + length + 1)) == NULL)
+		{
+			buffer->failed = 1;
+			return;
+		}
+		buffer->text = text;
+		buffer->capacity = buffer->capacity * 2 + length + 1;
+	}
+	buffer->length += length;
+}
+
+static int has_label(const image_state* state, unsigned int address)
+{
+	return address < state->size && (state->labels[address] & LABEL_ANY) &&
+		state->loaded[address] && state->kind[address] != KIND_CONTINUED;
+}
+
+static const char* label_name(const image_state* state, unsigned int address, char* buff)
+{
+	unsigned int labels = state->labels[address];
+	const char* prefix = "loc";
+
+	if(state->names[address] != NULL)
+		return state->names[address];
+	if(labels & LABEL_CALL)
+		prefix = "sub";
+	else if(labels & (LABEL_JUMP|LABEL_VECTOR))
+		prefix = "loc";
+	else if(labels & LABEL_TABLE)
+		prefix = "tbl";
+	else if(labels & LABEL_HEADER)
+		prefix = "hdr";
+	else if(state->kind[address] != KIND_CODE)
+		prefix = "dat";
+	sprintf(buff, "%s_%05x", prefix, address);
+	return buff;
+}
+
+/* A code address as a label if it has one */
+static const char* address_name(const image_state* state, unsigned int address, char* buff)
+{
+	if(has_label(state, address))
+		return label_name(state, address, buff);
+	sprintf(buff, "$%x", address);
+	return buff;
+}
+
+/* Replace the address in an operand of the disassembly with its label */
+static void substitute_label(char* str, unsigned int address, const char* label)
+{
+	char hex[16];
+	char result[256];
+	char* start;
+	char* end;
+	char* pc_reg;
+	size_t hex_length = sprintf(hex, "$%x", address);
+
+	for(start = strstr(str, hex);start != NULL;start = strstr(start + 1, hex))
+		if(!isxdigit((unsigned char)start[hex_length]) && (start == str || start[-1] != '#'))
+			break;
+	if(start == NULL)
+		return;
+	end = start + hex_length;
+	if(end[0] == '.' && (end[1] == 'w' || end[1] == 'l'))
+		end += 2;
+
+	/* (d16,PC) has the address in a comment after the operands: "($10,PC), A0; ($102e)" */
+	if(start - str >= 3 && strncmp(start - 3, "; (", 3) == 0 && (pc_reg = strstr(str, ",PC)")) != NULL && pc_reg < start)
+	{
+		char* open = pc_reg;
+
+		while(open > str && *open != '(')
+			open--;
+		snprintf(result, sizeof(result), "%.*s%s%.*s", (int)(open + 1 - str), str, label, (int)(start - 3 - pc_reg), pc_reg);
+	}
+	else
+		snprintf(result, sizeof(result), "%.*s%s%s", (int)(start - str), str, label, end);
+	strcpy(str, result);
+}
+
+/* The words at address as hex, like make_hex() in sim.c */
+static const char* hex_words(const image_state* state, unsigned int address, unsigned int length, char* buff)
+{
+	char* ptr = buff;
+	unsigned int i;
+
+	*ptr = 0;
+	for(i = 0;i < length;i += 2)
+		ptr += sprintf(ptr, i + 2 < length ? "%04x " : "%04x", READ_WORD(state->image, address + i));
+	return buff;
+}
+
+static void list_code(const image_state* state, m68k_dasm_context* ctx, unsigned int pc, text_buffer* out)
+{
+	m68k_dasm_instruction insn;
+	char str[256];
+	char hex[80];
+	char buff[32];
+	unsigned int length = m68k_dasm_decode(ctx, pc, &insn, str);
+	unsigned int i;
+
+	for(i = 0;i < insn.operand_count;i++)
+	{
+		const m68k_dasm_operand* operand = &insn.operands[i];
+
+		if((operand->type == M68K_DASM_OPERAND_TARGET || (operand->flags & M68K_DASM_OPFLAG_ADDRESS)) && has_label(state, operand->value))
+			substitute_label(str, operand->value, label_name(state, operand->value, buff));
+	}
+	buffer_printf(out, "%05x: %-20s  %s\n", pc, hex_words(state, pc, length, hex), str);
+}
+
+static void list_header(const image_state* state, unsigned int address, unsigned int end, text_buffer* out)
+{
+	unsigned int length = state->image[address] & 0x1f;
+	unsigned int i;
+
+	buffer_printf(out, "%05x: %-20s  dc.b    $%02x,", address, "", state->image[address]);
+	for(i = 0;i < length && isprint(state->image[address + 1 + i]) && state->image[address + 1 + i] != '"';i++);
+	if(i == length)
+		buffer_printf(out, "\"%.*s\"", length, state->image + address + 1);
+	else
+		for(i = 0;i < length;i++)
+			buffer_printf(out, i ? ",$%02x" : "$%02x", state->image[address + 1 + i]);
+	if(address + 1 + length < end)
+		buffer_printf(out, ",$%02x", state->image[end - 1]);
+	buffer_printf(out, "\n");
+}
+
+/* Data up to the next label, item or line boundary */
+static unsigned int list_data(const image_state* state, unsigned int address, text_buffer* out)
+{
+	char ascii[DATA_LINE_BYTES + 1];
+	unsigned int end = address;
+	unsigned int i;
+
+	do
+		end++;
+	while(end < state->size && end % DATA_LINE_BYTES != 0 && state->loaded[end] &&
+		state->kind[end] == KIND_DATA && !(state->labels[end] & (LABEL_ANY|LABEL_BROKEN)) && state->words[end] == NULL);
+
+	buffer_printf(out, "%05x: %-20s  dc.b    ", address, "");
+	for(i = 0;i < end - address;i++)
+	{
+		unsigned char c = state->image[address + i];
+
+		buffer_printf(out, i ? ",$%02x" : "$%02x", c);
+		ascii[i] = isprint(c) ? c : '.';
+	}
+	ascii[i] = 0;
+	buffer_printf(out, "%*s; %s\n", (int)(DATA_LINE_BYTES - i) * 4 + 2, "", ascii);
+	return end;
+}
+
+static void* list_range(void* arg)
+{
+	worker* w = arg;
+	image_state* state = w->state;
+	text_buffer* out = &w->output;
+	m68k_dasm_context ctx;
+	unsigned int address = w->start;
+	char buff[32];
+	char buff2[32];
+	char hex[16];
+
+	m68k_dasm_init_context(&ctx, state->cpu_type);
+	m68k_dasm_set_buffer(&ctx, state->image, 0, state->size);
+	while(address < w->end)
+	{
+		unsigned int end = address + 1;
+
+		if(!state->loaded[address])
+		{
+			address++;
+			continue;
+		}
+		if(address == 0 || !state->loaded[address - 1])
+			buffer_printf(out, "\n        org     $%05x\n", address);
+		if(state->words[address] != NULL)
+			buffer_printf(out, state->kind[address] == KIND_HEADER ? "\n; header of %s\n" : "; %s\n", state->words[address]);
+		if(has_label(state, address))
+			buffer_printf(out, "%s:\n", label_name(state, address, buff));
+		if(state->labels[address] & LABEL_BROKEN)
+			buffer_printf(out, "; the code before or a branch runs into this\n");
+
+		while(end < state->size && state->kind[end] == KIND_CONTINUED)
+			end++;
+		switch(state->kind[address])
+		{
+			case KIND_CODE:
+				list_code(state, &ctx, address, out);
+				break;
+			case KIND_POINTER:
+				buffer_printf(out, "%05x: %-20s  dc.l    %s\n", address, hex_words(state, address, 4, hex),
+					address_name(state, READ_LONG(state->image, address), buff));
+				break;
+			case KIND_OFFSET:
+				buffer_printf(out, "%05x: %-20s  dc.w    %s-%s\n", address, hex_words(state, address, 2, hex),
+					address_name(state, state->table[address] + (short)READ_WORD(state->image, address), buff),
+					address_name(state, state->table[address], buff2));
+				break;
+			case KIND_HEADER:
+				list_header(state, address, end, out);
+				break;
+			case KIND_LINK:
+				buffer_printf(out, "%05x: %-20s  dc.w    %s\n", address, hex_words(state, address, 2, hex),
+					READ_WORD(state->image, address) ? address_name(state, READ_WORD(state->image, address), buff) : "0");
+				break;
+			default:
+				end = list_data(state, address, out);
+				break;
+		}
+		address = end;
+	}
+	return NULL;
+}
+
+
+/* ======================================================================== */
+/* ================================== API ================================= */
+/* ======================================================================== */
+
+static unsigned int thread_count(void)
+{
+	long count = sysconf(_SC_NPROCESSORS_ONLN);
+
+	if(count < 1)
+		return 1;
+	return count > MAX_THREADS ? MAX_THREADS : (unsigned int)count;
+}
+
+int disassemble_image(const char* filename, const unsigned char* image, const unsigned char* loaded, unsigned int size, unsigned int cpu_type)
+{
+	image_state state;
+	worker workers[MAX_THREADS];
+	m68k_dasm_context ctx;
+	unsigned int threads = thread_count();
+	unsigned int i;
+	FILE* file = strcmp(filename, "-") == 0 ? stdout : fopen(filename, "w");
+	int result = 0;
+
+	/* This also builds the disassembler tables before the threads use them */
+	if(file == NULL || !m68k_dasm_init_context(&ctx, cpu_type))
+		goto done_file;
+
+	memset(&state, 0, sizeof(state));
+	state.image    = image;
+	state.loaded   = loaded;
+	state.size     = size;
+	state.cpu_type = cpu_type;
+	state.insns    = calloc(size / 2 + 1, sizeof(*state.insns));
+	state.kind     = calloc(size, 1);
+	state.labels   = calloc(size, 1);
+	state.table    = calloc(size, sizeof(*state.table));
+	state.names    = calloc(size, sizeof(*state.names));
+	state.words    = calloc(size, sizeof(*state.words));
+	state.stack    = malloc((size / 2 + 1) * sizeof(*state.stack));
+	if(!state.insns || !state.kind || !state.labels || !state.table || !state.names || !state.words || !state.stack)
+		goto done;
+
+	/* Decode every even address, in one even sized range per thread */
+	for(i = 0;i < threads;i++)
+	{
+		workers[i].state = &state;
+		workers[i].start = (unsigned int)((unsigned long long)size * i / threads) & ~1;
+		workers[i].end   = (unsigned int)((unsigned long long)size * (i + 1) / threads) & ~1;
+	}
+	workers[threads - 1].end = size;
+	run_workers(workers, threads, decode_range);
+
+	add_vectors(&state);
+	walk_all(&state);
+	add_forth_words(&state);
+
+	/* List the image in ranges that start on a line and item boundary, so
+	 * that the listing is the same whatever the number of threads.
+	 */
+	for(i = 0;i < threads;i++)
+	{
+		unsigned int start = (unsigned int)((unsigned long long)size * i / threads) & ~(DATA_LINE_BYTES - 1);
+
+		while(start < size && state.kind[start] == KIND_CONTINUED)
+			start++;
+		workers[i].start = start;
+		memset(&workers[i].output, 0, sizeof(workers[i].output));
+		if(i > 0)
+			workers[i - 1].end = start;
+	}
+	workers[threads - 1].end = size;
+	run_workers(workers, threads, list_range);
+
+	fprintf(file, "; %u entry points, %u instructions, %u jump tables, %u flows into data\n",
+		state.entries, state.instructions, state.tables, state.broken);
+	result = 1;
+	for(i = 0;i < threads;i++)
+	{
+		if(workers[i].output.failed)
+			result = 0;
+		else if(workers[i].output.length > 0)
+			fwrite(workers[i].output.text, 1, workers[i].output.length, file);
+		free(workers[i].output.text);
+	}
+	if(ferror(file))
+		result = 0;
+
+done:
+	if(state.names != NULL)
+		for(i = 0;i < size;i++)
+			free(state.names[i]);
+	if(state.words != NULL)
+		for(i = 0;i < size;i++)
+			free(state.words[i]);
+	free(state.insns);
+	free(state.kind);
+	free(state.labels);
+	free(state.table);
+	free(state.names);
+	free(state.words);
+	free(state.stack);
+done_file:
+	if(file != NULL && file != stdout)
+		fclose(file);
+	return result;
+}
@@ -0,0 +1,12 @@
+#ifndef DISASM__HEADER
+#define DISASM__HEADER
+
+/* Write an annotated listing of the size bytes at image to filename ("-" for
+ * stdout).  loaded[addr] is nonzero for the bytes the image really holds.
+ * Code is told from data by following the control flow from the exception
+ * vectors and the Forth dictionary, using all host cores.  Returns 0 if the
+ * listing could not be written.
+ */
+int disassemble_image(const char* filename, const unsigned char* image, const unsigned char* loaded, unsigned int size, unsigned int cpu_type);
+
+#endif /* DISASM__HEADER */
@@ -0,0 +1,303 @@
+/* Forth dictionary index and word profiler for the simulator.
+ *
+ * The dictionary is a list linked from the latest word back to the first.
+ * Walking it for every lookup, as word tracing does on every NEXT, makes
+ * tracing crawl, so the words are kept in an array sorted by header address
+ * and found with a binary search.  Each lookup compares here and last with
+ * the values the index was built from: when words were added only the new
+ * ones are walked, when just here moved the latest word is stretched to it,
+ * and anything else (a forget, a reloaded image) rebuilds the index.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "forth.h"
+
+/* Dictionary pointers of the Forth system */
+#define FORTH_HERE_ADDRESS 0x2002
+#define FORTH_LAST_ADDRESS 0x2004
+
+#define MAX_FORTH_WORDS    8192
+
+typedef struct
+{
+	unsigned int       start;       /* Header: name length, name, padding, link */
+	unsigned int       end;         /* Next header, or here for the latest word */
+	unsigned long long calls;       /* Times NEXT ran the word */
+	unsigned long long ip_cycles;   /* Cycles with the IP in the word */
+	unsigned long long run_cycles;  /* Cycles from NEXT running the word to the next NEXT */
+} word_entry;
+
+static const unsigned char* g_memory;
+static unsigned int         g_memory_size;
+static word_entry*          g_words;
+static unsigned int         g_word_count;
+static unsigned int         g_here;     /* here and last when the index was brought up to date */
+static unsigned int         g_last;
+static int                  g_indexed;
+static unsigned int         g_headers[MAX_FORTH_WORDS];
+
+static int                  g_profiling;
+static int                  g_ip_word = -1;    /* Word holding the IP at the last NEXT */
+static int                  g_run_word = -1;   /* Word the last NEXT ran */
+static unsigned long long   g_next_cycles;     /* Cycle count at the last NEXT */
+
+
+/* -------------------------------- Index --------------------------------- */
+
+static unsigned int read_word(unsigned int address)
+{
+	if(address + 1 >= g_memory_size)
+		return 0;
+	return (g_memory[address] << 8) | g_memory[address + 1];
+}
+
+/* Collect the headers from header back to (not including) stop, latest
+ * first.  Returns how many there are, or -1 if the list does not reach stop.
+ */
+static int collect_headers(unsigned int header, unsigned int stop)
+{
+	unsigned int previous = 0xffffffff;
+	int count;
+
+	for(count = 0; header != stop; count++)
+	{
+		/* The links must lead to ever lower addresses */
+		if(header == 0 || header >= previous || header >= g_memory_size || count == MAX_FORTH_WORDS)
+			return stop == 0 ? count : -1;
+		g_headers[count] = header;
+		previous = header;
+		header = read_word((header + 1 + (g_memory[header] & 0x1f) + 1) & ~1);
+	}
+	return count;
+}
+
+static int find_index(const word_entry* words, unsigned int count, unsigned int address)
+{
+	unsigned int low = 0;
+	unsigned int high = count;
+
+	while(low < high)
+	{
+		unsigned int mid = (low + high) / 2;
+
+		if(words[mid].start <= address)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	return (int)low - 1;
+}
+
+/* Index the whole dictionary again, keeping the profile of words that are
+ * still where they were.
+ */
+static void rebuild_index(unsigned int last, unsigned int here)
+{
+	int count = collect_headers(last, 0);
+	word_entry* words = calloc(count + 1, sizeof(*words));
+	int i;
+
+	if(words == NULL)
+	{
+		g_word_count = 0;
+		g_indexed = 0;
+		return;
+	}
+	for(i = 0; i < count; i++)
+	{
+		word_entry* word = &words[i];
+		int old;
+
+		word->start = g_headers[count - 1 - i];
+		word->end = i + 1 < count ? g_headers[count - 2 - i] : here;
+		old = find_index(g_words, g_word_count, word->start);
+		if(old >= 0 && g_words[old].start == word->start)
+		{
+			word->calls = g_words[old].calls;
+			word->ip_cycles = g_words[old].ip_cycles;
+			word->run_cycles = g_words[old].run_cycles;
+		}
+	}
+	free(g_words);
+	g_words = words;
+	g_word_count = count;
+	g_indexed = 1;
+}
+
+/* Add the words defined since the index was last brought up to date.
+ * Returns 0 if the dictionary changed some other way.
+ */
+static int extend_index(unsigned int last, unsigned int here)
+{
+	int count = collect_headers(last, g_last);
+	word_entry* words;
+	int i;
+
+	if(count <= 0 || g_word_count == 0)
+		return 0;
+	if((words = realloc(g_words, (g_word_count + count) * sizeof(*words))) == NULL)
+		return 0;
+	g_words = words;
+	g_words[g_word_count - 1].end = g_headers[count - 1];
+	for(i = 0; i < count; i++)
+	{
+		word_entry* word = &g_words[g_word_count + i];
+
+		memset(word, 0, sizeof(*word));
+		word->start = g_headers[count - 1 - i];
+		word->end = i + 1 < count ? g_headers[count - 2 - i] : here;
+	}
+	g_word_count += count;
+	return 1;
+}
+
+/* Bring the index up to date.  Returns 1 if the words moved to other
+ * positions in it.
+ */
+static int update_index(void)
+{
+	unsigned int here = read_word(FORTH_HERE_ADDRESS);
+	unsigned int last = read_word(FORTH_LAST_ADDRESS);
+	int moved = 0;
+
+	if(!g_indexed || last != g_last)
+	{
+		if(!g_indexed || !extend_index(last, here))
+		{
+			rebuild_index(last, here);
+			moved = 1;
+		}
+	}
+	else if(here != g_here && g_word_count != 0)
+		g_words[g_word_count - 1].end = here;
+	g_here = here;
+	g_last = last;
+	return moved;
+}
+
+/* The word holding address, or -1 */
+static int find_word(unsigned int address)
+{
+	int i = find_index(g_words, g_word_count, address);
+
+	return i >= 0 && address < g_words[i].end ? i : -1;
+}
+
+void forth_init(const unsigned char* memory, unsigned int size)
+{
+	g_memory = memory;
+	g_memory_size = size;
+	g_indexed = 0;
+}
+
+int forth_find_address(unsigned int address, unsigned int* start, unsigned int* end)
+{
+	int i;
+
+	update_index();
+	if((i = find_word(address)) < 0)
+		return 0;
+	*start = g_words[i].start;
+	*end = g_words[i].end;
+	return 1;
+}
+
+int forth_find_name(const char* name, unsigned int* start, unsigned int* end)
+{
+	unsigned int length = strlen(name);
+	unsigned int i;
+
+	update_index();
+	for(i = g_word_count; i-- > 0; )
+	{
+		unsigned int header = g_words[i].start;
+
+		if((g_memory[header] & 0x1f) == length && header + 1 + length <= g_memory_size &&
+		   memcmp(g_memory + header + 1, name, length) == 0)
+		{
+			*start = header;
+			*end = g_words[i].end;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+
+/* ------------------------------- Profiler ------------------------------- */
+
+void forth_profile_start(void)
+{
+	g_profiling = 1;
+	g_ip_word = -1;
+	g_run_word = -1;
+}
+
+void forth_profile_next(unsigned int a0, unsigned int a6, unsigned long long cycles)
+{
+	unsigned long long elapsed = cycles - g_next_cycles;
+
+	if(!g_profiling)
+		return;
+	if(update_index())
+		g_ip_word = g_run_word = -1;
+	if(g_ip_word >= 0)
+		g_words[g_ip_word].ip_cycles += elapsed;
+	if(g_run_word >= 0)
+		g_words[g_run_word].run_cycles += elapsed;
+	if((g_run_word = find_word(a0)) >= 0)
+		g_words[g_run_word].calls++;
+	g_ip_word = find_word(a6);
+	g_next_cycles = cycles;
+}
+
+static int compare_words(const void* a, const void* b)
+{
+	const word_entry* x = *(const word_entry* const*)a;
+	const word_entry* y = *(const word_entry* const*)b;
+
+	if(x->ip_cycles != y->ip_cycles)
+		return x->ip_cycles > y->ip_cycles ? -1 : 1;
+	if(x->run_cycles != y->run_cycles)
+		return x->run_cycles > y->run_cycles ? -1 : 1;
+	return x->start < y->start ? -1 : x->start > y->start;
+}
+
+int forth_profile_write(const char* filename)
+{
+	const word_entry** order;
+	FILE* file;
+	unsigned int count = 0;
+	unsigned int i;
+	int ok;
+
+	update_index();
+	if((order = malloc((g_word_count + 1) * sizeof(*order))) == NULL)
+		return 0;
+	for(i = 0; i < g_word_count; i++)
+		if(g_words[i].calls || g_words[i].ip_cycles || g_words[i].run_cycles)
+			order[count++] = &g_words[i];
+	qsort(order, count, sizeof(*order), compare_words);
+
+	if((file = fopen(filename, "w")) == NULL)
+	{
+		free(order);
+		return 0;
+	}
+	fprintf(file, "# calls: times NEXT ran the word\n"
+				  "# ip cycles: cycles with the IP in the word's body, with the primitives it runs\n"
+				  "# run cycles: cycles from NEXT running the word to the next NEXT\n"
+				  "#        calls       ip cycles      run cycles  header  word\n");
+	for(i = 0; i < count; i++)
+	{
+		const word_entry* word = order[i];
+
+		fprintf(file, "%14llu  %14llu  %14llu  %04x    %.*s\n", word->calls, word->ip_cycles, word->run_cycles,
+				word->start, g_memory[word->start] & 0x1f, (const char*)g_memory + word->start + 1);
+	}
+	ok = !ferror(file);
+	free(order);
+	return fclose(file) == 0 && ok;
+}
@@ -0,0 +1,31 @@
+#ifndef FORTH__HEADER
+#define FORTH__HEADER
+
+/* Index the Forth dictionary in the size bytes of RAM at memory.  The index
+ * follows the dictionary as words are added, and is rebuilt if it changes
+ * any other way.
+ */
+void forth_init(const unsigned char* memory, unsigned int size);
+
+/* Find the word whose header or body holds address.  Sets *start to its
+ * header and *end to the next header (or here), and returns 1, or returns
+ * 0 if no word holds address.
+ */
+int forth_find_address(unsigned int address, unsigned int* start, unsigned int* end);
+
+/* Find the latest word called name, as forth_find_address() */
+int forth_find_name(const char* name, unsigned int* start, unsigned int* end);
+
+/* Count words and cycles from now on.  Call forth_profile_next() every time
+ * the inner interpreter's NEXT runs, with A0 (the word it is about to run),
+ * A6 (the IP) and the cycle count.
+ */
+void forth_profile_start(void);
+void forth_profile_next(unsigned int a0, unsigned int a6, unsigned long long cycles);
+
+/* Write how often each word ran and the cycles spent in it.  Returns 0 if
+ * the report could not be written.
+ */
+int forth_profile_write(const char* filename);
+
+#endif /* FORTH__HEADER */
@@ -164,6 +164,14 @@
 #define M68K_INSTRUCTION_CALLBACK(pc) cpu_instr_callback(pc)
 
 
+/* If ON, CPU will call the call hook callback after every subroutine call
+ * (jsr, bsr), return (rts, rtr, rtd, rte) and exception.  When OFF, the
+ * opcode handlers are built without any trace of it.
+ */
+#define M68K_CALL_HOOK              OPT_SPECIFY_HANDLER
+#define M68K_CALL_HOOK_CALLBACK(T, PC, TARGET) cpu_call_callback(T, PC, TARGET)
+
+
 /* If ON, the CPU will emulate the 4-byte prefetch queue of a real 68000 */
 #define M68K_EMULATE_PREFETCH       OPT_ON
 
@@ -175,6 +183,84 @@
 #define M68K_EMULATE_ADDRESS_ERROR  OPT_ON
 
 
+/* If ON, most ALU instructions only record their operands and result, and the
+ * N, Z, V and C flags are computed when something actually reads them
+ * (conditional branches, SR/CCR reads, exception processing).
+ */
+#define M68K_LAZY_FLAGS             OPT_OFF
+
+/* If ON, m68kmake's output includes a separate copy of the opcode handlers
+ * for each of the 68000, 68010, 68020, 68030 and 68040 that are enabled
+ * above, compiled with the CPU type fixed.  This removes the CPU type checks
+ * from those handlers, but compiling m68kops.c takes several times longer.
+ */
+#define M68K_SPECIALIZE_HANDLERS    OPT_OFF
+
+/* If ON, opcodes are dispatched through a 128KB table of 16-bit handler
+ * indices and a small array of handler pointers, instead of a table with
+ * one pointer per opcode (512KB on 64-bit hosts).  This costs one more load
+ * per instruction but keeps much less of the dispatch data in the cache.
+ */
+#define M68K_COMPACT_DISPATCH       OPT_OFF
+
+/* If ON, the CPU counts how often each opcode handler runs, and
+ * m68k_write_handler_profile() saves the counts in a file that can be passed
+ * to m68kmake to lay out the hot handlers together in m68kops.c.
+ */
+#define M68K_PROFILE_HANDLERS       OPT_OFF
+
+/* If ON, the CPU counts how often each opcode runs and, per opcode handler,
+ * the cycles it used and how often a conditional branch was taken, see
+ * m68k_write_instruction_stats().  dbf loops are then always run one
+ * instruction at a time.  This slows every instruction down a little and
+ * takes about 550KB.
+ */
+#define M68K_INSTRUCTION_STATS      OPT_OFF
+
+/* If ON, the CPU counts the reads, writes and instruction fetches that go
+ * to each M68K_HEATMAP_LINE_SIZE bytes of the address space, and how many of
+ * these lines it accesses in each interval set with
+ * m68k_set_working_set_interval(), see m68k_write_memory_heatmap().  The
+ * counts take 2MB for each 16MB of address space accessed.  dbf loops are
+ * then always run one instruction at a time.
+ */
+#define M68K_MEMORY_HEATMAP         OPT_OFF
+
+/* If ON, the CPU measures in clock cycles how long each interrupt waits
+ * from m68k_set_irq() raising its level until it is taken, and how long each
+ * interrupt and exception runs until the rte that returns from it, see
+ * m68k_write_latency_histograms().  The histograms take about 150KB.
+ */
+#define M68K_INTERRUPT_LATENCY      OPT_OFF
+
+/* If ON, the CPU counts the instructions and cycles it runs, see
+ * m68k_get_perf_counters().  This costs one add per instruction.
+ */
+#define M68K_PERF_COUNTERS          OPT_ON
+
+/* If ON, the disassembler's opcode table and the validity bitmaps behind
+ * m68k_is_valid_instruction() come from m68kdasmtab.h, which the build
+ * writes with m68kdasm.c compiled as a program with M68K_DASM_GENERATOR.
+ * If OFF, they are built on the first call into the disassembler.
+ */
+#define M68K_DASM_PREBUILT_TABLES   OPT_ON
+
+/* If ON, the CPU can record each instruction it runs (PC, instruction words,
+ * changed registers, the first memory write and any exception) in a ring of
+ * M68K_TRACE_BUFFER_SIZE records, see m68k_trace_buffer_enable().  The
+ * instruction words are read with m68k_read_disassembler_16().  The size
+ * must be a power of 2.
+ */
+#define M68K_TRACE_BUFFER           OPT_ON
+#define M68K_TRACE_BUFFER_SIZE      4096
+
+/* If ON, the CPU can report the PC at a fixed interval of clock cycles, see
+ * m68k_set_pc_sample_period().  This costs one compare per instruction,
+ * instead of the function call M68K_INSTRUCTION_HOOK makes.
+ */
+#define M68K_SAMPLE_PC              OPT_ON
+
+
 /* Turn ON to enable logging of illegal instruction calls.
  * M68K_LOG_FILEHANDLE must be #defined to a stdio file stream.
  * Turn on M68K_LOG_1010_1111 to log all 1010 and 1111 calls.
@@ -0,0 +1,7191 @@
+/* Generated from m68kdasm.c with M68K_DASM_GENERATOR.  Do not edit. */
+
+#define DASM_TABLE_OPCODE_COUNT 306
+
+static const unsigned short g_instruction_index[0x10000] =
+{
+	211,211,211,211,211,211,211,211,305,305,305,305,305,305,305,305,
+	211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,
+	211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,
+	211,211,211,211,211,211,211,211,211,211,305,305,209,305,305,305,
+	212,212,212,212,212,212,212,212,305,305,305,305,305,305,305,305,
+	212,212,212,212,212,212,212,212,212,212,212,212,212,212,212,212,
+	212,212,212,212,212,212,212,212,212,212,212,212,212,212,212,212,
+	212,212,212,212,212,212,212,212,212,212,305,305,210,305,305,305,
+	213,213,213,213,213,213,213,213,305,305,305,305,305,305,305,305,
+	213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,
+	213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,
+	213,213,213,213,213,213,213,213,213,213,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	83,83,83,83,83,83,83,83,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,83,83,83,83,83,83,83,83,
+	83,83,83,83,83,83,83,83,83,83,83,83,305,305,305,305,
+	73,73,73,73,73,73,73,73,176,176,176,176,176,176,176,176,
+	73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+	73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+	73,73,73,73,73,73,73,73,73,73,73,73,73,305,305,305,
+	52,52,52,52,52,52,52,52,177,177,177,177,177,177,177,177,
+	52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+	52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+	52,52,52,52,52,52,52,52,52,52,305,305,305,305,305,305,
+	54,54,54,54,54,54,54,54,178,178,178,178,178,178,178,178,
+	54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,
+	54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,
+	54,54,54,54,54,54,54,54,54,54,305,305,305,305,305,305,
+	68,68,68,68,68,68,68,68,179,179,179,179,179,179,179,179,
+	68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+	68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+	68,68,68,68,68,68,68,68,68,68,305,305,305,305,305,305,
+	32,32,32,32,32,32,32,32,305,305,305,305,305,305,305,305,
+	32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+	32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+	32,32,32,32,32,32,32,32,32,32,305,305,30,305,305,305,
+	33,33,33,33,33,33,33,33,305,305,305,305,305,305,305,305,
+	33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+	33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+	33,33,33,33,33,33,33,33,33,33,305,305,31,305,305,305,
+	34,34,34,34,34,34,34,34,305,305,305,305,305,305,305,305,
+	34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+	34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+	34,34,34,34,34,34,34,34,34,34,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	84,84,84,84,84,84,84,84,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,84,84,84,84,84,84,84,84,
+	84,84,84,84,84,84,84,84,84,84,84,84,305,305,305,305,
+	73,73,73,73,73,73,73,73,176,176,176,176,176,176,176,176,
+	73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+	73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+	73,73,73,73,73,73,73,73,73,73,73,73,73,305,305,305,
+	52,52,52,52,52,52,52,52,177,177,177,177,177,177,177,177,
+	52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+	52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+	52,52,52,52,52,52,52,52,52,52,305,305,305,305,305,305,
+	54,54,54,54,54,54,54,54,178,178,178,178,178,178,178,178,
+	54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,
+	54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,
+	54,54,54,54,54,54,54,54,54,54,305,305,305,305,305,305,
+	68,68,68,68,68,68,68,68,179,179,179,179,179,179,179,179,
+	68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+	68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+	68,68,68,68,68,68,68,68,68,68,305,305,305,305,305,305,
+	264,264,264,264,264,264,264,264,305,305,305,305,305,305,305,305,
+	264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,
+	264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,
+	264,264,264,264,264,264,264,264,264,264,305,305,305,305,305,305,
+	265,265,265,265,265,265,265,265,305,305,305,305,305,305,305,305,
+	265,265,265,265,265,265,265,265,265,265,265,265,265,265,265,265,
+	265,265,265,265,265,265,265,265,265,265,265,265,265,265,265,265,
+	265,265,265,265,265,265,265,265,265,265,305,305,305,305,305,305,
+	266,266,266,266,266,266,266,266,305,305,305,305,305,305,305,305,
+	266,266,266,266,266,266,266,266,266,266,266,266,266,266,266,266,
+	266,266,266,266,266,266,266,266,266,266,266,266,266,266,266,266,
+	266,266,266,266,266,266,266,266,266,266,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	85,85,85,85,85,85,85,85,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,85,85,85,85,85,85,85,85,
+	85,85,85,85,85,85,85,85,85,85,85,85,305,305,305,305,
+	73,73,73,73,73,73,73,73,176,176,176,176,176,176,176,176,
+	73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+	73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+	73,73,73,73,73,73,73,73,73,73,73,73,73,305,305,305,
+	52,52,52,52,52,52,52,52,177,177,177,177,177,177,177,177,
+	52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+	52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+	52,52,52,52,52,52,52,52,52,52,305,305,305,305,305,305,
+	54,54,54,54,54,54,54,54,178,178,178,178,178,178,178,178,
+	54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,
+	54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,
+	54,54,54,54,54,54,54,54,54,54,305,305,305,305,305,305,
+	68,68,68,68,68,68,68,68,179,179,179,179,179,179,179,179,
+	68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+	68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+	68,68,68,68,68,68,68,68,68,68,305,305,305,305,305,305,
+	12,12,12,12,12,12,12,12,305,305,305,305,305,305,305,305,
+	12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+	12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+	12,12,12,12,12,12,12,12,12,12,305,305,305,305,305,305,
+	13,13,13,13,13,13,13,13,305,305,305,305,305,305,305,305,
+	13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+	13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+	13,13,13,13,13,13,13,13,13,13,305,305,305,305,305,305,
+	14,14,14,14,14,14,14,14,305,305,305,305,305,305,305,305,
+	14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+	14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+	14,14,14,14,14,14,14,14,14,14,305,305,305,305,305,305,
+	249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+	75,75,75,75,75,75,75,75,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,75,75,75,75,75,75,75,75,
+	75,75,75,75,75,75,75,75,75,75,75,75,305,305,305,305,
+	73,73,73,73,73,73,73,73,176,176,176,176,176,176,176,176,
+	73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+	73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+	73,73,73,73,73,73,73,73,73,73,73,73,73,305,305,305,
+	52,52,52,52,52,52,52,52,177,177,177,177,177,177,177,177,
+	52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+	52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+	52,52,52,52,52,52,52,52,52,52,305,305,305,305,305,305,
+	54,54,54,54,54,54,54,54,178,178,178,178,178,178,178,178,
+	54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,
+	54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,
+	54,54,54,54,54,54,54,54,54,54,305,305,305,305,305,305,
+	68,68,68,68,68,68,68,68,179,179,179,179,179,179,179,179,
+	68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+	68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+	68,68,68,68,68,68,68,68,68,68,305,305,305,305,305,305,
+	74,74,74,74,74,74,74,74,305,305,305,305,305,305,305,305,
+	74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,
+	74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,
+	74,74,74,74,74,74,74,74,74,74,74,74,305,305,305,305,
+	53,53,53,53,53,53,53,53,305,305,305,305,305,305,305,305,
+	53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,
+	53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,
+	53,53,53,53,53,53,53,53,53,53,305,305,305,305,305,305,
+	55,55,55,55,55,55,55,55,305,305,305,305,305,305,305,305,
+	55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,
+	55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,
+	55,55,55,55,55,55,55,55,55,55,305,305,305,305,305,305,
+	69,69,69,69,69,69,69,69,305,305,305,305,305,305,305,305,
+	69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+	69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+	69,69,69,69,69,69,69,69,69,69,305,305,305,305,305,305,
+	73,73,73,73,73,73,73,73,176,176,176,176,176,176,176,176,
+	73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+	73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+	73,73,73,73,73,73,73,73,73,73,73,73,73,305,305,305,
+	52,52,52,52,52,52,52,52,177,177,177,177,177,177,177,177,
+	52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+	52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+	52,52,52,52,52,52,52,52,52,52,305,305,305,305,305,305,
+	54,54,54,54,54,54,54,54,178,178,178,178,178,178,178,178,
+	54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,
+	54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,
+	54,54,54,54,54,54,54,54,54,54,305,305,305,305,305,305,
+	68,68,68,68,68,68,68,68,179,179,179,179,179,179,179,179,
+	68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+	68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+	68,68,68,68,68,68,68,68,68,68,305,305,305,305,305,305,
+	128,128,128,128,128,128,128,128,305,305,305,305,305,305,305,305,
+	128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+	128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+	128,128,128,128,128,128,128,128,128,128,305,305,126,305,305,305,
+	129,129,129,129,129,129,129,129,305,305,305,305,305,305,305,305,
+	129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,
+	129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,
+	129,129,129,129,129,129,129,129,129,129,305,305,127,305,305,305,
+	130,130,130,130,130,130,130,130,305,305,305,305,305,305,305,305,
+	130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,
+	130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,
+	130,130,130,130,130,130,130,130,130,130,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,305,305,305,305,305,305,
+	73,73,73,73,73,73,73,73,176,176,176,176,176,176,176,176,
+	73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+	73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+	73,73,73,73,73,73,73,73,73,73,73,73,73,305,305,305,
+	52,52,52,52,52,52,52,52,177,177,177,177,177,177,177,177,
+	52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+	52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+	52,52,52,52,52,52,52,52,52,52,305,305,305,305,305,305,
+	54,54,54,54,54,54,54,54,178,178,178,178,178,178,178,178,
+	54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,
+	54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,
+	54,54,54,54,54,54,54,54,54,54,305,305,305,305,305,305,
+	68,68,68,68,68,68,68,68,179,179,179,179,179,179,179,179,
+	68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+	68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+	68,68,68,68,68,68,68,68,68,68,305,305,305,305,305,305,
+	95,95,95,95,95,95,95,95,305,305,305,305,305,305,305,305,
+	95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,
+	95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,
+	95,95,95,95,95,95,95,95,95,95,96,97,305,305,305,305,
+	98,98,98,98,98,98,98,98,305,305,305,305,305,305,305,305,
+	98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+	98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+	98,98,98,98,98,98,98,98,98,98,99,100,305,305,305,305,
+	101,101,101,101,101,101,101,101,305,305,305,305,305,305,305,305,
+	101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,
+	101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,
+	101,101,101,101,101,101,101,101,101,101,102,103,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,
+	77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,
+	77,77,77,77,77,77,77,77,77,77,305,305,79,305,305,305,
+	73,73,73,73,73,73,73,73,176,176,176,176,176,176,176,176,
+	73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+	73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+	73,73,73,73,73,73,73,73,73,73,73,73,73,305,305,305,
+	52,52,52,52,52,52,52,52,177,177,177,177,177,177,177,177,
+	52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+	52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+	52,52,52,52,52,52,52,52,52,52,305,305,305,305,305,305,
+	54,54,54,54,54,54,54,54,178,178,178,178,178,178,178,178,
+	54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,
+	54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,
+	54,54,54,54,54,54,54,54,54,54,305,305,305,305,305,305,
+	68,68,68,68,68,68,68,68,179,179,179,179,179,179,179,179,
+	68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+	68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+	68,68,68,68,68,68,68,68,68,68,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,
+	180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,
+	180,180,180,180,180,180,180,180,180,180,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,
+	181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,
+	181,181,181,181,181,181,181,181,181,181,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,
+	182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,
+	182,182,182,182,182,182,182,182,182,182,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+	78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+	78,78,78,78,78,78,78,78,78,78,305,305,80,305,305,305,
+	73,73,73,73,73,73,73,73,176,176,176,176,176,176,176,176,
+	73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+	73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+	73,73,73,73,73,73,73,73,73,73,73,73,73,305,305,305,
+	52,52,52,52,52,52,52,52,177,177,177,177,177,177,177,177,
+	52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+	52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+	52,52,52,52,52,52,52,52,52,52,305,305,305,305,305,305,
+	54,54,54,54,54,54,54,54,178,178,178,178,178,178,178,178,
+	54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,
+	54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,
+	54,54,54,54,54,54,54,54,54,54,305,305,305,305,305,305,
+	68,68,68,68,68,68,68,68,179,179,179,179,179,179,179,179,
+	68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+	68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+	68,68,68,68,68,68,68,68,68,68,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	158,158,158,158,158,158,158,158,305,305,305,305,305,305,305,305,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+	158,158,158,158,158,158,158,158,158,158,158,158,158,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,
+	162,162,162,162,162,162,162,162,162,162,162,162,162,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+	160,160,160,160,160,160,160,160,160,160,160,160,160,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+	161,161,161,161,161,161,161,161,161,161,161,161,161,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+	159,159,159,159,159,159,159,159,159,159,159,159,159,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	196,196,196,196,196,196,196,196,305,305,305,305,305,305,305,305,
+	196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,
+	196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,
+	196,196,196,196,196,196,196,196,196,196,305,305,305,305,305,305,
+	197,197,197,197,197,197,197,197,305,305,305,305,305,305,305,305,
+	197,197,197,197,197,197,197,197,197,197,197,197,197,197,197,197,
+	197,197,197,197,197,197,197,197,197,197,197,197,197,197,197,197,
+	197,197,197,197,197,197,197,197,197,197,305,305,305,305,305,305,
+	198,198,198,198,198,198,198,198,305,305,305,305,305,305,305,305,
+	198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,
+	198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,
+	198,198,198,198,198,198,198,198,198,198,305,305,305,305,305,305,
+	166,166,166,166,166,166,166,166,305,305,305,305,305,305,305,305,
+	166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,
+	166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,
+	166,166,166,166,166,166,166,166,166,166,305,305,305,305,305,305,
+	82,82,82,82,82,82,82,82,305,305,305,305,305,305,305,305,
+	82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+	82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+	82,82,82,82,82,82,82,82,82,82,82,82,82,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	81,81,81,81,81,81,81,81,305,305,305,305,305,305,305,305,
+	81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,
+	81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,
+	81,81,81,81,81,81,81,81,81,81,81,81,81,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	141,141,141,141,141,141,141,141,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,141,141,141,141,141,141,141,141,
+	141,141,141,141,141,141,141,141,141,141,141,141,305,305,305,305,
+	87,87,87,87,87,87,87,87,305,305,305,305,305,305,305,305,
+	87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+	87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+	87,87,87,87,87,87,87,87,87,87,305,305,305,305,305,305,
+	88,88,88,88,88,88,88,88,305,305,305,305,305,305,305,305,
+	88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+	88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+	88,88,88,88,88,88,88,88,88,88,305,305,305,305,305,305,
+	89,89,89,89,89,89,89,89,305,305,305,305,305,305,305,305,
+	89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
+	89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
+	89,89,89,89,89,89,89,89,89,89,305,305,305,305,305,305,
+	164,164,164,164,164,164,164,164,305,305,305,305,305,305,305,305,
+	164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,
+	164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,
+	164,164,164,164,164,164,164,164,164,164,305,305,305,305,305,305,
+	82,82,82,82,82,82,82,82,305,305,305,305,305,305,305,305,
+	82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+	82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+	82,82,82,82,82,82,82,82,82,82,82,82,82,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	81,81,81,81,81,81,81,81,305,305,305,305,305,305,305,305,
+	81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,
+	81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,
+	81,81,81,81,81,81,81,81,81,81,81,81,81,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	141,141,141,141,141,141,141,141,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,141,141,141,141,141,141,141,141,
+	141,141,141,141,141,141,141,141,141,141,141,141,305,305,305,305,
+	193,193,193,193,193,193,193,193,305,305,305,305,305,305,305,305,
+	193,193,193,193,193,193,193,193,193,193,193,193,193,193,193,193,
+	193,193,193,193,193,193,193,193,193,193,193,193,193,193,193,193,
+	193,193,193,193,193,193,193,193,193,193,305,305,305,305,305,305,
+	194,194,194,194,194,194,194,194,305,305,305,305,305,305,305,305,
+	194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,
+	194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,
+	194,194,194,194,194,194,194,194,194,194,305,305,305,305,305,305,
+	195,195,195,195,195,195,195,195,305,305,305,305,305,305,305,305,
+	195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,
+	195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,
+	195,195,195,195,195,195,195,195,195,195,305,305,305,305,305,305,
+	163,163,163,163,163,163,163,163,305,305,305,305,305,305,305,305,
+	163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,
+	163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,
+	163,163,163,163,163,163,163,163,163,163,163,163,163,305,305,305,
+	82,82,82,82,82,82,82,82,305,305,305,305,305,305,305,305,
+	82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+	82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+	82,82,82,82,82,82,82,82,82,82,82,82,82,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	81,81,81,81,81,81,81,81,305,305,305,305,305,305,305,305,
+	81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,
+	81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,
+	81,81,81,81,81,81,81,81,81,81,81,81,81,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	141,141,141,141,141,141,141,141,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,141,141,141,141,141,141,141,141,
+	141,141,141,141,141,141,141,141,141,141,141,141,305,305,305,305,
+	200,200,200,200,200,200,200,200,305,305,305,305,305,305,305,305,
+	200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,
+	200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,
+	200,200,200,200,200,200,200,200,200,200,305,305,305,305,305,305,
+	201,201,201,201,201,201,201,201,305,305,305,305,305,305,305,305,
+	201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,
+	201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,
+	201,201,201,201,201,201,201,201,201,201,305,305,305,305,305,305,
+	202,202,202,202,202,202,202,202,305,305,305,305,305,305,305,305,
+	202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,
+	202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,
+	202,202,202,202,202,202,202,202,202,202,305,305,305,305,305,305,
+	165,165,165,165,165,165,165,165,305,305,305,305,305,305,305,305,
+	165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,
+	165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,
+	165,165,165,165,165,165,165,165,165,165,165,165,165,305,305,305,
+	82,82,82,82,82,82,82,82,305,305,305,305,305,305,305,305,
+	82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+	82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+	82,82,82,82,82,82,82,82,82,82,82,82,82,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	81,81,81,81,81,81,81,81,305,305,305,305,305,305,305,305,
+	81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,
+	81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,
+	81,81,81,81,81,81,81,81,81,81,81,81,81,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	141,141,141,141,141,141,141,141,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,141,141,141,141,141,141,141,141,
+	141,141,141,141,141,141,141,141,141,141,141,141,305,305,305,305,
+	192,192,192,192,192,192,192,192,143,143,143,143,143,143,143,143,
+	192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,
+	192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,
+	192,192,192,192,192,192,192,192,192,192,305,305,305,305,305,305,
+	276,276,276,276,276,276,276,276,64,64,64,64,64,64,64,64,
+	216,216,216,216,216,216,216,216,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,216,216,216,216,216,216,216,216,
+	216,216,216,216,216,216,216,216,216,216,216,216,305,305,305,305,
+	135,135,135,135,135,135,135,135,305,305,305,305,305,305,305,305,
+	172,172,172,172,172,172,172,172,305,305,305,305,305,305,305,305,
+	170,170,170,170,170,170,170,170,172,172,172,172,172,172,172,172,
+	172,172,172,172,172,172,172,172,172,172,305,305,305,305,305,305,
+	136,136,136,136,136,136,136,136,305,305,305,305,305,305,305,305,
+	173,173,173,173,173,173,173,173,305,305,305,305,305,305,305,305,
+	171,171,171,171,171,171,171,171,173,173,173,173,173,173,173,173,
+	173,173,173,173,173,173,173,173,173,173,305,305,305,305,305,305,
+	82,82,82,82,82,82,82,82,305,305,305,305,305,305,305,305,
+	82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+	82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+	82,82,82,82,82,82,82,82,82,82,82,82,82,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	81,81,81,81,81,81,81,81,305,305,305,305,305,305,305,305,
+	81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,
+	81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,
+	81,81,81,81,81,81,81,81,81,81,81,81,81,305,305,305,
+	134,134,134,134,134,134,134,134,305,305,305,305,305,305,305,305,
+	141,141,141,141,141,141,141,141,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,141,141,141,141,141,141,141,141,
+	141,141,141,141,141,141,141,141,141,141,141,141,305,305,305,305,
+	283,283,283,283,283,283,283,283,305,305,305,305,305,305,305,305,
+	283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
+	283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
+	283,283,283,283,283,283,283,283,283,283,284,285,286,305,305,305,
+	287,287,287,287,287,287,287,287,288,288,288,288,288,288,288,288,
+	287,287,287,287,287,287,287,287,287,287,287,287,287,287,287,287,
+	287,287,287,287,287,287,287,287,287,287,287,287,287,287,287,287,
+	287,287,287,287,287,287,287,287,287,287,289,290,291,305,305,305,
+	292,292,292,292,292,292,292,292,293,293,293,293,293,293,293,293,
+	292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
+	292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,292,
+	292,292,292,292,292,292,292,292,292,292,294,295,296,305,305,305,
+	277,277,277,277,277,277,277,277,305,305,305,305,305,305,305,305,
+	277,277,277,277,277,277,277,277,277,277,277,277,277,277,277,277,
+	277,277,277,277,277,277,277,277,277,277,277,277,277,277,277,277,
+	277,277,277,277,277,277,277,277,277,277,305,305,138,305,305,305,
+	82,82,82,82,82,82,82,82,305,305,305,305,305,305,305,305,
+	82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+	82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+	82,82,82,82,82,82,82,82,82,82,82,82,82,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	81,81,81,81,81,81,81,81,305,305,305,305,305,305,305,305,
+	81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,
+	81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,
+	81,81,81,81,81,81,81,81,81,81,81,81,81,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	141,141,141,141,141,141,141,141,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,141,141,141,141,141,141,141,141,
+	141,141,141,141,141,141,141,141,141,141,141,141,305,305,305,305,
+	191,191,191,191,191,191,191,191,305,305,305,305,305,305,305,305,
+	191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+	191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+	191,191,191,191,191,191,191,191,191,191,191,191,191,305,305,305,
+	122,122,122,122,122,122,122,122,305,305,305,305,305,305,305,305,
+	122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
+	122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
+	122,122,122,122,122,122,122,122,122,122,122,122,122,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,
+	305,305,305,305,305,305,305,305,174,174,174,174,174,174,174,174,
+	174,174,174,174,174,174,174,174,174,174,174,174,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,
+	305,305,305,305,305,305,305,305,175,175,175,175,175,175,175,175,
+	175,175,175,175,175,175,175,175,175,175,175,175,305,305,305,305,
+	82,82,82,82,82,82,82,82,305,305,305,305,305,305,305,305,
+	82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+	82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+	82,82,82,82,82,82,82,82,82,82,82,82,82,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	81,81,81,81,81,81,81,81,305,305,305,305,305,305,305,305,
+	81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,
+	81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,
+	81,81,81,81,81,81,81,81,81,81,81,81,81,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	141,141,141,141,141,141,141,141,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,141,141,141,141,141,141,141,141,
+	141,141,141,141,141,141,141,141,141,141,141,141,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,
+	142,142,142,142,142,142,142,142,297,297,297,297,297,297,297,297,
+	167,167,167,167,167,167,167,167,168,168,168,168,168,168,168,168,
+	218,199,255,248,247,251,282,250,305,305,169,169,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	140,140,140,140,140,140,140,140,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,140,140,140,140,140,140,140,140,
+	140,140,140,140,140,140,140,140,140,140,140,140,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	139,139,139,139,139,139,139,139,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,139,139,139,139,139,139,139,139,
+	139,139,139,139,139,139,139,139,139,139,139,139,305,305,305,305,
+	82,82,82,82,82,82,82,82,305,305,305,305,305,305,305,305,
+	82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+	82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+	82,82,82,82,82,82,82,82,82,82,82,82,82,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	81,81,81,81,81,81,81,81,305,305,305,305,305,305,305,305,
+	81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,
+	81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,
+	81,81,81,81,81,81,81,81,81,81,81,81,81,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	141,141,141,141,141,141,141,141,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,141,141,141,141,141,141,141,141,
+	141,141,141,141,141,141,141,141,141,141,141,141,305,305,305,305,
+	15,15,15,15,15,15,15,15,305,305,305,305,305,305,305,305,
+	15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,
+	15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,
+	15,15,15,15,15,15,15,15,15,15,305,305,305,305,305,305,
+	16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+	16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+	16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+	16,16,16,16,16,16,16,16,16,16,305,305,305,305,305,305,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,305,305,305,305,305,305,
+	254,254,254,254,254,254,254,254,118,118,118,118,118,118,118,118,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,280,281,279,305,305,305,
+	267,267,267,267,267,267,267,267,305,305,305,305,305,305,305,305,
+	267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,
+	267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,
+	267,267,267,267,267,267,267,267,267,267,305,305,305,305,305,305,
+	268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,
+	268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,
+	268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,
+	268,268,268,268,268,268,268,268,268,268,305,305,305,305,305,305,
+	269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,
+	269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,
+	269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,
+	269,269,269,269,269,269,269,269,269,269,305,305,305,305,305,305,
+	254,254,254,254,254,254,254,254,119,119,119,119,119,119,119,119,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,280,281,279,305,305,305,
+	15,15,15,15,15,15,15,15,305,305,305,305,305,305,305,305,
+	15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,
+	15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,
+	15,15,15,15,15,15,15,15,15,15,305,305,305,305,305,305,
+	16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+	16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+	16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+	16,16,16,16,16,16,16,16,16,16,305,305,305,305,305,305,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,305,305,305,305,305,305,
+	254,254,254,254,254,254,254,254,118,118,118,118,118,118,118,118,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,280,281,279,305,305,305,
+	267,267,267,267,267,267,267,267,305,305,305,305,305,305,305,305,
+	267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,
+	267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,
+	267,267,267,267,267,267,267,267,267,267,305,305,305,305,305,305,
+	268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,
+	268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,
+	268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,
+	268,268,268,268,268,268,268,268,268,268,305,305,305,305,305,305,
+	269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,
+	269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,
+	269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,
+	269,269,269,269,269,269,269,269,269,269,305,305,305,305,305,305,
+	254,254,254,254,254,254,254,254,118,118,118,118,118,118,118,118,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,280,281,279,305,305,305,
+	15,15,15,15,15,15,15,15,305,305,305,305,305,305,305,305,
+	15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,
+	15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,
+	15,15,15,15,15,15,15,15,15,15,305,305,305,305,305,305,
+	16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+	16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+	16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+	16,16,16,16,16,16,16,16,16,16,305,305,305,305,305,305,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,305,305,305,305,305,305,
+	254,254,254,254,254,254,254,254,118,118,118,118,118,118,118,118,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,280,281,279,305,305,305,
+	267,267,267,267,267,267,267,267,305,305,305,305,305,305,305,305,
+	267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,
+	267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,
+	267,267,267,267,267,267,267,267,267,267,305,305,305,305,305,305,
+	268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,
+	268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,
+	268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,
+	268,268,268,268,268,268,268,268,268,268,305,305,305,305,305,305,
+	269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,
+	269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,
+	269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,
+	269,269,269,269,269,269,269,269,269,269,305,305,305,305,305,305,
+	254,254,254,254,254,254,254,254,118,118,118,118,118,118,118,118,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,280,281,279,305,305,305,
+	15,15,15,15,15,15,15,15,305,305,305,305,305,305,305,305,
+	15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,
+	15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,
+	15,15,15,15,15,15,15,15,15,15,305,305,305,305,305,305,
+	16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+	16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+	16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+	16,16,16,16,16,16,16,16,16,16,305,305,305,305,305,305,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,305,305,305,305,305,305,
+	254,254,254,254,254,254,254,254,118,118,118,118,118,118,118,118,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,280,281,279,305,305,305,
+	267,267,267,267,267,267,267,267,305,305,305,305,305,305,305,305,
+	267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,
+	267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,
+	267,267,267,267,267,267,267,267,267,267,305,305,305,305,305,305,
+	268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,
+	268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,
+	268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,
+	268,268,268,268,268,268,268,268,268,268,305,305,305,305,305,305,
+	269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,
+	269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,
+	269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,
+	269,269,269,269,269,269,269,269,269,269,305,305,305,305,305,305,
+	254,254,254,254,254,254,254,254,118,118,118,118,118,118,118,118,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,280,281,279,305,305,305,
+	15,15,15,15,15,15,15,15,305,305,305,305,305,305,305,305,
+	15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,
+	15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,
+	15,15,15,15,15,15,15,15,15,15,305,305,305,305,305,305,
+	16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+	16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+	16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+	16,16,16,16,16,16,16,16,16,16,305,305,305,305,305,305,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,305,305,305,305,305,305,
+	254,254,254,254,254,254,254,254,118,118,118,118,118,118,118,118,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,280,281,279,305,305,305,
+	267,267,267,267,267,267,267,267,305,305,305,305,305,305,305,305,
+	267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,
+	267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,
+	267,267,267,267,267,267,267,267,267,267,305,305,305,305,305,305,
+	268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,
+	268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,
+	268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,
+	268,268,268,268,268,268,268,268,268,268,305,305,305,305,305,305,
+	269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,
+	269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,
+	269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,
+	269,269,269,269,269,269,269,269,269,269,305,305,305,305,305,305,
+	254,254,254,254,254,254,254,254,118,118,118,118,118,118,118,118,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,280,281,279,305,305,305,
+	15,15,15,15,15,15,15,15,305,305,305,305,305,305,305,305,
+	15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,
+	15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,
+	15,15,15,15,15,15,15,15,15,15,305,305,305,305,305,305,
+	16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+	16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+	16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+	16,16,16,16,16,16,16,16,16,16,305,305,305,305,305,305,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,305,305,305,305,305,305,
+	254,254,254,254,254,254,254,254,118,118,118,118,118,118,118,118,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,280,281,279,305,305,305,
+	267,267,267,267,267,267,267,267,305,305,305,305,305,305,305,305,
+	267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,
+	267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,
+	267,267,267,267,267,267,267,267,267,267,305,305,305,305,305,305,
+	268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,
+	268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,
+	268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,
+	268,268,268,268,268,268,268,268,268,268,305,305,305,305,305,305,
+	269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,
+	269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,
+	269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,
+	269,269,269,269,269,269,269,269,269,269,305,305,305,305,305,305,
+	254,254,254,254,254,254,254,254,118,118,118,118,118,118,118,118,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,280,281,279,305,305,305,
+	15,15,15,15,15,15,15,15,305,305,305,305,305,305,305,305,
+	15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,
+	15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,
+	15,15,15,15,15,15,15,15,15,15,305,305,305,305,305,305,
+	16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+	16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+	16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+	16,16,16,16,16,16,16,16,16,16,305,305,305,305,305,305,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,305,305,305,305,305,305,
+	254,254,254,254,254,254,254,254,118,118,118,118,118,118,118,118,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,280,281,279,305,305,305,
+	267,267,267,267,267,267,267,267,305,305,305,305,305,305,305,305,
+	267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,
+	267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,
+	267,267,267,267,267,267,267,267,267,267,305,305,305,305,305,305,
+	268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,
+	268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,
+	268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,
+	268,268,268,268,268,268,268,268,268,268,305,305,305,305,305,305,
+	269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,
+	269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,
+	269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,
+	269,269,269,269,269,269,269,269,269,269,305,305,305,305,305,305,
+	254,254,254,254,254,254,254,254,118,118,118,118,118,118,118,118,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,280,281,279,305,305,305,
+	15,15,15,15,15,15,15,15,305,305,305,305,305,305,305,305,
+	15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,
+	15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,
+	15,15,15,15,15,15,15,15,15,15,305,305,305,305,305,305,
+	16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+	16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+	16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+	16,16,16,16,16,16,16,16,16,16,305,305,305,305,305,305,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,305,305,305,305,305,305,
+	254,254,254,254,254,254,254,254,118,118,118,118,118,118,118,118,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,280,281,279,305,305,305,
+	267,267,267,267,267,267,267,267,305,305,305,305,305,305,305,305,
+	267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,
+	267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,267,
+	267,267,267,267,267,267,267,267,267,267,305,305,305,305,305,305,
+	268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,
+	268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,
+	268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,268,
+	268,268,268,268,268,268,268,268,268,268,305,305,305,305,305,305,
+	269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,
+	269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,
+	269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,269,
+	269,269,269,269,269,269,269,269,269,269,305,305,305,305,305,305,
+	254,254,254,254,254,254,254,254,118,118,118,118,118,118,118,118,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+	254,254,254,254,254,254,254,254,254,254,280,281,279,305,305,305,
+	66,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+	65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+	65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+	65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+	65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+	65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+	65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+	65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+	65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+	65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+	65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+	65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+	65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+	65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+	65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+	65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,67,
+	71,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+	70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+	70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+	70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+	70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+	70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+	70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+	70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+	70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+	70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+	70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+	70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+	70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+	70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+	70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+	70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,72,
+	50,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,51,
+	50,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,51,
+	50,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,51,
+	50,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,51,
+	50,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,51,
+	50,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,51,
+	50,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,51,
+	50,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,51,
+	50,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,51,
+	50,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,51,
+	50,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,51,
+	50,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,51,
+	50,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,51,
+	50,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+	49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,51,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	203,203,203,203,203,203,203,203,305,305,305,305,305,305,305,305,
+	203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,
+	203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,
+	203,203,203,203,203,203,203,203,203,203,203,203,203,305,305,305,
+	204,204,204,204,204,204,204,204,305,305,305,305,305,305,305,305,
+	204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,
+	204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,
+	204,204,204,204,204,204,204,204,204,204,204,204,204,305,305,305,
+	205,205,205,205,205,205,205,205,305,305,305,305,305,305,305,305,
+	205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,
+	205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,
+	205,205,205,205,205,205,205,205,205,205,205,205,205,305,305,305,
+	121,121,121,121,121,121,121,121,305,305,305,305,305,305,305,305,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,305,305,305,
+	252,252,252,252,252,252,252,252,253,253,253,253,253,253,253,253,
+	206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,
+	206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,
+	206,206,206,206,206,206,206,206,206,206,305,305,305,305,305,305,
+	214,214,214,214,214,214,214,214,215,215,215,215,215,215,215,215,
+	207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,
+	207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,
+	207,207,207,207,207,207,207,207,207,207,305,305,305,305,305,305,
+	298,298,298,298,298,298,298,298,299,299,299,299,299,299,299,299,
+	208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,
+	208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,
+	208,208,208,208,208,208,208,208,208,208,305,305,305,305,305,305,
+	120,120,120,120,120,120,120,120,305,305,305,305,305,305,305,305,
+	120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,
+	120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,
+	120,120,120,120,120,120,120,120,120,120,120,120,120,305,305,305,
+	203,203,203,203,203,203,203,203,305,305,305,305,305,305,305,305,
+	203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,
+	203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,
+	203,203,203,203,203,203,203,203,203,203,203,203,203,305,305,305,
+	204,204,204,204,204,204,204,204,305,305,305,305,305,305,305,305,
+	204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,
+	204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,
+	204,204,204,204,204,204,204,204,204,204,204,204,204,305,305,305,
+	205,205,205,205,205,205,205,205,305,305,305,305,305,305,305,305,
+	205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,
+	205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,
+	205,205,205,205,205,205,205,205,205,205,205,205,205,305,305,305,
+	121,121,121,121,121,121,121,121,305,305,305,305,305,305,305,305,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,305,305,305,
+	252,252,252,252,252,252,252,252,253,253,253,253,253,253,253,253,
+	206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,
+	206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,
+	206,206,206,206,206,206,206,206,206,206,305,305,305,305,305,305,
+	214,214,214,214,214,214,214,214,215,215,215,215,215,215,215,215,
+	207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,
+	207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,
+	207,207,207,207,207,207,207,207,207,207,305,305,305,305,305,305,
+	298,298,298,298,298,298,298,298,299,299,299,299,299,299,299,299,
+	208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,
+	208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,
+	208,208,208,208,208,208,208,208,208,208,305,305,305,305,305,305,
+	120,120,120,120,120,120,120,120,305,305,305,305,305,305,305,305,
+	120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,
+	120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,
+	120,120,120,120,120,120,120,120,120,120,120,120,120,305,305,305,
+	203,203,203,203,203,203,203,203,305,305,305,305,305,305,305,305,
+	203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,
+	203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,
+	203,203,203,203,203,203,203,203,203,203,203,203,203,305,305,305,
+	204,204,204,204,204,204,204,204,305,305,305,305,305,305,305,305,
+	204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,
+	204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,
+	204,204,204,204,204,204,204,204,204,204,204,204,204,305,305,305,
+	205,205,205,205,205,205,205,205,305,305,305,305,305,305,305,305,
+	205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,
+	205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,
+	205,205,205,205,205,205,205,205,205,205,205,205,205,305,305,305,
+	121,121,121,121,121,121,121,121,305,305,305,305,305,305,305,305,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,305,305,305,
+	252,252,252,252,252,252,252,252,253,253,253,253,253,253,253,253,
+	206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,
+	206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,
+	206,206,206,206,206,206,206,206,206,206,305,305,305,305,305,305,
+	214,214,214,214,214,214,214,214,215,215,215,215,215,215,215,215,
+	207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,
+	207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,
+	207,207,207,207,207,207,207,207,207,207,305,305,305,305,305,305,
+	298,298,298,298,298,298,298,298,299,299,299,299,299,299,299,299,
+	208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,
+	208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,
+	208,208,208,208,208,208,208,208,208,208,305,305,305,305,305,305,
+	120,120,120,120,120,120,120,120,305,305,305,305,305,305,305,305,
+	120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,
+	120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,
+	120,120,120,120,120,120,120,120,120,120,120,120,120,305,305,305,
+	203,203,203,203,203,203,203,203,305,305,305,305,305,305,305,305,
+	203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,
+	203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,
+	203,203,203,203,203,203,203,203,203,203,203,203,203,305,305,305,
+	204,204,204,204,204,204,204,204,305,305,305,305,305,305,305,305,
+	204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,
+	204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,
+	204,204,204,204,204,204,204,204,204,204,204,204,204,305,305,305,
+	205,205,205,205,205,205,205,205,305,305,305,305,305,305,305,305,
+	205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,
+	205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,
+	205,205,205,205,205,205,205,205,205,205,205,205,205,305,305,305,
+	121,121,121,121,121,121,121,121,305,305,305,305,305,305,305,305,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,305,305,305,
+	252,252,252,252,252,252,252,252,253,253,253,253,253,253,253,253,
+	206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,
+	206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,
+	206,206,206,206,206,206,206,206,206,206,305,305,305,305,305,305,
+	214,214,214,214,214,214,214,214,215,215,215,215,215,215,215,215,
+	207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,
+	207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,
+	207,207,207,207,207,207,207,207,207,207,305,305,305,305,305,305,
+	298,298,298,298,298,298,298,298,299,299,299,299,299,299,299,299,
+	208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,
+	208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,
+	208,208,208,208,208,208,208,208,208,208,305,305,305,305,305,305,
+	120,120,120,120,120,120,120,120,305,305,305,305,305,305,305,305,
+	120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,
+	120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,
+	120,120,120,120,120,120,120,120,120,120,120,120,120,305,305,305,
+	203,203,203,203,203,203,203,203,305,305,305,305,305,305,305,305,
+	203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,
+	203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,
+	203,203,203,203,203,203,203,203,203,203,203,203,203,305,305,305,
+	204,204,204,204,204,204,204,204,305,305,305,305,305,305,305,305,
+	204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,
+	204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,
+	204,204,204,204,204,204,204,204,204,204,204,204,204,305,305,305,
+	205,205,205,205,205,205,205,205,305,305,305,305,305,305,305,305,
+	205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,
+	205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,
+	205,205,205,205,205,205,205,205,205,205,205,205,205,305,305,305,
+	121,121,121,121,121,121,121,121,305,305,305,305,305,305,305,305,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,305,305,305,
+	252,252,252,252,252,252,252,252,253,253,253,253,253,253,253,253,
+	206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,
+	206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,
+	206,206,206,206,206,206,206,206,206,206,305,305,305,305,305,305,
+	214,214,214,214,214,214,214,214,215,215,215,215,215,215,215,215,
+	207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,
+	207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,
+	207,207,207,207,207,207,207,207,207,207,305,305,305,305,305,305,
+	298,298,298,298,298,298,298,298,299,299,299,299,299,299,299,299,
+	208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,
+	208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,
+	208,208,208,208,208,208,208,208,208,208,305,305,305,305,305,305,
+	120,120,120,120,120,120,120,120,305,305,305,305,305,305,305,305,
+	120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,
+	120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,
+	120,120,120,120,120,120,120,120,120,120,120,120,120,305,305,305,
+	203,203,203,203,203,203,203,203,305,305,305,305,305,305,305,305,
+	203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,
+	203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,
+	203,203,203,203,203,203,203,203,203,203,203,203,203,305,305,305,
+	204,204,204,204,204,204,204,204,305,305,305,305,305,305,305,305,
+	204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,
+	204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,
+	204,204,204,204,204,204,204,204,204,204,204,204,204,305,305,305,
+	205,205,205,205,205,205,205,205,305,305,305,305,305,305,305,305,
+	205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,
+	205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,
+	205,205,205,205,205,205,205,205,205,205,205,205,205,305,305,305,
+	121,121,121,121,121,121,121,121,305,305,305,305,305,305,305,305,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,305,305,305,
+	252,252,252,252,252,252,252,252,253,253,253,253,253,253,253,253,
+	206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,
+	206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,
+	206,206,206,206,206,206,206,206,206,206,305,305,305,305,305,305,
+	214,214,214,214,214,214,214,214,215,215,215,215,215,215,215,215,
+	207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,
+	207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,
+	207,207,207,207,207,207,207,207,207,207,305,305,305,305,305,305,
+	298,298,298,298,298,298,298,298,299,299,299,299,299,299,299,299,
+	208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,
+	208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,
+	208,208,208,208,208,208,208,208,208,208,305,305,305,305,305,305,
+	120,120,120,120,120,120,120,120,305,305,305,305,305,305,305,305,
+	120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,
+	120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,
+	120,120,120,120,120,120,120,120,120,120,120,120,120,305,305,305,
+	203,203,203,203,203,203,203,203,305,305,305,305,305,305,305,305,
+	203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,
+	203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,
+	203,203,203,203,203,203,203,203,203,203,203,203,203,305,305,305,
+	204,204,204,204,204,204,204,204,305,305,305,305,305,305,305,305,
+	204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,
+	204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,
+	204,204,204,204,204,204,204,204,204,204,204,204,204,305,305,305,
+	205,205,205,205,205,205,205,205,305,305,305,305,305,305,305,305,
+	205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,
+	205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,
+	205,205,205,205,205,205,205,205,205,205,205,205,205,305,305,305,
+	121,121,121,121,121,121,121,121,305,305,305,305,305,305,305,305,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,305,305,305,
+	252,252,252,252,252,252,252,252,253,253,253,253,253,253,253,253,
+	206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,
+	206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,
+	206,206,206,206,206,206,206,206,206,206,305,305,305,305,305,305,
+	214,214,214,214,214,214,214,214,215,215,215,215,215,215,215,215,
+	207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,
+	207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,
+	207,207,207,207,207,207,207,207,207,207,305,305,305,305,305,305,
+	298,298,298,298,298,298,298,298,299,299,299,299,299,299,299,299,
+	208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,
+	208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,
+	208,208,208,208,208,208,208,208,208,208,305,305,305,305,305,305,
+	120,120,120,120,120,120,120,120,305,305,305,305,305,305,305,305,
+	120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,
+	120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,
+	120,120,120,120,120,120,120,120,120,120,120,120,120,305,305,305,
+	203,203,203,203,203,203,203,203,305,305,305,305,305,305,305,305,
+	203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,
+	203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,
+	203,203,203,203,203,203,203,203,203,203,203,203,203,305,305,305,
+	204,204,204,204,204,204,204,204,305,305,305,305,305,305,305,305,
+	204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,
+	204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,
+	204,204,204,204,204,204,204,204,204,204,204,204,204,305,305,305,
+	205,205,205,205,205,205,205,205,305,305,305,305,305,305,305,305,
+	205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,
+	205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,
+	205,205,205,205,205,205,205,205,205,205,205,205,205,305,305,305,
+	121,121,121,121,121,121,121,121,305,305,305,305,305,305,305,305,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,305,305,305,
+	252,252,252,252,252,252,252,252,253,253,253,253,253,253,253,253,
+	206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,
+	206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,
+	206,206,206,206,206,206,206,206,206,206,305,305,305,305,305,305,
+	214,214,214,214,214,214,214,214,215,215,215,215,215,215,215,215,
+	207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,
+	207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,
+	207,207,207,207,207,207,207,207,207,207,305,305,305,305,305,305,
+	298,298,298,298,298,298,298,298,299,299,299,299,299,299,299,299,
+	208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,
+	208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,
+	208,208,208,208,208,208,208,208,208,208,305,305,305,305,305,305,
+	120,120,120,120,120,120,120,120,305,305,305,305,305,305,305,305,
+	120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,
+	120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,
+	120,120,120,120,120,120,120,120,120,120,120,120,120,305,305,305,
+	256,256,256,256,256,256,256,256,305,305,305,305,305,305,305,305,
+	256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+	256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+	256,256,256,256,256,256,256,256,256,256,256,256,256,305,305,305,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,305,305,305,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,305,305,305,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,305,305,305,
+	270,270,270,270,270,270,270,270,273,273,273,273,273,273,273,273,
+	259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,
+	259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,
+	259,259,259,259,259,259,259,259,259,259,305,305,305,305,305,305,
+	271,271,271,271,271,271,271,271,274,274,274,274,274,274,274,274,
+	260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,
+	260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,
+	260,260,260,260,260,260,260,260,260,260,305,305,305,305,305,305,
+	272,272,272,272,272,272,272,272,275,275,275,275,275,275,275,275,
+	261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,
+	261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,
+	261,261,261,261,261,261,261,261,261,261,305,305,305,305,305,305,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,305,305,305,
+	256,256,256,256,256,256,256,256,305,305,305,305,305,305,305,305,
+	256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+	256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+	256,256,256,256,256,256,256,256,256,256,256,256,256,305,305,305,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,305,305,305,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,305,305,305,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,305,305,305,
+	270,270,270,270,270,270,270,270,273,273,273,273,273,273,273,273,
+	259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,
+	259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,
+	259,259,259,259,259,259,259,259,259,259,305,305,305,305,305,305,
+	271,271,271,271,271,271,271,271,274,274,274,274,274,274,274,274,
+	260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,
+	260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,
+	260,260,260,260,260,260,260,260,260,260,305,305,305,305,305,305,
+	272,272,272,272,272,272,272,272,275,275,275,275,275,275,275,275,
+	261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,
+	261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,
+	261,261,261,261,261,261,261,261,261,261,305,305,305,305,305,305,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,305,305,305,
+	256,256,256,256,256,256,256,256,305,305,305,305,305,305,305,305,
+	256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+	256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+	256,256,256,256,256,256,256,256,256,256,256,256,256,305,305,305,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,305,305,305,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,305,305,305,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,305,305,305,
+	270,270,270,270,270,270,270,270,273,273,273,273,273,273,273,273,
+	259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,
+	259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,
+	259,259,259,259,259,259,259,259,259,259,305,305,305,305,305,305,
+	271,271,271,271,271,271,271,271,274,274,274,274,274,274,274,274,
+	260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,
+	260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,
+	260,260,260,260,260,260,260,260,260,260,305,305,305,305,305,305,
+	272,272,272,272,272,272,272,272,275,275,275,275,275,275,275,275,
+	261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,
+	261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,
+	261,261,261,261,261,261,261,261,261,261,305,305,305,305,305,305,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,305,305,305,
+	256,256,256,256,256,256,256,256,305,305,305,305,305,305,305,305,
+	256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+	256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+	256,256,256,256,256,256,256,256,256,256,256,256,256,305,305,305,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,305,305,305,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,305,305,305,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,305,305,305,
+	270,270,270,270,270,270,270,270,273,273,273,273,273,273,273,273,
+	259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,
+	259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,
+	259,259,259,259,259,259,259,259,259,259,305,305,305,305,305,305,
+	271,271,271,271,271,271,271,271,274,274,274,274,274,274,274,274,
+	260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,
+	260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,
+	260,260,260,260,260,260,260,260,260,260,305,305,305,305,305,305,
+	272,272,272,272,272,272,272,272,275,275,275,275,275,275,275,275,
+	261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,
+	261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,
+	261,261,261,261,261,261,261,261,261,261,305,305,305,305,305,305,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,305,305,305,
+	256,256,256,256,256,256,256,256,305,305,305,305,305,305,305,305,
+	256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+	256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+	256,256,256,256,256,256,256,256,256,256,256,256,256,305,305,305,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,305,305,305,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,305,305,305,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,305,305,305,
+	270,270,270,270,270,270,270,270,273,273,273,273,273,273,273,273,
+	259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,
+	259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,
+	259,259,259,259,259,259,259,259,259,259,305,305,305,305,305,305,
+	271,271,271,271,271,271,271,271,274,274,274,274,274,274,274,274,
+	260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,
+	260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,
+	260,260,260,260,260,260,260,260,260,260,305,305,305,305,305,305,
+	272,272,272,272,272,272,272,272,275,275,275,275,275,275,275,275,
+	261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,
+	261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,
+	261,261,261,261,261,261,261,261,261,261,305,305,305,305,305,305,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,305,305,305,
+	256,256,256,256,256,256,256,256,305,305,305,305,305,305,305,305,
+	256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+	256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+	256,256,256,256,256,256,256,256,256,256,256,256,256,305,305,305,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,305,305,305,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,305,305,305,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,305,305,305,
+	270,270,270,270,270,270,270,270,273,273,273,273,273,273,273,273,
+	259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,
+	259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,
+	259,259,259,259,259,259,259,259,259,259,305,305,305,305,305,305,
+	271,271,271,271,271,271,271,271,274,274,274,274,274,274,274,274,
+	260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,
+	260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,
+	260,260,260,260,260,260,260,260,260,260,305,305,305,305,305,305,
+	272,272,272,272,272,272,272,272,275,275,275,275,275,275,275,275,
+	261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,
+	261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,
+	261,261,261,261,261,261,261,261,261,261,305,305,305,305,305,305,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,305,305,305,
+	256,256,256,256,256,256,256,256,305,305,305,305,305,305,305,305,
+	256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+	256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+	256,256,256,256,256,256,256,256,256,256,256,256,256,305,305,305,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,305,305,305,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,305,305,305,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,305,305,305,
+	270,270,270,270,270,270,270,270,273,273,273,273,273,273,273,273,
+	259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,
+	259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,
+	259,259,259,259,259,259,259,259,259,259,305,305,305,305,305,305,
+	271,271,271,271,271,271,271,271,274,274,274,274,274,274,274,274,
+	260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,
+	260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,
+	260,260,260,260,260,260,260,260,260,260,305,305,305,305,305,305,
+	272,272,272,272,272,272,272,272,275,275,275,275,275,275,275,275,
+	261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,
+	261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,
+	261,261,261,261,261,261,261,261,261,261,305,305,305,305,305,305,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,305,305,305,
+	256,256,256,256,256,256,256,256,305,305,305,305,305,305,305,305,
+	256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+	256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+	256,256,256,256,256,256,256,256,256,256,256,256,256,305,305,305,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,
+	257,257,257,257,257,257,257,257,257,257,257,257,257,305,305,305,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+	258,258,258,258,258,258,258,258,258,258,258,258,258,305,305,305,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,
+	262,262,262,262,262,262,262,262,262,262,262,262,262,305,305,305,
+	270,270,270,270,270,270,270,270,273,273,273,273,273,273,273,273,
+	259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,
+	259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,259,
+	259,259,259,259,259,259,259,259,259,259,305,305,305,305,305,305,
+	271,271,271,271,271,271,271,271,274,274,274,274,274,274,274,274,
+	260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,
+	260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,260,
+	260,260,260,260,260,260,260,260,260,260,305,305,305,305,305,305,
+	272,272,272,272,272,272,272,272,275,275,275,275,275,275,275,275,
+	261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,
+	261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,
+	261,261,261,261,261,261,261,261,261,261,305,305,305,305,305,305,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,
+	263,263,263,263,263,263,263,263,263,263,263,263,263,305,305,305,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	90,90,90,90,90,90,90,90,305,305,305,305,305,305,305,305,
+	90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,
+	90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,
+	90,90,90,90,90,90,90,90,90,90,90,90,90,305,305,305,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,305,305,305,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,305,305,305,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,305,305,305,
+	123,123,123,123,123,123,123,123,104,104,104,104,104,104,104,104,
+	123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+	123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+	123,123,123,123,123,123,123,123,123,123,305,305,305,305,305,305,
+	124,124,124,124,124,124,124,124,105,105,105,105,105,105,105,105,
+	124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
+	124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
+	124,124,124,124,124,124,124,124,124,124,305,305,305,305,305,305,
+	125,125,125,125,125,125,125,125,106,106,106,106,106,106,106,106,
+	125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
+	125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
+	125,125,125,125,125,125,125,125,125,125,305,305,305,305,305,305,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,305,305,305,
+	90,90,90,90,90,90,90,90,305,305,305,305,305,305,305,305,
+	90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,
+	90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,
+	90,90,90,90,90,90,90,90,90,90,90,90,90,305,305,305,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,305,305,305,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,305,305,305,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,305,305,305,
+	123,123,123,123,123,123,123,123,104,104,104,104,104,104,104,104,
+	123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+	123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+	123,123,123,123,123,123,123,123,123,123,305,305,305,305,305,305,
+	124,124,124,124,124,124,124,124,105,105,105,105,105,105,105,105,
+	124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
+	124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
+	124,124,124,124,124,124,124,124,124,124,305,305,305,305,305,305,
+	125,125,125,125,125,125,125,125,106,106,106,106,106,106,106,106,
+	125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
+	125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
+	125,125,125,125,125,125,125,125,125,125,305,305,305,305,305,305,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,305,305,305,
+	90,90,90,90,90,90,90,90,305,305,305,305,305,305,305,305,
+	90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,
+	90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,
+	90,90,90,90,90,90,90,90,90,90,90,90,90,305,305,305,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,305,305,305,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,305,305,305,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,305,305,305,
+	123,123,123,123,123,123,123,123,104,104,104,104,104,104,104,104,
+	123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+	123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+	123,123,123,123,123,123,123,123,123,123,305,305,305,305,305,305,
+	124,124,124,124,124,124,124,124,105,105,105,105,105,105,105,105,
+	124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
+	124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
+	124,124,124,124,124,124,124,124,124,124,305,305,305,305,305,305,
+	125,125,125,125,125,125,125,125,106,106,106,106,106,106,106,106,
+	125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
+	125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
+	125,125,125,125,125,125,125,125,125,125,305,305,305,305,305,305,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,305,305,305,
+	90,90,90,90,90,90,90,90,305,305,305,305,305,305,305,305,
+	90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,
+	90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,
+	90,90,90,90,90,90,90,90,90,90,90,90,90,305,305,305,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,305,305,305,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,305,305,305,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,305,305,305,
+	123,123,123,123,123,123,123,123,104,104,104,104,104,104,104,104,
+	123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+	123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+	123,123,123,123,123,123,123,123,123,123,305,305,305,305,305,305,
+	124,124,124,124,124,124,124,124,105,105,105,105,105,105,105,105,
+	124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
+	124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
+	124,124,124,124,124,124,124,124,124,124,305,305,305,305,305,305,
+	125,125,125,125,125,125,125,125,106,106,106,106,106,106,106,106,
+	125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
+	125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
+	125,125,125,125,125,125,125,125,125,125,305,305,305,305,305,305,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,305,305,305,
+	90,90,90,90,90,90,90,90,305,305,305,305,305,305,305,305,
+	90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,
+	90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,
+	90,90,90,90,90,90,90,90,90,90,90,90,90,305,305,305,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,305,305,305,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,305,305,305,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,305,305,305,
+	123,123,123,123,123,123,123,123,104,104,104,104,104,104,104,104,
+	123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+	123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+	123,123,123,123,123,123,123,123,123,123,305,305,305,305,305,305,
+	124,124,124,124,124,124,124,124,105,105,105,105,105,105,105,105,
+	124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
+	124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
+	124,124,124,124,124,124,124,124,124,124,305,305,305,305,305,305,
+	125,125,125,125,125,125,125,125,106,106,106,106,106,106,106,106,
+	125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
+	125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
+	125,125,125,125,125,125,125,125,125,125,305,305,305,305,305,305,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,305,305,305,
+	90,90,90,90,90,90,90,90,305,305,305,305,305,305,305,305,
+	90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,
+	90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,
+	90,90,90,90,90,90,90,90,90,90,90,90,90,305,305,305,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,305,305,305,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,305,305,305,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,305,305,305,
+	123,123,123,123,123,123,123,123,104,104,104,104,104,104,104,104,
+	123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+	123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+	123,123,123,123,123,123,123,123,123,123,305,305,305,305,305,305,
+	124,124,124,124,124,124,124,124,105,105,105,105,105,105,105,105,
+	124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
+	124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
+	124,124,124,124,124,124,124,124,124,124,305,305,305,305,305,305,
+	125,125,125,125,125,125,125,125,106,106,106,106,106,106,106,106,
+	125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
+	125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
+	125,125,125,125,125,125,125,125,125,125,305,305,305,305,305,305,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,305,305,305,
+	90,90,90,90,90,90,90,90,305,305,305,305,305,305,305,305,
+	90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,
+	90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,
+	90,90,90,90,90,90,90,90,90,90,90,90,90,305,305,305,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,305,305,305,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,305,305,305,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,305,305,305,
+	123,123,123,123,123,123,123,123,104,104,104,104,104,104,104,104,
+	123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+	123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+	123,123,123,123,123,123,123,123,123,123,305,305,305,305,305,305,
+	124,124,124,124,124,124,124,124,105,105,105,105,105,105,105,105,
+	124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
+	124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
+	124,124,124,124,124,124,124,124,124,124,305,305,305,305,305,305,
+	125,125,125,125,125,125,125,125,106,106,106,106,106,106,106,106,
+	125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
+	125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
+	125,125,125,125,125,125,125,125,125,125,305,305,305,305,305,305,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,305,305,305,
+	90,90,90,90,90,90,90,90,305,305,305,305,305,305,305,305,
+	90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,
+	90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,
+	90,90,90,90,90,90,90,90,90,90,90,90,90,305,305,305,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+	91,91,91,91,91,91,91,91,91,91,91,91,91,305,305,305,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+	92,92,92,92,92,92,92,92,92,92,92,92,92,305,305,305,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,
+	93,93,93,93,93,93,93,93,93,93,93,93,93,305,305,305,
+	123,123,123,123,123,123,123,123,104,104,104,104,104,104,104,104,
+	123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+	123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+	123,123,123,123,123,123,123,123,123,123,305,305,305,305,305,305,
+	124,124,124,124,124,124,124,124,105,105,105,105,105,105,105,105,
+	124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
+	124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
+	124,124,124,124,124,124,124,124,124,124,305,305,305,305,305,305,
+	125,125,125,125,125,125,125,125,106,106,106,106,106,106,106,106,
+	125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
+	125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
+	125,125,125,125,125,125,125,125,125,125,305,305,305,305,305,305,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,
+	94,94,94,94,94,94,94,94,94,94,94,94,94,305,305,305,
+	24,24,24,24,24,24,24,24,305,305,305,305,305,305,305,305,
+	24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+	24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+	24,24,24,24,24,24,24,24,24,24,24,24,24,305,305,305,
+	25,25,25,25,25,25,25,25,305,305,305,305,305,305,305,305,
+	25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+	25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+	25,25,25,25,25,25,25,25,25,25,25,25,25,305,305,305,
+	26,26,26,26,26,26,26,26,305,305,305,305,305,305,305,305,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,305,305,305,
+	190,190,190,190,190,190,190,190,305,305,305,305,305,305,305,305,
+	190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,
+	190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,
+	190,190,190,190,190,190,190,190,190,190,190,190,190,305,305,305,
+	2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,
+	27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+	27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+	27,27,27,27,27,27,27,27,27,27,305,305,305,305,305,305,
+	131,131,131,131,131,131,131,131,132,132,132,132,132,132,132,132,
+	28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,
+	28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,
+	28,28,28,28,28,28,28,28,28,28,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,133,133,133,133,133,133,133,133,
+	29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+	29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+	29,29,29,29,29,29,29,29,29,29,305,305,305,305,305,305,
+	189,189,189,189,189,189,189,189,305,305,305,305,305,305,305,305,
+	189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,
+	189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,
+	189,189,189,189,189,189,189,189,189,189,189,189,189,305,305,305,
+	24,24,24,24,24,24,24,24,305,305,305,305,305,305,305,305,
+	24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+	24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+	24,24,24,24,24,24,24,24,24,24,24,24,24,305,305,305,
+	25,25,25,25,25,25,25,25,305,305,305,305,305,305,305,305,
+	25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+	25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+	25,25,25,25,25,25,25,25,25,25,25,25,25,305,305,305,
+	26,26,26,26,26,26,26,26,305,305,305,305,305,305,305,305,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,305,305,305,
+	190,190,190,190,190,190,190,190,305,305,305,305,305,305,305,305,
+	190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,
+	190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,
+	190,190,190,190,190,190,190,190,190,190,190,190,190,305,305,305,
+	2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,
+	27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+	27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+	27,27,27,27,27,27,27,27,27,27,305,305,305,305,305,305,
+	131,131,131,131,131,131,131,131,132,132,132,132,132,132,132,132,
+	28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,
+	28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,
+	28,28,28,28,28,28,28,28,28,28,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,133,133,133,133,133,133,133,133,
+	29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+	29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+	29,29,29,29,29,29,29,29,29,29,305,305,305,305,305,305,
+	189,189,189,189,189,189,189,189,305,305,305,305,305,305,305,305,
+	189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,
+	189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,
+	189,189,189,189,189,189,189,189,189,189,189,189,189,305,305,305,
+	24,24,24,24,24,24,24,24,305,305,305,305,305,305,305,305,
+	24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+	24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+	24,24,24,24,24,24,24,24,24,24,24,24,24,305,305,305,
+	25,25,25,25,25,25,25,25,305,305,305,305,305,305,305,305,
+	25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+	25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+	25,25,25,25,25,25,25,25,25,25,25,25,25,305,305,305,
+	26,26,26,26,26,26,26,26,305,305,305,305,305,305,305,305,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,305,305,305,
+	190,190,190,190,190,190,190,190,305,305,305,305,305,305,305,305,
+	190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,
+	190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,
+	190,190,190,190,190,190,190,190,190,190,190,190,190,305,305,305,
+	2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,
+	27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+	27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+	27,27,27,27,27,27,27,27,27,27,305,305,305,305,305,305,
+	131,131,131,131,131,131,131,131,132,132,132,132,132,132,132,132,
+	28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,
+	28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,
+	28,28,28,28,28,28,28,28,28,28,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,133,133,133,133,133,133,133,133,
+	29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+	29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+	29,29,29,29,29,29,29,29,29,29,305,305,305,305,305,305,
+	189,189,189,189,189,189,189,189,305,305,305,305,305,305,305,305,
+	189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,
+	189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,
+	189,189,189,189,189,189,189,189,189,189,189,189,189,305,305,305,
+	24,24,24,24,24,24,24,24,305,305,305,305,305,305,305,305,
+	24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+	24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+	24,24,24,24,24,24,24,24,24,24,24,24,24,305,305,305,
+	25,25,25,25,25,25,25,25,305,305,305,305,305,305,305,305,
+	25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+	25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+	25,25,25,25,25,25,25,25,25,25,25,25,25,305,305,305,
+	26,26,26,26,26,26,26,26,305,305,305,305,305,305,305,305,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,305,305,305,
+	190,190,190,190,190,190,190,190,305,305,305,305,305,305,305,305,
+	190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,
+	190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,
+	190,190,190,190,190,190,190,190,190,190,190,190,190,305,305,305,
+	2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,
+	27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+	27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+	27,27,27,27,27,27,27,27,27,27,305,305,305,305,305,305,
+	131,131,131,131,131,131,131,131,132,132,132,132,132,132,132,132,
+	28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,
+	28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,
+	28,28,28,28,28,28,28,28,28,28,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,133,133,133,133,133,133,133,133,
+	29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+	29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+	29,29,29,29,29,29,29,29,29,29,305,305,305,305,305,305,
+	189,189,189,189,189,189,189,189,305,305,305,305,305,305,305,305,
+	189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,
+	189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,
+	189,189,189,189,189,189,189,189,189,189,189,189,189,305,305,305,
+	24,24,24,24,24,24,24,24,305,305,305,305,305,305,305,305,
+	24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+	24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+	24,24,24,24,24,24,24,24,24,24,24,24,24,305,305,305,
+	25,25,25,25,25,25,25,25,305,305,305,305,305,305,305,305,
+	25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+	25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+	25,25,25,25,25,25,25,25,25,25,25,25,25,305,305,305,
+	26,26,26,26,26,26,26,26,305,305,305,305,305,305,305,305,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,305,305,305,
+	190,190,190,190,190,190,190,190,305,305,305,305,305,305,305,305,
+	190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,
+	190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,
+	190,190,190,190,190,190,190,190,190,190,190,190,190,305,305,305,
+	2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,
+	27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+	27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+	27,27,27,27,27,27,27,27,27,27,305,305,305,305,305,305,
+	131,131,131,131,131,131,131,131,132,132,132,132,132,132,132,132,
+	28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,
+	28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,
+	28,28,28,28,28,28,28,28,28,28,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,133,133,133,133,133,133,133,133,
+	29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+	29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+	29,29,29,29,29,29,29,29,29,29,305,305,305,305,305,305,
+	189,189,189,189,189,189,189,189,305,305,305,305,305,305,305,305,
+	189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,
+	189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,
+	189,189,189,189,189,189,189,189,189,189,189,189,189,305,305,305,
+	24,24,24,24,24,24,24,24,305,305,305,305,305,305,305,305,
+	24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+	24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+	24,24,24,24,24,24,24,24,24,24,24,24,24,305,305,305,
+	25,25,25,25,25,25,25,25,305,305,305,305,305,305,305,305,
+	25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+	25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+	25,25,25,25,25,25,25,25,25,25,25,25,25,305,305,305,
+	26,26,26,26,26,26,26,26,305,305,305,305,305,305,305,305,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,305,305,305,
+	190,190,190,190,190,190,190,190,305,305,305,305,305,305,305,305,
+	190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,
+	190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,
+	190,190,190,190,190,190,190,190,190,190,190,190,190,305,305,305,
+	2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,
+	27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+	27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+	27,27,27,27,27,27,27,27,27,27,305,305,305,305,305,305,
+	131,131,131,131,131,131,131,131,132,132,132,132,132,132,132,132,
+	28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,
+	28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,
+	28,28,28,28,28,28,28,28,28,28,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,133,133,133,133,133,133,133,133,
+	29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+	29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+	29,29,29,29,29,29,29,29,29,29,305,305,305,305,305,305,
+	189,189,189,189,189,189,189,189,305,305,305,305,305,305,305,305,
+	189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,
+	189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,
+	189,189,189,189,189,189,189,189,189,189,189,189,189,305,305,305,
+	24,24,24,24,24,24,24,24,305,305,305,305,305,305,305,305,
+	24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+	24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+	24,24,24,24,24,24,24,24,24,24,24,24,24,305,305,305,
+	25,25,25,25,25,25,25,25,305,305,305,305,305,305,305,305,
+	25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+	25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+	25,25,25,25,25,25,25,25,25,25,25,25,25,305,305,305,
+	26,26,26,26,26,26,26,26,305,305,305,305,305,305,305,305,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,305,305,305,
+	190,190,190,190,190,190,190,190,305,305,305,305,305,305,305,305,
+	190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,
+	190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,
+	190,190,190,190,190,190,190,190,190,190,190,190,190,305,305,305,
+	2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,
+	27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+	27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+	27,27,27,27,27,27,27,27,27,27,305,305,305,305,305,305,
+	131,131,131,131,131,131,131,131,132,132,132,132,132,132,132,132,
+	28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,
+	28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,
+	28,28,28,28,28,28,28,28,28,28,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,133,133,133,133,133,133,133,133,
+	29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+	29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+	29,29,29,29,29,29,29,29,29,29,305,305,305,305,305,305,
+	189,189,189,189,189,189,189,189,305,305,305,305,305,305,305,305,
+	189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,
+	189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,
+	189,189,189,189,189,189,189,189,189,189,189,189,189,305,305,305,
+	24,24,24,24,24,24,24,24,305,305,305,305,305,305,305,305,
+	24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+	24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+	24,24,24,24,24,24,24,24,24,24,24,24,24,305,305,305,
+	25,25,25,25,25,25,25,25,305,305,305,305,305,305,305,305,
+	25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+	25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+	25,25,25,25,25,25,25,25,25,25,25,25,25,305,305,305,
+	26,26,26,26,26,26,26,26,305,305,305,305,305,305,305,305,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,305,305,305,
+	190,190,190,190,190,190,190,190,305,305,305,305,305,305,305,305,
+	190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,
+	190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,
+	190,190,190,190,190,190,190,190,190,190,190,190,190,305,305,305,
+	2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,
+	27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+	27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+	27,27,27,27,27,27,27,27,27,27,305,305,305,305,305,305,
+	131,131,131,131,131,131,131,131,132,132,132,132,132,132,132,132,
+	28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,
+	28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,
+	28,28,28,28,28,28,28,28,28,28,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,133,133,133,133,133,133,133,133,
+	29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+	29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+	29,29,29,29,29,29,29,29,29,29,305,305,305,305,305,305,
+	189,189,189,189,189,189,189,189,305,305,305,305,305,305,305,305,
+	189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,
+	189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,
+	189,189,189,189,189,189,189,189,189,189,189,189,189,305,305,305,
+	4,4,4,4,4,4,4,4,305,305,305,305,305,305,305,305,
+	4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+	4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+	4,4,4,4,4,4,4,4,4,4,4,4,4,305,305,305,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,305,305,305,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,305,305,305,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,305,305,305,
+	18,18,18,18,18,18,18,18,21,21,21,21,21,21,21,21,
+	7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+	7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+	7,7,7,7,7,7,7,7,7,7,305,305,305,305,305,305,
+	19,19,19,19,19,19,19,19,22,22,22,22,22,22,22,22,
+	8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+	8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+	8,8,8,8,8,8,8,8,8,8,305,305,305,305,305,305,
+	20,20,20,20,20,20,20,20,23,23,23,23,23,23,23,23,
+	9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+	9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+	9,9,9,9,9,9,9,9,9,9,305,305,305,305,305,305,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,305,305,305,
+	4,4,4,4,4,4,4,4,305,305,305,305,305,305,305,305,
+	4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+	4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+	4,4,4,4,4,4,4,4,4,4,4,4,4,305,305,305,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,305,305,305,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,305,305,305,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,305,305,305,
+	18,18,18,18,18,18,18,18,21,21,21,21,21,21,21,21,
+	7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+	7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+	7,7,7,7,7,7,7,7,7,7,305,305,305,305,305,305,
+	19,19,19,19,19,19,19,19,22,22,22,22,22,22,22,22,
+	8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+	8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+	8,8,8,8,8,8,8,8,8,8,305,305,305,305,305,305,
+	20,20,20,20,20,20,20,20,23,23,23,23,23,23,23,23,
+	9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+	9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+	9,9,9,9,9,9,9,9,9,9,305,305,305,305,305,305,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,305,305,305,
+	4,4,4,4,4,4,4,4,305,305,305,305,305,305,305,305,
+	4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+	4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+	4,4,4,4,4,4,4,4,4,4,4,4,4,305,305,305,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,305,305,305,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,305,305,305,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,305,305,305,
+	18,18,18,18,18,18,18,18,21,21,21,21,21,21,21,21,
+	7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+	7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+	7,7,7,7,7,7,7,7,7,7,305,305,305,305,305,305,
+	19,19,19,19,19,19,19,19,22,22,22,22,22,22,22,22,
+	8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+	8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+	8,8,8,8,8,8,8,8,8,8,305,305,305,305,305,305,
+	20,20,20,20,20,20,20,20,23,23,23,23,23,23,23,23,
+	9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+	9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+	9,9,9,9,9,9,9,9,9,9,305,305,305,305,305,305,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,305,305,305,
+	4,4,4,4,4,4,4,4,305,305,305,305,305,305,305,305,
+	4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+	4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+	4,4,4,4,4,4,4,4,4,4,4,4,4,305,305,305,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,305,305,305,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,305,305,305,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,305,305,305,
+	18,18,18,18,18,18,18,18,21,21,21,21,21,21,21,21,
+	7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+	7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+	7,7,7,7,7,7,7,7,7,7,305,305,305,305,305,305,
+	19,19,19,19,19,19,19,19,22,22,22,22,22,22,22,22,
+	8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+	8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+	8,8,8,8,8,8,8,8,8,8,305,305,305,305,305,305,
+	20,20,20,20,20,20,20,20,23,23,23,23,23,23,23,23,
+	9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+	9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+	9,9,9,9,9,9,9,9,9,9,305,305,305,305,305,305,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,305,305,305,
+	4,4,4,4,4,4,4,4,305,305,305,305,305,305,305,305,
+	4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+	4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+	4,4,4,4,4,4,4,4,4,4,4,4,4,305,305,305,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,305,305,305,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,305,305,305,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,305,305,305,
+	18,18,18,18,18,18,18,18,21,21,21,21,21,21,21,21,
+	7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+	7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+	7,7,7,7,7,7,7,7,7,7,305,305,305,305,305,305,
+	19,19,19,19,19,19,19,19,22,22,22,22,22,22,22,22,
+	8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+	8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+	8,8,8,8,8,8,8,8,8,8,305,305,305,305,305,305,
+	20,20,20,20,20,20,20,20,23,23,23,23,23,23,23,23,
+	9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+	9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+	9,9,9,9,9,9,9,9,9,9,305,305,305,305,305,305,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,305,305,305,
+	4,4,4,4,4,4,4,4,305,305,305,305,305,305,305,305,
+	4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+	4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+	4,4,4,4,4,4,4,4,4,4,4,4,4,305,305,305,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,305,305,305,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,305,305,305,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,305,305,305,
+	18,18,18,18,18,18,18,18,21,21,21,21,21,21,21,21,
+	7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+	7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+	7,7,7,7,7,7,7,7,7,7,305,305,305,305,305,305,
+	19,19,19,19,19,19,19,19,22,22,22,22,22,22,22,22,
+	8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+	8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+	8,8,8,8,8,8,8,8,8,8,305,305,305,305,305,305,
+	20,20,20,20,20,20,20,20,23,23,23,23,23,23,23,23,
+	9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+	9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+	9,9,9,9,9,9,9,9,9,9,305,305,305,305,305,305,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,305,305,305,
+	4,4,4,4,4,4,4,4,305,305,305,305,305,305,305,305,
+	4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+	4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+	4,4,4,4,4,4,4,4,4,4,4,4,4,305,305,305,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,305,305,305,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,305,305,305,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,305,305,305,
+	18,18,18,18,18,18,18,18,21,21,21,21,21,21,21,21,
+	7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+	7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+	7,7,7,7,7,7,7,7,7,7,305,305,305,305,305,305,
+	19,19,19,19,19,19,19,19,22,22,22,22,22,22,22,22,
+	8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+	8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+	8,8,8,8,8,8,8,8,8,8,305,305,305,305,305,305,
+	20,20,20,20,20,20,20,20,23,23,23,23,23,23,23,23,
+	9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+	9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+	9,9,9,9,9,9,9,9,9,9,305,305,305,305,305,305,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,305,305,305,
+	4,4,4,4,4,4,4,4,305,305,305,305,305,305,305,305,
+	4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+	4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+	4,4,4,4,4,4,4,4,4,4,4,4,4,305,305,305,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,305,305,305,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,305,305,305,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,305,305,305,
+	18,18,18,18,18,18,18,18,21,21,21,21,21,21,21,21,
+	7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+	7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+	7,7,7,7,7,7,7,7,7,7,305,305,305,305,305,305,
+	19,19,19,19,19,19,19,19,22,22,22,22,22,22,22,22,
+	8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+	8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+	8,8,8,8,8,8,8,8,8,8,305,305,305,305,305,305,
+	20,20,20,20,20,20,20,20,23,23,23,23,23,23,23,23,
+	9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+	9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+	9,9,9,9,9,9,9,9,9,9,305,305,305,305,305,305,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,305,305,305,
+	35,35,35,35,35,35,35,35,144,144,144,144,144,144,144,144,
+	233,233,233,233,233,233,233,233,219,219,219,219,219,219,219,219,
+	38,38,38,38,38,38,38,38,147,147,147,147,147,147,147,147,
+	236,236,236,236,236,236,236,236,222,222,222,222,222,222,222,222,
+	36,36,36,36,36,36,36,36,145,145,145,145,145,145,145,145,
+	234,234,234,234,234,234,234,234,220,220,220,220,220,220,220,220,
+	39,39,39,39,39,39,39,39,148,148,148,148,148,148,148,148,
+	237,237,237,237,237,237,237,237,223,223,223,223,223,223,223,223,
+	37,37,37,37,37,37,37,37,146,146,146,146,146,146,146,146,
+	235,235,235,235,235,235,235,235,221,221,221,221,221,221,221,221,
+	40,40,40,40,40,40,40,40,149,149,149,149,149,149,149,149,
+	238,238,238,238,238,238,238,238,224,224,224,224,224,224,224,224,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+	41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+	41,41,41,41,41,41,41,41,41,41,305,305,305,305,305,305,
+	42,42,42,42,42,42,42,42,151,151,151,151,151,151,151,151,
+	240,240,240,240,240,240,240,240,226,226,226,226,226,226,226,226,
+	45,45,45,45,45,45,45,45,154,154,154,154,154,154,154,154,
+	243,243,243,243,243,243,243,243,229,229,229,229,229,229,229,229,
+	43,43,43,43,43,43,43,43,152,152,152,152,152,152,152,152,
+	241,241,241,241,241,241,241,241,227,227,227,227,227,227,227,227,
+	46,46,46,46,46,46,46,46,155,155,155,155,155,155,155,155,
+	244,244,244,244,244,244,244,244,230,230,230,230,230,230,230,230,
+	44,44,44,44,44,44,44,44,153,153,153,153,153,153,153,153,
+	242,242,242,242,242,242,242,242,228,228,228,228,228,228,228,228,
+	47,47,47,47,47,47,47,47,156,156,156,156,156,156,156,156,
+	245,245,245,245,245,245,245,245,231,231,231,231,231,231,231,231,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+	48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+	48,48,48,48,48,48,48,48,48,48,305,305,305,305,305,305,
+	35,35,35,35,35,35,35,35,144,144,144,144,144,144,144,144,
+	233,233,233,233,233,233,233,233,219,219,219,219,219,219,219,219,
+	38,38,38,38,38,38,38,38,147,147,147,147,147,147,147,147,
+	236,236,236,236,236,236,236,236,222,222,222,222,222,222,222,222,
+	36,36,36,36,36,36,36,36,145,145,145,145,145,145,145,145,
+	234,234,234,234,234,234,234,234,220,220,220,220,220,220,220,220,
+	39,39,39,39,39,39,39,39,148,148,148,148,148,148,148,148,
+	237,237,237,237,237,237,237,237,223,223,223,223,223,223,223,223,
+	37,37,37,37,37,37,37,37,146,146,146,146,146,146,146,146,
+	235,235,235,235,235,235,235,235,221,221,221,221,221,221,221,221,
+	40,40,40,40,40,40,40,40,149,149,149,149,149,149,149,149,
+	238,238,238,238,238,238,238,238,224,224,224,224,224,224,224,224,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,
+	150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,
+	150,150,150,150,150,150,150,150,150,150,305,305,305,305,305,305,
+	42,42,42,42,42,42,42,42,151,151,151,151,151,151,151,151,
+	240,240,240,240,240,240,240,240,226,226,226,226,226,226,226,226,
+	45,45,45,45,45,45,45,45,154,154,154,154,154,154,154,154,
+	243,243,243,243,243,243,243,243,229,229,229,229,229,229,229,229,
+	43,43,43,43,43,43,43,43,152,152,152,152,152,152,152,152,
+	241,241,241,241,241,241,241,241,227,227,227,227,227,227,227,227,
+	46,46,46,46,46,46,46,46,155,155,155,155,155,155,155,155,
+	244,244,244,244,244,244,244,244,230,230,230,230,230,230,230,230,
+	44,44,44,44,44,44,44,44,153,153,153,153,153,153,153,153,
+	242,242,242,242,242,242,242,242,228,228,228,228,228,228,228,228,
+	47,47,47,47,47,47,47,47,156,156,156,156,156,156,156,156,
+	245,245,245,245,245,245,245,245,231,231,231,231,231,231,231,231,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,
+	157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,
+	157,157,157,157,157,157,157,157,157,157,305,305,305,305,305,305,
+	35,35,35,35,35,35,35,35,144,144,144,144,144,144,144,144,
+	233,233,233,233,233,233,233,233,219,219,219,219,219,219,219,219,
+	38,38,38,38,38,38,38,38,147,147,147,147,147,147,147,147,
+	236,236,236,236,236,236,236,236,222,222,222,222,222,222,222,222,
+	36,36,36,36,36,36,36,36,145,145,145,145,145,145,145,145,
+	234,234,234,234,234,234,234,234,220,220,220,220,220,220,220,220,
+	39,39,39,39,39,39,39,39,148,148,148,148,148,148,148,148,
+	237,237,237,237,237,237,237,237,223,223,223,223,223,223,223,223,
+	37,37,37,37,37,37,37,37,146,146,146,146,146,146,146,146,
+	235,235,235,235,235,235,235,235,221,221,221,221,221,221,221,221,
+	40,40,40,40,40,40,40,40,149,149,149,149,149,149,149,149,
+	238,238,238,238,238,238,238,238,224,224,224,224,224,224,224,224,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	239,239,239,239,239,239,239,239,239,239,239,239,239,239,239,239,
+	239,239,239,239,239,239,239,239,239,239,239,239,239,239,239,239,
+	239,239,239,239,239,239,239,239,239,239,305,305,305,305,305,305,
+	42,42,42,42,42,42,42,42,151,151,151,151,151,151,151,151,
+	240,240,240,240,240,240,240,240,226,226,226,226,226,226,226,226,
+	45,45,45,45,45,45,45,45,154,154,154,154,154,154,154,154,
+	243,243,243,243,243,243,243,243,229,229,229,229,229,229,229,229,
+	43,43,43,43,43,43,43,43,152,152,152,152,152,152,152,152,
+	241,241,241,241,241,241,241,241,227,227,227,227,227,227,227,227,
+	46,46,46,46,46,46,46,46,155,155,155,155,155,155,155,155,
+	244,244,244,244,244,244,244,244,230,230,230,230,230,230,230,230,
+	44,44,44,44,44,44,44,44,153,153,153,153,153,153,153,153,
+	242,242,242,242,242,242,242,242,228,228,228,228,228,228,228,228,
+	47,47,47,47,47,47,47,47,156,156,156,156,156,156,156,156,
+	245,245,245,245,245,245,245,245,231,231,231,231,231,231,231,231,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,
+	246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,
+	246,246,246,246,246,246,246,246,246,246,305,305,305,305,305,305,
+	35,35,35,35,35,35,35,35,144,144,144,144,144,144,144,144,
+	233,233,233,233,233,233,233,233,219,219,219,219,219,219,219,219,
+	38,38,38,38,38,38,38,38,147,147,147,147,147,147,147,147,
+	236,236,236,236,236,236,236,236,222,222,222,222,222,222,222,222,
+	36,36,36,36,36,36,36,36,145,145,145,145,145,145,145,145,
+	234,234,234,234,234,234,234,234,220,220,220,220,220,220,220,220,
+	39,39,39,39,39,39,39,39,148,148,148,148,148,148,148,148,
+	237,237,237,237,237,237,237,237,223,223,223,223,223,223,223,223,
+	37,37,37,37,37,37,37,37,146,146,146,146,146,146,146,146,
+	235,235,235,235,235,235,235,235,221,221,221,221,221,221,221,221,
+	40,40,40,40,40,40,40,40,149,149,149,149,149,149,149,149,
+	238,238,238,238,238,238,238,238,224,224,224,224,224,224,224,224,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+	225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+	225,225,225,225,225,225,225,225,225,225,305,305,305,305,305,305,
+	42,42,42,42,42,42,42,42,151,151,151,151,151,151,151,151,
+	240,240,240,240,240,240,240,240,226,226,226,226,226,226,226,226,
+	45,45,45,45,45,45,45,45,154,154,154,154,154,154,154,154,
+	243,243,243,243,243,243,243,243,229,229,229,229,229,229,229,229,
+	43,43,43,43,43,43,43,43,152,152,152,152,152,152,152,152,
+	241,241,241,241,241,241,241,241,227,227,227,227,227,227,227,227,
+	46,46,46,46,46,46,46,46,155,155,155,155,155,155,155,155,
+	244,244,244,244,244,244,244,244,230,230,230,230,230,230,230,230,
+	44,44,44,44,44,44,44,44,153,153,153,153,153,153,153,153,
+	242,242,242,242,242,242,242,242,228,228,228,228,228,228,228,228,
+	47,47,47,47,47,47,47,47,156,156,156,156,156,156,156,156,
+	245,245,245,245,245,245,245,245,231,231,231,231,231,231,231,231,
+	305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+	232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,
+	232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,
+	232,232,232,232,232,232,232,232,232,232,305,305,305,305,305,305,
+	35,35,35,35,35,35,35,35,144,144,144,144,144,144,144,144,
+	233,233,233,233,233,233,233,233,219,219,219,219,219,219,219,219,
+	38,38,38,38,38,38,38,38,147,147,147,147,147,147,147,147,
+	236,236,236,236,236,236,236,236,222,222,222,222,222,222,222,222,
+	36,36,36,36,36,36,36,36,145,145,145,145,145,145,145,145,
+	234,234,234,234,234,234,234,234,220,220,220,220,220,220,220,220,
+	39,39,39,39,39,39,39,39,148,148,148,148,148,148,148,148,
+	237,237,237,237,237,237,237,237,223,223,223,223,223,223,223,223,
+	37,37,37,37,37,37,37,37,146,146,146,146,146,146,146,146,
+	235,235,235,235,235,235,235,235,221,221,221,221,221,221,221,221,
+	40,40,40,40,40,40,40,40,149,149,149,149,149,149,149,149,
+	238,238,238,238,238,238,238,238,224,224,224,224,224,224,224,224,
+	63,63,63,63,63,63,63,63,305,305,305,305,305,305,305,305,
+	63,63,63,63,63,63,63,63,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,63,63,63,63,63,63,63,63,
+	63,63,63,63,63,63,63,63,63,63,63,63,305,305,305,305,
+	42,42,42,42,42,42,42,42,151,151,151,151,151,151,151,151,
+	240,240,240,240,240,240,240,240,226,226,226,226,226,226,226,226,
+	45,45,45,45,45,45,45,45,154,154,154,154,154,154,154,154,
+	243,243,243,243,243,243,243,243,229,229,229,229,229,229,229,229,
+	43,43,43,43,43,43,43,43,152,152,152,152,152,152,152,152,
+	241,241,241,241,241,241,241,241,227,227,227,227,227,227,227,227,
+	46,46,46,46,46,46,46,46,155,155,155,155,155,155,155,155,
+	244,244,244,244,244,244,244,244,230,230,230,230,230,230,230,230,
+	44,44,44,44,44,44,44,44,153,153,153,153,153,153,153,153,
+	242,242,242,242,242,242,242,242,228,228,228,228,228,228,228,228,
+	47,47,47,47,47,47,47,47,156,156,156,156,156,156,156,156,
+	245,245,245,245,245,245,245,245,231,231,231,231,231,231,231,231,
+	59,59,59,59,59,59,59,59,305,305,305,305,305,305,305,305,
+	59,59,59,59,59,59,59,59,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,305,305,305,305,
+	35,35,35,35,35,35,35,35,144,144,144,144,144,144,144,144,
+	233,233,233,233,233,233,233,233,219,219,219,219,219,219,219,219,
+	38,38,38,38,38,38,38,38,147,147,147,147,147,147,147,147,
+	236,236,236,236,236,236,236,236,222,222,222,222,222,222,222,222,
+	36,36,36,36,36,36,36,36,145,145,145,145,145,145,145,145,
+	234,234,234,234,234,234,234,234,220,220,220,220,220,220,220,220,
+	39,39,39,39,39,39,39,39,148,148,148,148,148,148,148,148,
+	237,237,237,237,237,237,237,237,223,223,223,223,223,223,223,223,
+	37,37,37,37,37,37,37,37,146,146,146,146,146,146,146,146,
+	235,235,235,235,235,235,235,235,221,221,221,221,221,221,221,221,
+	40,40,40,40,40,40,40,40,149,149,149,149,149,149,149,149,
+	238,238,238,238,238,238,238,238,224,224,224,224,224,224,224,224,
+	56,56,56,56,56,56,56,56,305,305,305,305,305,305,305,305,
+	56,56,56,56,56,56,56,56,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,56,56,56,56,56,56,56,56,
+	56,56,56,56,56,56,56,56,56,56,305,305,305,305,305,305,
+	42,42,42,42,42,42,42,42,151,151,151,151,151,151,151,151,
+	240,240,240,240,240,240,240,240,226,226,226,226,226,226,226,226,
+	45,45,45,45,45,45,45,45,154,154,154,154,154,154,154,154,
+	243,243,243,243,243,243,243,243,229,229,229,229,229,229,229,229,
+	43,43,43,43,43,43,43,43,152,152,152,152,152,152,152,152,
+	241,241,241,241,241,241,241,241,227,227,227,227,227,227,227,227,
+	46,46,46,46,46,46,46,46,155,155,155,155,155,155,155,155,
+	244,244,244,244,244,244,244,244,230,230,230,230,230,230,230,230,
+	44,44,44,44,44,44,44,44,153,153,153,153,153,153,153,153,
+	242,242,242,242,242,242,242,242,228,228,228,228,228,228,228,228,
+	47,47,47,47,47,47,47,47,156,156,156,156,156,156,156,156,
+	245,245,245,245,245,245,245,245,231,231,231,231,231,231,231,231,
+	58,58,58,58,58,58,58,58,305,305,305,305,305,305,305,305,
+	58,58,58,58,58,58,58,58,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,58,58,58,58,58,58,58,58,
+	58,58,58,58,58,58,58,58,58,58,58,58,305,305,305,305,
+	35,35,35,35,35,35,35,35,144,144,144,144,144,144,144,144,
+	233,233,233,233,233,233,233,233,219,219,219,219,219,219,219,219,
+	38,38,38,38,38,38,38,38,147,147,147,147,147,147,147,147,
+	236,236,236,236,236,236,236,236,222,222,222,222,222,222,222,222,
+	36,36,36,36,36,36,36,36,145,145,145,145,145,145,145,145,
+	234,234,234,234,234,234,234,234,220,220,220,220,220,220,220,220,
+	39,39,39,39,39,39,39,39,148,148,148,148,148,148,148,148,
+	237,237,237,237,237,237,237,237,223,223,223,223,223,223,223,223,
+	37,37,37,37,37,37,37,37,146,146,146,146,146,146,146,146,
+	235,235,235,235,235,235,235,235,221,221,221,221,221,221,221,221,
+	40,40,40,40,40,40,40,40,149,149,149,149,149,149,149,149,
+	238,238,238,238,238,238,238,238,224,224,224,224,224,224,224,224,
+	57,57,57,57,57,57,57,57,305,305,305,305,305,305,305,305,
+	57,57,57,57,57,57,57,57,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,57,57,57,57,57,57,57,57,
+	57,57,57,57,57,57,57,57,57,57,305,305,305,305,305,305,
+	42,42,42,42,42,42,42,42,151,151,151,151,151,151,151,151,
+	240,240,240,240,240,240,240,240,226,226,226,226,226,226,226,226,
+	45,45,45,45,45,45,45,45,154,154,154,154,154,154,154,154,
+	243,243,243,243,243,243,243,243,229,229,229,229,229,229,229,229,
+	43,43,43,43,43,43,43,43,152,152,152,152,152,152,152,152,
+	241,241,241,241,241,241,241,241,227,227,227,227,227,227,227,227,
+	46,46,46,46,46,46,46,46,155,155,155,155,155,155,155,155,
+	244,244,244,244,244,244,244,244,230,230,230,230,230,230,230,230,
+	44,44,44,44,44,44,44,44,153,153,153,153,153,153,153,153,
+	242,242,242,242,242,242,242,242,228,228,228,228,228,228,228,228,
+	47,47,47,47,47,47,47,47,156,156,156,156,156,156,156,156,
+	245,245,245,245,245,245,245,245,231,231,231,231,231,231,231,231,
+	60,60,60,60,60,60,60,60,305,305,305,305,305,305,305,305,
+	60,60,60,60,60,60,60,60,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,305,305,305,305,
+	35,35,35,35,35,35,35,35,144,144,144,144,144,144,144,144,
+	233,233,233,233,233,233,233,233,219,219,219,219,219,219,219,219,
+	38,38,38,38,38,38,38,38,147,147,147,147,147,147,147,147,
+	236,236,236,236,236,236,236,236,222,222,222,222,222,222,222,222,
+	36,36,36,36,36,36,36,36,145,145,145,145,145,145,145,145,
+	234,234,234,234,234,234,234,234,220,220,220,220,220,220,220,220,
+	39,39,39,39,39,39,39,39,148,148,148,148,148,148,148,148,
+	237,237,237,237,237,237,237,237,223,223,223,223,223,223,223,223,
+	37,37,37,37,37,37,37,37,146,146,146,146,146,146,146,146,
+	235,235,235,235,235,235,235,235,221,221,221,221,221,221,221,221,
+	40,40,40,40,40,40,40,40,149,149,149,149,149,149,149,149,
+	238,238,238,238,238,238,238,238,224,224,224,224,224,224,224,224,
+	62,62,62,62,62,62,62,62,305,305,305,305,305,305,305,305,
+	62,62,62,62,62,62,62,62,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,62,62,62,62,62,62,62,62,
+	62,62,62,62,62,62,62,62,62,62,305,305,305,305,305,305,
+	42,42,42,42,42,42,42,42,151,151,151,151,151,151,151,151,
+	240,240,240,240,240,240,240,240,226,226,226,226,226,226,226,226,
+	45,45,45,45,45,45,45,45,154,154,154,154,154,154,154,154,
+	243,243,243,243,243,243,243,243,229,229,229,229,229,229,229,229,
+	43,43,43,43,43,43,43,43,152,152,152,152,152,152,152,152,
+	241,241,241,241,241,241,241,241,227,227,227,227,227,227,227,227,
+	46,46,46,46,46,46,46,46,155,155,155,155,155,155,155,155,
+	244,244,244,244,244,244,244,244,230,230,230,230,230,230,230,230,
+	44,44,44,44,44,44,44,44,153,153,153,153,153,153,153,153,
+	242,242,242,242,242,242,242,242,228,228,228,228,228,228,228,228,
+	47,47,47,47,47,47,47,47,156,156,156,156,156,156,156,156,
+	245,245,245,245,245,245,245,245,231,231,231,231,231,231,231,231,
+	61,61,61,61,61,61,61,61,305,305,305,305,305,305,305,305,
+	61,61,61,61,61,61,61,61,305,305,305,305,305,305,305,305,
+	305,305,305,305,305,305,305,305,61,61,61,61,61,61,61,61,
+	61,61,61,61,61,61,61,61,61,61,305,305,305,305,305,305,
+	300,300,300,300,300,300,300,300,300,300,300,300,300,300,300,300,
+	300,300,300,300,300,300,300,300,300,300,300,300,300,300,300,300,
+	300,300,300,300,300,300,300,300,300,300,300,300,300,300,300,300,
+	300,300,300,300,300,300,300,300,300,300,300,300,300,300,300,300,
+	304,304,304,304,304,304,304,304,303,303,303,303,303,303,303,303,
+	304,304,304,304,304,304,304,304,304,304,304,304,304,304,304,304,
+	304,304,304,304,304,304,304,304,304,304,304,304,304,304,304,304,
+	304,304,304,304,304,304,304,304,304,304,115,116,114,304,304,304,
+	301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,
+	301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,
+	301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,
+	301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,
+	302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,
+	302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,
+	302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,
+	302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	112,112,112,112,112,112,112,112,1,1,1,1,1,1,1,1,
+	112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,
+	112,112,112,112,112,112,112,112,112,112,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,
+	1,1,1,1,1,1,1,1,111,111,111,111,111,111,111,111,
+	111,111,111,111,111,111,111,111,111,111,111,111,111,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,
+	137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,
+	137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,
+	137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,
+	113,113,113,113,113,113,113,113,109,109,109,109,109,109,109,109,
+	113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
+	113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
+	113,113,113,113,113,113,113,113,113,113,115,116,114,1,1,1,
+	107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+	107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+	107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+	107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+	108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+	108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+	108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+	108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	112,112,112,112,112,112,112,112,1,1,1,1,1,1,1,1,
+	112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,
+	112,112,112,112,112,112,112,112,112,112,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,
+	1,1,1,1,1,1,1,1,111,111,111,111,111,111,111,111,
+	111,111,111,111,111,111,111,111,111,111,111,111,111,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
+	86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
+	117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,
+	117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,
+	86,86,86,86,86,86,86,86,109,109,109,109,109,109,109,109,
+	86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
+	117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,
+	117,117,117,117,117,117,117,117,117,117,115,116,114,117,117,117,
+	86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
+	86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
+	117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,
+	117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,
+	86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
+	86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
+	117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,
+	117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,
+	217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,
+	217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,
+	112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,
+	112,112,112,112,112,112,112,112,112,112,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,
+	1,1,1,1,1,1,1,1,111,111,111,111,111,111,111,111,
+	111,111,111,111,111,111,111,111,111,111,111,111,111,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	185,185,185,185,185,185,185,185,186,186,186,186,186,186,186,186,
+	187,187,187,187,187,187,187,187,188,188,188,188,188,188,188,188,
+	184,184,184,184,184,184,184,184,110,110,110,110,110,110,110,110,
+	110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+	113,113,113,113,113,113,113,113,109,109,109,109,109,109,109,109,
+	113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
+	113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
+	113,113,113,113,113,113,113,113,113,113,115,116,114,1,1,1,
+	107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+	107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+	107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+	107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+	108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+	108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+	108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+	108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	112,112,112,112,112,112,112,112,1,1,1,1,1,1,1,1,
+	112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,
+	112,112,112,112,112,112,112,112,112,112,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,
+	1,1,1,1,1,1,1,1,111,111,111,111,111,111,111,111,
+	111,111,111,111,111,111,111,111,111,111,111,111,111,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+	110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+	110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+	110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+	113,113,113,113,113,113,113,113,109,109,109,109,109,109,109,109,
+	113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
+	113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
+	113,113,113,113,113,113,113,113,113,113,115,116,114,1,1,1,
+	107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+	107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+	107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+	107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+	108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+	108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+	108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+	108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	112,112,112,112,112,112,112,112,1,1,1,1,1,1,1,1,
+	112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,
+	112,112,112,112,112,112,112,112,112,112,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,
+	1,1,1,1,1,1,1,1,111,111,111,111,111,111,111,111,
+	111,111,111,111,111,111,111,111,111,111,111,111,111,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+	110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+	110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+	110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+	113,113,113,113,113,113,113,113,109,109,109,109,109,109,109,109,
+	113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
+	113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
+	113,113,113,113,113,113,113,113,113,113,115,116,114,1,1,1,
+	107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+	107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+	107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+	107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+	108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+	108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+	108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+	108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	112,112,112,112,112,112,112,112,1,1,1,1,1,1,1,1,
+	112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,
+	112,112,112,112,112,112,112,112,112,112,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,
+	1,1,1,1,1,1,1,1,111,111,111,111,111,111,111,111,
+	111,111,111,111,111,111,111,111,111,111,111,111,111,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+	110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+	110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+	110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+	113,113,113,113,113,113,113,113,109,109,109,109,109,109,109,109,
+	113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
+	113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
+	113,113,113,113,113,113,113,113,113,113,115,116,114,1,1,1,
+	107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+	107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+	107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+	107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+	108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+	108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+	108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+	108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	112,112,112,112,112,112,112,112,1,1,1,1,1,1,1,1,
+	112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,
+	112,112,112,112,112,112,112,112,112,112,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,
+	1,1,1,1,1,1,1,1,111,111,111,111,111,111,111,111,
+	111,111,111,111,111,111,111,111,111,111,111,111,111,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+	110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+	110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+	110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+	113,113,113,113,113,113,113,113,109,109,109,109,109,109,109,109,
+	113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
+	113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
+	113,113,113,113,113,113,113,113,113,113,115,116,114,1,1,1,
+	107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+	107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+	107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+	107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+	108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+	108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+	108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+	108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	112,112,112,112,112,112,112,112,1,1,1,1,1,1,1,1,
+	112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,
+	112,112,112,112,112,112,112,112,112,112,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,
+	1,1,1,1,1,1,1,1,111,111,111,111,111,111,111,111,
+	111,111,111,111,111,111,111,111,111,111,111,111,111,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+};
+
+static const unsigned char g_valid_instructions[VALID_GROUP_COUNT][0x10000 / 8] =
+{
+	{
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x0f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0x00,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0x00,0xff,0xff,0xff,0x03,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0xff,0xff,0x00,0xff,0xff,0x0f,0x00,0x00,0xff,0xff,0x00,0xff,0xff,0x0f,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x00,
+		0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe3,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+	},
+	{
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x0f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0x00,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0x00,0xff,0xff,0xff,0x03,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0xff,0xff,0x00,0xff,0xff,0x0f,0x00,0x00,0xff,0xff,0x00,0xff,0xff,0x0f,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x0c,
+		0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe3,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+	},
+	{
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x0f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x0f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x0f,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x13,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x13,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0x00,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0x00,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0x00,0x00,0xff,0xff,0x00,0xff,0xff,0x0f,0x00,0x00,0xff,0xff,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x0c,
+		0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe3,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+	},
+	{
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x0f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x0f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x0f,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x13,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x13,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0x00,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0x00,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0x00,0x00,0xff,0xff,0x00,0xff,0xff,0x0f,0x00,0x00,0xff,0xff,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x0c,
+		0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe3,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+	},
+	{
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x0f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x0f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x0f,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x13,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x13,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0x00,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0x00,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0x00,0x00,0xff,0xff,0x00,0xff,0xff,0x0f,0x00,0x00,0xff,0xff,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x0c,
+		0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe3,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xe3,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0x00,0xff,0x00,0x00,0x00,0xfc,0xff,0xff,0x00,0x00,0xff,0x00,0x00,0xe0,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+	},
+	{
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x0f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x13,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x0f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x0f,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x13,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x13,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0x00,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0x00,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0x00,0x00,0xff,0xff,0x00,0xff,0xff,0x0f,0x00,0x00,0xff,0xff,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x0c,
+		0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0x00,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x0f,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0x00,0x00,0xff,0xff,0x03,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+		0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+	},
+};
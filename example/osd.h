@@ -4,5 +4,6 @@
 void changemode(int dir);
 int kbhit(void);
 int osd_get_char(void);
+unsigned long long osd_nanoseconds(void);
 
 #endif /* HEADER__OSD */
@@ -14,3 +14,10 @@ int osd_get_char(void)
 	}
 	return ch;
 }
+
+/* Host time, for measuring the simulator itself */
+#include <time.h>
+unsigned long long osd_nanoseconds(void)
+{
+	return (unsigned long long)clock() * 1000000000ull / CLOCKS_PER_SEC;
+}
@@ -49,3 +49,11 @@ int osd_get_char() {
     return ch;
 }
 
+
+/* Monotonic host time, for measuring the simulator itself */
+unsigned long long osd_nanoseconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
@@ -0,0 +1,586 @@
+/* Sampling PC profiler for the simulator.
+ *
+ * The CPU reports the PC every few hundred cycles (M68K_SAMPLE_PC), which
+ * costs far less than looking at every instruction through the instruction
+ * hook.  Samples are counted per address in a hash table.  For the call
+ * stacks, the stack above A7 is searched for return addresses, values that
+ * point just behind a bsr or jsr.  Without frame pointers this is a guess:
+ * a stale return address left on the stack shows up as an extra caller.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "m68k.h"
+#include "pcsample.h"
+
+#define MAX_STACK_DEPTH  16
+#define STACK_SCAN_BYTES 256
+#define MIN_TABLE_SLOTS  1024     /* Power of 2 */
+#define MAX_FOLDED_LINE  4096
+
+#define READ_LONG(BASE, ADDR) (((unsigned int)(BASE)[ADDR]<<24) |	\
+							  ((BASE)[(ADDR)+1]<<16) |		\
+							  ((BASE)[(ADDR)+2]<<8) |		\
+							  (BASE)[(ADDR)+3])
+
+/* ELF section and symbol types */
+#define SHT_SYMTAB  2
+#define STT_NOTYPE  0
+#define STT_FUNC    2
+
+typedef struct
+{
+	unsigned int  address;
+	unsigned long count;      /* 0 for an empty slot */
+} pc_count;
+
+typedef struct
+{
+	unsigned int  depth;
+	unsigned int  frames[MAX_STACK_DEPTH]; /* The sampled PC, then the return addresses */
+	unsigned long count;      /* 0 for an empty slot */
+} stack_count;
+
+typedef struct
+{
+	unsigned int address;
+	unsigned int order;       /* Load order, to sort symbols at the same address */
+	char*        name;
+} symbol;
+
+typedef struct
+{
+	char*         text;
+	unsigned long count;
+} folded_line;
+
+static const unsigned char* g_memory;
+static unsigned int         g_memory_size;
+static unsigned int         g_period;
+static unsigned long        g_samples;
+static unsigned long        g_dropped;   /* Samples lost for want of memory */
+static m68k_dasm_context    g_dasm;
+
+static pc_count*    g_pcs;
+static unsigned int g_pc_slots;
+static unsigned int g_pc_used;
+static stack_count* g_stacks;
+static unsigned int g_stack_slots;
+static unsigned int g_stack_used;
+static symbol*      g_symbols;
+static unsigned int g_symbol_count;
+
+
+/* ------------------------------- Sampling ------------------------------- */
+
+/* The top bits of the product, which depend on every bit of address:
+ * (address * 2654435761u) >> (32 - log2(slots)) for a power of 2 slots
+ */
+static unsigned int hash_pc(unsigned int address, unsigned int slots)
+{
+	return (unsigned int)(((unsigned long long)(address * 2654435761u) * slots) >> 32);
+}
+
+static unsigned int hash_stack(const unsigned int* frames, unsigned int depth)
+{
+	unsigned int hash = 2166136261u ^ depth;
+	unsigned int i;
+
+	for(i = 0; i < depth; i++)
+		hash = (hash ^ frames[i]) * 16777619u;
+	return hash;
+}
+
+static unsigned int find_pc(const pc_count* table, unsigned int slots, unsigned int address)
+{
+	unsigned int i = hash_pc(address, slots);
+
+	while(table[i].count != 0 && table[i].address != address)
+		i = (i + 1) & (slots - 1);
+	return i;
+}
+
+static unsigned int find_stack(const stack_count* table, unsigned int slots, const unsigned int* frames, unsigned int depth)
+{
+	unsigned int i = hash_stack(frames, depth) & (slots - 1);
+
+	while(table[i].count != 0 &&
+		  (table[i].depth != depth || memcmp(table[i].frames, frames, depth * sizeof(*frames)) != 0))
+		i = (i + 1) & (slots - 1);
+	return i;
+}
+
+/* Double a table once it is three quarters full.  Returns 0 if there is no
+ * room for another entry.
+ */
+static int grow_pcs(void)
+{
+	unsigned int slots = g_pc_slots ? g_pc_slots * 2 : MIN_TABLE_SLOTS;
+	pc_count* table;
+	unsigned int i;
+
+	if(g_pc_used * 4 < g_pc_slots * 3)
+		return 1;
+	if((table = calloc(slots, sizeof(*table))) == NULL)
+		return g_pc_slots != 0 && g_pc_used < g_pc_slots - 1;
+	for(i = 0; i < g_pc_slots; i++)
+		if(g_pcs[i].count != 0)
+			table[find_pc(table, slots, g_pcs[i].address)] = g_pcs[i];
+	free(g_pcs);
+	g_pcs = table;
+	g_pc_slots = slots;
+	return 1;
+}
+
+static int grow_stacks(void)
+{
+	unsigned int slots = g_stack_slots ? g_stack_slots * 2 : MIN_TABLE_SLOTS;
+	stack_count* table;
+	unsigned int i;
+
+	if(g_stack_used * 4 < g_stack_slots * 3)
+		return 1;
+	if((table = calloc(slots, sizeof(*table))) == NULL)
+		return g_stack_slots != 0 && g_stack_used < g_stack_slots - 1;
+	for(i = 0; i < g_stack_slots; i++)
+		if(g_stacks[i].count != 0)
+			table[find_stack(table, slots, g_stacks[i].frames, g_stacks[i].depth)] = g_stacks[i];
+	free(g_stacks);
+	g_stacks = table;
+	g_stack_slots = slots;
+	return 1;
+}
+
+/* True if a bsr or jsr ends just before address */
+static int is_return_address(unsigned int address)
+{
+	m68k_dasm_instruction insn;
+	unsigned int length;
+
+	if((address & 1) || address > g_memory_size)
+		return 0;
+	for(length = 2; length <= 6 && length <= address; length += 2)
+		if(m68k_dasm_decode(&g_dasm, address - length, &insn, NULL) == length &&
+		   (insn.flags & M68K_DASM_FLAG_CALL))
+			return 1;
+	return 0;
+}
+
+static unsigned int walk_stack(unsigned int pc, unsigned int* frames)
+{
+	unsigned int sp = m68k_get_reg(NULL, M68K_REG_A7) & ~1;
+	unsigned int end = sp + STACK_SCAN_BYTES;
+	unsigned int depth = 0;
+
+	frames[depth++] = pc;
+	if(end > g_memory_size || end < sp)
+		end = g_memory_size;
+	for(; sp + 4 <= end && depth < MAX_STACK_DEPTH; sp += 2)
+	{
+		unsigned int value = READ_LONG(g_memory, sp);
+
+		if(is_return_address(value))
+		{
+			frames[depth++] = value;
+			sp += 2;
+		}
+	}
+	return depth;
+}
+
+static void take_sample(unsigned int pc)
+{
+	unsigned int frames[MAX_STACK_DEPTH];
+	unsigned int depth;
+	unsigned int i;
+
+	g_samples++;
+	if(!grow_pcs() || !grow_stacks())
+	{
+		g_dropped++;
+		return;
+	}
+	i = find_pc(g_pcs, g_pc_slots, pc);
+	if(g_pcs[i].count++ == 0)
+	{
+		g_pcs[i].address = pc;
+		g_pc_used++;
+	}
+
+	depth = walk_stack(pc, frames);
+	i = find_stack(g_stacks, g_stack_slots, frames, depth);
+	if(g_stacks[i].count++ == 0)
+	{
+		g_stacks[i].depth = depth;
+		memcpy(g_stacks[i].frames, frames, depth * sizeof(*frames));
+		g_stack_used++;
+	}
+}
+
+void pc_sample_start(unsigned int period, const unsigned char* memory, unsigned int size)
+{
+	g_memory = memory;
+	g_memory_size = size;
+	g_period = period;
+	m68k_dasm_init_context(&g_dasm, M68K_CPU_TYPE_68000);
+	m68k_dasm_set_buffer(&g_dasm, memory, 0, size);
+	m68k_set_pc_sample_callback(take_sample);
+	m68k_set_pc_sample_period(period);
+}
+
+
+/* -------------------------------- Symbols ------------------------------- */
+
+static int compare_symbols(const void* a, const void* b)
+{
+	const symbol* x = a;
+	const symbol* y = b;
+
+	if(x->address != y->address)
+		return x->address < y->address ? -1 : 1;
+	return x->order < y->order ? -1 : x->order > y->order;
+}
+
+static int add_symbol(unsigned int address, const char* name, unsigned int length)
+{
+	static unsigned int allocated = 0;
+	symbol* sym;
+
+	if(g_symbol_count == allocated)
+	{
+		unsigned int count = allocated ? allocated * 2 : 256;
+		symbol* symbols = realloc(g_symbols, count * sizeof(*symbols));
+
+		if(symbols == NULL)
+			return 0;
+		g_symbols = symbols;
+		allocated = count;
+	}
+	sym = &g_symbols[g_symbol_count];
+	if((sym->name = malloc(length + 1)) == NULL)
+		return 0;
+	memcpy(sym->name, name, length);
+	sym->name[length] = '\0';
+	sym->address = address;
+	sym->order = g_symbol_count;
+	g_symbol_count++;
+	return 1;
+}
+
+static unsigned int elf_get(const unsigned char* p, unsigned int size, int big_endian)
+{
+	unsigned int value = 0;
+	unsigned int i;
+
+	for(i = 0; i < size; i++)
+		value |= (unsigned int)p[big_endian ? i : size - 1 - i] << ((size - 1 - i) * 8);
+	return value;
+}
+
+/* Functions and untyped labels from the symbol tables of a 32-bit ELF file */
+static int load_elf_symbols(const unsigned char* data, unsigned long size)
+{
+	int big_endian = data[5] == 2;
+	unsigned int shoff;
+	unsigned int shentsize;
+	unsigned int shnum;
+	unsigned int i;
+	unsigned int j;
+
+	if(size < 52 || data[4] != 1)
+		return 0;
+	shoff = elf_get(data + 0x20, 4, big_endian);
+	shentsize = elf_get(data + 0x2e, 2, big_endian);
+	shnum = elf_get(data + 0x30, 2, big_endian);
+	if(shentsize < 40 || shoff > size || shnum > (size - shoff) / shentsize)
+		return 0;
+
+	for(i = 0; i < shnum; i++)
+	{
+		const unsigned char* sh = data + shoff + i * shentsize;
+		const unsigned char* strtab_sh;
+		unsigned int offset = elf_get(sh + 16, 4, big_endian);
+		unsigned int length = elf_get(sh + 20, 4, big_endian);
+		unsigned int link = elf_get(sh + 24, 4, big_endian);
+		unsigned int str_offset;
+		unsigned int str_length;
+
+		if(elf_get(sh + 4, 4, big_endian) != SHT_SYMTAB || link >= shnum ||
+		   offset > size || length > size - offset)
+			continue;
+		strtab_sh = data + shoff + link * shentsize;
+		str_offset = elf_get(strtab_sh + 16, 4, big_endian);
+		str_length = elf_get(strtab_sh + 20, 4, big_endian);
+		if(str_offset > size || str_length > size - str_offset)
+			continue;
+
+		for(j = 0; j + 16 <= length; j += 16)
+		{
+			const unsigned char* st = data + offset + j;
+			unsigned int name = elf_get(st, 4, big_endian);
+			unsigned int type = st[12] & 0xf;
+			const char* text = (const char*)data + str_offset + name;
+			unsigned int name_length;
+
+			if((type != STT_FUNC && type != STT_NOTYPE) || elf_get(st + 14, 2, big_endian) == 0 ||
+			   name == 0 || name >= str_length)
+				continue;
+			name_length = strnlen(text, str_length - name);
+			if(!add_symbol(elf_get(st + 4, 4, big_endian), text, name_length))
+				return 0;
+		}
+	}
+	return 1;
+}
+
+/* Lines of "<hex address> <name>" or "<hex address> <type> <name>" */
+static int load_text_symbols(const char* data, unsigned long size)
+{
+	const char* line = data;
+	const char* end = data + size;
+
+	while(line < end)
+	{
+		const char* next = memchr(line, '\n', end - line);
+		char buff[512];
+		char address[64];
+		char field[256];
+		char name[256];
+		char* rest;
+		unsigned long value;
+		unsigned int length = (next ? next : end) - line;
+		int fields;
+
+		if(length >= sizeof(buff))
+			length = sizeof(buff) - 1;
+		memcpy(buff, line, length);
+		buff[length] = '\0';
+		line = next ? next + 1 : end;
+
+		fields = sscanf(buff, "%63s %255s %255s", address, field, name);
+		if(fields < 2 || address[0] == '#')
+			continue;
+		value = strtoul(address, &rest, 16);
+		if(*rest != '\0')
+			continue;
+		if(fields == 2)
+			strcpy(name, field);
+		if(!add_symbol(value, name, strlen(name)))
+			return 0;
+	}
+	return 1;
+}
+
+int pc_sample_load_symbols(const char* filename)
+{
+	FILE* file;
+	unsigned char* data;
+	long size;
+	int ok;
+
+	if((file = fopen(filename, "rb")) == NULL)
+		return 0;
+	if(fseek(file, 0, SEEK_END) != 0 || (size = ftell(file)) < 0 || fseek(file, 0, SEEK_SET) != 0 ||
+	   (data = malloc(size + 1)) == NULL)
+	{
+		fclose(file);
+		return 0;
+	}
+	ok = fread(data, 1, size, file) == (size_t)size;
+	fclose(file);
+	if(ok)
+	{
+		if(size >= 16 && memcmp(data, "\177ELF", 4) == 0)
+			ok = load_elf_symbols(data, size);
+		else
+			ok = load_text_symbols((const char*)data, size);
+	}
+	free(data);
+	qsort(g_symbols, g_symbol_count, sizeof(*g_symbols), compare_symbols);
+	return ok;
+}
+
+/* The symbol at or below address, or NULL */
+static const symbol* find_symbol(unsigned int address)
+{
+	unsigned int low = 0;
+	unsigned int high = g_symbol_count;
+
+	while(low < high)
+	{
+		unsigned int mid = (low + high) / 2;
+
+		if(g_symbols[mid].address <= address)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	return low ? &g_symbols[low - 1] : NULL;
+}
+
+static const char* location_name(unsigned int address, int with_offset, char* buff)
+{
+	const symbol* sym = find_symbol(address);
+
+	if(sym == NULL)
+		sprintf(buff, "0x%05x", address);
+	else if(with_offset && sym->address != address)
+		sprintf(buff, "%.200s+0x%x", sym->name, address - sym->address);
+	else
+		return sym->name;
+	return buff;
+}
+
+const char* pc_sample_location_name(unsigned int address, char* buff)
+{
+	return location_name(address, 1, buff);
+}
+
+
+/* -------------------------------- Output -------------------------------- */
+
+static int compare_pc_counts(const void* a, const void* b)
+{
+	const pc_count* x = a;
+	const pc_count* y = b;
+
+	if(x->count != y->count)
+		return x->count > y->count ? -1 : 1;
+	return x->address < y->address ? -1 : x->address > y->address;
+}
+
+static double percent(unsigned long count)
+{
+	return g_samples ? count * 100.0 / g_samples : 0.0;
+}
+
+int pc_sample_write_report(const char* filename)
+{
+	FILE* file;
+	pc_count* pcs;
+	pc_count* functions;
+	unsigned int count = 0;
+	unsigned int function_count = 0;
+	unsigned int i;
+	char buff[256];
+	int ok;
+
+	if((pcs = malloc((g_pc_used + 1) * sizeof(*pcs))) == NULL)
+		return 0;
+	if((functions = malloc((g_pc_used + 1) * sizeof(*functions))) == NULL)
+	{
+		free(pcs);
+		return 0;
+	}
+	for(i = 0; i < g_pc_slots; i++)
+		if(g_pcs[i].count != 0)
+			pcs[count++] = g_pcs[i];
+
+	/* Add up the addresses of each function, keyed by its start */
+	qsort(pcs, count, sizeof(*pcs), compare_pc_counts);
+	for(i = 0; i < count; i++)
+	{
+		const symbol* sym = find_symbol(pcs[i].address);
+		unsigned int j;
+
+		if(sym == NULL)
+			continue;
+		for(j = 0; j < function_count && functions[j].address != sym->address; j++)
+			;
+		if(j == function_count)
+		{
+			functions[function_count].address = sym->address;
+			functions[function_count++].count = 0;
+		}
+		functions[j].count += pcs[i].count;
+	}
+	qsort(functions, function_count, sizeof(*functions), compare_pc_counts);
+
+	if((file = fopen(filename, "w")) == NULL)
+	{
+		free(pcs);
+		free(functions);
+		return 0;
+	}
+	fprintf(file, "# %lu samples, one every %u cycles", g_samples, g_period);
+	if(g_dropped)
+		fprintf(file, ", %lu dropped for lack of memory", g_dropped);
+	fprintf(file, "\n");
+	if(function_count)
+	{
+		fprintf(file, "\n# samples  percent  function\n");
+		for(i = 0; i < function_count; i++)
+			fprintf(file, "%9lu  %6.2f%%  %s\n", functions[i].count, percent(functions[i].count),
+					location_name(functions[i].address, 0, buff));
+	}
+	fprintf(file, "\n# samples  percent  address  location\n");
+	for(i = 0; i < count; i++)
+		fprintf(file, "%9lu  %6.2f%%  %05x    %s\n", pcs[i].count, percent(pcs[i].count), pcs[i].address,
+				location_name(pcs[i].address, 1, buff));
+	ok = !ferror(file);
+	free(pcs);
+	free(functions);
+	return fclose(file) == 0 && ok;
+}
+
+static int compare_folded_lines(const void* a, const void* b)
+{
+	return strcmp(((const folded_line*)a)->text, ((const folded_line*)b)->text);
+}
+
+/* Stacks that differ only in addresses within the same functions are
+ * merged, as flame graphs only show functions.
+ */
+int pc_sample_write_folded(const char* filename)
+{
+	folded_line* lines = malloc((g_stack_used + 1) * sizeof(*lines));
+	unsigned int count = 0;
+	unsigned int i;
+	FILE* file;
+	int ok = lines != NULL;
+
+	for(i = 0; ok && i < g_stack_slots; i++)
+	{
+		const stack_count* stack = &g_stacks[i];
+		char text[MAX_FOLDED_LINE];
+		char buff[256];
+		unsigned int length = 0;
+		unsigned int j;
+
+		if(stack->count == 0)
+			continue;
+		text[0] = '\0';
+		for(j = stack->depth; j-- > 0 && length < sizeof(text) - 1; )
+		{
+			/* A return address belongs to the call just before it */
+			const char* name = location_name(j ? stack->frames[j] - 2 : stack->frames[j], 0, buff);
+
+			length += snprintf(text + length, sizeof(text) - length, j + 1 < stack->depth ? ";%s" : "%s", name);
+		}
+		if((lines[count].text = strdup(text)) == NULL)
+			ok = 0;
+		else
+			lines[count++].count = stack->count;
+	}
+	if(ok && (file = fopen(filename, "w")) != NULL)
+	{
+		qsort(lines, count, sizeof(*lines), compare_folded_lines);
+		for(i = 0; i < count; i++)
+		{
+			unsigned long total = lines[i].count;
+
+			while(i + 1 < count && strcmp(lines[i].text, lines[i + 1].text) == 0)
+				total += lines[++i].count;
+			fprintf(file, "%s %lu\n", lines[i].text, total);
+		}
+		ok = !ferror(file);
+		ok = fclose(file) == 0 && ok;
+	}
+	else
+		ok = 0;
+	for(i = 0; i < count; i++)
+		free(lines[i].text);
+	free(lines);
+	return ok;
+}
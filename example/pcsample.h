@@ -0,0 +1,33 @@
+#ifndef PCSAMPLE__HEADER
+#define PCSAMPLE__HEADER
+
+/* Sample the PC every period cycles from now on.  memory holds the size
+ * bytes of RAM from address 0, where the stack is looked at for the return
+ * addresses of each sample.
+ */
+void pc_sample_start(unsigned int period, const unsigned char* memory, unsigned int size);
+
+/* Name addresses after the symbols in filename: lines of "<hex address>
+ * <name>" (or nm's "<hex address> <type> <name>"), or the symbol table of
+ * an ELF file.  Returns 0 if the file could not be read.
+ */
+int pc_sample_load_symbols(const char* filename);
+
+/* Name address after the symbol at or below it, as "name" or "name+0x12",
+ * or as a hex address if there is none.  Returns the name, which may be in
+ * buff; buff must hold 256 characters.
+ */
+const char* pc_sample_location_name(unsigned int address, char* buff);
+
+/* Write how many samples fell into each function and at each address.
+ * Returns 0 if the report could not be written.
+ */
+int pc_sample_write_report(const char* filename);
+
+/* Write the sampled call stacks in the folded form that flamegraph.pl
+ * reads, one "outer;...;inner <count>" line per stack.  Returns 0 if the
+ * file could not be written.
+ */
+int pc_sample_write_folded(const char* filename);
+
+#endif /* PCSAMPLE__HEADER */
@@ -0,0 +1,177 @@
+/* Performance counters of the simulator itself.
+ *
+ * The CPU counts the instructions and cycles it runs (M68K_PERF_COUNTERS),
+ * the memory callbacks count their calls per region, and the main loop
+ * switches between the CPU and the device updates.  Together they show
+ * whether a slow run is spent emulating the CPU or polling the devices, and
+ * how fast the emulated machine runs in real time.
+ *
+ * The main loop runs one instruction per iteration, which takes about as
+ * long as reading the host clock.  So only one iteration in
+ * PERF_SAMPLE_PERIOD is timed, less the cost of the clock reads, and the
+ * split of those samples is applied to the whole run.
+ */
+
+#include <signal.h>
+#include <stdio.h>
+#include "m68k.h"
+#include "osd.h"
+#include "perf.h"
+
+#define PERF_SAMPLE_PERIOD 256   /* Main loop iterations per timed one */
+#define PERF_CALIBRATION   1000  /* Clock reads to time in perf_start() */
+
+unsigned long long g_perf_reads[PERF_NUM_REGIONS];
+unsigned long long g_perf_writes[PERF_NUM_REGIONS];
+
+static const char* const g_region_names[PERF_NUM_REGIONS] = {"ram", "rom", "uart", "debug port"};
+
+/* Counts at some point in time */
+typedef struct
+{
+	unsigned long long time;                    /* Host nanoseconds */
+	unsigned long long phase_time[PERF_NUM_PHASES]; /* In the timed iterations */
+	m68k_perf_counters counters;
+} perf_counts;
+
+static int                   g_running;
+static int                   g_phase;           /* Phase being timed, or -1 */
+static unsigned int          g_iterations;      /* Since the last timed one */
+static unsigned long long    g_phase_start;
+static unsigned long long    g_phase_time[PERF_NUM_PHASES];
+static unsigned long long    g_clock_cost;      /* Nanoseconds per osd_nanoseconds() */
+static unsigned long long    g_now;             /* Time of the last clock read */
+static unsigned long long    g_interval;        /* Nanoseconds between reports, or 0 */
+static unsigned long long    g_next_report;
+static perf_counts           g_start;
+static perf_counts           g_last_report;
+static volatile sig_atomic_t g_report_requested;
+static int                   g_counted;         /* 1 if the CPU counts instructions */
+
+
+static void get_counts(perf_counts* counts)
+{
+	int i;
+
+	counts->time = g_now = osd_nanoseconds();
+	for(i = 0; i < PERF_NUM_PHASES; i++)
+		counts->phase_time[i] = g_phase_time[i];
+	g_counted = m68k_get_perf_counters(&counts->counters);
+	if(!g_counted)
+		counts->counters.instructions = counts->counters.cycles = 0;
+}
+
+#ifdef SIGUSR1
+static void request_report(int signal_number)
+{
+	(void)signal_number;
+	g_report_requested = 1;
+}
+#endif
+
+void perf_start(unsigned int interval)
+{
+	unsigned long long start = osd_nanoseconds();
+	int i;
+
+	for(i = 0; i < PERF_CALIBRATION; i++)
+		g_now = osd_nanoseconds();
+	g_clock_cost = (g_now - start) / PERF_CALIBRATION;
+	g_phase = -1;
+	g_iterations = 0;
+	g_interval = interval * 1000000000ull;
+	get_counts(&g_start);
+	g_next_report = g_now + g_interval;
+	g_last_report = g_start;
+	g_running = 1;
+#ifdef SIGUSR1
+	signal(SIGUSR1, request_report);
+#endif
+}
+
+void perf_phase(int phase)
+{
+	unsigned long long time;
+
+	if(!g_running)
+		return;
+	if(g_phase < 0)
+	{
+		/* Not timing: start with the CPU of every PERF_SAMPLE_PERIODth iteration */
+		if(phase != PERF_CPU || ++g_iterations < PERF_SAMPLE_PERIOD)
+			return;
+		g_iterations = 0;
+		g_phase = phase;
+		g_phase_start = g_now = osd_nanoseconds();
+		return;
+	}
+	g_now = osd_nanoseconds();
+	time = g_now - g_phase_start;
+	g_phase_time[g_phase] += time > g_clock_cost ? time - g_clock_cost : 0;
+	g_phase_start = g_now;
+	/* The iteration ends when the next one enters the CPU */
+	g_phase = phase == PERF_CPU ? -1 : phase;
+}
+
+void perf_poll(void)
+{
+	if(!g_running)
+		return;
+	if(g_report_requested || (g_interval && g_now >= g_next_report))
+	{
+		g_report_requested = 0;
+		while(g_interval && g_next_report <= g_now)
+			g_next_report += g_interval;
+		perf_report(stderr);
+	}
+}
+
+/* One line for the counts from from to to.  The time in the CPU is the
+ * share of the timed iterations it had, applied to the whole span.
+ */
+static void report_span(FILE* file, const char* label, const perf_counts* from, const perf_counts* to)
+{
+	double seconds = (to->time - from->time) / 1e9;
+	unsigned long long cpu = to->phase_time[PERF_CPU] - from->phase_time[PERF_CPU];
+	unsigned long long devices = to->phase_time[PERF_DEVICES] - from->phase_time[PERF_DEVICES];
+	unsigned long long instructions = to->counters.instructions - from->counters.instructions;
+	unsigned long long cycles = to->counters.cycles - from->counters.cycles;
+	double cpu_share;
+
+	if(seconds <= 0)
+		return;
+	fprintf(file, "perf: %s %.3f s: %llu instructions, %llu cycles, %.3f MIPS, %.3f MHz, ",
+			label, seconds, instructions, cycles, instructions / seconds / 1e6, cycles / seconds / 1e6);
+	if(cpu + devices == 0)
+	{
+		fprintf(file, "no timed iterations\n");
+		return;
+	}
+	cpu_share = (double)cpu / (cpu + devices);
+	if(instructions)
+		fprintf(file, "%.1f ns per instruction in the cpu, ", cpu_share * seconds * 1e9 / instructions);
+	fprintf(file, "cpu %.1f%%, devices %.1f%%\n", cpu_share * 100, (1 - cpu_share) * 100);
+}
+
+void perf_report(FILE* file)
+{
+	perf_counts now;
+	int i;
+
+	if(!g_running)
+		return;
+	/* End a timed iteration here, so that the report is not in it */
+	if(g_phase >= 0)
+		perf_phase(PERF_CPU);
+	get_counts(&now);
+	if(!g_counted)
+		fprintf(file, "perf: no instruction counts (is M68K_PERF_COUNTERS on?)\n");
+	report_span(file, "last", &g_last_report, &now);
+	report_span(file, "total", &g_start, &now);
+	fprintf(file, "perf: memory callbacks (reads/writes):");
+	for(i = 0; i < PERF_NUM_REGIONS; i++)
+		fprintf(file, " %s %llu/%llu", g_region_names[i], g_perf_reads[i], g_perf_writes[i]);
+	fprintf(file, "\n");
+	fflush(file);
+	g_last_report = now;
+}
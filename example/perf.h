@@ -0,0 +1,50 @@
+#ifndef PERF__HEADER
+#define PERF__HEADER
+
+#include <stdio.h>
+
+/* What the host is busy with, see perf_phase() */
+enum
+{
+	PERF_CPU,
+	PERF_DEVICES,
+	PERF_NUM_PHASES
+};
+
+/* Where the memory callbacks went */
+enum
+{
+	PERF_RAM,
+	PERF_ROM,
+	PERF_UART,
+	PERF_DEBUG_PORT,
+	PERF_NUM_REGIONS
+};
+
+extern unsigned long long g_perf_reads[PERF_NUM_REGIONS];
+extern unsigned long long g_perf_writes[PERF_NUM_REGIONS];
+
+/* Count a memory callback for region */
+#define perf_read(REGION)  g_perf_reads[REGION]++
+#define perf_write(REGION) g_perf_writes[REGION]++
+
+/* Start timing the phases, and report on stderr every interval seconds
+ * (never if 0) and whenever SIGUSR1 arrives.
+ */
+void perf_start(unsigned int interval);
+
+/* Count the host time from now on to phase, until the next call.  The main
+ * loop calls this for PERF_CPU and PERF_DEVICES once per iteration, and only
+ * a sample of the iterations is timed.
+ */
+void perf_phase(int phase);
+
+/* Report if a report is due */
+void perf_poll(void);
+
+/* Write the counts since perf_start() and since the last report, and the
+ * emulated clock and instruction rate they make.
+ */
+void perf_report(FILE* file);
+
+#endif /* PERF__HEADER */
@@ -14,8 +14,14 @@
 #include "sim.h"
 #include "m68k.h"
 #include "osd.h"
+#include "disasm.h"
+#include "pcsample.h"
+#include "forth.h"
+#include "callgraph.h"
+#include "perf.h"
+#include "timeline.h"
 
-void disassemble_program();
+void disassemble_program(const char* filename);
 
 /* Memory-mapped IO ports */
 // adapted to emu68kplus
@@ -102,10 +108,16 @@ void uart_dreg_write(unsigned char c);
 void xprintf(const char *format, ...);
 void xgets(char *buf, int size, int noecho_flag);
 
+void word_profile_next(unsigned int pc);
+
 
 /* Data */
 unsigned int g_quit = 0;                        /* 1 if we want to quit */
 unsigned int g_nmi = 0;                         /* 1 if nmi pending */
+unsigned long long g_cycles = 0;                /* Cycles run by earlier m68k_execute() calls */
+int g_word_profile = 0;                         /* 1 to profile the Forth words at each NEXT */
+int g_call_graph = 0;                           /* 1 to follow calls for the call graph */
+int g_timeline = 0;                             /* 1 to write the timeline */
 
 // one byte read ahead and ungetc
 // we compose PIR9 (uart creg) with g_input_device_ready 
@@ -124,6 +136,7 @@ unsigned int g_int_controller_highest_int = 0;  /* Highest pending interrupt */
 unsigned char g_rom[MAX_ROM+1];                 /* ROM */
 #endif //MAX_ROM
 unsigned char g_ram[MAX_RAM+1];                 /* RAM */
+unsigned char g_loaded[MAX_RAM+1];              /* 1 where a program file set the RAM */
 unsigned int  g_fc;                             /* Current function code from CPU */
 
 
@@ -160,24 +173,29 @@ unsigned int cpu_read_byte(unsigned int address)
 #if defined(MAX_ROM)
 		if(address > MAX_ROM)
 			exit_error("Attempted to read byte from ROM address %08x", address);
+		perf_read(PERF_ROM);
 		return READ_BYTE(g_rom, address);
 #endif //MAX_ROM
 	}
 
 	/* dbg_port */
 	if ((address & 0xfff00) == 0x80100) {
+		perf_read(PERF_DEBUG_PORT);
 		return debug_port_read(address);
 	}
 	/* Otherwise it's data space */
 	switch(address)
 	{
 		case UART_CREG_ADDRESS:
+			perf_read(PERF_UART);
 			return input_device_status();
 		case UART_DREG_ADDRESS:
+			perf_read(PERF_UART);
 			return input_device_read();
 		default:
 			break;
 	}
+	perf_read(PERF_RAM);
 	if(address > MAX_RAM)
 		exit_error("Attempted to read byte from RAM address %08x", address);
 	return READ_BYTE(g_ram, address);
@@ -190,24 +208,29 @@ unsigned int cpu_read_word(unsigned int address)
 #if defined(MAX_ROM)
 		if(address > MAX_ROM)
 			exit_error("Attempted to read word from ROM address %08x", address);
+		perf_read(PERF_ROM);
 		return READ_WORD(g_rom, address);
 #endif //MAX_ROM
 	}
 
 	/* dbg_port */
 	if ((address & 0xfff00) == 0x80100) {
+		perf_read(PERF_DEBUG_PORT);
 		return debug_port_read(address);
 	}
 	/* Otherwise it's data space */
 	switch(address)
 	{
 		case UART_CREG_ADDRESS:
+			perf_read(PERF_UART);
 			return input_device_status();
 		case UART_DREG_ADDRESS:
+			perf_read(PERF_UART);
 			return input_device_read();
 		default:
 			break;
 	}
+	perf_read(PERF_RAM);
 	if(address > MAX_RAM)
 		exit_error("Attempted to read word from RAM address %08x", address);
 	return READ_WORD(g_ram, address);
@@ -220,24 +243,29 @@ unsigned int cpu_read_long(unsigned int address)
 #if defined(MAX_ROM)
 		if(address > MAX_ROM)
 			exit_error("Attempted to read long from ROM address %08x", address);
+		perf_read(PERF_ROM);
 		return READ_LONG(g_rom, address);
 #endif //MAX_ROM
 	}
 
 	/* dbg_port */
 	if ((address & 0xfff00) == 0x80100) {
+		perf_read(PERF_DEBUG_PORT);
 		return debug_port_read(address);
 	}
 	/* Otherwise it's data space */
 	switch(address)
 	{
 		case UART_CREG_ADDRESS:
+			perf_read(PERF_UART);
 			return input_device_status();
 		case UART_DREG_ADDRESS:
+			perf_read(PERF_UART);
 			return input_device_read();
 		default:
 			break;
 	}
+	perf_read(PERF_RAM);
 	if(address > MAX_RAM)
 		exit_error("Attempted to read long from RAM address %08x", address);
 	return READ_LONG(g_ram, address);
@@ -251,6 +279,9 @@ unsigned int cpu_read_word_dasm(unsigned int address)
 		exit_error("Disassembler attempted to read word from ROM address %08x", address);
 	return READ_WORD(g_rom, address);
 #endif //MAX_ROM
+	// the trace buffer reads every instruction through here, wild ones too
+	if(address >= MAX_RAM)
+		return 0;
 	return READ_WORD(g_ram, address);
 }
 
@@ -261,6 +292,8 @@ unsigned int cpu_read_long_dasm(unsigned int address)
 		exit_error("Dasm attempted to read long from ROM address %08x", address);
 	return READ_LONG(g_rom, address);
 #endif //MAX_ROM
+	if(address >= MAX_RAM - 2)
+		return 0;
 	return READ_LONG(g_ram, address);
 }
 
@@ -276,11 +309,13 @@ void cpu_write_byte(unsigned int address, unsigned int value)
 	switch(address)
 	{
 		case UART_DREG_ADDRESS:
+			perf_write(PERF_UART);
 			output_device_write(value);
 			return;
 		default:
 			break;
 	}
+	perf_write(PERF_RAM);
 	if(address > MAX_RAM)
 		exit_error("Attempted to write %02x to RAM address %08x", value&0xff, address);
 	WRITE_BYTE(g_ram, address, value);
@@ -296,11 +331,13 @@ void cpu_write_word(unsigned int address, unsigned int value)
 	switch(address)
 	{
 		case UART_DREG_ADDRESS:
+			perf_write(PERF_UART);
 			output_device_write(value);
 			return;
 		default:
 			break;
 	}
+	perf_write(PERF_RAM);
 	if(address > MAX_RAM)
 		exit_error("Attempted to write %04x to RAM address %08x", value&0xffff, address);
 	WRITE_WORD(g_ram, address, value);
@@ -316,11 +353,13 @@ void cpu_write_long(unsigned int address, unsigned int value)
 	switch(address)
 	{
 		case UART_DREG_ADDRESS:
+			perf_write(PERF_UART);
 			output_device_write(value);
 			return;
 		default:
 			break;
 	}
+	perf_write(PERF_RAM);
 	if(address > MAX_RAM)
 		exit_error("Attempted to write %08x to RAM address %08x", value, address);
 	WRITE_LONG(g_ram, address, value);
@@ -343,16 +382,26 @@ void cpu_set_fc(unsigned int fc)
 /* Called when the CPU acknowledges an interrupt */
 int cpu_irq_ack(int level)
 {
+	unsigned int vector = M68K_INT_ACK_SPURIOUS;
+
 	switch(level)
 	{
 		case IRQ_NMI_DEVICE:
-			return nmi_device_ack();
+			vector = nmi_device_ack();
+			break;
 		case IRQ_INPUT_DEVICE:
-			return input_device_ack();
+			vector = input_device_ack();
+			break;
 		case IRQ_OUTPUT_DEVICE:
-			return output_device_ack();
+			vector = output_device_ack();
+			break;
 	}
-	return M68K_INT_ACK_SPURIOUS;
+	if(g_timeline) {
+		// The handler the CPU is about to jump to, unless the vector is uninitialized
+		unsigned int number = vector == M68K_INT_ACK_AUTOVECTOR ? 24 + (unsigned int)level : vector == M68K_INT_ACK_SPURIOUS ? 24 : vector;
+		timeline_interrupt(level, cpu_read_long_dasm(m68k_get_reg(NULL, M68K_REG_VBR) + number * 4));
+	}
+	return vector;
 }
 
 
@@ -433,6 +482,8 @@ unsigned int input_device_read(void)
 	// emulate uart_dreg is read.
 	int_controller_clear(IRQ_INPUT_DEVICE);
 	g_input_device_ready = 0;
+	if(g_timeline)
+		timeline_uart(1, value, g_cycles + m68k_cycles_run());
 	//printf("%02X]", value);
 	return value;
 }
@@ -527,6 +578,8 @@ unsigned int output_device_read(void)
 
 void output_device_write(unsigned int value)
 {
+	if(g_timeline)
+		timeline_uart(0, value, g_cycles + m68k_cycles_run());
 	g_output_device_data_ready = 1;
 	g_output_device_data = value & 0xff;
 	if (g_output_device_empty)
@@ -671,28 +724,143 @@ void make_hex(char* buff, unsigned int pc, unsigned int length)
 	}
 }
 
-void disassemble_program()
+void disassemble_program(const char* filename)
 {
-	unsigned int pc;
-	unsigned int instr_size;
-	char buff[100];
-	char buff2[100];
+	if(!disassemble_image(filename, g_ram, g_loaded, MAX_RAM+1, M68K_CPU_TYPE_68000))
+		exit_error("Unable to write listing %s", filename);
+}
 
-	pc = cpu_read_long_dasm(4);
+/* Trace buffer */
+#define MAX_TRACE_RECORDS 0x10000
 
-	while(pc <= 0x16e)
-	{
-		instr_size = m68k_disassemble(buff, pc, M68K_CPU_TYPE_68000);
-		make_hex(buff2, pc, instr_size);
-		printf("%03x: %-20s: %s\n", pc, buff2, buff);
-		pc += instr_size;
+static const char *g_trace_file = NULL;
+static int g_trace_steps = 0;		/* 1 if breakpoints want the step listing */
+static int g_trace_written = 0;		/* 1 once a trigger has written g_trace_file */
+
+// one line per record: address, cycle stamp, words, disassembly, then what it changed
+void print_trace_record(FILE *out, m68k_dasm_context *ctx, const m68k_trace_record *r)
+{
+	static const char *const reg_names[16] = {
+		"D0", "D1", "D2", "D3", "D4", "D5", "D6", "D7",
+		"A0", "A1", "A2", "A3", "A4", "A5", "A6", "A7"
+	};
+	static const char size_names[4] = {'?', 'b', 'w', 'l'};
+	unsigned char bytes[M68K_TRACE_MAX_WORDS * 2];
+	char hex[M68K_TRACE_MAX_WORDS * 5 + 1];
+	char text[200];
+	unsigned int length, i, stored = 0;
+
+	fprintf(out, "%05x %10u  ", r->pc, r->cycles);
+	if(r->flags & M68K_TRACE_NO_INSTRUCTION) {
+		fprintf(out, "%-20s  %-28s", "", "(interrupt)");
+	} else {
+		for(i = 0; i < M68K_TRACE_MAX_WORDS; i++) {
+			bytes[i * 2] = r->words[i] >> 8;
+			bytes[i * 2 + 1] = r->words[i] & 0xff;
+		}
+		m68k_dasm_set_buffer(ctx, bytes, r->pc, sizeof bytes);
+		length = m68k_dasm_decode(ctx, r->pc, NULL, text) / 2;
+		if(length > M68K_TRACE_MAX_WORDS)
+			length = M68K_TRACE_MAX_WORDS;
+		hex[0] = '\0';
+		for(i = 0; i < length; i++)
+			sprintf(hex + strlen(hex), i ? " %04x" : "%04x", r->words[i]);
+		fprintf(out, "%-20s  %-28s", hex, text);
 	}
-	fflush(stdout);
+	for(i = 0; i < 16; i++) {
+		if(!(r->changed & (1 << i)))
+			continue;
+		if(stored < 2)
+			fprintf(out, " %s=%08x", reg_names[i], r->reg_value[stored++]);
+		else
+			fprintf(out, " %s", reg_names[i]);
+	}
+	if(r->flags & M68K_TRACE_WRITE_SIZE)
+		fprintf(out, " [%05x].%c=%x%s", r->write_address, size_names[r->flags & M68K_TRACE_WRITE_SIZE],
+				r->write_value, (r->flags & M68K_TRACE_MORE_WRITES) ? " +" : "");
+	if(r->flags & M68K_TRACE_EXCEPTION)
+		fprintf(out, " vector %u", r->vector);
+	fprintf(out, "\n");
+}
+
+// called from the step mode in m68k_execute()
+void dump_trace(int count)
+{
+	m68k_trace_record records[16];
+	m68k_dasm_context ctx;
+	unsigned int n;
+
+	if(count > 16)
+		count = 16;
+	m68k_dasm_init_context(&ctx, M68K_CPU_TYPE_68000);
+	n = m68k_trace_buffer_get(records, count);
+	for(unsigned int i = 0; i < n; ++i)
+		print_trace_record(stderr, &ctx, &records[i]);
+}
+
+void trace_trigger(unsigned int type, unsigned int value)
+{
+	static const char *const type_names[] = {"pc", "write", "exception"};
+
+	if(!m68k_trace_buffer_write(g_trace_file, 0))
+		exit_error("Unable to write trace %s", g_trace_file);
+	// later triggers keep overwriting the file with the newest records
+	if(!g_trace_written) {
+		fprintf(stderr, type == M68K_TRACE_TRIGGER_EXCEPTION ? "\ntrace: %s %u triggered, wrote %s\n" : "\ntrace: %s %x triggered, wrote %s\n",
+				type_names[type], value, g_trace_file);
+		g_trace_written = 1;
+	}
+}
+
+// pc:<hex address>, write:<hex address> or exception:<vector>, or '*' for any
+void add_trace_trigger(const char *spec)
+{
+	const char *value = strchr(spec, ':');
+	unsigned int type;
+	unsigned int n = M68K_TRACE_TRIGGER_ANY;
+
+	if(value == NULL) {
+		exit_error("Bad trace trigger %s", spec);
+		return;
+	}
+	if(strncmp(spec, "pc:", 3) == 0)
+		type = M68K_TRACE_TRIGGER_PC;
+	else if(strncmp(spec, "write:", 6) == 0)
+		type = M68K_TRACE_TRIGGER_WRITE;
+	else if(strncmp(spec, "exception:", 10) == 0)
+		type = M68K_TRACE_TRIGGER_EXCEPTION;
+	else {
+		exit_error("Bad trace trigger %s", spec);
+		return;
+	}
+	if(strcmp(value + 1, "*") != 0)
+		n = strtoul(value + 1, NULL, type == M68K_TRACE_TRIGGER_EXCEPTION ? 10 : 16);
+	if(!m68k_trace_buffer_add_trigger(type, n))
+		exit_error("Too many trace triggers");
+}
+
+void render_trace(const char *filename)
+{
+	m68k_trace_record *records = malloc(MAX_TRACE_RECORDS * sizeof *records);
+	m68k_dasm_context ctx;
+	unsigned int n;
+
+	if(records == NULL)
+		exit_error("Out of memory");
+	if((n = m68k_trace_buffer_read(filename, records, MAX_TRACE_RECORDS)) == 0)
+		exit_error("Unable to read trace %s", filename);
+	m68k_dasm_init_context(&ctx, M68K_CPU_TYPE_68000);
+	for(unsigned int i = 0; i < n; ++i)
+		print_trace_record(stdout, &ctx, &records[i]);
+	free(records);
 }
 
 void cpu_instr_callback(int pc)
 {
-	(void)pc;
+	if(g_word_profile)
+		word_profile_next(pc);
+	if(g_timeline && cpu_read_word_dasm(pc) == 0x4e72)	/* stop */
+		timeline_stop(g_cycles + m68k_cycles_run());
 /* The following code would print out instructions as they are executed */
 /*
 	static char buff[100];
@@ -708,6 +876,14 @@ void cpu_instr_callback(int pc)
 */
 }
 
+void cpu_call_callback(int type, unsigned int pc, unsigned int target)
+{
+	if(g_call_graph)
+		call_graph_event(type, pc, target, m68k_get_reg(NULL, M68K_REG_A7), g_cycles + m68k_cycles_run());
+	if(g_timeline)
+		timeline_call(type, pc, target, m68k_get_reg(NULL, M68K_REG_A7), g_cycles + m68k_cycles_run());
+}
+
 // bootloader
 
 typedef unsigned long int addr_t;
@@ -799,6 +975,7 @@ typedef unsigned short saddr_t;
 
 extern void set_breakpoint_addr(saddr_t a);
 extern void set_wordtrace_addr(saddr_t addr);
+extern saddr_t donext_addr;
 
 void manualboot(void)
 {
@@ -855,12 +1032,14 @@ void manualboot(void)
 					// set breakpoint address
 					fprintf(stderr, "P%04lX", (addr_t)n);
 					set_breakpoint_addr(n);
+					g_trace_steps = 1;
 				} else if (cc == 'Q') {
 					// set word trace breakpoint, %a0 has IP
 					fprintf(stderr, "Q%04lX", (addr_t)n);
 					extern void set_wordtrace_addr(saddr_t a);
 					set_breakpoint_addr(n);
 					set_wordtrace_addr(n);
+					g_trace_steps = 1;
 				} else if (cc == 'R') {
 					// set do_next breakpoint
 					// here, %a0 has the address of next-to-jump token
@@ -868,11 +1047,15 @@ void manualboot(void)
 					extern void set_donext_addr(saddr_t a);
 					set_breakpoint_addr(n);
 					set_donext_addr(n);
+					g_trace_steps = 1;
 
 				}
             } else {
                 if (/* 0 <= addr &&*/ addr < (MAX_RAM + 1)) {
                     //xprintf("[%04X] = %02X%02X\n", addr, ((n>>8)&0xff), (n & 0xff));
+                    g_loaded[addr] = 1;
+                    if (addr < MAX_RAM)
+                        g_loaded[addr + 1] = 1;
                     poke_ram(addr++, ((n>>8) & 0xff));
                     poke_ram(addr++, (n & 0xff));
                     if (max < addr)
@@ -891,21 +1074,115 @@ void manualboot(void)
 /* The main loop */
 int main(int argc, char* argv[])
 {
-
-	if(argc == 1)
+	const char *profile_file = NULL;
+	const char *listing_file = NULL;
+	const char *render_file = NULL;
+	const char *sample_report = NULL;
+	const char *sample_folded = NULL;
+	const char *symbol_file = NULL;
+	const char *word_report = NULL;
+	const char *stats_file = NULL;
+	const char *call_graph_file = NULL;
+	const char *heatmap_file = NULL;
+	const char *latency_file = NULL;
+	long perf_interval = -1;
+	const char *timeline_file = NULL;
+	double clock_mhz = 8;
+	unsigned int sample_period = 997;
+	unsigned int working_set_interval = 100000;
+	int first_file = 1;
+
+	// -p <file>: write an opcode handler profile for m68kmake on exit
+	// -d <file>: write a listing of the loaded program instead of running it
+	// -t <file>: record a trace and write it to file when a trigger fires
+	// -T <trigger>: add a trigger for -t
+	// -r <file>: print a trace written by -t and exit
+	// -s <file>: sample the PC and write where the time went on exit
+	// -f <file>: write the sampled call stacks for flamegraph.pl on exit
+	// -y <file>: symbols for -s and -f, an "address name" list or an ELF file
+	// -i <cycles>: sample period for -s and -f
+	// -w <file>: profile the Forth words and write the counts on exit
+	// -n <address>: address of NEXT for -w, instead of an R line in the program
+	// -S <file>: write instruction statistics on exit, as JSON if file ends in .json
+	// -c <file>: follow calls and write a callgrind call graph on exit (symbols from -y)
+	// -m <file>: write the memory heatmap and working set on exit, as JSON if file ends in .json
+	// -W <cycles>: working set interval for -m
+	// -L <file>: write interrupt latency and service time histograms on exit, as JSON if file ends in .json
+	// -P <seconds>: report the simulator's own speed every so many seconds (0: never), on SIGUSR1 and on exit
+	// -e <file>: write a timeline of calls, interrupts, UART bytes and STOPs as Chrome trace events
+	// -M <MHz>: clock for the -e timestamps
+	while(argc > first_file + 1) {
+		if(strcmp(argv[first_file], "-p") == 0)
+			profile_file = argv[first_file + 1];
+		else if(strcmp(argv[first_file], "-d") == 0)
+			listing_file = argv[first_file + 1];
+		else if(strcmp(argv[first_file], "-t") == 0)
+			g_trace_file = argv[first_file + 1];
+		else if(strcmp(argv[first_file], "-T") == 0)
+			add_trace_trigger(argv[first_file + 1]);
+		else if(strcmp(argv[first_file], "-r") == 0)
+			render_file = argv[first_file + 1];
+		else if(strcmp(argv[first_file], "-s") == 0)
+			sample_report = argv[first_file + 1];
+		else if(strcmp(argv[first_file], "-f") == 0)
+			sample_folded = argv[first_file + 1];
+		else if(strcmp(argv[first_file], "-y") == 0)
+			symbol_file = argv[first_file + 1];
+		else if(strcmp(argv[first_file], "-i") == 0)
+			sample_period = strtoul(argv[first_file + 1], NULL, 0);
+		else if(strcmp(argv[first_file], "-w") == 0)
+			word_report = argv[first_file + 1];
+		else if(strcmp(argv[first_file], "-n") == 0)
+			donext_addr = strtoul(argv[first_file + 1], NULL, 16);
+		else if(strcmp(argv[first_file], "-S") == 0)
+			stats_file = argv[first_file + 1];
+		else if(strcmp(argv[first_file], "-c") == 0)
+			call_graph_file = argv[first_file + 1];
+		else if(strcmp(argv[first_file], "-m") == 0)
+			heatmap_file = argv[first_file + 1];
+		else if(strcmp(argv[first_file], "-W") == 0)
+			working_set_interval = strtoul(argv[first_file + 1], NULL, 0);
+		else if(strcmp(argv[first_file], "-L") == 0)
+			latency_file = argv[first_file + 1];
+		else if(strcmp(argv[first_file], "-P") == 0)
+			perf_interval = strtol(argv[first_file + 1], NULL, 0);
+		else if(strcmp(argv[first_file], "-e") == 0)
+			timeline_file = argv[first_file + 1];
+		else if(strcmp(argv[first_file], "-M") == 0)
+			clock_mhz = strtod(argv[first_file + 1], NULL);
+		else
+			break;
+		first_file += 2;
+	}
+	if(render_file) {
+		render_trace(render_file);
+		return 0;
+	}
+	if(argc <= first_file)
 	{
-		printf("Usage: sim <program file>...\n");
+		printf("Usage: sim [-p <profile file>] [-d <listing file>] [-t <trace file> [-T <trigger>]...]\n");
+		printf("           [-s <sample report>] [-f <folded stacks>] [-y <symbol file>] [-i <cycles>]\n");
+		printf("           [-w <word profile> [-n <NEXT address>]] [-S <statistics file>]\n");
+		printf("           [-c <call graph>] [-m <heatmap file> [-W <cycles>]] [-L <latency file>]\n");
+		printf("           [-P <seconds>] [-e <timeline file> [-M <MHz>]] <program file>...\n");
+		printf("       sim -r <trace file>\n");
 		exit(-1);
 	}
 
 	// boot process
 	xprintf(";");		// boot prompt
-	for(int i = 1; i < argc; ++i) {
+	for(int i = first_file; i < argc; ++i) {
 		if((xf = fopen(argv[i], "rb")) == NULL)
 			exit_error("Unable to open %s", argv[i]);
 		manualboot();
 		fclose(xf);
 	}
+	forth_init(g_ram, MAX_RAM+1);
+	if(listing_file) {
+		disassemble_program(listing_file);
+		return 0;
+	}
+
 	// read dump format
 	printf("\nrun...");fflush(stdout);
 
@@ -914,15 +1191,44 @@ int main(int argc, char* argv[])
 		exit_error("Error reading %s", argv[1]);
 #endif //MAX_ROM
 
-//	disassemble_program();
-
 	m68k_init();
+	m68k_map_direct_memory(0, MAX_RAM+1, g_ram);
 	m68k_set_cpu_type(M68K_CPU_TYPE_68000);
+	m68k_set_trace_trigger_callback(g_trace_file ? trace_trigger : NULL);
+	m68k_trace_buffer_enable(g_trace_file != NULL || g_trace_steps);
+	if(word_report) {
+		if(!donext_addr)
+			exit_error("-w needs the address of NEXT, from -n or an R line");
+		forth_profile_start();
+		g_word_profile = 1;
+	}
+	if(symbol_file && !pc_sample_load_symbols(symbol_file))
+		exit_error("Unable to read symbols %s", symbol_file);
+	if((sample_report || sample_folded) && sample_period)
+		pc_sample_start(sample_period, g_ram, MAX_RAM+1);
+	if(heatmap_file)
+		m68k_set_working_set_interval(working_set_interval);
 	m68k_pulse_reset();
+	if(call_graph_file) {
+		call_graph_start(m68k_get_reg(NULL, M68K_REG_PC), g_cycles);
+		g_call_graph = 1;
+	}
+	if(timeline_file) {
+		if(clock_mhz <= 0)
+			exit_error("-M needs a clock above 0 MHz");
+		if(!timeline_start(timeline_file, clock_mhz))
+			exit_error("Unable to open timeline %s", timeline_file);
+		g_timeline = 1;
+#if M68K_CALL_HOOK == OPT_OFF
+		fprintf(stderr, "Timeline %s will have no calls, interrupts or exceptions (is M68K_CALL_HOOK on?)\n", timeline_file);
+#endif
+	}
 	input_device_reset();
 	output_device_reset();
 	nmi_device_reset();
 
+	if(perf_interval >= 0)
+		perf_start(perf_interval);
 	g_quit = 0;
 	while(!g_quit)
 	{
@@ -937,13 +1243,55 @@ int main(int argc, char* argv[])
 		// 100000 is usually a good value to start at, then work from there.
 
 		// Note that I am not emulating the correct clock speed!
-		m68k_execute(1);
+		perf_phase(PERF_CPU);
+		g_cycles += m68k_execute(1);
+		perf_phase(PERF_DEVICES);
 		output_device_update();
 		input_device_update();
 		nmi_device_update();
+		perf_poll();
 	}
 
 	input_device_restore();
+	if(perf_interval >= 0)
+		perf_report(stderr);
+
+	if(profile_file && !m68k_write_handler_profile(profile_file))
+		fprintf(stderr, "Unable to write profile %s (is M68K_PROFILE_HANDLERS on?)\n", profile_file);
+	if(stats_file) {
+		size_t length = strlen(stats_file);
+		int format = length >= 5 && strcmp(stats_file + length - 5, ".json") == 0 ? M68K_STATS_JSON : M68K_STATS_CSV;
+
+		if(!m68k_write_instruction_stats(stats_file, format))
+			fprintf(stderr, "Unable to write statistics %s (is M68K_INSTRUCTION_STATS on?)\n", stats_file);
+	}
+	if(heatmap_file) {
+		size_t length = strlen(heatmap_file);
+		int format = length >= 5 && strcmp(heatmap_file + length - 5, ".json") == 0 ? M68K_STATS_JSON : M68K_STATS_CSV;
+
+		if(!m68k_write_memory_heatmap(heatmap_file, format))
+			fprintf(stderr, "Unable to write heatmap %s (is M68K_MEMORY_HEATMAP on?)\n", heatmap_file);
+	}
+	if(latency_file) {
+		size_t length = strlen(latency_file);
+		int format = length >= 5 && strcmp(latency_file + length - 5, ".json") == 0 ? M68K_STATS_JSON : M68K_STATS_CSV;
+
+		if(!m68k_write_latency_histograms(latency_file, format))
+			fprintf(stderr, "Unable to write latency histograms %s (is M68K_INTERRUPT_LATENCY on?)\n", latency_file);
+	}
+	if(timeline_file && !timeline_end(g_cycles))
+		fprintf(stderr, "Unable to write timeline %s\n", timeline_file);
+	if(call_graph_file && !call_graph_write(call_graph_file, argv[first_file], g_cycles))
+		fprintf(stderr, "Unable to write call graph %s (is M68K_CALL_HOOK on?)\n", call_graph_file);
+	if(word_report && !forth_profile_write(word_report))
+		fprintf(stderr, "Unable to write word profile %s\n", word_report);
+	if(sample_report && !pc_sample_write_report(sample_report))
+		fprintf(stderr, "Unable to write samples %s (is M68K_SAMPLE_PC on?)\n", sample_report);
+	if(sample_folded && !pc_sample_write_folded(sample_folded))
+		fprintf(stderr, "Unable to write stacks %s\n", sample_folded);
+	// without a trigger, the trace ends where the program did
+	if(g_trace_file && !g_trace_written && !m68k_trace_buffer_write(g_trace_file, 0))
+		fprintf(stderr, "Unable to write trace %s (is M68K_TRACE_BUFFER on?)\n", g_trace_file);
 
 	return 0;
 }
@@ -1017,33 +1365,16 @@ void dump_streambuf(void)
 }
 
 // word execution trace
+// both lookups go through the dictionary index in forth.c
 addr_t _find(const char *name, int *result_len)
 {
-	saddr_t np, dp0, dp = peek_word(0x2004);			// last
-	saddr_t pp = peek_word(0x2002);				// here
-	//fprintf(stderr, "dp = %04X\n", dp);
-	while(dp) {
-		// match name and entry-string
-		dp0 = dp;
-		int len = peek_ram(dp) & 0x1f;	// length of entry-name
-		//fprintf(stderr, "dp = %04X: len = %d, name = %s, entry = %.*s\n", dp, len, name, len, &g_ram[dp + 1]);
-		if ((int)strlen(name) == len && strncmp((const char *)&g_ram[dp+1], name, len) == 0) {
-			// got it
-			//fprintf(stderr, "found: %04X\n", dp);
-			if (result_len)
-				*result_len = pp - dp0;
-			return dp;
-		}
-		// not match, seek previous entry
-		dp += len + 1;
-		if ((dp % 2) == 1) dp++;
-		np = peek_word(dp);
-		pp = dp0;
-		dp = np;
-	}
-	// not found
-	//fprintf(stderr, "not found\n");
-	return dp;
+	unsigned int start, end;
+
+	if (!forth_find_name(name, &start, &end))
+		return 0;
+	if (result_len)
+		*result_len = end - start;
+	return start;
 }
 
 saddr_t start_trace = 0;
@@ -1053,37 +1384,22 @@ saddr_t wordtrace_addr = 0;
 
 void _find_addr(saddr_t addr, saddr_t *startp, saddr_t *endp)
 {
-	saddr_t np, dp0, dp = peek_word(0x2004);	// last
-	saddr_t pp = peek_word(0x2002);				// here
-	//fprintf(stderr, "dp = %04X\n", dp);
-	while(dp) {
-		// match name and entry-string
-		dp0 = dp;
-		int len = peek_ram(dp) & 0x1f;	// length of entry-name
-		//fprintf(stderr, "dp = %04X: len = %d, name = %s, entry = %.*s\n", dp, len, name, len, &g_ram[dp + 1]);
-		if (dp0 <= addr && addr < pp) {
-			// got it
-			if (startp)
-				*startp = dp0;
-			if (endp)
-				*endp = pp;
-			//fprintf(stderr, "start: %04X, end: %04X\n", dp0, pp);
-			return;
-		}
-		// not match, seek previous entry
-		dp += len + 1;
-		if ((dp % 2) == 1) dp++;
-		np = peek_word(dp);
-		pp = dp0;
-		dp = np;
-	}
-	// not find, do nothing
-	//fprintf(stderr, "bad trace addr: %04X\n", addr);
+	unsigned int start = 0, end = 0;
+
+	forth_find_address(addr, &start, &end);
 	if (startp)
-		*startp = 0;
+		*startp = start;
 	if (endp)
-		*endp = 0;
-	return;
+		*endp = end;
+}
+
+// called before every instruction while profiling words, %a0 is the word NEXT runs, %a6 the IP
+void word_profile_next(unsigned int pc)
+{
+	if (pc != donext_addr)
+		return;
+	forth_profile_next(m68k_get_reg(NULL, M68K_REG_A0), m68k_get_reg(NULL, M68K_REG_A6),
+		g_cycles + m68k_cycles_run());
 }
 
 void dump_find(void)
@@ -11,5 +11,6 @@ void cpu_pulse_reset(void);
 void cpu_set_fc(unsigned int fc);
 int  cpu_irq_ack(int level);
 void cpu_instr_callback(int pc);
+void cpu_call_callback(int type, unsigned int pc, unsigned int target);
 
 #endif /* SIM__HEADER */
@@ -0,0 +1,180 @@
+/* Timeline of the guest in the Chrome trace event format, which
+ * chrome://tracing and Perfetto (ui.perfetto.dev) open.
+ *
+ * Calls, interrupts and exceptions come from the call hook (M68K_CALL_HOOK)
+ * and are kept on a shadow stack, matched by the stack pointer as the call
+ * graph profiler does; each one becomes a complete ("X") event when it
+ * returns.  UART bytes are instant events on a track of their own, and the
+ * time from a STOP to the interrupt that ends it is an idle span.  Events
+ * are written as they end, so the file never has to be held in memory.
+ */
+
+#include <stdio.h>
+#include "m68k.h"
+#include "pcsample.h"
+#include "timeline.h"
+
+#define MAX_TIMELINE_DEPTH 4096
+
+/* Tracks */
+#define CPU_TID   1
+#define UART_TID  2
+
+typedef struct
+{
+	unsigned int       target;      /* Function or handler entered */
+	unsigned int       sp;          /* A7 after the call or exception */
+	int                exception;
+	int                level;       /* Interrupt level, or 0 */
+	unsigned long long start;
+} span;
+
+static FILE*              g_file;
+static double             g_mhz;
+static span               g_stack[MAX_TIMELINE_DEPTH];
+static unsigned int       g_depth;
+static int                g_interrupt_level;
+static unsigned int       g_interrupt_handler;
+static int                g_idle;
+static unsigned long long g_idle_start;
+
+
+static void write_string(const char* s)
+{
+	fputc('"', g_file);
+	for(; *s; s++)
+	{
+		if(*s == '"' || *s == '\\')
+			fputc('\\', g_file);
+		if((unsigned char)*s >= ' ')
+			fputc(*s, g_file);
+	}
+	fputc('"', g_file);
+}
+
+static void write_complete(const char* name, const char* category, unsigned long long start, unsigned long long end)
+{
+	fprintf(g_file, ",\n{\"name\": ");
+	write_string(name);
+	fprintf(g_file, ", \"cat\": \"%s\", \"ph\": \"X\", \"pid\": 1, \"tid\": %d, \"ts\": %.3f, \"dur\": %.3f}",
+			category, CPU_TID, start / g_mhz, (end - start) / g_mhz);
+}
+
+static void end_idle(unsigned long long cycles)
+{
+	if(!g_idle)
+		return;
+	write_complete("idle", "idle", g_idle_start, cycles);
+	g_idle = 0;
+}
+
+static void pop_span(unsigned long long cycles)
+{
+	const span* s = &g_stack[--g_depth];
+	char buff[256];
+	char name[300];
+
+	if(s->level)
+	{
+		sprintf(name, "irq %d %s", s->level, pc_sample_location_name(s->target, buff));
+		write_complete(name, "interrupt", s->start, cycles);
+	}
+	else
+		write_complete(pc_sample_location_name(s->target, buff), s->exception ? "exception" : "function",
+					   s->start, cycles);
+}
+
+static void push_span(unsigned int target, unsigned int sp, int exception, int level, unsigned long long cycles)
+{
+	if(g_depth == MAX_TIMELINE_DEPTH)
+		return;
+	g_stack[g_depth].target = target;
+	g_stack[g_depth].sp = sp;
+	g_stack[g_depth].exception = exception;
+	g_stack[g_depth].level = level;
+	g_stack[g_depth].start = cycles;
+	g_depth++;
+}
+
+int timeline_start(const char* filename, double mhz)
+{
+	if((g_file = fopen(filename, "w")) == NULL)
+		return 0;
+	g_mhz = mhz;
+	fprintf(g_file, "[\n{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 1, \"args\": {\"name\": \"m68k\"}},\n"
+					"{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": %d, \"args\": {\"name\": \"cpu\"}},\n"
+					"{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": %d, \"args\": {\"name\": \"uart\"}}",
+			CPU_TID, UART_TID);
+	return 1;
+}
+
+void timeline_call(int type, unsigned int pc, unsigned int target, unsigned int sp, unsigned long long cycles)
+{
+	(void)pc;
+	if(g_file == NULL)
+		return;
+	end_idle(cycles);
+	switch(type)
+	{
+		case M68K_CALL_SUBROUTINE:
+			push_span(target, sp, 0, 0, cycles);
+			break;
+		case M68K_CALL_RETURN:
+			while(g_depth && !g_stack[g_depth - 1].exception && g_stack[g_depth - 1].sp < sp)
+				pop_span(cycles);
+			break;
+		case M68K_CALL_EXCEPTION:
+			push_span(target, sp, 1, target == g_interrupt_handler ? g_interrupt_level : 0, cycles);
+			g_interrupt_level = 0;
+			break;
+		case M68K_CALL_EXCEPTION_RETURN:
+		{
+			unsigned int i = g_depth;
+
+			while(i && !g_stack[i - 1].exception)
+				i--;
+			while(i && g_depth >= i)
+				pop_span(cycles);
+			break;
+		}
+	}
+}
+
+void timeline_interrupt(int level, unsigned int handler)
+{
+	g_interrupt_level = level;
+	g_interrupt_handler = handler;
+}
+
+void timeline_stop(unsigned long long cycles)
+{
+	if(g_file == NULL || g_idle)
+		return;
+	g_idle = 1;
+	g_idle_start = cycles;
+}
+
+void timeline_uart(int received, unsigned int value, unsigned long long cycles)
+{
+	if(g_file == NULL)
+		return;
+	fprintf(g_file, ",\n{\"name\": \"%s\", \"cat\": \"uart\", \"ph\": \"i\", \"s\": \"t\", \"pid\": 1, \"tid\": %d, "
+					"\"ts\": %.3f, \"args\": {\"byte\": \"0x%02x\"}}",
+			received ? "rx" : "tx", UART_TID, cycles / g_mhz, value & 0xff);
+}
+
+int timeline_end(unsigned long long cycles)
+{
+	int ok;
+
+	if(g_file == NULL)
+		return 0;
+	end_idle(cycles);
+	while(g_depth)
+		pop_span(cycles);
+	fprintf(g_file, "\n]\n");
+	ok = !ferror(g_file);
+	ok = fclose(g_file) == 0 && ok;
+	g_file = NULL;
+	return ok;
+}
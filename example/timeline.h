@@ -0,0 +1,32 @@
+#ifndef TIMELINE__HEADER
+#define TIMELINE__HEADER
+
+/* Start writing the timeline to filename, with cycle counts turned into
+ * microseconds at a clock of mhz.  Returns 0 if the file could not be
+ * opened.
+ */
+int timeline_start(const char* filename, double mhz);
+
+/* Follow a M68K_CALL_xxx event from the call hook.  sp is A7 after the
+ * event and cycles the cycle count.
+ */
+void timeline_call(int type, unsigned int pc, unsigned int target, unsigned int sp, unsigned long long cycles);
+
+/* The interrupt of level is being acknowledged, and the CPU will jump to
+ * handler.  The next exception is taken as that interrupt only if it
+ * enters handler.
+ */
+void timeline_interrupt(int level, unsigned int handler);
+
+/* The CPU is about to run a STOP instruction and wait for an interrupt */
+void timeline_stop(unsigned long long cycles);
+
+/* A byte went out of the UART, or was read from it if received */
+void timeline_uart(int received, unsigned int value, unsigned long long cycles);
+
+/* End the spans still open at cycles and finish the file.  Returns 0 if
+ * it could not be written.
+ */
+int timeline_end(unsigned long long cycles);
+
+#endif /* TIMELINE__HEADER */
@@ -90,6 +90,115 @@ extern "C" {
 #define M68K_INT_ACK_SPURIOUS      0xfffffffe
 
 
+/* Maximum number of host memory blocks that can be mapped with
+ * m68k_map_direct_memory().
+ */
+#define M68K_DIRECT_MAP_MAX        4
+
+/* Maximum number of triggers set with m68k_trace_buffer_add_trigger() */
+#define M68K_TRACE_MAX_TRIGGERS    8
+
+
+/* Opcode properties in m68k_opcode_info.flags */
+#define M68K_OPINFO_READS_MEMORY    0x0001 /* Reads data memory or the stack */
+#define M68K_OPINFO_WRITES_MEMORY   0x0002 /* Writes data memory or the stack */
+#define M68K_OPINFO_CHANGES_PC      0x0004 /* Branch, jump, call or return */
+#define M68K_OPINFO_ENDS_BLOCK      0x0008 /* Execution may not continue with the next instruction */
+#define M68K_OPINFO_ACCESSES_SR     0x0010 /* Reads or writes the whole status register */
+#define M68K_OPINFO_PRIVILEGED      0x0020 /* Supervisor only on at least one CPU type */
+#define M68K_OPINFO_MAY_TRAP        0x0040 /* May take an exception other than a bus or address error */
+#define M68K_OPINFO_VARIABLE_LENGTH 0x0080 /* length is a minimum (68020+ full index extension, FPU, PMMU) */
+#define M68K_OPINFO_CONDITIONAL     0x0100 /* Conditional branch (Bcc, DBcc) */
+
+/* Bits in m68k_opcode_info.cpus */
+#define M68K_OPINFO_CPU_000         0x01
+#define M68K_OPINFO_CPU_010         0x02
+#define M68K_OPINFO_CPU_020         0x04
+#define M68K_OPINFO_CPU_030         0x08
+#define M68K_OPINFO_CPU_040         0x10
+
+/* Effective address modes in m68k_opcode_info.ea */
+enum
+{
+	M68K_OPINFO_EA_NONE,    /* No effective address operand */
+	M68K_OPINFO_EA_DN,      /* Dn */
+	M68K_OPINFO_EA_AN,      /* An */
+	M68K_OPINFO_EA_AI,      /* (An) */
+	M68K_OPINFO_EA_PI,      /* (An)+ */
+	M68K_OPINFO_EA_PD,      /* -(An) */
+	M68K_OPINFO_EA_DI,      /* (d16,An) */
+	M68K_OPINFO_EA_IX,      /* (d8,An,Xn) and the 68020 extensions */
+	M68K_OPINFO_EA_AW,      /* (xxx).w */
+	M68K_OPINFO_EA_AL,      /* (xxx).l */
+	M68K_OPINFO_EA_PCDI,    /* (d16,PC) */
+	M68K_OPINFO_EA_PCIX,    /* (d8,PC,Xn) and the 68020 extensions */
+	M68K_OPINFO_EA_I,       /* #imm */
+	M68K_OPINFO_NUM_EA
+};
+
+/* Formats for m68k_write_instruction_stats(), m68k_write_memory_heatmap()
+ * and m68k_write_latency_histograms()
+ */
+enum
+{
+	M68K_STATS_CSV,
+	M68K_STATS_JSON
+};
+
+
+/* Control flow of a decoded instruction in m68k_dasm_instruction.flags */
+#define M68K_DASM_FLAG_BRANCH       0x0001 /* May continue somewhere other than the next instruction */
+#define M68K_DASM_FLAG_CONDITIONAL  0x0002 /* Only branches or traps if a condition holds */
+#define M68K_DASM_FLAG_CALL         0x0004 /* Subroutine call (bsr, jsr, callm) */
+#define M68K_DASM_FLAG_RETURN       0x0008 /* Return (rts, rtr, rte, rtd, rtm) */
+#define M68K_DASM_FLAG_TARGET       0x0010 /* The branch destination is known and in target */
+#define M68K_DASM_FLAG_TRAP         0x0020 /* Trap (trap, trapv, trapcc, chk, chk2, bkpt, illegal, line A/F) */
+
+/* Properties of an operand in m68k_dasm_operand.flags */
+#define M68K_DASM_OPFLAG_INDEX      0x0001 /* Has an index register */
+#define M68K_DASM_OPFLAG_INDEX_LONG 0x0002 /* The index register is used as a long */
+#define M68K_DASM_OPFLAG_NO_BASE    0x0004 /* The base register is suppressed */
+#define M68K_DASM_OPFLAG_INDIRECT   0x0008 /* Memory indirect, with the outer displacement */
+#define M68K_DASM_OPFLAG_POSTINDEX  0x0010 /* The index is added after the indirection */
+#define M68K_DASM_OPFLAG_ADDRESS    0x0020 /* value is the address the operand refers to */
+#define M68K_DASM_OPFLAG_REG_OFFSET 0x0040 /* Bit field offset is in data register reg */
+#define M68K_DASM_OPFLAG_REG_WIDTH  0x0080 /* Bit field width is in data register index */
+
+/* Most operands any instruction has in m68k_dasm_instruction */
+#define M68K_DASM_MAX_OPERANDS      4
+
+
+/* What a record in the trace buffer holds, in m68k_trace_record.flags */
+#define M68K_TRACE_WRITE_SIZE       0x03 /* Size of the first write: 1, 2 or 3 for 8, 16 or 32 bits, or 0 */
+#define M68K_TRACE_MORE_WRITES      0x04 /* More than one write, only the first is recorded */
+#define M68K_TRACE_MORE_REGS        0x08 /* More than two registers changed, only the lowest two are recorded */
+#define M68K_TRACE_EXCEPTION        0x10 /* Took the exception in vector */
+#define M68K_TRACE_NO_INSTRUCTION   0x20 /* Exception between instructions (an interrupt), pc is where it was taken */
+
+/* Instruction words kept in a trace record */
+#define M68K_TRACE_MAX_WORDS        5
+
+/* Events that m68k_trace_buffer_add_trigger() can watch for */
+enum
+{
+	M68K_TRACE_TRIGGER_PC,        /* An instruction at the address ran */
+	M68K_TRACE_TRIGGER_WRITE,     /* Memory at the address was written */
+	M68K_TRACE_TRIGGER_EXCEPTION  /* The exception vector was taken */
+};
+
+/* Trigger value matching any address or vector */
+#define M68K_TRACE_TRIGGER_ANY      0xffffffff
+
+/* Events reported to the call hook callback */
+enum
+{
+	M68K_CALL_SUBROUTINE,       /* jsr or bsr */
+	M68K_CALL_RETURN,           /* rts, rtr or rtd */
+	M68K_CALL_EXCEPTION,        /* Exception processing, including interrupts */
+	M68K_CALL_EXCEPTION_RETURN  /* rte */
+};
+
+
 /* CPU types for use in m68k_set_cpu_type() */
 enum
 {
@@ -106,6 +215,288 @@ enum
 	M68K_CPU_TYPE_SCC68070
 };
 
+/* Static information about an opcode, see m68k_get_opcode_info() */
+typedef struct
+{
+	const char*    mnemonic; /* Mnemonic, with the condition for Bcc, Scc and such */
+	const char*    handler;  /* Name of the opcode handler */
+	unsigned char  size;     /* Operation size in bits, or 0 */
+	unsigned char  length;   /* Instruction length in 16-bit words */
+	unsigned char  ea;       /* M68K_OPINFO_EA_xxx mode the handler is for; the source for MOVE */
+	unsigned char  cpus;     /* M68K_OPINFO_CPU_xxx families that have this opcode */
+	unsigned short flags;    /* M68K_OPINFO_xxx */
+} m68k_opcode_info;
+
+/* Counts for one opcode handler, see m68k_get_handler_stats() */
+typedef struct
+{
+	const m68k_opcode_info* info;
+	unsigned long long count;  /* Times the handler ran */
+	unsigned long long cycles; /* Cycles it used, with any exception it took */
+	unsigned long long taken;  /* Times it branched, for M68K_OPINFO_CONDITIONAL handlers */
+} m68k_handler_stats;
+
+/* Bytes of address space counted together in the memory heatmap */
+#define M68K_HEATMAP_LINE_SIZE      256
+
+/* Accesses to one line of memory, see m68k_get_memory_heatmap() */
+typedef struct
+{
+	unsigned int       address; /* First address of the line */
+	unsigned long long reads;   /* Reads in data space */
+	unsigned long long writes;
+	unsigned long long fetches; /* Reads in program space: instruction words and PC relative operands */
+} m68k_heatmap_line;
+
+/* Lines of memory touched in one working set interval, see
+ * m68k_get_working_set()
+ */
+typedef struct
+{
+	unsigned int lines; /* Lines accessed in the interval */
+	unsigned int total; /* Lines accessed since the heatmap was cleared */
+} m68k_working_set;
+
+/* Buckets of an m68k_latency_histogram */
+#define M68K_LATENCY_BUCKETS        32
+
+/* Distribution of a time in clock cycles, see m68k_get_interrupt_latency().
+ * Bucket 0 counts times of 0 cycles, bucket n times of 2^(n-1) to 2^n-1
+ * cycles, and the last bucket everything longer as well.
+ */
+typedef struct
+{
+	unsigned long long count;
+	unsigned long long total; /* Sum of the times */
+	unsigned int       min;
+	unsigned int       max;
+	unsigned long long buckets[M68K_LATENCY_BUCKETS];
+} m68k_latency_histogram;
+
+/* What the CPU has run, see m68k_get_perf_counters() */
+typedef struct
+{
+	unsigned long long instructions; /* Instructions, without exception processing */
+	unsigned long long cycles;       /* Clock cycles returned by m68k_execute() */
+} m68k_perf_counters;
+
+/* Instructions in m68k_dasm_instruction.mnemonic.  Instructions whose
+ * mnemonic includes a condition (Bcc, DBcc, Scc, TRAPcc and the coprocessor
+ * forms) have it in m68k_dasm_instruction.condition instead.
+ */
+enum
+{
+	M68K_INSN_ILLEGAL,
+	M68K_INSN_LINE_A,
+	M68K_INSN_LINE_F,
+	M68K_INSN_ABCD,
+	M68K_INSN_ADD,
+	M68K_INSN_ADDA,
+	M68K_INSN_ADDI,
+	M68K_INSN_ADDQ,
+	M68K_INSN_ADDX,
+	M68K_INSN_AND,
+	M68K_INSN_ANDI,
+	M68K_INSN_ASL,
+	M68K_INSN_ASR,
+	M68K_INSN_BCC,
+	M68K_INSN_BCHG,
+	M68K_INSN_BCLR,
+	M68K_INSN_BFCHG,
+	M68K_INSN_BFCLR,
+	M68K_INSN_BFEXTS,
+	M68K_INSN_BFEXTU,
+	M68K_INSN_BFFFO,
+	M68K_INSN_BFINS,
+	M68K_INSN_BFSET,
+	M68K_INSN_BFTST,
+	M68K_INSN_BKPT,
+	M68K_INSN_BRA,
+	M68K_INSN_BSET,
+	M68K_INSN_BSR,
+	M68K_INSN_BTST,
+	M68K_INSN_CALLM,
+	M68K_INSN_CAS,
+	M68K_INSN_CAS2,
+	M68K_INSN_CHK,
+	M68K_INSN_CHK2,
+	M68K_INSN_CINV,
+	M68K_INSN_CLR,
+	M68K_INSN_CMP,
+	M68K_INSN_CMP2,
+	M68K_INSN_CMPA,
+	M68K_INSN_CMPI,
+	M68K_INSN_CMPM,
+	M68K_INSN_CPBCC,
+	M68K_INSN_CPDBCC,
+	M68K_INSN_CPGEN,
+	M68K_INSN_CPRESTORE,
+	M68K_INSN_CPSAVE,
+	M68K_INSN_CPSCC,
+	M68K_INSN_CPTRAPCC,
+	M68K_INSN_CPUSH,
+	M68K_INSN_DBCC,
+	M68K_INSN_DIVS,
+	M68K_INSN_DIVU,
+	M68K_INSN_EOR,
+	M68K_INSN_EORI,
+	M68K_INSN_EXG,
+	M68K_INSN_EXT,
+	M68K_INSN_EXTB,
+	M68K_INSN_FPU,
+	M68K_INSN_JMP,
+	M68K_INSN_JSR,
+	M68K_INSN_LEA,
+	M68K_INSN_LINK,
+	M68K_INSN_LSL,
+	M68K_INSN_LSR,
+	M68K_INSN_MOVE,
+	M68K_INSN_MOVE16,
+	M68K_INSN_MOVEA,
+	M68K_INSN_MOVEC,
+	M68K_INSN_MOVEM,
+	M68K_INSN_MOVEP,
+	M68K_INSN_MOVEQ,
+	M68K_INSN_MOVES,
+	M68K_INSN_MULS,
+	M68K_INSN_MULU,
+	M68K_INSN_NBCD,
+	M68K_INSN_NEG,
+	M68K_INSN_NEGX,
+	M68K_INSN_NOP,
+	M68K_INSN_NOT,
+	M68K_INSN_OR,
+	M68K_INSN_ORI,
+	M68K_INSN_PACK,
+	M68K_INSN_PBCC,
+	M68K_INSN_PDBCC,
+	M68K_INSN_PEA,
+	M68K_INSN_PFLUSH,
+	M68K_INSN_PMMU,
+	M68K_INSN_RESET,
+	M68K_INSN_ROL,
+	M68K_INSN_ROR,
+	M68K_INSN_ROXL,
+	M68K_INSN_ROXR,
+	M68K_INSN_RTD,
+	M68K_INSN_RTE,
+	M68K_INSN_RTM,
+	M68K_INSN_RTR,
+	M68K_INSN_RTS,
+	M68K_INSN_SBCD,
+	M68K_INSN_SCC,
+	M68K_INSN_STOP,
+	M68K_INSN_SUB,
+	M68K_INSN_SUBA,
+	M68K_INSN_SUBI,
+	M68K_INSN_SUBQ,
+	M68K_INSN_SUBX,
+	M68K_INSN_SWAP,
+	M68K_INSN_TAS,
+	M68K_INSN_TRAP,
+	M68K_INSN_TRAPCC,
+	M68K_INSN_TRAPV,
+	M68K_INSN_TST,
+	M68K_INSN_UNLK,
+	M68K_INSN_UNPK,
+	M68K_INSN_COUNT
+};
+
+/* Operand kinds in m68k_dasm_operand.type */
+enum
+{
+	M68K_DASM_OPERAND_NONE,
+	M68K_DASM_OPERAND_DREG,     /* Dn */
+	M68K_DASM_OPERAND_AREG,     /* An */
+	M68K_DASM_OPERAND_AI,       /* (An) */
+	M68K_DASM_OPERAND_PI,       /* (An)+ */
+	M68K_DASM_OPERAND_PD,       /* -(An) */
+	M68K_DASM_OPERAND_DI,       /* (d16,An) */
+	M68K_DASM_OPERAND_IX,       /* (d8,An,Xn) and the 68020+ full extension modes */
+	M68K_DASM_OPERAND_AW,       /* (xxx).w */
+	M68K_DASM_OPERAND_AL,       /* (xxx).l */
+	M68K_DASM_OPERAND_PCDI,     /* (d16,PC) */
+	M68K_DASM_OPERAND_PCIX,     /* (d8,PC,Xn) and the 68020+ full extension modes */
+	M68K_DASM_OPERAND_IMM,      /* #value */
+	M68K_DASM_OPERAND_TARGET,   /* Branch destination address in value */
+	M68K_DASM_OPERAND_REGLIST,  /* MOVEM list in value, bit 0-7 = D0-D7, bit 8-15 = A0-A7 */
+	M68K_DASM_OPERAND_REGPAIR,  /* reg:index, 0-7 = D0-D7, 8-15 = A0-A7 (mull, divl, cas2) */
+	M68K_DASM_OPERAND_CCR,
+	M68K_DASM_OPERAND_SR,
+	M68K_DASM_OPERAND_USP,
+	M68K_DASM_OPERAND_CONTROL,  /* MOVEC control register, its code in value */
+	M68K_DASM_OPERAND_BITFIELD, /* {offset:width} in reg and index */
+	M68K_DASM_OPERAND_FPREG,    /* FPn */
+	M68K_DASM_OPERAND_FPLIST,   /* FMOVEM list in value, bit n = FPn */
+	M68K_DASM_OPERAND_FPCONTROL /* FPCR, FPSR and FPIAR as bits 12, 11 and 10 of value */
+};
+
+/* One operand of a decoded instruction */
+typedef struct
+{
+	unsigned char  type;         /* M68K_DASM_OPERAND_xxx */
+	unsigned char  reg;          /* Register, base register or bit field offset */
+	unsigned char  index;        /* Index register (0-7 = D0-D7, 8-15 = A0-A7) or bit field width */
+	unsigned char  scale;        /* Index scale factor: 1, 2, 4 or 8 */
+	unsigned short flags;        /* M68K_DASM_OPFLAG_xxx */
+	int            displacement; /* Displacement or base displacement */
+	int            outer;        /* Outer displacement */
+	unsigned int   value;        /* Immediate data, absolute or target address, register list */
+} m68k_dasm_operand;
+
+/* A decoded instruction, filled in by m68k_dasm_decode() */
+typedef struct
+{
+	unsigned int      pc;            /* Address of the instruction */
+	unsigned int      length;        /* Length in bytes */
+	unsigned int      opcode;        /* First word */
+	unsigned short    mnemonic;      /* M68K_INSN_xxx */
+	unsigned char     size;          /* Size suffix in bytes (1, 2 or 4), or 0 */
+	unsigned char     condition;     /* Condition code of Bcc, DBcc, Scc, TRAPcc and such */
+	unsigned int      flags;         /* M68K_DASM_FLAG_xxx */
+	unsigned int      target;        /* Branch destination if M68K_DASM_FLAG_TARGET */
+	unsigned int      operand_count;
+	m68k_dasm_operand operands[M68K_DASM_MAX_OPERANDS];
+} m68k_dasm_instruction;
+
+/* State of one disassembler, see m68k_dasm_init_context().  The fields are
+ * private to m68kdasm.c.
+ */
+typedef struct
+{
+	unsigned int           cpu_type;
+	unsigned int           address_mask;
+	unsigned int           pc;
+	unsigned int           ir;
+	unsigned int           opcode_type;
+	const unsigned char*   buffer;
+	unsigned int           buffer_address;
+	unsigned int           buffer_size;
+	int                    text;
+	m68k_dasm_instruction* insn;
+	char                   str[100];
+	char                   helper_str[100];
+	char                   ea_str[2][64];
+	unsigned int           ea_str_index;
+	char                   hex_str[3][20];
+	char                   imm_str[2][15];
+} m68k_dasm_context;
+
+/* One instruction in the trace buffer, see M68K_TRACE_BUFFER */
+typedef struct
+{
+	unsigned int   pc;              /* Address of the instruction */
+	unsigned int   cycles;          /* Cycles run before it (wraps at 32 bits) */
+	unsigned short words[M68K_TRACE_MAX_WORDS]; /* Opcode and extension words, the rest 0 */
+	unsigned short sr;              /* Status register before the instruction */
+	unsigned short changed;         /* Registers it changed, bit 0-7 for D0-D7, 8-15 for A0-A7 */
+	unsigned char  flags;           /* M68K_TRACE_xxx */
+	unsigned char  vector;          /* Exception vector if M68K_TRACE_EXCEPTION */
+	unsigned int   reg_value[2];    /* New values of the two lowest registers in changed */
+	unsigned int   write_address;   /* First memory write, if M68K_TRACE_WRITE_SIZE is set */
+	unsigned int   write_value;
+} m68k_trace_record;
+
 /* Registers used by m68k_get_reg() and m68k_set_reg() */
 typedef enum
 {
@@ -294,6 +685,38 @@ void m68k_set_fc_callback(void  (*callback)(unsigned int new_fc));
 void m68k_set_instr_hook_callback(void  (*callback)(unsigned int pc));
 
 
+/* Set a callback for subroutine calls, returns and exceptions.
+ * You must enable M68K_CALL_HOOK in m68kconf.h.
+ * The CPU calls this callback with the M68K_CALL_xxx type, the address of
+ * the instruction (for an interrupt, the address it was taken at) and the
+ * address execution continues at.  For calls and returns the return address
+ * has already been pushed or pulled, so A7 points past it.
+ * Default behavior: do nothing.
+ */
+void m68k_set_call_hook_callback(void  (*callback)(int type, unsigned int pc, unsigned int target));
+
+
+/* Set the callback for trace buffer triggers.
+ * You must enable M68K_TRACE_BUFFER in m68kconf.h.
+ * The CPU calls this callback with the M68K_TRACE_TRIGGER_xxx type and the
+ * matching address or vector once the record of the instruction that set
+ * off a trigger is complete, so the callback can save the buffer with
+ * m68k_trace_buffer_write().
+ * Default behavior: do nothing.
+ */
+void m68k_set_trace_trigger_callback(void  (*callback)(unsigned int type, unsigned int value));
+
+
+/* Set the callback for PC samples.
+ * You must enable M68K_SAMPLE_PC in m68kconf.h.
+ * Every m68k_set_pc_sample_period() cycles, the CPU calls this callback
+ * with the address of the instruction it was running.  An instruction that
+ * spans several periods is reported once for each.
+ * Default behavior: do nothing.
+ */
+void m68k_set_pc_sample_callback(void  (*callback)(unsigned int pc));
+
+
 
 /* ======================================================================== */
 /* ====================== FUNCTIONS TO ACCESS THE CPU ===================== */
@@ -376,6 +799,168 @@ unsigned int m68k_get_reg(void* context, m68k_register_t reg);
 /* Poke values into the internals of the currently running CPU context */
 void m68k_set_reg(m68k_register_t reg, unsigned int value);
 
+/* Map a block of host memory directly into the 68k address space.
+ * The CPU may then bypass the memory callbacks and move data in and out of
+ * [address, address+size) through host_ptr for block transfers such as
+ * MOVEM, FMOVEM, FSAVE and dbf loops around a single move (Ay)+, (Ax)+ or
+ * move Dy, (Ax)+, and for bit field operands.  The block must hold plain RAM in 68k (big-endian) byte
+ * order; never map device registers or memory whose accesses have side
+ * effects.  The map is ignored while the PMMU is enabled.
+ * Returns 1 on success, or 0 if M68K_DIRECT_MAP_MAX blocks are already
+ * mapped.
+ */
+int m68k_map_direct_memory(unsigned int address, unsigned int size, unsigned char* host_ptr);
+
+/* Remove all blocks mapped with m68k_map_direct_memory() */
+void m68k_unmap_direct_memory(void);
+
+/* Copy size bytes of 68k memory at address to or from a host buffer.
+ * Memory mapped with m68k_map_direct_memory() is copied directly; anything
+ * else goes through m68k_read_memory_8() and m68k_write_memory_8().
+ * Addresses are physical, the PMMU is not consulted.
+ */
+void m68k_read_block(unsigned int address, unsigned char* buffer, unsigned int size);
+void m68k_write_block(unsigned int address, const unsigned char* buffer, unsigned int size);
+
+/* Get static information about an opcode, as generated by m68kmake from
+ * m68k_in.c.  Opcodes that no CPU type implements return the information
+ * for the illegal instruction handler.
+ */
+const m68k_opcode_info* m68k_get_opcode_info(unsigned int opcode);
+
+/* Write how often each opcode handler has run, in the form m68kmake takes
+ * as its profile file.  Requires M68K_PROFILE_HANDLERS.
+ * Returns 1 on success, or 0 if the file could not be written or profiling
+ * is not compiled in.
+ */
+int m68k_write_handler_profile(const char* filename);
+
+/* Reset the counts written by m68k_write_handler_profile() */
+void m68k_clear_handler_profile(void);
+
+/* Copy the statistics of the first max opcode handlers, by handler index,
+ * to stats.  Entry 0 is the illegal instruction handler.  Returns the
+ * number of handlers, or 0 if M68K_INSTRUCTION_STATS is off.
+ */
+unsigned int m68k_get_handler_stats(m68k_handler_stats* stats, unsigned int max);
+
+/* Copy how often each of the 0x10000 opcodes ran to counts.  Returns 0 if
+ * M68K_INSTRUCTION_STATS is off.
+ */
+int m68k_get_opcode_counts(unsigned long long* counts);
+
+/* Write the handler, effective address mode and opcode statistics as
+ * M68K_STATS_CSV or M68K_STATS_JSON.  Returns 0 if the file could not be
+ * written or M68K_INSTRUCTION_STATS is off.
+ */
+int m68k_write_instruction_stats(const char* filename, int format);
+
+/* Reset the instruction statistics */
+void m68k_clear_instruction_stats(void);
+
+/* Copy the first max lines of memory that have been accessed, in address
+ * order, to lines.  An access counts for the line holding its first byte.
+ * Returns the number of lines accessed, which can be more than max, or 0 if
+ * M68K_MEMORY_HEATMAP is off.
+ */
+unsigned int m68k_get_memory_heatmap(m68k_heatmap_line* lines, unsigned int max);
+
+/* Count the lines of memory accessed in every cycles clock cycles the CPU
+ * runs, or stop counting if cycles is 0 (the default).  Requires
+ * M68K_MEMORY_HEATMAP.
+ */
+void m68k_set_working_set_interval(unsigned int cycles);
+
+/* Copy the working set of the first max intervals that have ended to
+ * points.  Returns the number of intervals that have ended, which can be more
+ * than max, or 0 if M68K_MEMORY_HEATMAP is off.
+ */
+unsigned int m68k_get_working_set(m68k_working_set* points, unsigned int max);
+
+/* Write the access counts of each line of memory accessed and the working
+ * set of each interval as M68K_STATS_CSV or M68K_STATS_JSON.  Returns 0 if
+ * the file could not be written or M68K_MEMORY_HEATMAP is off.
+ */
+int m68k_write_memory_heatmap(const char* filename, int format);
+
+/* Reset the memory heatmap and the working set */
+void m68k_clear_memory_heatmap(void);
+
+/* Copy the histograms of interrupt level (1-7) to latency, the cycles from
+ * m68k_set_irq() raising the level until the CPU took the interrupt, and to
+ * service, the cycles from taking it until the rte returning from it began.
+ * Either may be NULL.  Returns 0 if level is out of range or
+ * M68K_INTERRUPT_LATENCY is off.
+ */
+int m68k_get_interrupt_latency(unsigned int level, m68k_latency_histogram* latency, m68k_latency_histogram* service);
+
+/* As m68k_get_interrupt_latency() for exception vector (0-255).  Only
+ * interrupts have a latency; service counts every exception that was
+ * returned from with rte.
+ */
+int m68k_get_exception_latency(unsigned int vector, m68k_latency_histogram* latency, m68k_latency_histogram* service);
+
+/* Write the latency and service histograms of each interrupt level and
+ * exception vector that was taken as M68K_STATS_CSV or M68K_STATS_JSON.
+ * Returns 0 if the file could not be written or M68K_INTERRUPT_LATENCY is
+ * off.
+ */
+int m68k_write_latency_histograms(const char* filename, int format);
+
+/* Reset the latency histograms */
+void m68k_clear_latency_histograms(void);
+
+/* Copy the number of instructions and cycles run since the counters were
+ * last cleared to counters.  The cycles of a timeslice are added when
+ * m68k_execute() returns.  Returns 0 if M68K_PERF_COUNTERS is off.
+ */
+int m68k_get_perf_counters(m68k_perf_counters* counters);
+
+/* Reset the counters read by m68k_get_perf_counters() */
+void m68k_clear_perf_counters(void);
+
+/* Call the PC sample callback every cycles clock cycles the CPU runs, or
+ * never if cycles is 0 (the default).  Requires M68K_SAMPLE_PC.  A period
+ * that is not a multiple of common loop lengths, such as a prime, keeps the
+ * samples from locking onto one instruction of a loop.
+ */
+void m68k_set_pc_sample_period(unsigned int cycles);
+
+/* Start or stop recording instructions in the trace buffer, a ring of the
+ * last M68K_TRACE_BUFFER_SIZE records.  Requires M68K_TRACE_BUFFER.
+ * Recording starts off.
+ */
+void m68k_trace_buffer_enable(int enable);
+
+/* Empty the trace buffer */
+void m68k_trace_buffer_clear(void);
+
+/* Call the trace trigger callback whenever an event of type happens at
+ * value, which may be M68K_TRACE_TRIGGER_ANY.  Triggers only fire while
+ * recording.  Returns 0 if M68K_TRACE_MAX_TRIGGERS triggers are already set.
+ */
+int m68k_trace_buffer_add_trigger(unsigned int type, unsigned int value);
+
+/* Remove all triggers */
+void m68k_trace_buffer_clear_triggers(void);
+
+/* Copy the last count records, oldest first, to records.  Returns how many
+ * were copied, which is less than count if the buffer holds fewer.
+ */
+unsigned int m68k_trace_buffer_get(m68k_trace_record* records, unsigned int count);
+
+/* Save the last count records (all of them if count is 0) in a binary file
+ * that m68k_trace_buffer_read() loads back.  Returns 1 on success, or 0 if
+ * the file could not be written or the trace buffer is not compiled in.
+ */
+int m68k_trace_buffer_write(const char* filename, unsigned int count);
+
+/* Load at most max records from a file written by m68k_trace_buffer_write().
+ * Returns the number of records, or 0 if the file could not be read.  This
+ * works without M68K_TRACE_BUFFER, so that traces can be decoded offline.
+ */
+unsigned int m68k_trace_buffer_read(const char* filename, m68k_trace_record* records, unsigned int max);
+
 /* Check if an instruction is valid for the specified CPU type */
 unsigned int m68k_is_valid_instruction(unsigned int instruction, unsigned int cpu_type);
 
@@ -389,6 +974,33 @@ unsigned int m68k_disassemble(char* str_buff, unsigned int pc, unsigned int cpu_
  */
 unsigned int m68k_disassemble_raw(char* str_buff, unsigned int pc, const unsigned char* opdata, const unsigned char* argdata, unsigned int cpu_type);
 
+/* The functions above share one set of disassembler state.  The m68k_dasm
+ * functions keep it in a caller provided context instead, so any number of
+ * them can run at once, and they never allocate memory.
+ *
+ * m68k_dasm_init_context() sets up ctx to disassemble for cpu_type, reading
+ * through m68k_read_disassembler_xx().  Returns 0 if cpu_type is unknown.
+ * Unless M68K_DASM_PREBUILT_TABLES is on, the first call also builds tables
+ * shared by all contexts, so do it once before disassembling on several
+ * threads.
+ */
+int m68k_dasm_init_context(m68k_dasm_context* ctx, unsigned int cpu_type);
+
+/* Read instructions from size bytes at data, which hold the 68k memory at
+ * address, instead of through m68k_read_disassembler_xx().  Bytes outside
+ * the buffer read as 0.  Pass NULL to go back to the callbacks.
+ */
+void m68k_dasm_set_buffer(m68k_dasm_context* ctx, const unsigned char* data, unsigned int address, unsigned int size);
+
+/* Decode the instruction at pc into insn and return its length in bytes.
+ * The disassembly text is only formatted if str_buff is not NULL; it takes
+ * at most 200 characters.  insn may also be NULL.
+ */
+unsigned int m68k_dasm_decode(m68k_dasm_context* ctx, unsigned int pc, m68k_dasm_instruction* insn, char* str_buff);
+
+/* Name of an M68K_INSN_xxx mnemonic, such as "add" or "bcc" */
+const char* m68k_dasm_mnemonic_name(unsigned int mnemonic);
+
 
 /* ======================================================================== */
 /* ============================== MAME STUFF ============================== */
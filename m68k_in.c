@@ -109,11 +109,21 @@ XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 M68KMAKE_PROTOTYPE_FOOTER
 
 
-/* Build the opcode handler table */
-void m68ki_build_opcode_table(void);
-
-extern void (*m68ki_instruction_jump_table[0x10000])(void); /* opcode handler jump table */
-extern unsigned char m68ki_cycles[][0x10000];
+/* Opcode handler jump and cycle tables */
+extern void (*const m68ki_instruction_jump_table[0x10000])(void); /* opcode handler jump table */
+extern void (*const m68ki_instruction_jump_table_000[0x10000])(void);
+extern void (*const m68ki_instruction_jump_table_010[0x10000])(void);
+extern void (*const m68ki_instruction_jump_table_020[0x10000])(void);
+extern void (*const m68ki_instruction_jump_table_030[0x10000])(void);
+extern void (*const m68ki_instruction_jump_table_040[0x10000])(void);
+extern const unsigned short m68ki_instruction_index_table[0x10000]; /* opcode to handler index */
+extern void (*const m68ki_instruction_handler_table[])(void);
+extern void (*const m68ki_instruction_handler_table_000[])(void);
+extern void (*const m68ki_instruction_handler_table_010[])(void);
+extern void (*const m68ki_instruction_handler_table_020[])(void);
+extern void (*const m68ki_instruction_handler_table_030[])(void);
+extern void (*const m68ki_instruction_handler_table_040[])(void);
+extern const unsigned char m68ki_cycles[][0x10000];
 
 
 /* ======================================================================== */
@@ -128,147 +138,20 @@ XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 M68KMAKE_TABLE_HEADER
 
 /* ======================================================================== */
-/* ========================= OPCODE TABLE BUILDER ========================= */
+/* ========================== OPCODE JUMP TABLES ========================== */
 /* ======================================================================== */
 
-#include <stdio.h>
-#include "m68kops.h"
-
-#define NUM_CPU_TYPES 5
-
-void  (*m68ki_instruction_jump_table[0x10000])(void); /* opcode handler jump table */
-unsigned char m68ki_cycles[NUM_CPU_TYPES][0x10000]; /* Cycles used by CPU type */
-
-/* This is used to generate the opcode handler jump table */
-typedef struct
-{
-	void (*opcode_handler)(void);        /* handler function */
-	unsigned int  mask;                  /* mask on opcode */
-	unsigned int  match;                 /* what to match after masking */
-	unsigned char cycles[NUM_CPU_TYPES]; /* cycles each cpu type takes */
-} opcode_handler_struct;
-
+/* m68kmake expands these tables to one entry per opcode, so they need no
+ * setup at runtime and end up in read-only data.
+ */
 
-/* Opcode handler table */
-static const opcode_handler_struct m68k_opcode_handler_table[] =
-{
-/*   function                      mask    match    000  010  020  040 */
+#include "m68kops.h"
 
 
 
 XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 M68KMAKE_TABLE_FOOTER
 
-	{0, 0, 0, {0, 0, 0, 0, 0}}
-};
-
-
-/* Build the opcode handler jump table */
-void m68ki_build_opcode_table(void)
-{
-	const opcode_handler_struct *ostruct;
-	int cycle_cost;
-	int instr;
-	int i;
-	int j;
-	int k;
-
-	for(i = 0; i < 0x10000; i++)
-	{
-		/* default to illegal */
-		m68ki_instruction_jump_table[i] = m68k_op_illegal;
-		for(k=0;k<NUM_CPU_TYPES;k++)
-			m68ki_cycles[k][i] = 0;
-	}
-
-	ostruct = m68k_opcode_handler_table;
-	while(ostruct->mask != 0xff00)
-	{
-		for(i = 0;i < 0x10000;i++)
-		{
-			if((i & ostruct->mask) == ostruct->match)
-			{
-				m68ki_instruction_jump_table[i] = ostruct->opcode_handler;
-				for(k=0;k<NUM_CPU_TYPES;k++)
-					m68ki_cycles[k][i] = ostruct->cycles[k];
-			}
-		}
-		ostruct++;
-	}
-	while(ostruct->mask == 0xff00)
-	{
-		for(i = 0;i <= 0xff;i++)
-		{
-			m68ki_instruction_jump_table[ostruct->match | i] = ostruct->opcode_handler;
-			for(k=0;k<NUM_CPU_TYPES;k++)
-				m68ki_cycles[k][ostruct->match | i] = ostruct->cycles[k];
-		}
-		ostruct++;
-	}
-	while(ostruct->mask == 0xf1f8)
-	{
-		for(i = 0;i < 8;i++)
-		{
-			for(j = 0;j < 8;j++)
-			{
-				instr = ostruct->match | (i << 9) | j;
-				m68ki_instruction_jump_table[instr] = ostruct->opcode_handler;
-				for(k=0;k<NUM_CPU_TYPES;k++)
-					m68ki_cycles[k][instr] = ostruct->cycles[k];
-				// For all shift operations with known shift distance (encoded in instruction word)
-				if((instr & 0xf000) == 0xe000 && (!(instr & 0x20)))
-				{
-					// On the 68000 and 68010 shift distance affect execution time.
-					// Add the cycle cost of shifting; 2 times the shift distance
-					cycle_cost = ((((i-1)&7)+1)<<1);
-					m68ki_cycles[0][instr] += cycle_cost;
-					m68ki_cycles[1][instr] += cycle_cost;
-					// On the 68020 shift distance does not affect execution time
-					m68ki_cycles[2][instr] += 0;
-				}
-			}
-		}
-		ostruct++;
-	}
-	while(ostruct->mask == 0xfff0)
-	{
-		for(i = 0;i <= 0x0f;i++)
-		{
-			m68ki_instruction_jump_table[ostruct->match | i] = ostruct->opcode_handler;
-			for(k=0;k<NUM_CPU_TYPES;k++)
-				m68ki_cycles[k][ostruct->match | i] = ostruct->cycles[k];
-		}
-		ostruct++;
-	}
-	while(ostruct->mask == 0xf1ff)
-	{
-		for(i = 0;i <= 0x07;i++)
-		{
-			m68ki_instruction_jump_table[ostruct->match | (i << 9)] = ostruct->opcode_handler;
-			for(k=0;k<NUM_CPU_TYPES;k++)
-				m68ki_cycles[k][ostruct->match | (i << 9)] = ostruct->cycles[k];
-		}
-		ostruct++;
-	}
-	while(ostruct->mask == 0xfff8)
-	{
-		for(i = 0;i <= 0x07;i++)
-		{
-			m68ki_instruction_jump_table[ostruct->match | i] = ostruct->opcode_handler;
-			for(k=0;k<NUM_CPU_TYPES;k++)
-				m68ki_cycles[k][ostruct->match | i] = ostruct->cycles[k];
-		}
-		ostruct++;
-	}
-	while(ostruct->mask == 0xffff)
-	{
-		m68ki_instruction_jump_table[ostruct->match] = ostruct->opcode_handler;
-		for(k=0;k<NUM_CPU_TYPES;k++)
-			m68ki_cycles[k][ostruct->match] = ostruct->cycles[k];
-		ostruct++;
-	}
-}
-
 
 /* ======================================================================== */
 /* ============================== END OF FILE ============================= */
@@ -1073,12 +956,9 @@ M68KMAKE_OP(add, 8, er, d)
 	uint dst = MASK_OUT_ABOVE_8(*r_dst);
 	uint res = src + dst;
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	m68ki_flags_add_8(src, dst, res);
 
-	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -1089,12 +969,9 @@ M68KMAKE_OP(add, 8, er, .)
 	uint dst = MASK_OUT_ABOVE_8(*r_dst);
 	uint res = src + dst;
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	m68ki_flags_add_8(src, dst, res);
 
-	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -1105,12 +982,9 @@ M68KMAKE_OP(add, 16, er, d)
 	uint dst = MASK_OUT_ABOVE_16(*r_dst);
 	uint res = src + dst;
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	m68ki_flags_add_16(src, dst, res);
 
-	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -1121,12 +995,9 @@ M68KMAKE_OP(add, 16, er, a)
 	uint dst = MASK_OUT_ABOVE_16(*r_dst);
 	uint res = src + dst;
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	m68ki_flags_add_16(src, dst, res);
 
-	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -1137,12 +1008,9 @@ M68KMAKE_OP(add, 16, er, .)
 	uint dst = MASK_OUT_ABOVE_16(*r_dst);
 	uint res = src + dst;
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	m68ki_flags_add_16(src, dst, res);
 
-	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -1153,12 +1021,9 @@ M68KMAKE_OP(add, 32, er, d)
 	uint dst = *r_dst;
 	uint res = src + dst;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	m68ki_flags_add_32(src, dst, res);
 
-	*r_dst = FLAG_Z;
+	*r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -1169,12 +1034,9 @@ M68KMAKE_OP(add, 32, er, a)
 	uint dst = *r_dst;
 	uint res = src + dst;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	m68ki_flags_add_32(src, dst, res);
 
-	*r_dst = FLAG_Z;
+	*r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -1185,12 +1047,9 @@ M68KMAKE_OP(add, 32, er, .)
 	uint dst = *r_dst;
 	uint res = src + dst;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	m68ki_flags_add_32(src, dst, res);
 
-	*r_dst = FLAG_Z;
+	*r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -1201,12 +1060,9 @@ M68KMAKE_OP(add, 8, re, .)
 	uint dst = m68ki_read_8(ea);
 	uint res = src + dst;
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	m68ki_flags_add_8(src, dst, res);
 
-	m68ki_write_8(ea, FLAG_Z);
+	m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -1217,12 +1073,9 @@ M68KMAKE_OP(add, 16, re, .)
 	uint dst = m68ki_read_16(ea);
 	uint res = src + dst;
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	m68ki_flags_add_16(src, dst, res);
 
-	m68ki_write_16(ea, FLAG_Z);
+	m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -1233,12 +1086,9 @@ M68KMAKE_OP(add, 32, re, .)
 	uint dst = m68ki_read_32(ea);
 	uint res = src + dst;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	m68ki_flags_add_32(src, dst, res);
 
-	m68ki_write_32(ea, FLAG_Z);
+	m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -1299,12 +1149,9 @@ M68KMAKE_OP(addi, 8, ., d)
 	uint dst = MASK_OUT_ABOVE_8(*r_dst);
 	uint res = src + dst;
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	m68ki_flags_add_8(src, dst, res);
 
-	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -1315,12 +1162,9 @@ M68KMAKE_OP(addi, 8, ., .)
 	uint dst = m68ki_read_8(ea);
 	uint res = src + dst;
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	m68ki_flags_add_8(src, dst, res);
 
-	m68ki_write_8(ea, FLAG_Z);
+	m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -1331,12 +1175,9 @@ M68KMAKE_OP(addi, 16, ., d)
 	uint dst = MASK_OUT_ABOVE_16(*r_dst);
 	uint res = src + dst;
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	m68ki_flags_add_16(src, dst, res);
 
-	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -1347,12 +1188,9 @@ M68KMAKE_OP(addi, 16, ., .)
 	uint dst = m68ki_read_16(ea);
 	uint res = src + dst;
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	m68ki_flags_add_16(src, dst, res);
 
-	m68ki_write_16(ea, FLAG_Z);
+	m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -1363,12 +1201,9 @@ M68KMAKE_OP(addi, 32, ., d)
 	uint dst = *r_dst;
 	uint res = src + dst;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	m68ki_flags_add_32(src, dst, res);
 
-	*r_dst = FLAG_Z;
+	*r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -1379,12 +1214,9 @@ M68KMAKE_OP(addi, 32, ., .)
 	uint dst = m68ki_read_32(ea);
 	uint res = src + dst;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	m68ki_flags_add_32(src, dst, res);
 
-	m68ki_write_32(ea, FLAG_Z);
+	m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -1395,12 +1227,9 @@ M68KMAKE_OP(addq, 8, ., d)
 	uint dst = MASK_OUT_ABOVE_8(*r_dst);
 	uint res = src + dst;
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	m68ki_flags_add_8(src, dst, res);
 
-	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -1411,12 +1240,9 @@ M68KMAKE_OP(addq, 8, ., .)
 	uint dst = m68ki_read_8(ea);
 	uint res = src + dst;
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	m68ki_flags_add_8(src, dst, res);
 
-	m68ki_write_8(ea, FLAG_Z);
+	m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -1427,12 +1253,9 @@ M68KMAKE_OP(addq, 16, ., d)
 	uint dst = MASK_OUT_ABOVE_16(*r_dst);
 	uint res = src + dst;
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	m68ki_flags_add_16(src, dst, res);
 
-	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -1451,12 +1274,9 @@ M68KMAKE_OP(addq, 16, ., .)
 	uint dst = m68ki_read_16(ea);
 	uint res = src + dst;
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	m68ki_flags_add_16(src, dst, res);
 
-	m68ki_write_16(ea, FLAG_Z);
+	m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -1467,12 +1287,9 @@ M68KMAKE_OP(addq, 32, ., d)
 	uint dst = *r_dst;
 	uint res = src + dst;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	m68ki_flags_add_32(src, dst, res);
 
-	*r_dst = FLAG_Z;
+	*r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -1492,12 +1309,9 @@ M68KMAKE_OP(addq, 32, ., .)
 	uint res = src + dst;
 
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
-	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	m68ki_flags_add_32(src, dst, res);
 
-	m68ki_write_32(ea, FLAG_Z);
+	m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -1756,10 +1570,7 @@ M68KMAKE_OP(and, 32, re, .)
 	uint ea = M68KMAKE_GET_EA_AY_32;
 	uint res = DX & m68ki_read_32(ea);
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 
 	m68ki_write_32(ea, res);
 }
@@ -1781,10 +1592,7 @@ M68KMAKE_OP(andi, 8, ., .)
 	uint ea = M68KMAKE_GET_EA_AY_8;
 	uint res = src & m68ki_read_8(ea);
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 
 	m68ki_write_8(ea, res);
 }
@@ -1806,10 +1614,7 @@ M68KMAKE_OP(andi, 16, ., .)
 	uint ea = M68KMAKE_GET_EA_AY_16;
 	uint res = src & m68ki_read_16(ea);
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 
 	m68ki_write_16(ea, res);
 }
@@ -1831,10 +1636,7 @@ M68KMAKE_OP(andi, 32, ., .)
 	uint ea = M68KMAKE_GET_EA_AY_32;
 	uint res = src & m68ki_read_32(ea);
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 
 	m68ki_write_32(ea, res);
 }
@@ -2290,6 +2092,7 @@ M68KMAKE_OP(bcc, 8, ., .)
 {
 	if(M68KMAKE_CC)
 	{
+		m68ki_stats_branch_taken();   /* auto-disable (see m68kcpu.h) */
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 		m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
 		return;
@@ -2304,6 +2107,7 @@ M68KMAKE_OP(bcc, 16, ., .)
 	{
 		uint offset = OPER_I_16();
 		REG_PC -= 2;
+		m68ki_stats_branch_taken();   /* auto-disable (see m68kcpu.h) */
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 		m68ki_branch_16(offset);
 		return;
@@ -2321,6 +2125,7 @@ M68KMAKE_OP(bcc, 32, ., .)
 		{
 			uint offset = OPER_I_32();
 			REG_PC -= 4;
+			m68ki_stats_branch_taken();   /* auto-disable (see m68kcpu.h) */
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 			m68ki_branch_32(offset);
 			return;
@@ -2332,6 +2137,7 @@ M68KMAKE_OP(bcc, 32, ., .)
 	{
 		if(M68KMAKE_CC)
 		{
+			m68ki_stats_branch_taken();   /* auto-disable (see m68kcpu.h) */
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 			m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
 			return;
@@ -2470,8 +2276,8 @@ M68KMAKE_OP(bfchg, 32, ., .)
 		uint mask_base;
 		uint data_long;
 		uint mask_long;
-		uint data_byte = 0;
-		uint mask_byte = 0;
+		uint data_byte;
+		uint mask_byte;
 		uint ea = M68KMAKE_GET_EA_AY_8;
 
 
@@ -2492,22 +2298,15 @@ M68KMAKE_OP(bfchg, 32, ., .)
 
 		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
 		mask_long = mask_base >> offset;
+		mask_byte = MASK_OUT_ABOVE_8(mask_base << (8 - offset));
 
-		data_long = m68ki_read_32(ea);
+		data_long = m68ki_read_bitfield(ea, offset, width, &data_byte);
 		FLAG_N = NFLAG_32(data_long << offset);
-		FLAG_Z = data_long & mask_long;
+		FLAG_Z = (data_long & mask_long) | (data_byte & mask_byte);
 		FLAG_V = VFLAG_CLEAR;
 		FLAG_C = CFLAG_CLEAR;
 
-		m68ki_write_32(ea, data_long ^ mask_long);
-
-		if((width + offset) > 32)
-		{
-			mask_byte = MASK_OUT_ABOVE_8(mask_base);
-			data_byte = m68ki_read_8(ea+4);
-			FLAG_Z |= (data_byte & mask_byte);
-			m68ki_write_8(ea+4, data_byte ^ mask_byte);
-		}
+		m68ki_write_bitfield(ea, offset, width, data_long ^ mask_long, data_byte ^ mask_byte);
 		return;
 	}
 	m68ki_exception_illegal();
@@ -2561,8 +2360,8 @@ M68KMAKE_OP(bfclr, 32, ., .)
 		uint mask_base;
 		uint data_long;
 		uint mask_long;
-		uint data_byte = 0;
-		uint mask_byte = 0;
+		uint data_byte;
+		uint mask_byte;
 		uint ea = M68KMAKE_GET_EA_AY_8;
 
 
@@ -2583,22 +2382,15 @@ M68KMAKE_OP(bfclr, 32, ., .)
 
 		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
 		mask_long = mask_base >> offset;
+		mask_byte = MASK_OUT_ABOVE_8(mask_base << (8 - offset));
 
-		data_long = m68ki_read_32(ea);
+		data_long = m68ki_read_bitfield(ea, offset, width, &data_byte);
 		FLAG_N = NFLAG_32(data_long << offset);
-		FLAG_Z = data_long & mask_long;
+		FLAG_Z = (data_long & mask_long) | (data_byte & mask_byte);
 		FLAG_V = VFLAG_CLEAR;
 		FLAG_C = CFLAG_CLEAR;
 
-		m68ki_write_32(ea, data_long & ~mask_long);
-
-		if((width + offset) > 32)
-		{
-			mask_byte = MASK_OUT_ABOVE_8(mask_base);
-			data_byte = m68ki_read_8(ea+4);
-			FLAG_Z |= (data_byte & mask_byte);
-			m68ki_write_8(ea+4, data_byte & ~mask_byte);
-		}
+		m68ki_write_bitfield(ea, offset, width, data_long & ~mask_long, data_byte & ~mask_byte);
 		return;
 	}
 	m68ki_exception_illegal();
@@ -2647,6 +2439,7 @@ M68KMAKE_OP(bfexts, 32, ., .)
 		sint offset = (word2>>6)&31;
 		uint width = word2;
 		uint data;
+		uint data_byte;
 		uint ea = M68KMAKE_GET_EA_AY_8;
 
 
@@ -2665,12 +2458,8 @@ M68KMAKE_OP(bfexts, 32, ., .)
 		}
 		width = ((width-1) & 31) + 1;
 
-		data = m68ki_read_32(ea);
-
-		data = MASK_OUT_ABOVE_32(data<<offset);
-
-		if((offset+width) > 32)
-			data |= (m68ki_read_8(ea+4) << offset) >> 8;
+		data = m68ki_read_bitfield(ea, offset, width, &data_byte);
+		data = MASK_OUT_ABOVE_32(data<<offset) | ((data_byte << offset) >> 8);
 
 		FLAG_N = NFLAG_32(data);
 		data  = MAKE_INT_32(data) >> (32 - width);
@@ -2729,6 +2518,7 @@ M68KMAKE_OP(bfextu, 32, ., .)
 		sint offset = (word2>>6)&31;
 		uint width = word2;
 		uint data;
+		uint data_byte;
 		uint ea = M68KMAKE_GET_EA_AY_8;
 
 
@@ -2747,11 +2537,8 @@ M68KMAKE_OP(bfextu, 32, ., .)
 		}
 		width = ((width-1) & 31) + 1;
 
-		data = m68ki_read_32(ea);
-		data = MASK_OUT_ABOVE_32(data<<offset);
-
-		if((offset+width) > 32)
-			data |= (m68ki_read_8(ea+4) << offset) >> 8;
+		data = m68ki_read_bitfield(ea, offset, width, &data_byte);
+		data = MASK_OUT_ABOVE_32(data<<offset) | ((data_byte << offset) >> 8);
 
 		FLAG_N = NFLAG_32(data);
 		data  >>= (32 - width);
@@ -2776,7 +2563,6 @@ M68KMAKE_OP(bfffo, 32, ., d)
 		uint offset = (word2>>6)&31;
 		uint width = word2;
 		uint64 data = DY;
-		uint bit;
 
 
 		if(BIT_B(word2))
@@ -2795,10 +2581,7 @@ M68KMAKE_OP(bfffo, 32, ., d)
 		FLAG_V = VFLAG_CLEAR;
 		FLAG_C = CFLAG_CLEAR;
 
-		for(bit = 1<<(width-1);bit && !(data & bit);bit>>= 1)
-			offset++;
-
-		REG_D[(word2>>12)&7] = offset;
+		REG_D[(word2>>12)&7] = offset + m68ki_bitfield_ffo(data, width);
 
 		return;
 	}
@@ -2815,7 +2598,7 @@ M68KMAKE_OP(bfffo, 32, ., .)
 		sint local_offset;
 		uint width = word2;
 		uint data;
-		uint bit;
+		uint data_byte;
 		uint ea = M68KMAKE_GET_EA_AY_8;
 
 
@@ -2834,11 +2617,8 @@ M68KMAKE_OP(bfffo, 32, ., .)
 		}
 		width = ((width-1) & 31) + 1;
 
-		data = m68ki_read_32(ea);
-		data = MASK_OUT_ABOVE_32(data<<local_offset);
-
-		if((local_offset+width) > 32)
-			data |= (m68ki_read_8(ea+4) << local_offset) >> 8;
+		data = m68ki_read_bitfield(ea, local_offset, width, &data_byte);
+		data = MASK_OUT_ABOVE_32(data<<local_offset) | ((data_byte << local_offset) >> 8);
 
 		FLAG_N = NFLAG_32(data);
 		data  >>= (32 - width);
@@ -2847,10 +2627,7 @@ M68KMAKE_OP(bfffo, 32, ., .)
 		FLAG_V = VFLAG_CLEAR;
 		FLAG_C = CFLAG_CLEAR;
 
-		for(bit = 1<<(width-1);bit && !(data & bit);bit>>= 1)
-			offset++;
-
-		REG_D[(word2>>12)&7] = offset;
+		REG_D[(word2>>12)&7] = offset + m68ki_bitfield_ffo(data, width);
 
 		return;
 	}
@@ -2913,8 +2690,8 @@ M68KMAKE_OP(bfins, 32, ., .)
 		uint mask_base;
 		uint data_long;
 		uint mask_long;
-		uint data_byte = 0;
-		uint mask_byte = 0;
+		uint data_byte;
+		uint mask_byte;
 		uint ea = M68KMAKE_GET_EA_AY_8;
 
 
@@ -2935,26 +2712,21 @@ M68KMAKE_OP(bfins, 32, ., .)
 
 		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
 		mask_long = mask_base >> offset;
+		mask_byte = MASK_OUT_ABOVE_8(mask_base << (8 - offset));
 
 		insert_base = MASK_OUT_ABOVE_32(insert_base << (32 - width));
 		FLAG_N = NFLAG_32(insert_base);
 		FLAG_Z = insert_base;
 		insert_long = insert_base >> offset;
+		insert_byte = MASK_OUT_ABOVE_8(insert_base << (8 - offset));
 
-		data_long = m68ki_read_32(ea);
+		data_long = m68ki_read_bitfield(ea, offset, width, &data_byte);
 		FLAG_V = VFLAG_CLEAR;
 		FLAG_C = CFLAG_CLEAR;
 
-		m68ki_write_32(ea, (data_long & ~mask_long) | insert_long);
-
-		if((width + offset) > 32)
-		{
-			mask_byte = MASK_OUT_ABOVE_8(mask_base);
-			insert_byte = MASK_OUT_ABOVE_8(insert_base);
-			data_byte = m68ki_read_8(ea+4);
-			FLAG_Z |= (data_byte & mask_byte);
-			m68ki_write_8(ea+4, (data_byte & ~mask_byte) | insert_byte);
-		}
+		data_long = (data_long & ~mask_long) | insert_long;
+		data_byte = (data_byte & ~mask_byte) | insert_byte;
+		m68ki_write_bitfield(ea, offset, width, data_long, data_byte);
 		return;
 	}
 	m68ki_exception_illegal();
@@ -3008,8 +2780,8 @@ M68KMAKE_OP(bfset, 32, ., .)
 		uint mask_base;
 		uint data_long;
 		uint mask_long;
-		uint data_byte = 0;
-		uint mask_byte = 0;
+		uint data_byte;
+		uint mask_byte;
 		uint ea = M68KMAKE_GET_EA_AY_8;
 
 
@@ -3031,22 +2803,15 @@ M68KMAKE_OP(bfset, 32, ., .)
 
 		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
 		mask_long = mask_base >> offset;
+		mask_byte = MASK_OUT_ABOVE_8(mask_base << (8 - offset));
 
-		data_long = m68ki_read_32(ea);
+		data_long = m68ki_read_bitfield(ea, offset, width, &data_byte);
 		FLAG_N = NFLAG_32(data_long << offset);
-		FLAG_Z = data_long & mask_long;
+		FLAG_Z = (data_long & mask_long) | (data_byte & mask_byte);
 		FLAG_V = VFLAG_CLEAR;
 		FLAG_C = CFLAG_CLEAR;
 
-		m68ki_write_32(ea, data_long | mask_long);
-
-		if((width + offset) > 32)
-		{
-			mask_byte = MASK_OUT_ABOVE_8(mask_base);
-			data_byte = m68ki_read_8(ea+4);
-			FLAG_Z |= (data_byte & mask_byte);
-			m68ki_write_8(ea+4, data_byte | mask_byte);
-		}
+		m68ki_write_bitfield(ea, offset, width, data_long | mask_long, data_byte | mask_byte);
 		return;
 	}
 	m68ki_exception_illegal();
@@ -3098,8 +2863,8 @@ M68KMAKE_OP(bftst, 32, ., .)
 		uint mask_base;
 		uint data_long;
 		uint mask_long;
-		uint data_byte = 0;
-		uint mask_byte = 0;
+		uint data_byte;
+		uint mask_byte;
 		uint ea = M68KMAKE_GET_EA_AY_8;
 
 		if(BIT_B(word2))
@@ -3120,19 +2885,13 @@ M68KMAKE_OP(bftst, 32, ., .)
 
 		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
 		mask_long = mask_base >> offset;
+		mask_byte = MASK_OUT_ABOVE_8(mask_base << (8 - offset));
 
-		data_long = m68ki_read_32(ea);
-		FLAG_N = ((data_long & (0x80000000 >> offset))<<offset)>>24;
-		FLAG_Z = data_long & mask_long;
+		data_long = m68ki_read_bitfield(ea, offset, width, &data_byte);
+		FLAG_N = NFLAG_32(data_long << offset);
+		FLAG_Z = (data_long & mask_long) | (data_byte & mask_byte);
 		FLAG_V = VFLAG_CLEAR;
 		FLAG_C = CFLAG_CLEAR;
-
-		if((width + offset) > 32)
-		{
-			mask_byte = MASK_OUT_ABOVE_8(mask_base);
-			data_byte = m68ki_read_8(ea+4);
-			FLAG_Z |= (data_byte & mask_byte);
-		}
 		return;
 	}
 	m68ki_exception_illegal();
@@ -3238,6 +2997,7 @@ M68KMAKE_OP(bsr, 8, ., .)
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
 	m68ki_push_32(REG_PC);
 	m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+	m68ki_call_hook(M68K_CALL_SUBROUTINE, REG_PPC, REG_PC); /* auto-disable (see m68kcpu.h) */
 }
 
 
@@ -3248,6 +3008,7 @@ M68KMAKE_OP(bsr, 16, ., .)
 	m68ki_push_32(REG_PC);
 	REG_PC -= 2;
 	m68ki_branch_16(offset);
+	m68ki_call_hook(M68K_CALL_SUBROUTINE, REG_PPC, REG_PC); /* auto-disable (see m68kcpu.h) */
 }
 
 
@@ -3260,6 +3021,7 @@ M68KMAKE_OP(bsr, 32, ., .)
 		m68ki_push_32(REG_PC);
 		REG_PC -= 4;
 		m68ki_branch_32(offset);
+		m68ki_call_hook(M68K_CALL_SUBROUTINE, REG_PPC, REG_PC); /* auto-disable (see m68kcpu.h) */
 		return;
 	}
 	else
@@ -3267,6 +3029,7 @@ M68KMAKE_OP(bsr, 32, ., .)
 		m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
 		m68ki_push_32(REG_PC);
 		m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+		m68ki_call_hook(M68K_CALL_SUBROUTINE, REG_PPC, REG_PC); /* auto-disable (see m68kcpu.h) */
 	}
 }
 
@@ -3863,10 +3626,7 @@ M68KMAKE_OP(cmp, 8, ., d)
 	uint dst = MASK_OUT_ABOVE_8(DX);
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
-	FLAG_C = CFLAG_8(res);
+	m68ki_flags_cmp_8(src, dst, res);
 }
 
 
@@ -3876,10 +3636,7 @@ M68KMAKE_OP(cmp, 8, ., .)
 	uint dst = MASK_OUT_ABOVE_8(DX);
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
-	FLAG_C = CFLAG_8(res);
+	m68ki_flags_cmp_8(src, dst, res);
 }
 
 
@@ -3889,10 +3646,7 @@ M68KMAKE_OP(cmp, 16, ., d)
 	uint dst = MASK_OUT_ABOVE_16(DX);
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
-	FLAG_C = CFLAG_16(res);
+	m68ki_flags_cmp_16(src, dst, res);
 }
 
 
@@ -3902,10 +3656,7 @@ M68KMAKE_OP(cmp, 16, ., a)
 	uint dst = MASK_OUT_ABOVE_16(DX);
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
-	FLAG_C = CFLAG_16(res);
+	m68ki_flags_cmp_16(src, dst, res);
 }
 
 
@@ -3915,10 +3666,7 @@ M68KMAKE_OP(cmp, 16, ., .)
 	uint dst = MASK_OUT_ABOVE_16(DX);
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
-	FLAG_C = CFLAG_16(res);
+	m68ki_flags_cmp_16(src, dst, res);
 }
 
 
@@ -3928,10 +3676,7 @@ M68KMAKE_OP(cmp, 32, ., d)
 	uint dst = DX;
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
-	FLAG_C = CFLAG_SUB_32(src, dst, res);
+	m68ki_flags_cmp_32(src, dst, res);
 }
 
 
@@ -3941,10 +3686,7 @@ M68KMAKE_OP(cmp, 32, ., a)
 	uint dst = DX;
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
-	FLAG_C = CFLAG_SUB_32(src, dst, res);
+	m68ki_flags_cmp_32(src, dst, res);
 }
 
 
@@ -3954,10 +3696,7 @@ M68KMAKE_OP(cmp, 32, ., .)
 	uint dst = DX;
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
-	FLAG_C = CFLAG_SUB_32(src, dst, res);
+	m68ki_flags_cmp_32(src, dst, res);
 }
 
 
@@ -3967,10 +3706,7 @@ M68KMAKE_OP(cmpa, 16, ., d)
 	uint dst = AX;
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
-	FLAG_C = CFLAG_SUB_32(src, dst, res);
+	m68ki_flags_cmp_32(src, dst, res);
 }
 
 
@@ -3980,10 +3716,7 @@ M68KMAKE_OP(cmpa, 16, ., a)
 	uint dst = AX;
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
-	FLAG_C = CFLAG_SUB_32(src, dst, res);
+	m68ki_flags_cmp_32(src, dst, res);
 }
 
 
@@ -3993,10 +3726,7 @@ M68KMAKE_OP(cmpa, 16, ., .)
 	uint dst = AX;
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
-	FLAG_C = CFLAG_SUB_32(src, dst, res);
+	m68ki_flags_cmp_32(src, dst, res);
 }
 
 
@@ -4006,10 +3736,7 @@ M68KMAKE_OP(cmpa, 32, ., d)
 	uint dst = AX;
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
-	FLAG_C = CFLAG_SUB_32(src, dst, res);
+	m68ki_flags_cmp_32(src, dst, res);
 }
 
 
@@ -4019,10 +3746,7 @@ M68KMAKE_OP(cmpa, 32, ., a)
 	uint dst = AX;
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
-	FLAG_C = CFLAG_SUB_32(src, dst, res);
+	m68ki_flags_cmp_32(src, dst, res);
 }
 
 
@@ -4032,10 +3756,7 @@ M68KMAKE_OP(cmpa, 32, ., .)
 	uint dst = AX;
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
-	FLAG_C = CFLAG_SUB_32(src, dst, res);
+	m68ki_flags_cmp_32(src, dst, res);
 }
 
 
@@ -4045,10 +3766,7 @@ M68KMAKE_OP(cmpi, 8, ., d)
 	uint dst = MASK_OUT_ABOVE_8(DY);
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
-	FLAG_C = CFLAG_8(res);
+	m68ki_flags_cmp_8(src, dst, res);
 }
 
 
@@ -4058,10 +3776,7 @@ M68KMAKE_OP(cmpi, 8, ., .)
 	uint dst = M68KMAKE_GET_OPER_AY_8;
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
-	FLAG_C = CFLAG_8(res);
+	m68ki_flags_cmp_8(src, dst, res);
 }
 
 
@@ -4073,10 +3788,7 @@ M68KMAKE_OP(cmpi, 8, ., pcdi)
 		uint dst = OPER_PCDI_8();
 		uint res = dst - src;
 
-		FLAG_N = NFLAG_8(res);
-		FLAG_Z = MASK_OUT_ABOVE_8(res);
-		FLAG_V = VFLAG_SUB_8(src, dst, res);
-		FLAG_C = CFLAG_8(res);
+		m68ki_flags_cmp_8(src, dst, res);
 		return;
 	}
 	m68ki_exception_illegal();
@@ -4091,10 +3803,7 @@ M68KMAKE_OP(cmpi, 8, ., pcix)
 		uint dst = OPER_PCIX_8();
 		uint res = dst - src;
 
-		FLAG_N = NFLAG_8(res);
-		FLAG_Z = MASK_OUT_ABOVE_8(res);
-		FLAG_V = VFLAG_SUB_8(src, dst, res);
-		FLAG_C = CFLAG_8(res);
+		m68ki_flags_cmp_8(src, dst, res);
 		return;
 	}
 	m68ki_exception_illegal();
@@ -4107,10 +3816,7 @@ M68KMAKE_OP(cmpi, 16, ., d)
 	uint dst = MASK_OUT_ABOVE_16(DY);
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
-	FLAG_C = CFLAG_16(res);
+	m68ki_flags_cmp_16(src, dst, res);
 }
 
 
@@ -4120,10 +3826,7 @@ M68KMAKE_OP(cmpi, 16, ., .)
 	uint dst = M68KMAKE_GET_OPER_AY_16;
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
-	FLAG_C = CFLAG_16(res);
+	m68ki_flags_cmp_16(src, dst, res);
 }
 
 
@@ -4135,10 +3838,7 @@ M68KMAKE_OP(cmpi, 16, ., pcdi)
 		uint dst = OPER_PCDI_16();
 		uint res = dst - src;
 
-		FLAG_N = NFLAG_16(res);
-		FLAG_Z = MASK_OUT_ABOVE_16(res);
-		FLAG_V = VFLAG_SUB_16(src, dst, res);
-		FLAG_C = CFLAG_16(res);
+		m68ki_flags_cmp_16(src, dst, res);
 		return;
 	}
 	m68ki_exception_illegal();
@@ -4153,10 +3853,7 @@ M68KMAKE_OP(cmpi, 16, ., pcix)
 		uint dst = OPER_PCIX_16();
 		uint res = dst - src;
 
-		FLAG_N = NFLAG_16(res);
-		FLAG_Z = MASK_OUT_ABOVE_16(res);
-		FLAG_V = VFLAG_SUB_16(src, dst, res);
-		FLAG_C = CFLAG_16(res);
+		m68ki_flags_cmp_16(src, dst, res);
 		return;
 	}
 	m68ki_exception_illegal();
@@ -4170,10 +3867,7 @@ M68KMAKE_OP(cmpi, 32, ., d)
 	uint res = dst - src;
 
 	m68ki_cmpild_callback(src, REG_IR & 7);		   /* auto-disable (see m68kcpu.h) */
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
-	FLAG_C = CFLAG_SUB_32(src, dst, res);
+	m68ki_flags_cmp_32(src, dst, res);
 }
 
 
@@ -4183,10 +3877,7 @@ M68KMAKE_OP(cmpi, 32, ., .)
 	uint dst = M68KMAKE_GET_OPER_AY_32;
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
-	FLAG_C = CFLAG_SUB_32(src, dst, res);
+	m68ki_flags_cmp_32(src, dst, res);
 }
 
 
@@ -4198,10 +3889,7 @@ M68KMAKE_OP(cmpi, 32, ., pcdi)
 		uint dst = OPER_PCDI_32();
 		uint res = dst - src;
 
-		FLAG_N = NFLAG_32(res);
-		FLAG_Z = MASK_OUT_ABOVE_32(res);
-		FLAG_V = VFLAG_SUB_32(src, dst, res);
-		FLAG_C = CFLAG_SUB_32(src, dst, res);
+		m68ki_flags_cmp_32(src, dst, res);
 		return;
 	}
 	m68ki_exception_illegal();
@@ -4216,10 +3904,7 @@ M68KMAKE_OP(cmpi, 32, ., pcix)
 		uint dst = OPER_PCIX_32();
 		uint res = dst - src;
 
-		FLAG_N = NFLAG_32(res);
-		FLAG_Z = MASK_OUT_ABOVE_32(res);
-		FLAG_V = VFLAG_SUB_32(src, dst, res);
-		FLAG_C = CFLAG_SUB_32(src, dst, res);
+		m68ki_flags_cmp_32(src, dst, res);
 		return;
 	}
 	m68ki_exception_illegal();
@@ -4232,10 +3917,7 @@ M68KMAKE_OP(cmpm, 8, ., ax7)
 	uint dst = OPER_A7_PI_8();
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
-	FLAG_C = CFLAG_8(res);
+	m68ki_flags_cmp_8(src, dst, res);
 }
 
 
@@ -4245,10 +3927,7 @@ M68KMAKE_OP(cmpm, 8, ., ay7)
 	uint dst = OPER_AX_PI_8();
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
-	FLAG_C = CFLAG_8(res);
+	m68ki_flags_cmp_8(src, dst, res);
 }
 
 
@@ -4258,10 +3937,7 @@ M68KMAKE_OP(cmpm, 8, ., axy7)
 	uint dst = OPER_A7_PI_8();
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
-	FLAG_C = CFLAG_8(res);
+	m68ki_flags_cmp_8(src, dst, res);
 }
 
 
@@ -4271,10 +3947,7 @@ M68KMAKE_OP(cmpm, 8, ., .)
 	uint dst = OPER_AX_PI_8();
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
-	FLAG_C = CFLAG_8(res);
+	m68ki_flags_cmp_8(src, dst, res);
 }
 
 
@@ -4284,10 +3957,7 @@ M68KMAKE_OP(cmpm, 16, ., .)
 	uint dst = OPER_AX_PI_16();
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
-	FLAG_C = CFLAG_16(res);
+	m68ki_flags_cmp_16(src, dst, res);
 }
 
 
@@ -4297,10 +3967,7 @@ M68KMAKE_OP(cmpm, 32, ., .)
 	uint dst = OPER_AX_PI_32();
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
-	FLAG_C = CFLAG_SUB_32(src, dst, res);
+	m68ki_flags_cmp_32(src, dst, res);
 }
 
 
@@ -4387,9 +4054,12 @@ M68KMAKE_OP(dbf, 16, ., .)
 	{
 		uint offset = OPER_I_16();
 		REG_PC -= 2;
+		m68ki_stats_branch_taken();   /* auto-disable (see m68kcpu.h) */
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 		m68ki_branch_16(offset);
 		USE_CYCLES(CYC_DBCC_F_NOEXP);
+		if(offset == 0xfffc)
+			m68ki_dbf_block_loop(r_dst);
 		return;
 	}
 	REG_PC += 2;
@@ -4409,6 +4079,7 @@ M68KMAKE_OP(dbcc, 16, ., .)
 		{
 			uint offset = OPER_I_16();
 			REG_PC -= 2;
+			m68ki_stats_branch_taken();   /* auto-disable (see m68kcpu.h) */
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 			m68ki_branch_16(offset);
 			USE_CYCLES(CYC_DBCC_F_NOEXP);
@@ -4976,10 +4647,7 @@ M68KMAKE_OP(eor, 8, ., d)
 {
 	uint res = MASK_OUT_ABOVE_8(DY ^= MASK_OUT_ABOVE_8(DX));
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -4990,10 +4658,7 @@ M68KMAKE_OP(eor, 8, ., .)
 
 	m68ki_write_8(ea, res);
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -5001,10 +4666,7 @@ M68KMAKE_OP(eor, 16, ., d)
 {
 	uint res = MASK_OUT_ABOVE_16(DY ^= MASK_OUT_ABOVE_16(DX));
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -5015,10 +4677,7 @@ M68KMAKE_OP(eor, 16, ., .)
 
 	m68ki_write_16(ea, res);
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -5026,10 +4685,7 @@ M68KMAKE_OP(eor, 32, ., d)
 {
 	uint res = DY ^= DX;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -5040,10 +4696,7 @@ M68KMAKE_OP(eor, 32, ., .)
 
 	m68ki_write_32(ea, res);
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -5051,10 +4704,7 @@ M68KMAKE_OP(eori, 8, ., d)
 {
 	uint res = MASK_OUT_ABOVE_8(DY ^= OPER_I_8());
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -5066,10 +4716,7 @@ M68KMAKE_OP(eori, 8, ., .)
 
 	m68ki_write_8(ea, res);
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -5077,10 +4724,7 @@ M68KMAKE_OP(eori, 16, ., d)
 {
 	uint res = MASK_OUT_ABOVE_16(DY ^= OPER_I_16());
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -5092,10 +4736,7 @@ M68KMAKE_OP(eori, 16, ., .)
 
 	m68ki_write_16(ea, res);
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -5103,10 +4744,7 @@ M68KMAKE_OP(eori, 32, ., d)
 {
 	uint res = DY ^= OPER_I_32();
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -5118,10 +4756,7 @@ M68KMAKE_OP(eori, 32, ., .)
 
 	m68ki_write_32(ea, res);
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -5238,6 +4873,7 @@ M68KMAKE_OP(jsr, 32, ., .)
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
 	m68ki_push_32(REG_PC);
 	m68ki_jump(ea);
+	m68ki_call_hook(M68K_CALL_SUBROUTINE, REG_PPC, REG_PC); /* auto-disable (see m68kcpu.h) */
 }
 
 
@@ -5664,10 +5300,7 @@ M68KMAKE_OP(move, 8, d, d)
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -5678,10 +5311,7 @@ M68KMAKE_OP(move, 8, d, .)
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -5692,10 +5322,7 @@ M68KMAKE_OP(move, 8, ai, d)
 
 	m68ki_write_8(ea, res);
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -5706,10 +5333,7 @@ M68KMAKE_OP(move, 8, ai, .)
 
 	m68ki_write_8(ea, res);
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -5720,10 +5344,7 @@ M68KMAKE_OP(move, 8, pi7, d)
 
 	m68ki_write_8(ea, res);
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -5734,10 +5355,7 @@ M68KMAKE_OP(move, 8, pi, d)
 
 	m68ki_write_8(ea, res);
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -5748,10 +5366,7 @@ M68KMAKE_OP(move, 8, pi7, .)
 
 	m68ki_write_8(ea, res);
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -5762,10 +5377,7 @@ M68KMAKE_OP(move, 8, pi, .)
 
 	m68ki_write_8(ea, res);
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -5776,10 +5388,7 @@ M68KMAKE_OP(move, 8, pd7, d)
 
 	m68ki_write_8(ea, res);
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -5790,10 +5399,7 @@ M68KMAKE_OP(move, 8, pd, d)
 
 	m68ki_write_8(ea, res);
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -5804,10 +5410,7 @@ M68KMAKE_OP(move, 8, pd7, .)
 
 	m68ki_write_8(ea, res);
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -5818,10 +5421,7 @@ M68KMAKE_OP(move, 8, pd, .)
 
 	m68ki_write_8(ea, res);
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -5832,10 +5432,7 @@ M68KMAKE_OP(move, 8, di, d)
 
 	m68ki_write_8(ea, res);
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -5846,10 +5443,7 @@ M68KMAKE_OP(move, 8, di, .)
 
 	m68ki_write_8(ea, res);
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -5860,10 +5454,7 @@ M68KMAKE_OP(move, 8, ix, d)
 
 	m68ki_write_8(ea, res);
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -5874,10 +5465,7 @@ M68KMAKE_OP(move, 8, ix, .)
 
 	m68ki_write_8(ea, res);
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -5888,10 +5476,7 @@ M68KMAKE_OP(move, 8, aw, d)
 
 	m68ki_write_8(ea, res);
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -5902,10 +5487,7 @@ M68KMAKE_OP(move, 8, aw, .)
 
 	m68ki_write_8(ea, res);
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -5916,10 +5498,7 @@ M68KMAKE_OP(move, 8, al, d)
 
 	m68ki_write_8(ea, res);
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -5930,10 +5509,7 @@ M68KMAKE_OP(move, 8, al, .)
 
 	m68ki_write_8(ea, res);
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -5944,10 +5520,7 @@ M68KMAKE_OP(move, 16, d, d)
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -5958,10 +5531,7 @@ M68KMAKE_OP(move, 16, d, a)
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -5972,10 +5542,7 @@ M68KMAKE_OP(move, 16, d, .)
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -5986,10 +5553,7 @@ M68KMAKE_OP(move, 16, ai, d)
 
 	m68ki_write_16(ea, res);
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -6000,10 +5564,7 @@ M68KMAKE_OP(move, 16, ai, a)
 
 	m68ki_write_16(ea, res);
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -6014,10 +5575,7 @@ M68KMAKE_OP(move, 16, ai, .)
 
 	m68ki_write_16(ea, res);
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -6028,10 +5586,7 @@ M68KMAKE_OP(move, 16, pi, d)
 
 	m68ki_write_16(ea, res);
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -6042,10 +5597,7 @@ M68KMAKE_OP(move, 16, pi, a)
 
 	m68ki_write_16(ea, res);
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -6056,10 +5608,7 @@ M68KMAKE_OP(move, 16, pi, .)
 
 	m68ki_write_16(ea, res);
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -6070,10 +5619,7 @@ M68KMAKE_OP(move, 16, pd, d)
 
 	m68ki_write_16(ea, res);
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -6084,10 +5630,7 @@ M68KMAKE_OP(move, 16, pd, a)
 
 	m68ki_write_16(ea, res);
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -6098,10 +5641,7 @@ M68KMAKE_OP(move, 16, pd, .)
 
 	m68ki_write_16(ea, res);
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -6112,10 +5652,7 @@ M68KMAKE_OP(move, 16, di, d)
 
 	m68ki_write_16(ea, res);
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -6126,10 +5663,7 @@ M68KMAKE_OP(move, 16, di, a)
 
 	m68ki_write_16(ea, res);
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -6140,10 +5674,7 @@ M68KMAKE_OP(move, 16, di, .)
 
 	m68ki_write_16(ea, res);
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -6154,10 +5685,7 @@ M68KMAKE_OP(move, 16, ix, d)
 
 	m68ki_write_16(ea, res);
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -6168,10 +5696,7 @@ M68KMAKE_OP(move, 16, ix, a)
 
 	m68ki_write_16(ea, res);
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -6182,10 +5707,7 @@ M68KMAKE_OP(move, 16, ix, .)
 
 	m68ki_write_16(ea, res);
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -6196,10 +5718,7 @@ M68KMAKE_OP(move, 16, aw, d)
 
 	m68ki_write_16(ea, res);
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -6210,10 +5729,7 @@ M68KMAKE_OP(move, 16, aw, a)
 
 	m68ki_write_16(ea, res);
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -6224,10 +5740,7 @@ M68KMAKE_OP(move, 16, aw, .)
 
 	m68ki_write_16(ea, res);
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -6238,10 +5751,7 @@ M68KMAKE_OP(move, 16, al, d)
 
 	m68ki_write_16(ea, res);
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -6252,10 +5762,7 @@ M68KMAKE_OP(move, 16, al, a)
 
 	m68ki_write_16(ea, res);
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -6266,10 +5773,7 @@ M68KMAKE_OP(move, 16, al, .)
 
 	m68ki_write_16(ea, res);
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -6280,10 +5784,7 @@ M68KMAKE_OP(move, 32, d, d)
 
 	*r_dst = res;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -6294,10 +5795,7 @@ M68KMAKE_OP(move, 32, d, a)
 
 	*r_dst = res;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -6308,10 +5806,7 @@ M68KMAKE_OP(move, 32, d, .)
 
 	*r_dst = res;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -6322,10 +5817,7 @@ M68KMAKE_OP(move, 32, ai, d)
 
 	m68ki_write_32(ea, res);
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -6336,10 +5828,7 @@ M68KMAKE_OP(move, 32, ai, a)
 
 	m68ki_write_32(ea, res);
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -6350,10 +5839,7 @@ M68KMAKE_OP(move, 32, ai, .)
 
 	m68ki_write_32(ea, res);
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -6364,10 +5850,7 @@ M68KMAKE_OP(move, 32, pi, d)
 
 	m68ki_write_32(ea, res);
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -6378,10 +5861,7 @@ M68KMAKE_OP(move, 32, pi, a)
 
 	m68ki_write_32(ea, res);
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -6392,10 +5872,7 @@ M68KMAKE_OP(move, 32, pi, .)
 
 	m68ki_write_32(ea, res);
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -6407,10 +5884,7 @@ M68KMAKE_OP(move, 32, pd, d)
 	m68ki_write_16(ea+2, res & 0xFFFF );
 	m68ki_write_16(ea, (res >> 16) & 0xFFFF );
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -6422,10 +5896,7 @@ M68KMAKE_OP(move, 32, pd, a)
 	m68ki_write_16(ea+2, res & 0xFFFF );
 	m68ki_write_16(ea, (res >> 16) & 0xFFFF );
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -6437,10 +5908,7 @@ M68KMAKE_OP(move, 32, pd, .)
 	m68ki_write_16(ea+2, res & 0xFFFF );
 	m68ki_write_16(ea, (res >> 16) & 0xFFFF );
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -6451,10 +5919,7 @@ M68KMAKE_OP(move, 32, di, d)
 
 	m68ki_write_32(ea, res);
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -6465,10 +5930,7 @@ M68KMAKE_OP(move, 32, di, a)
 
 	m68ki_write_32(ea, res);
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -6479,10 +5941,7 @@ M68KMAKE_OP(move, 32, di, .)
 
 	m68ki_write_32(ea, res);
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -6493,10 +5952,7 @@ M68KMAKE_OP(move, 32, ix, d)
 
 	m68ki_write_32(ea, res);
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -6507,10 +5963,7 @@ M68KMAKE_OP(move, 32, ix, a)
 
 	m68ki_write_32(ea, res);
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -6521,10 +5974,7 @@ M68KMAKE_OP(move, 32, ix, .)
 
 	m68ki_write_32(ea, res);
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -6535,10 +5985,7 @@ M68KMAKE_OP(move, 32, aw, d)
 
 	m68ki_write_32(ea, res);
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -6549,10 +5996,7 @@ M68KMAKE_OP(move, 32, aw, a)
 
 	m68ki_write_32(ea, res);
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -6563,10 +6007,7 @@ M68KMAKE_OP(move, 32, aw, .)
 
 	m68ki_write_32(ea, res);
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -6577,10 +6018,7 @@ M68KMAKE_OP(move, 32, al, d)
 
 	m68ki_write_32(ea, res);
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -6591,10 +6029,7 @@ M68KMAKE_OP(move, 32, al, a)
 
 	m68ki_write_32(ea, res);
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -6605,10 +6040,7 @@ M68KMAKE_OP(move, 32, al, .)
 
 	m68ki_write_32(ea, res);
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -7042,15 +6474,17 @@ M68KMAKE_OP(movem, 16, re, pd)
 	uint i = 0;
 	uint register_list = OPER_I_16();
 	uint ea = AY;
-	uint count = 0;
+	uint count = m68ki_bit_count_16(register_list);
 
-	for(; i < 16; i++)
-		if(register_list & (1 << i))
-		{
-			ea -= 2;
-			m68ki_write_16(ea, MASK_OUT_ABOVE_16(REG_DA[15-i]));
-			count++;
-		}
+	if(m68ki_movem_store_direct(ea - (count << 1), register_list, count, 2, 1))
+		ea -= count << 1;
+	else
+		for(; i < 16; i++)
+			if(register_list & (1 << i))
+			{
+				ea -= 2;
+				m68ki_write_16(ea, MASK_OUT_ABOVE_16(REG_DA[15-i]));
+			}
 	AY = ea;
 
 	USE_CYCLES(count<<CYC_MOVEM_W);
@@ -7062,15 +6496,15 @@ M68KMAKE_OP(movem, 16, re, .)
 	uint i = 0;
 	uint register_list = OPER_I_16();
 	uint ea = M68KMAKE_GET_EA_AY_16;
-	uint count = 0;
+	uint count = m68ki_bit_count_16(register_list);
 
-	for(; i < 16; i++)
-		if(register_list & (1 << i))
-		{
-			m68ki_write_16(ea, MASK_OUT_ABOVE_16(REG_DA[i]));
-			ea += 2;
-			count++;
-		}
+	if(!m68ki_movem_store_direct(ea, register_list, count, 2, 0))
+		for(; i < 16; i++)
+			if(register_list & (1 << i))
+			{
+				m68ki_write_16(ea, MASK_OUT_ABOVE_16(REG_DA[i]));
+				ea += 2;
+			}
 
 	USE_CYCLES(count<<CYC_MOVEM_W);
 }
@@ -7081,16 +6515,18 @@ M68KMAKE_OP(movem, 32, re, pd)
 	uint i = 0;
 	uint register_list = OPER_I_16();
 	uint ea = AY;
-	uint count = 0;
+	uint count = m68ki_bit_count_16(register_list);
 
-	for(; i < 16; i++)
-		if(register_list & (1 << i))
-		{
-			ea -= 4;
-			m68ki_write_16(ea+2, REG_DA[15-i] & 0xFFFF );
-			m68ki_write_16(ea, (REG_DA[15-i] >> 16) & 0xFFFF );
-			count++;
-		}
+	if(m68ki_movem_store_direct(ea - (count << 2), register_list, count, 4, 1))
+		ea -= count << 2;
+	else
+		for(; i < 16; i++)
+			if(register_list & (1 << i))
+			{
+				ea -= 4;
+				m68ki_write_16(ea+2, REG_DA[15-i] & 0xFFFF );
+				m68ki_write_16(ea, (REG_DA[15-i] >> 16) & 0xFFFF );
+			}
 	AY = ea;
 
 	USE_CYCLES(count<<CYC_MOVEM_L);
@@ -7102,15 +6538,15 @@ M68KMAKE_OP(movem, 32, re, .)
 	uint i = 0;
 	uint register_list = OPER_I_16();
 	uint ea = M68KMAKE_GET_EA_AY_32;
-	uint count = 0;
+	uint count = m68ki_bit_count_16(register_list);
 
-	for(; i < 16; i++)
-		if(register_list & (1 << i))
-		{
-			m68ki_write_32(ea, REG_DA[i]);
-			ea += 4;
-			count++;
-		}
+	if(!m68ki_movem_store_direct(ea, register_list, count, 4, 0))
+		for(; i < 16; i++)
+			if(register_list & (1 << i))
+			{
+				m68ki_write_32(ea, REG_DA[i]);
+				ea += 4;
+			}
 
 	USE_CYCLES(count<<CYC_MOVEM_L);
 }
@@ -7121,15 +6557,17 @@ M68KMAKE_OP(movem, 16, er, pi)
 	uint i = 0;
 	uint register_list = OPER_I_16();
 	uint ea = AY;
-	uint count = 0;
+	uint count = m68ki_bit_count_16(register_list);
 
-	for(; i < 16; i++)
-		if(register_list & (1 << i))
-		{
-			REG_DA[i] = MAKE_INT_16(MASK_OUT_ABOVE_16(m68ki_read_16(ea)));
-			ea += 2;
-			count++;
-		}
+	if(m68ki_movem_load_direct(ea, register_list, count, 2))
+		ea += count << 1;
+	else
+		for(; i < 16; i++)
+			if(register_list & (1 << i))
+			{
+				REG_DA[i] = MAKE_INT_16(MASK_OUT_ABOVE_16(m68ki_read_16(ea)));
+				ea += 2;
+			}
 	AY = ea;
 
 	USE_CYCLES(count<<CYC_MOVEM_W);
@@ -7179,15 +6617,15 @@ M68KMAKE_OP(movem, 16, er, .)
 	uint i = 0;
 	uint register_list = OPER_I_16();
 	uint ea = M68KMAKE_GET_EA_AY_16;
-	uint count = 0;
+	uint count = m68ki_bit_count_16(register_list);
 
-	for(; i < 16; i++)
-		if(register_list & (1 << i))
-		{
-			REG_DA[i] = MAKE_INT_16(MASK_OUT_ABOVE_16(m68ki_read_16(ea)));
-			ea += 2;
-			count++;
-		}
+	if(!m68ki_movem_load_direct(ea, register_list, count, 2))
+		for(; i < 16; i++)
+			if(register_list & (1 << i))
+			{
+				REG_DA[i] = MAKE_INT_16(MASK_OUT_ABOVE_16(m68ki_read_16(ea)));
+				ea += 2;
+			}
 
 	USE_CYCLES(count<<CYC_MOVEM_W);
 }
@@ -7198,15 +6636,17 @@ M68KMAKE_OP(movem, 32, er, pi)
 	uint i = 0;
 	uint register_list = OPER_I_16();
 	uint ea = AY;
-	uint count = 0;
+	uint count = m68ki_bit_count_16(register_list);
 
-	for(; i < 16; i++)
-		if(register_list & (1 << i))
-		{
-			REG_DA[i] = m68ki_read_32(ea);
-			ea += 4;
-			count++;
-		}
+	if(m68ki_movem_load_direct(ea, register_list, count, 4))
+		ea += count << 2;
+	else
+		for(; i < 16; i++)
+			if(register_list & (1 << i))
+			{
+				REG_DA[i] = m68ki_read_32(ea);
+				ea += 4;
+			}
 	AY = ea;
 
 	USE_CYCLES(count<<CYC_MOVEM_L);
@@ -7256,15 +6696,15 @@ M68KMAKE_OP(movem, 32, er, .)
 	uint i = 0;
 	uint register_list = OPER_I_16();
 	uint ea = M68KMAKE_GET_EA_AY_32;
-	uint count = 0;
+	uint count = m68ki_bit_count_16(register_list);
 
-	for(; i < 16; i++)
-		if(register_list & (1 << i))
-		{
-			REG_DA[i] = m68ki_read_32(ea);
-			ea += 4;
-			count++;
-		}
+	if(!m68ki_movem_load_direct(ea, register_list, count, 4))
+		for(; i < 16; i++)
+			if(register_list & (1 << i))
+			{
+				REG_DA[i] = m68ki_read_32(ea);
+				ea += 4;
+			}
 
 	USE_CYCLES(count<<CYC_MOVEM_L);
 }
@@ -7414,10 +6854,7 @@ M68KMAKE_OP(moveq, 32, ., .)
 {
 	uint res = DX = MAKE_INT_8(MASK_OUT_ABOVE_8(REG_IR));
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -7444,10 +6881,7 @@ M68KMAKE_OP(muls, 16, ., d)
 
 	*r_dst = res;
 
-	FLAG_Z = res;
-	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -7458,10 +6892,7 @@ M68KMAKE_OP(muls, 16, ., .)
 
 	*r_dst = res;
 
-	FLAG_Z = res;
-	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -7472,10 +6903,7 @@ M68KMAKE_OP(mulu, 16, ., d)
 
 	*r_dst = res;
 
-	FLAG_Z = res;
-	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -7486,10 +6914,7 @@ M68KMAKE_OP(mulu, 16, ., .)
 
 	*r_dst = res;
 
-	FLAG_Z = res;
-	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -8006,10 +7431,7 @@ M68KMAKE_OP(not, 8, ., d)
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -8020,10 +7442,7 @@ M68KMAKE_OP(not, 8, ., .)
 
 	m68ki_write_8(ea, res);
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -8033,11 +7452,8 @@ M68KMAKE_OP(not, 16, ., d)
 	uint res = MASK_OUT_ABOVE_16(~*r_dst);
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
-
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -8048,10 +7464,7 @@ M68KMAKE_OP(not, 16, ., .)
 
 	m68ki_write_16(ea, res);
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -8060,10 +7473,7 @@ M68KMAKE_OP(not, 32, ., d)
 	uint* r_dst = &DY;
 	uint res = *r_dst = MASK_OUT_ABOVE_32(~*r_dst);
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -8074,10 +7484,7 @@ M68KMAKE_OP(not, 32, ., .)
 
 	m68ki_write_32(ea, res);
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -8085,10 +7492,7 @@ M68KMAKE_OP(or, 8, er, d)
 {
 	uint res = MASK_OUT_ABOVE_8((DX |= MASK_OUT_ABOVE_8(DY)));
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -8096,10 +7500,7 @@ M68KMAKE_OP(or, 8, er, .)
 {
 	uint res = MASK_OUT_ABOVE_8((DX |= M68KMAKE_GET_OPER_AY_8));
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -8107,10 +7508,7 @@ M68KMAKE_OP(or, 16, er, d)
 {
 	uint res = MASK_OUT_ABOVE_16((DX |= MASK_OUT_ABOVE_16(DY)));
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -8118,10 +7516,7 @@ M68KMAKE_OP(or, 16, er, .)
 {
 	uint res = MASK_OUT_ABOVE_16((DX |= M68KMAKE_GET_OPER_AY_16));
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -8129,10 +7524,7 @@ M68KMAKE_OP(or, 32, er, d)
 {
 	uint res = DX |= DY;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -8140,10 +7532,7 @@ M68KMAKE_OP(or, 32, er, .)
 {
 	uint res = DX |= M68KMAKE_GET_OPER_AY_32;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -8154,10 +7543,7 @@ M68KMAKE_OP(or, 8, re, .)
 
 	m68ki_write_8(ea, res);
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -8168,10 +7554,7 @@ M68KMAKE_OP(or, 16, re, .)
 
 	m68ki_write_16(ea, res);
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -8182,10 +7565,7 @@ M68KMAKE_OP(or, 32, re, .)
 
 	m68ki_write_32(ea, res);
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -8193,10 +7573,7 @@ M68KMAKE_OP(ori, 8, ., d)
 {
 	uint res = MASK_OUT_ABOVE_8((DY |= OPER_I_8()));
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -8208,10 +7585,7 @@ M68KMAKE_OP(ori, 8, ., .)
 
 	m68ki_write_8(ea, res);
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -8219,10 +7593,7 @@ M68KMAKE_OP(ori, 16, ., d)
 {
 	uint res = MASK_OUT_ABOVE_16(DY |= OPER_I_16());
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -8234,10 +7605,7 @@ M68KMAKE_OP(ori, 16, ., .)
 
 	m68ki_write_16(ea, res);
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -8245,10 +7613,7 @@ M68KMAKE_OP(ori, 32, ., d)
 {
 	uint res = DY |= OPER_I_32();
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -8260,10 +7625,7 @@ M68KMAKE_OP(ori, 32, ., .)
 
 	m68ki_write_32(ea, res);
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -9192,6 +8554,7 @@ M68KMAKE_OP(rtd, 32, ., .)
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 		REG_A[7] = MASK_OUT_ABOVE_32(REG_A[7] + MAKE_INT_16(OPER_I_16()));
 		m68ki_jump(new_pc);
+		m68ki_call_hook(M68K_CALL_RETURN, REG_PPC, REG_PC); /* auto-disable (see m68kcpu.h) */
 		return;
 	}
 	m68ki_exception_illegal();
@@ -9208,12 +8571,14 @@ M68KMAKE_OP(rte, 32, ., .)
 
 		m68ki_rte_callback();		   /* auto-disable (see m68kcpu.h) */
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_latency_rte();		   /* auto-disable (see m68kcpu.h) */
 
 		if(CPU_TYPE_IS_000(CPU_TYPE))
 		{
 			new_sr = m68ki_pull_16();
 			new_pc = m68ki_pull_32();
 			m68ki_jump(new_pc);
+			m68ki_call_hook(M68K_CALL_EXCEPTION_RETURN, REG_PPC, REG_PC); /* auto-disable (see m68kcpu.h) */
 			m68ki_set_sr(new_sr);
 
 			CPU_INSTR_MODE = INSTRUCTION_YES;
@@ -9231,6 +8596,7 @@ M68KMAKE_OP(rte, 32, ., .)
 				new_pc = m68ki_pull_32();
 				m68ki_fake_pull_16();	/* format word */
 				m68ki_jump(new_pc);
+				m68ki_call_hook(M68K_CALL_EXCEPTION_RETURN, REG_PPC, REG_PC); /* auto-disable (see m68kcpu.h) */
 				m68ki_set_sr(new_sr);
 				CPU_INSTR_MODE = INSTRUCTION_YES;
 				CPU_RUN_MODE = RUN_MODE_NORMAL;
@@ -9257,6 +8623,7 @@ M68KMAKE_OP(rte, 32, ., .)
 				m68ki_fake_pull_32();
 				m68ki_fake_pull_32();
 				m68ki_jump(new_pc);
+				m68ki_call_hook(M68K_CALL_EXCEPTION_RETURN, REG_PPC, REG_PC); /* auto-disable (see m68kcpu.h) */
 				m68ki_set_sr(new_sr);
 				CPU_INSTR_MODE = INSTRUCTION_YES;
 				CPU_RUN_MODE = RUN_MODE_NORMAL;
@@ -9279,6 +8646,7 @@ rte_loop:
 				new_pc = m68ki_pull_32();
 				m68ki_fake_pull_16();	/* format word */
 				m68ki_jump(new_pc);
+				m68ki_call_hook(M68K_CALL_EXCEPTION_RETURN, REG_PPC, REG_PC); /* auto-disable (see m68kcpu.h) */
 				m68ki_set_sr(new_sr);
 				CPU_INSTR_MODE = INSTRUCTION_YES;
 				CPU_RUN_MODE = RUN_MODE_NORMAL;
@@ -9295,6 +8663,7 @@ rte_loop:
 				m68ki_fake_pull_16();	/* format word */
 				m68ki_fake_pull_32();	/* address */
 				m68ki_jump(new_pc);
+				m68ki_call_hook(M68K_CALL_EXCEPTION_RETURN, REG_PPC, REG_PC); /* auto-disable (see m68kcpu.h) */
 				m68ki_set_sr(new_sr);
 				CPU_INSTR_MODE = INSTRUCTION_YES;
 				CPU_RUN_MODE = RUN_MODE_NORMAL;
@@ -9329,6 +8698,7 @@ M68KMAKE_OP(rtr, 32, ., .)
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
 	m68ki_set_ccr(m68ki_pull_16());
 	m68ki_jump(m68ki_pull_32());
+	m68ki_call_hook(M68K_CALL_RETURN, REG_PPC, REG_PC); /* auto-disable (see m68kcpu.h) */
 }
 
 
@@ -9336,6 +8706,7 @@ M68KMAKE_OP(rts, 32, ., .)
 {
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
 	m68ki_jump(m68ki_pull_32());
+	m68ki_call_hook(M68K_CALL_RETURN, REG_PPC, REG_PC); /* auto-disable (see m68kcpu.h) */
 }
 
 
@@ -9536,12 +8907,9 @@ M68KMAKE_OP(sub, 8, er, d)
 	uint dst = MASK_OUT_ABOVE_8(*r_dst);
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
-	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	m68ki_flags_sub_8(src, dst, res);
 
-	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -9552,12 +8920,9 @@ M68KMAKE_OP(sub, 8, er, .)
 	uint dst = MASK_OUT_ABOVE_8(*r_dst);
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
-	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	m68ki_flags_sub_8(src, dst, res);
 
-	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -9568,12 +8933,9 @@ M68KMAKE_OP(sub, 16, er, d)
 	uint dst = MASK_OUT_ABOVE_16(*r_dst);
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
-	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	m68ki_flags_sub_16(src, dst, res);
 
-	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -9584,12 +8946,9 @@ M68KMAKE_OP(sub, 16, er, a)
 	uint dst = MASK_OUT_ABOVE_16(*r_dst);
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
-	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	m68ki_flags_sub_16(src, dst, res);
 
-	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -9600,12 +8959,9 @@ M68KMAKE_OP(sub, 16, er, .)
 	uint dst = MASK_OUT_ABOVE_16(*r_dst);
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
-	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	m68ki_flags_sub_16(src, dst, res);
 
-	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -9616,12 +8972,9 @@ M68KMAKE_OP(sub, 32, er, d)
 	uint dst = *r_dst;
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
-	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	m68ki_flags_sub_32(src, dst, res);
 
-	*r_dst = FLAG_Z;
+	*r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -9632,12 +8985,9 @@ M68KMAKE_OP(sub, 32, er, a)
 	uint dst = *r_dst;
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
-	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	m68ki_flags_sub_32(src, dst, res);
 
-	*r_dst = FLAG_Z;
+	*r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -9648,12 +8998,9 @@ M68KMAKE_OP(sub, 32, er, .)
 	uint dst = *r_dst;
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
-	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	m68ki_flags_sub_32(src, dst, res);
 
-	*r_dst = FLAG_Z;
+	*r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -9664,12 +9011,9 @@ M68KMAKE_OP(sub, 8, re, .)
 	uint dst = m68ki_read_8(ea);
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_flags_sub_8(src, dst, res);
 
-	m68ki_write_8(ea, FLAG_Z);
+	m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -9680,12 +9024,9 @@ M68KMAKE_OP(sub, 16, re, .)
 	uint dst = m68ki_read_16(ea);
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_flags_sub_16(src, dst, res);
 
-	m68ki_write_16(ea, FLAG_Z);
+	m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -9696,12 +9037,9 @@ M68KMAKE_OP(sub, 32, re, .)
 	uint dst = m68ki_read_32(ea);
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_flags_sub_32(src, dst, res);
 
-	m68ki_write_32(ea, FLAG_Z);
+	m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -9762,12 +9100,9 @@ M68KMAKE_OP(subi, 8, ., d)
 	uint dst = MASK_OUT_ABOVE_8(*r_dst);
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_flags_sub_8(src, dst, res);
 
-	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -9778,12 +9113,9 @@ M68KMAKE_OP(subi, 8, ., .)
 	uint dst = m68ki_read_8(ea);
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_flags_sub_8(src, dst, res);
 
-	m68ki_write_8(ea, FLAG_Z);
+	m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -9794,12 +9126,9 @@ M68KMAKE_OP(subi, 16, ., d)
 	uint dst = MASK_OUT_ABOVE_16(*r_dst);
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_flags_sub_16(src, dst, res);
 
-	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -9810,12 +9139,9 @@ M68KMAKE_OP(subi, 16, ., .)
 	uint dst = m68ki_read_16(ea);
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_flags_sub_16(src, dst, res);
 
-	m68ki_write_16(ea, FLAG_Z);
+	m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -9826,12 +9152,9 @@ M68KMAKE_OP(subi, 32, ., d)
 	uint dst = *r_dst;
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_flags_sub_32(src, dst, res);
 
-	*r_dst = FLAG_Z;
+	*r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -9842,12 +9165,9 @@ M68KMAKE_OP(subi, 32, ., .)
 	uint dst = m68ki_read_32(ea);
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_flags_sub_32(src, dst, res);
 
-	m68ki_write_32(ea, FLAG_Z);
+	m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -9858,12 +9178,9 @@ M68KMAKE_OP(subq, 8, ., d)
 	uint dst = MASK_OUT_ABOVE_8(*r_dst);
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_flags_sub_8(src, dst, res);
 
-	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | MASK_OUT_ABOVE_8(res);
 }
 
 
@@ -9874,12 +9191,9 @@ M68KMAKE_OP(subq, 8, ., .)
 	uint dst = m68ki_read_8(ea);
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_flags_sub_8(src, dst, res);
 
-	m68ki_write_8(ea, FLAG_Z);
+	m68ki_write_8(ea, MASK_OUT_ABOVE_8(res));
 }
 
 
@@ -9890,12 +9204,9 @@ M68KMAKE_OP(subq, 16, ., d)
 	uint dst = MASK_OUT_ABOVE_16(*r_dst);
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_flags_sub_16(src, dst, res);
 
-	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_16(res);
 }
 
 
@@ -9914,12 +9225,9 @@ M68KMAKE_OP(subq, 16, ., .)
 	uint dst = m68ki_read_16(ea);
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_flags_sub_16(src, dst, res);
 
-	m68ki_write_16(ea, FLAG_Z);
+	m68ki_write_16(ea, MASK_OUT_ABOVE_16(res));
 }
 
 
@@ -9930,12 +9238,9 @@ M68KMAKE_OP(subq, 32, ., d)
 	uint dst = *r_dst;
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_flags_sub_32(src, dst, res);
 
-	*r_dst = FLAG_Z;
+	*r_dst = MASK_OUT_ABOVE_32(res);
 }
 
 
@@ -9954,12 +9259,9 @@ M68KMAKE_OP(subq, 32, ., .)
 	uint dst = m68ki_read_32(ea);
 	uint res = dst - src;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_flags_sub_32(src, dst, res);
 
-	m68ki_write_32(ea, FLAG_Z);
+	m68ki_write_32(ea, MASK_OUT_ABOVE_32(res));
 }
 
 
@@ -10305,10 +9607,7 @@ M68KMAKE_OP(tst, 8, ., d)
 {
 	uint res = MASK_OUT_ABOVE_8(DY);
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -10316,10 +9615,7 @@ M68KMAKE_OP(tst, 8, ., .)
 {
 	uint res = M68KMAKE_GET_OPER_AY_8;
 
-	FLAG_N = NFLAG_8(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_8(res);
 }
 
 
@@ -10329,10 +9625,7 @@ M68KMAKE_OP(tst, 8, ., pcdi)
 	{
 		uint res = OPER_PCDI_8();
 
-		FLAG_N = NFLAG_8(res);
-		FLAG_Z = res;
-		FLAG_V = VFLAG_CLEAR;
-		FLAG_C = CFLAG_CLEAR;
+		m68ki_flags_logic_8(res);
 		return;
 	}
 	m68ki_exception_illegal();
@@ -10345,10 +9638,7 @@ M68KMAKE_OP(tst, 8, ., pcix)
 	{
 		uint res = OPER_PCIX_8();
 
-		FLAG_N = NFLAG_8(res);
-		FLAG_Z = res;
-		FLAG_V = VFLAG_CLEAR;
-		FLAG_C = CFLAG_CLEAR;
+		m68ki_flags_logic_8(res);
 		return;
 	}
 	m68ki_exception_illegal();
@@ -10361,10 +9651,7 @@ M68KMAKE_OP(tst, 8, ., i)
 	{
 		uint res = OPER_I_8();
 
-		FLAG_N = NFLAG_8(res);
-		FLAG_Z = res;
-		FLAG_V = VFLAG_CLEAR;
-		FLAG_C = CFLAG_CLEAR;
+		m68ki_flags_logic_8(res);
 		return;
 	}
 	m68ki_exception_illegal();
@@ -10375,10 +9662,7 @@ M68KMAKE_OP(tst, 16, ., d)
 {
 	uint res = MASK_OUT_ABOVE_16(DY);
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -10388,10 +9672,7 @@ M68KMAKE_OP(tst, 16, ., a)
 	{
 		uint res = MAKE_INT_16(AY);
 
-		FLAG_N = NFLAG_16(res);
-		FLAG_Z = res;
-		FLAG_V = VFLAG_CLEAR;
-		FLAG_C = CFLAG_CLEAR;
+		m68ki_flags_logic_16(res);
 		return;
 	}
 	m68ki_exception_illegal();
@@ -10402,10 +9683,7 @@ M68KMAKE_OP(tst, 16, ., .)
 {
 	uint res = M68KMAKE_GET_OPER_AY_16;
 
-	FLAG_N = NFLAG_16(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_16(res);
 }
 
 
@@ -10415,10 +9693,7 @@ M68KMAKE_OP(tst, 16, ., pcdi)
 	{
 		uint res = OPER_PCDI_16();
 
-		FLAG_N = NFLAG_16(res);
-		FLAG_Z = res;
-		FLAG_V = VFLAG_CLEAR;
-		FLAG_C = CFLAG_CLEAR;
+		m68ki_flags_logic_16(res);
 		return;
 	}
 	m68ki_exception_illegal();
@@ -10431,10 +9706,7 @@ M68KMAKE_OP(tst, 16, ., pcix)
 	{
 		uint res = OPER_PCIX_16();
 
-		FLAG_N = NFLAG_16(res);
-		FLAG_Z = res;
-		FLAG_V = VFLAG_CLEAR;
-		FLAG_C = CFLAG_CLEAR;
+		m68ki_flags_logic_16(res);
 		return;
 	}
 	m68ki_exception_illegal();
@@ -10447,10 +9719,7 @@ M68KMAKE_OP(tst, 16, ., i)
 	{
 		uint res = OPER_I_16();
 
-		FLAG_N = NFLAG_16(res);
-		FLAG_Z = res;
-		FLAG_V = VFLAG_CLEAR;
-		FLAG_C = CFLAG_CLEAR;
+		m68ki_flags_logic_16(res);
 		return;
 	}
 	m68ki_exception_illegal();
@@ -10461,10 +9730,7 @@ M68KMAKE_OP(tst, 32, ., d)
 {
 	uint res = DY;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -10474,10 +9740,7 @@ M68KMAKE_OP(tst, 32, ., a)
 	{
 		uint res = AY;
 
-		FLAG_N = NFLAG_32(res);
-		FLAG_Z = res;
-		FLAG_V = VFLAG_CLEAR;
-		FLAG_C = CFLAG_CLEAR;
+		m68ki_flags_logic_32(res);
 		return;
 	}
 	m68ki_exception_illegal();
@@ -10488,10 +9751,7 @@ M68KMAKE_OP(tst, 32, ., .)
 {
 	uint res = M68KMAKE_GET_OPER_AY_32;
 
-	FLAG_N = NFLAG_32(res);
-	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_flags_logic_32(res);
 }
 
 
@@ -10501,10 +9761,7 @@ M68KMAKE_OP(tst, 32, ., pcdi)
 	{
 		uint res = OPER_PCDI_32();
 
-		FLAG_N = NFLAG_32(res);
-		FLAG_Z = res;
-		FLAG_V = VFLAG_CLEAR;
-		FLAG_C = CFLAG_CLEAR;
+		m68ki_flags_logic_32(res);
 		return;
 	}
 	m68ki_exception_illegal();
@@ -10517,10 +9774,7 @@ M68KMAKE_OP(tst, 32, ., pcix)
 	{
 		uint res = OPER_PCIX_32();
 
-		FLAG_N = NFLAG_32(res);
-		FLAG_Z = res;
-		FLAG_V = VFLAG_CLEAR;
-		FLAG_C = CFLAG_CLEAR;
+		m68ki_flags_logic_32(res);
 		return;
 	}
 	m68ki_exception_illegal();
@@ -10533,10 +9787,7 @@ M68KMAKE_OP(tst, 32, ., i)
 	{
 		uint res = OPER_I_32();
 
-		FLAG_N = NFLAG_32(res);
-		FLAG_Z = res;
-		FLAG_V = VFLAG_CLEAR;
-		FLAG_C = CFLAG_CLEAR;
+		m68ki_flags_logic_32(res);
 		return;
 	}
 	m68ki_exception_illegal();
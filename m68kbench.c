@@ -0,0 +1,460 @@
+/* Microbenchmarks of the emulation core.
+ *
+ * Each workload writes a loop of 68k code into memory and runs it for a
+ * fixed number of cycles, several times, and the best run is reported as
+ * host nanoseconds per emulated instruction.  On Linux the cache misses of
+ * the host over all runs are counted with perf_event_open(), where the
+ * kernel and the CPU provide the counters.  The Makefile builds this program
+ * with different core options and runs the builds one after the other, see
+ * "make dispatch_bench".
+ *
+ * Usage: m68kbench workload [runs]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "m68k.h"
+#include "m68kops.h"
+
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+#define RAM_SIZE         0x40000
+#define CODE_ADDRESS     0x10000  /* m68k_execute() stops at 0x8000 */
+#define BITFIELD_ADDRESS 0x20000
+#define RUN_CYCLES       40000000
+#define SLICE_CYCLES     100000
+#define DEFAULT_RUNS     5
+
+unsigned char g_ram[RAM_SIZE];
+
+static unsigned long long g_state = 0x2545f4914f6cdd1dULL;
+static unsigned int g_code_end;
+
+
+/* ======================================================================== */
+/* ================================ HOST I/O ============================== */
+/* ======================================================================== */
+
+unsigned int m68k_read_memory_8(unsigned int address)
+{
+	return g_ram[address & (RAM_SIZE - 1)];
+}
+
+unsigned int m68k_read_memory_16(unsigned int address)
+{
+	return (m68k_read_memory_8(address) << 8) | m68k_read_memory_8(address + 1);
+}
+
+unsigned int m68k_read_memory_32(unsigned int address)
+{
+	return (m68k_read_memory_16(address) << 16) | m68k_read_memory_16(address + 2);
+}
+
+unsigned int m68k_read_disassembler_16(unsigned int address)
+{
+	return m68k_read_memory_16(address);
+}
+
+unsigned int m68k_read_disassembler_32(unsigned int address)
+{
+	return m68k_read_memory_32(address);
+}
+
+void m68k_write_memory_8(unsigned int address, unsigned int value)
+{
+	g_ram[address & (RAM_SIZE - 1)] = value;
+}
+
+void m68k_write_memory_16(unsigned int address, unsigned int value)
+{
+	m68k_write_memory_8(address, value >> 8);
+	m68k_write_memory_8(address + 1, value);
+}
+
+void m68k_write_memory_32(unsigned int address, unsigned int value)
+{
+	m68k_write_memory_16(address, value >> 16);
+	m68k_write_memory_16(address + 2, value);
+}
+
+/* The core's hooks into the Forth debugger of the example, unused here */
+unsigned int g_quit;
+unsigned short start_trace, end_trace, donext_addr, wordtrace_addr;
+
+void dump_bufchar(const char* name, unsigned short address, unsigned short count)
+{
+	(void)name; (void)address; (void)count;
+}
+
+void dump_bufword(const char* name, unsigned short address, unsigned short count)
+{
+	(void)name; (void)address; (void)count;
+}
+
+void dump_linbuf(void)
+{
+}
+
+void dump_find(void)
+{
+}
+
+unsigned short peek_word(unsigned short address)
+{
+	(void)address;
+	return 0;
+}
+
+void _find_addr(unsigned short address, unsigned short* startp, unsigned short* endp)
+{
+	(void)address;
+	*startp = 0;
+	if(endp != NULL)
+		*endp = 0;
+}
+
+
+/* ======================================================================== */
+/* ================================ WORKLOADS ============================= */
+/* ======================================================================== */
+
+/* xorshift64*, the same sequence on every host */
+static unsigned int random32(void)
+{
+	g_state ^= g_state >> 12;
+	g_state ^= g_state << 25;
+	g_state ^= g_state >> 27;
+	return (g_state * 0x2545f4914f6cdd1dULL) >> 32;
+}
+
+static void emit_16(unsigned int value)
+{
+	m68k_write_memory_16(g_code_end, value);
+	g_code_end += 2;
+}
+
+/* A random 68000 instruction that only uses registers, leaves A6 and A7
+ * alone and cannot trap
+ */
+static unsigned int random_register_opcode(void)
+{
+	static const unsigned int alu[] = {0x8000, 0x9000, 0xb000, 0xc000, 0xd000};
+	unsigned int x = random32() & 7;
+	unsigned int y = random32() & 7;
+	unsigned int size = random32() % 3;
+
+	switch(random32() % 12)
+	{
+		case 0:  /* or, sub, cmp, and, add Dx,Dy */
+			return alu[random32() % 5] | (y << 9) | (size << 6) | x;
+		case 1:  /* eor Dy,Dx */
+			return 0xb100 | (y << 9) | (size << 6) | x;
+		case 2:  /* move.b, move.w, move.l Dx,Dy */
+			return (size == 0 ? 0x1000 : size == 1 ? 0x3000 : 0x2000) | (y << 9) | x;
+		case 3:  /* movea.w, adda.w, adda.l Dx,Ay */
+			return (size == 0 ? 0x3040 : size == 1 ? 0xd0c0 : 0xd1c0) | ((y % 6) << 9) | x;
+		case 4:  /* mulu, muls, exg Dx,Dy */
+			return (size == 0 ? 0xc0c0 : size == 1 ? 0xc1c0 : 0xc140) | (y << 9) | x;
+		case 5:  /* moveq */
+			return 0x7000 | (y << 9) | (random32() & 0xff);
+		case 6:  /* addq, subq */
+			return ((random32() & 1) ? 0x5100 : 0x5000) | (y << 9) | (size << 6) | x;
+		case 7:  /* asd, lsd, roxd, rod with an immediate or a register count */
+			return 0xe000 | (y << 9) | ((random32() & 1) << 8) | (size << 6) | ((random32() & 7) << 3) | x;
+		case 8:  /* scc */
+			return 0x50c0 | ((random32() & 15) << 8) | x;
+		case 9:  /* clr, neg, not, tst */
+			return (0x4200 + (random32() & 3) * 0x200) | (size << 6) | x;
+		case 10: /* swap, ext.w, ext.l */
+			return (size == 0 ? 0x4840 : size == 1 ? 0x4880 : 0x48c0) | x;
+		default: /* nop */
+			return 0x4e71;
+	}
+}
+
+/* About 4200 different opcodes in a random order, which spreads the
+ * dispatch over the whole opcode space
+ */
+static int fill_dispatch(unsigned int arg)
+{
+	int count = 0;
+
+	(void)arg;
+	while(count < 16384)
+	{
+		unsigned int opcode = random_register_opcode();
+
+		if(m68k_get_opcode_info(opcode)->cpus & M68K_OPINFO_CPU_000)
+		{
+			emit_16(opcode);
+			count++;
+		}
+	}
+	return count;
+}
+
+/* Mark the 64-byte line of offset as read, return 1 if it was not yet */
+static int touch_line(unsigned char* lines, unsigned int offset)
+{
+	if(lines[offset / 64])
+		return 0;
+	lines[offset / 64] = 1;
+	return 1;
+}
+
+/* Distinct 64-byte lines of dispatch data that the loop reads, with a table
+ * of one pointer per opcode and with M68K_COMPACT_DISPATCH
+ */
+static void report_dispatch_lines(void)
+{
+	static unsigned char jump_lines[0x10000 * sizeof(void*) / 64];
+	static unsigned char index_lines[0x10000 * 2 / 64];
+	static unsigned char handler_lines[(M68KI_NUM_OPCODE_HANDLERS + 1) * sizeof(void*) / 64 + 1];
+	static unsigned char seen[0x10000];
+	unsigned int opcodes = 0, jump = 0, compact = 0;
+	unsigned int address;
+
+	for(address = CODE_ADDRESS; address < g_code_end; address += 2)
+	{
+		unsigned int opcode = m68k_read_memory_16(address);
+		unsigned int handler = m68ki_instruction_index_table[opcode];
+
+		opcodes += !seen[opcode];
+		seen[opcode] = 1;
+		jump += touch_line(jump_lines, opcode * sizeof(void*));
+		compact += touch_line(index_lines, opcode * 2);
+		compact += touch_line(handler_lines, handler * sizeof(void*));
+	}
+	printf("  %u different opcodes, dispatch data read: %u cache lines per opcode table, %u compact\n", opcodes, jump, compact);
+}
+
+/* 64 times an FPU instruction on a new operand from 0 to 4 in fp0:
+ *   addq.b   #1,d0
+ *   fmove.w  d0,fp0
+ *   fmul.s   #0.015625,fp0
+ *   fxxx     fp0,fp1
+ * arg is the command word of the last instruction.  The fmove workload,
+ * with FMOVE there, is the cost of the other three.
+ */
+static int fill_fpu(unsigned int arg)
+{
+	int i;
+
+	for(i = 0; i < 64; i++)
+	{
+		emit_16(0x5200);
+		emit_16(0xf200);
+		emit_16(0x5000);
+		emit_16(0xf23c);
+		emit_16(0x4423);
+		emit_16(0x3c80);
+		emit_16(0x0000);
+		emit_16(0xf200);
+		emit_16(arg);
+	}
+	return 64 * 4;
+}
+
+/* 32 times the memory and register forms of the bit field instructions, on
+ * fields at a new offset (d2) and of a new width (d3) each time.  The
+ * offsets stay within 32 bytes of a0.
+ */
+static int fill_bitfield(unsigned int arg)
+{
+	static const unsigned short group[] =
+	{
+		0x5602,         /* addq.b  #3,d2 */
+		0x5a03,         /* addq.b  #5,d3 */
+		0xe9d0, 0x48a3, /* bfextu  (a0){d2:d3},d4 */
+		0xebd0, 0x58a3, /* bfexts  (a0){d2:d3},d5 */
+		0xedd0, 0x68a3, /* bfffo   (a0){d2:d3},d6 */
+		0xefd0, 0x48a3, /* bfins   d4,(a0){d2:d3} */
+		0xead0, 0x08a3, /* bfchg   (a0){d2:d3} */
+		0xe8d0, 0x08a3, /* bftst   (a0){d2:d3} */
+		0xe9c1, 0x48a3, /* bfextu  d1{d2:d3},d4 */
+		0xefc1, 0x58a3, /* bfins   d5,d1{d2:d3} */
+		0xedc1, 0x68a3, /* bfffo   d1{d2:d3},d6 */
+	};
+	unsigned int i, j;
+
+	(void)arg;
+	emit_16(0x207c);    /* movea.l #BITFIELD_ADDRESS,a0 */
+	emit_16(BITFIELD_ADDRESS >> 16);
+	emit_16(BITFIELD_ADDRESS & 0xffff);
+	for(i = 0; i < 32; i++)
+		for(j = 0; j < sizeof(group) / sizeof(group[0]); j++)
+			emit_16(group[j]);
+	return 1 + 32 * 11;
+}
+
+typedef struct
+{
+	const char*  name;
+	unsigned int cpu_type;
+	int        (*fill)(unsigned int arg); /* Writes the loop body, returns its instructions */
+	unsigned int arg;
+	void       (*report)(void);
+} workload;
+
+static const workload g_workloads[] =
+{
+	{"dispatch", M68K_CPU_TYPE_68000, fill_dispatch, 0,      report_dispatch_lines},
+	{"bitfield", M68K_CPU_TYPE_68020, fill_bitfield, 0,      NULL},
+	{"fmove",    M68K_CPU_TYPE_68040, fill_fpu,      0x0080, NULL},
+	{"fsin",     M68K_CPU_TYPE_68040, fill_fpu,      0x008e, NULL},
+	{"fetox",    M68K_CPU_TYPE_68040, fill_fpu,      0x0090, NULL},
+	{"flogn",    M68K_CPU_TYPE_68040, fill_fpu,      0x0094, NULL},
+	{"fsincos",  M68K_CPU_TYPE_68040, fill_fpu,      0x00b2, NULL}, /* fsincos fp0,fp2:fp1 */
+};
+
+
+/* ======================================================================== */
+/* ============================== MEASUREMENT ============================= */
+/* ======================================================================== */
+
+#ifdef __linux__
+static const struct
+{
+	const char*        name;
+	unsigned int       type;
+	unsigned long long config;
+} g_counters[] =
+{
+	{"L1d read misses", PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+	{"L1i read misses", PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1I | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+	{"LLC misses",      PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+};
+#define NUM_COUNTERS (sizeof(g_counters) / sizeof(g_counters[0]))
+
+static int g_counter_fds[NUM_COUNTERS];
+
+static void open_counters(void)
+{
+	struct perf_event_attr attr;
+	unsigned int i;
+
+	for(i = 0; i < NUM_COUNTERS; i++)
+	{
+		memset(&attr, 0, sizeof(attr));
+		attr.size = sizeof(attr);
+		attr.type = g_counters[i].type;
+		attr.config = g_counters[i].config;
+		attr.disabled = 1;
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+		g_counter_fds[i] = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+	}
+}
+
+static void enable_counters(int enable)
+{
+	unsigned int i;
+
+	for(i = 0; i < NUM_COUNTERS; i++)
+		if(g_counter_fds[i] >= 0)
+			ioctl(g_counter_fds[i], enable ? PERF_EVENT_IOC_ENABLE : PERF_EVENT_IOC_DISABLE, 0);
+}
+
+static void report_counters(unsigned long long instructions)
+{
+	unsigned long long value;
+	unsigned int i;
+
+	for(i = 0; i < NUM_COUNTERS; i++)
+	{
+		if(g_counter_fds[i] < 0 || read(g_counter_fds[i], &value, sizeof(value)) != sizeof(value))
+			printf("  %-16s unavailable\n", g_counters[i].name);
+		else
+			printf("  %-16s %llu, %.3f per 1000 instructions\n", g_counters[i].name, value, value * 1000.0 / instructions);
+	}
+}
+#else
+static void open_counters(void)
+{
+}
+
+static void enable_counters(int enable)
+{
+	(void)enable;
+}
+
+static void report_counters(unsigned long long instructions)
+{
+	(void)instructions;
+	printf("  cache miss counters unavailable\n");
+}
+#endif /* __linux__ */
+
+/* Run the loop for RUN_CYCLES cycles, return the instructions executed */
+static unsigned long long run(int body)
+{
+	int cycles;
+
+	m68k_pulse_reset();
+	m68k_set_reg(M68K_REG_A6, 0);
+	for(cycles = 0; cycles < RUN_CYCLES; )
+		cycles += m68k_execute(SLICE_CYCLES);
+	/* The body, addq.l #1,a6 and jmp once per pass */
+	return (unsigned long long)m68k_get_reg(NULL, M68K_REG_A6) * (body + 2);
+}
+
+int main(int argc, char* argv[])
+{
+	const workload* w = NULL;
+	unsigned long long instructions, total = 0;
+	double best = 0;
+	int runs = argc > 2 ? atoi(argv[2]) : DEFAULT_RUNS;
+	int body, i;
+
+	for(i = 0; argc > 1 && i < (int)(sizeof(g_workloads) / sizeof(g_workloads[0])); i++)
+		if(strcmp(argv[1], g_workloads[i].name) == 0)
+			w = &g_workloads[i];
+	if(w == NULL || runs <= 0)
+	{
+		fprintf(stderr, "Usage: %s workload [runs]\nWorkloads:", argv[0]);
+		for(i = 0; i < (int)(sizeof(g_workloads) / sizeof(g_workloads[0])); i++)
+			fprintf(stderr, " %s", g_workloads[i].name);
+		fprintf(stderr, "\n");
+		return 1;
+	}
+
+	m68k_init();
+	m68k_set_cpu_type(w->cpu_type);
+	m68k_map_direct_memory(0, RAM_SIZE, g_ram);
+	m68k_write_memory_32(0, RAM_SIZE - 4);
+	m68k_write_memory_32(4, CODE_ADDRESS);
+	g_code_end = CODE_ADDRESS;
+	body = w->fill(w->arg);
+	emit_16(0x528e);             /* addq.l #1,a6 */
+	emit_16(0x4ef9);             /* jmp CODE_ADDRESS */
+	emit_16(CODE_ADDRESS >> 16);
+	emit_16(CODE_ADDRESS & 0xffff);
+
+	open_counters();
+	for(i = 0; i < runs; i++)
+	{
+		clock_t start = clock();
+		double seconds;
+
+		enable_counters(1);
+		instructions = run(body);
+		enable_counters(0);
+		seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+		if(i == 0 || seconds / instructions < best)
+			best = seconds / instructions;
+		total += instructions;
+	}
+
+	printf("%s %s: %.2f ns per instruction (best of %d runs)\n", argv[0], w->name, best * 1e9, runs);
+	report_counters(total);
+	if(w->report != NULL)
+		w->report();
+	return 0;
+}
@@ -41,16 +41,203 @@
 extern void m68040_fpu_op0(void);
 extern void m68040_fpu_op1(void);
 extern void m68881_mmu_ops(void);
-extern unsigned char m68ki_cycles[][0x10000];
-extern void (*m68ki_instruction_jump_table[0x10000])(void); /* opcode handler jump table */
-extern void m68ki_build_opcode_table(void);
+extern const unsigned char m68ki_cycles[][0x10000];
+extern void (*const m68ki_instruction_jump_table[0x10000])(void); /* opcode handler jump table */
 
+#include <stdlib.h>
 #include "m68kops.h"
 #include "m68kcpu.h"
 
 #include "m68kfpu.c"
 #include "m68kmmu.h" // uses some functions from m68kfpu.c which are static !
 
+/* Opcode handler tables for the CPU models with their own handler set.
+ * With M68K_COMPACT_DISPATCH the table holds one pointer per handler and is
+ * indexed through m68ki_instruction_index_table, otherwise one per opcode.
+ */
+#if M68K_COMPACT_DISPATCH
+#define JUMP_TABLE(A) m68ki_instruction_handler_table##A
+#define m68ki_dispatch(OP) m68ki_cpu.jump_table[m68ki_instruction_index_table[OP]]()
+#else
+#define JUMP_TABLE(A) m68ki_instruction_jump_table##A
+#define m68ki_dispatch(OP) m68ki_cpu.jump_table[OP]()
+#endif
+
+/* Per-handler execution counts for m68k_write_handler_profile() */
+#if M68K_PROFILE_HANDLERS
+static unsigned long m68ki_handler_counts[M68KI_NUM_OPCODE_HANDLERS+1];
+#define m68ki_profile_handler(OP) m68ki_handler_counts[m68ki_instruction_index_table[OP]]++
+#else
+#define m68ki_profile_handler(OP)
+#endif
+
+/* Instruction statistics, see m68k_write_instruction_stats() */
+#if M68K_INSTRUCTION_STATS
+static unsigned long long m68ki_opcode_counts[0x10000];
+static unsigned long long m68ki_handler_cycles[M68KI_NUM_OPCODE_HANDLERS+1];
+static unsigned long long m68ki_handler_taken[M68KI_NUM_OPCODE_HANDLERS+1];
+static sint m68ki_stats_start_cycles;
+#define m68ki_stats_begin() m68ki_opcode_counts[REG_IR]++, m68ki_stats_start_cycles = GET_CYCLES()
+#define m68ki_stats_end() m68ki_handler_cycles[m68ki_instruction_index_table[REG_IR]] += m68ki_stats_start_cycles - GET_CYCLES()
+#else
+#define m68ki_stats_begin()
+#define m68ki_stats_end()
+#endif
+
+/* Ring of the last instructions run, see m68k_trace_buffer_enable() */
+#if M68K_TRACE_BUFFER
+m68k_trace_record* m68ki_trace_buffer_current = NULL;
+int m68ki_trace_buffer_enabled = 0;
+static m68k_trace_record m68ki_trace_buffer[M68K_TRACE_BUFFER_SIZE];
+static uint m68ki_trace_buffer_count;      /* Records written since the last clear */
+static uint m68ki_trace_buffer_cycle_base; /* Cycles run in earlier timeslices */
+static struct
+{
+	uint type;
+	uint value;
+} m68ki_trace_triggers[M68K_TRACE_MAX_TRIGGERS];
+static uint m68ki_trace_trigger_count;
+static int  m68ki_trace_trigger_pending;
+static uint m68ki_trace_trigger_type;
+static uint m68ki_trace_trigger_value;
+static void (*m68ki_trace_trigger_callback)(unsigned int type, unsigned int value);
+
+static void m68ki_trace_buffer_start_timeslice(void);
+static void m68ki_trace_buffer_begin_record(void);
+static void m68ki_trace_buffer_end_record(void);
+#define m68ki_trace_buffer_timeslice() m68ki_trace_buffer_start_timeslice()
+#define m68ki_trace_buffer_begin() if(m68ki_trace_buffer_enabled) m68ki_trace_buffer_begin_record()
+#define m68ki_trace_buffer_end() if(m68ki_trace_buffer_current) m68ki_trace_buffer_end_record()
+#else
+#define m68ki_trace_buffer_timeslice()
+#define m68ki_trace_buffer_begin()
+#define m68ki_trace_buffer_end()
+#endif /* M68K_TRACE_BUFFER */
+
+/* PC sampling, see m68k_set_pc_sample_period().  A sample is due when the
+ * cycle count of the timeslice has run down to m68ki_sample_at.
+ */
+#if M68K_SAMPLE_PC
+static uint m68ki_sample_period;
+static sint m68ki_sample_at = INT_MIN;
+static void (*m68ki_sample_callback)(unsigned int pc);
+
+static void m68ki_take_samples(void);
+#define m68ki_sample_pc() if(GET_CYCLES() <= m68ki_sample_at) m68ki_take_samples()
+#define m68ki_sample_timeslice(CYCLES) if(m68ki_sample_period) m68ki_sample_at = (CYCLES) - (GET_CYCLES() - m68ki_sample_at)
+#else
+#define m68ki_sample_pc()
+#define m68ki_sample_timeslice(CYCLES)
+#endif /* M68K_SAMPLE_PC */
+
+/* Memory heatmap, see m68k_write_memory_heatmap().  The lines of each 16MB
+ * of address space are allocated the first time one of them is accessed.
+ * A line's stamp is the number of the working set interval it was last
+ * accessed in, or 0 if it never was.  The interval ends when the cycle count
+ * of the timeslice has run down to m68ki_heatmap_at.
+ */
+#if M68K_MEMORY_HEATMAP
+#define M68KI_HEATMAP_LINE_BITS  8
+#define M68KI_HEATMAP_BLOCK_BITS (24 - M68KI_HEATMAP_LINE_BITS)
+
+typedef struct
+{
+	unsigned long long count[3]; /* By M68KI_HEATMAP_xxx */
+	uint stamp;
+} m68ki_heatmap_entry;
+
+static m68ki_heatmap_entry* m68ki_heatmap_blocks[256];
+static uint m68ki_heatmap_stamp = 1;
+static uint m68ki_heatmap_lines;          /* Lines accessed in this interval */
+static uint m68ki_heatmap_total;          /* Lines accessed since the last clear */
+static uint m68ki_heatmap_period;
+static sint m68ki_heatmap_at = INT_MIN;
+static m68k_working_set* m68ki_working_set;
+static uint m68ki_working_set_count;
+static uint m68ki_working_set_size;
+
+static void m68ki_heatmap_end_intervals(void);
+#define m68ki_heatmap_interval() if(GET_CYCLES() <= m68ki_heatmap_at) m68ki_heatmap_end_intervals()
+#define m68ki_heatmap_timeslice(CYCLES) if(m68ki_heatmap_period) m68ki_heatmap_at = (CYCLES) - (GET_CYCLES() - m68ki_heatmap_at)
+#else
+#define m68ki_heatmap_interval()
+#define m68ki_heatmap_timeslice(CYCLES)
+#endif /* M68K_MEMORY_HEATMAP */
+
+/* Interrupt latency, see m68k_write_latency_histograms().  Times are taken
+ * from a cycle count running across timeslices.  The exceptions being
+ * serviced are kept on a stack with the address of their stack frame, which
+ * is where A7 points when the rte returning from them starts.
+ */
+#if M68K_INTERRUPT_LATENCY
+#define M68KI_LATENCY_MAX_NESTING 64
+
+static m68k_latency_histogram m68ki_level_latency[8];
+static m68k_latency_histogram m68ki_level_service[8];
+static m68k_latency_histogram m68ki_vector_latency[256];
+static m68k_latency_histogram m68ki_vector_service[256];
+static unsigned long long m68ki_latency_cycle_base; /* Cycles run in earlier timeslices */
+static unsigned long long m68ki_latency_raised[8];  /* When each level in m68ki_latency_pending was raised */
+static uint m68ki_latency_pending;
+static unsigned long long m68ki_latency_wait;       /* Latency of the interrupt being taken */
+static int m68ki_latency_waited;
+static struct
+{
+	uint vector;
+	uint int_level;                                 /* Or 0 for exceptions */
+	uint frame;
+	unsigned long long taken;
+} m68ki_latency_stack[M68KI_LATENCY_MAX_NESTING];
+static uint m68ki_latency_depth;
+
+static unsigned long long m68ki_latency_cycles(void);
+static void m68ki_latency_add_irq(uint int_level);
+#define m68ki_latency_timeslice() m68ki_latency_cycle_base = m68ki_latency_cycles()
+#define m68ki_latency_irq(L) m68ki_latency_add_irq(L)
+#define m68ki_latency_reset() m68ki_latency_depth = m68ki_latency_pending = 0
+#else
+#define m68ki_latency_timeslice()
+#define m68ki_latency_irq(L)
+#define m68ki_latency_reset()
+#endif /* M68K_INTERRUPT_LATENCY */
+
+/* Instructions and cycles run, see m68k_get_perf_counters() */
+#if M68K_PERF_COUNTERS
+unsigned long long m68ki_perf_instructions;
+static unsigned long long m68ki_perf_cycles;
+#define m68ki_perf_instruction() m68ki_perf_instructions++
+#define m68ki_perf_timeslice(CYCLES) m68ki_perf_cycles += (CYCLES)
+#else
+#define m68ki_perf_instruction()
+#define m68ki_perf_timeslice(CYCLES)
+#endif /* M68K_PERF_COUNTERS */
+
+#if M68K_SPECIALIZE_000
+#define JUMP_TABLE_000 JUMP_TABLE(_000)
+#else
+#define JUMP_TABLE_000 JUMP_TABLE()
+#endif
+#if M68K_SPECIALIZE_010
+#define JUMP_TABLE_010 JUMP_TABLE(_010)
+#else
+#define JUMP_TABLE_010 JUMP_TABLE()
+#endif
+#if M68K_SPECIALIZE_020
+#define JUMP_TABLE_020 JUMP_TABLE(_020)
+#else
+#define JUMP_TABLE_020 JUMP_TABLE()
+#endif
+#if M68K_SPECIALIZE_030
+#define JUMP_TABLE_030 JUMP_TABLE(_030)
+#else
+#define JUMP_TABLE_030 JUMP_TABLE()
+#endif
+#if M68K_SPECIALIZE_040
+#define JUMP_TABLE_040 JUMP_TABLE(_040)
+#else
+#define JUMP_TABLE_040 JUMP_TABLE()
+#endif
+
 /* ======================================================================== */
 /* ================================= DATA ================================= */
 /* ======================================================================== */
@@ -601,6 +788,14 @@ static void default_instr_hook_callback(unsigned int pc)
 	(void)pc;
 }
 
+/* Called after subroutine calls, returns and exceptions */
+static void default_call_hook_callback(int type, unsigned int pc, unsigned int target)
+{
+	(void)type;
+	(void)pc;
+	(void)target;
+}
+
 
 #if M68K_EMULATE_ADDRESS_ERROR
 	#include <setjmp.h>
@@ -639,7 +834,11 @@ unsigned int m68k_get_reg(void* context, m68k_register_t regnum)
 		case M68K_REG_A6:	return cpu->dar[14];
 		case M68K_REG_A7:	return cpu->dar[15];
 		case M68K_REG_PC:	return MASK_OUT_ABOVE_32(cpu->pc);
-		case M68K_REG_SR:	return	cpu->t1_flag						|
+		case M68K_REG_SR:
+#if M68K_LAZY_FLAGS
+							m68ki_flags_materialize(cpu);
+#endif
+							return	cpu->t1_flag						|
 									cpu->t0_flag						|
 									(cpu->s_flag << 11)					|
 									(cpu->m_flag << 11)					|
@@ -778,6 +977,1029 @@ void m68k_set_instr_hook_callback(void  (*callback)(unsigned int pc))
 	CALLBACK_INSTR_HOOK = callback ? callback : default_instr_hook_callback;
 }
 
+void m68k_set_call_hook_callback(void  (*callback)(int type, unsigned int pc, unsigned int target))
+{
+	CALLBACK_CALL_HOOK = callback ? callback : default_call_hook_callback;
+}
+
+/* Map host memory for direct block transfers */
+int m68k_map_direct_memory(unsigned int address, unsigned int size, unsigned char* host_ptr)
+{
+	uint i = m68ki_cpu.direct_map_count;
+
+	if(i >= M68K_DIRECT_MAP_MAX)
+		return 0;
+	m68ki_cpu.direct_map[i].base = address;
+	m68ki_cpu.direct_map[i].size = size;
+	m68ki_cpu.direct_map[i].ptr = host_ptr;
+	m68ki_cpu.direct_map_count = i + 1;
+	return 1;
+}
+
+void m68k_unmap_direct_memory(void)
+{
+	m68ki_cpu.direct_map_count = 0;
+}
+
+/* Copy blocks between 68k memory and the host */
+void m68k_read_block(unsigned int address, unsigned char* buffer, unsigned int size)
+{
+	uint8* p = m68ki_direct_ptr(address, size, FLAG_S | FUNCTION_CODE_USER_DATA);
+	uint i;
+
+	for(i = 0; i < size; i++)
+		buffer[i] = p != NULL ? p[i] : m68k_read_memory_8(ADDRESS_68K(address + i));
+}
+
+void m68k_write_block(unsigned int address, const unsigned char* buffer, unsigned int size)
+{
+	uint8* p = m68ki_direct_ptr(address, size, FLAG_S | FUNCTION_CODE_USER_DATA);
+	uint i;
+
+	for(i = 0; i < size; i++)
+	{
+		if(p != NULL)
+			p[i] = buffer[i];
+		else
+			m68k_write_memory_8(ADDRESS_68K(address + i), buffer[i]);
+	}
+}
+
+const m68k_opcode_info* m68k_get_opcode_info(unsigned int opcode)
+{
+	return &m68ki_opcode_info_table[m68ki_instruction_index_table[opcode & 0xffff]];
+}
+
+int m68k_write_handler_profile(const char* filename)
+{
+#if M68K_PROFILE_HANDLERS
+	FILE* file;
+	int i;
+
+	if((file = fopen(filename, "w")) == NULL)
+		return 0;
+	fprintf(file, "# Musashi opcode handler profile: <count> <handler>\n");
+	for(i = 1; i <= M68KI_NUM_OPCODE_HANDLERS; i++)
+		if(m68ki_handler_counts[i] != 0)
+			fprintf(file, "%lu %s\n", m68ki_handler_counts[i], m68ki_opcode_info_table[i].handler);
+	return fclose(file) == 0;
+#else
+	(void)filename;
+	return 0;
+#endif /* M68K_PROFILE_HANDLERS */
+}
+
+void m68k_clear_handler_profile(void)
+{
+#if M68K_PROFILE_HANDLERS
+	int i;
+
+	for(i = 0; i <= M68KI_NUM_OPCODE_HANDLERS; i++)
+		m68ki_handler_counts[i] = 0;
+#endif /* M68K_PROFILE_HANDLERS */
+}
+
+#if M68K_INSTRUCTION_STATS
+void m68ki_stats_add_branch_taken(void)
+{
+	m68ki_handler_taken[m68ki_instruction_index_table[REG_IR]]++;
+}
+
+static const char* const m68ki_ea_names[M68K_OPINFO_NUM_EA] =
+{
+	"none", "dn", "an", "ai", "pi", "pd", "di", "ix", "aw", "al", "pcdi", "pcix", "i"
+};
+
+/* Most run handlers first */
+static int m68ki_compare_handler_stats(const void* a, const void* b)
+{
+	const m68k_handler_stats* x = (const m68k_handler_stats*)a;
+	const m68k_handler_stats* y = (const m68k_handler_stats*)b;
+
+	if(x->count != y->count)
+		return x->count > y->count ? -1 : 1;
+	return x->info < y->info ? -1 : x->info > y->info;
+}
+#endif /* M68K_INSTRUCTION_STATS */
+
+unsigned int m68k_get_handler_stats(m68k_handler_stats* stats, unsigned int max)
+{
+#if M68K_INSTRUCTION_STATS
+	uint i;
+
+	for(i = 0; i <= M68KI_NUM_OPCODE_HANDLERS && i < max; i++)
+	{
+		stats[i].info = &m68ki_opcode_info_table[i];
+		stats[i].count = 0;
+		stats[i].cycles = m68ki_handler_cycles[i];
+		stats[i].taken = m68ki_handler_taken[i];
+	}
+	for(i = 0; i < 0x10000; i++)
+		if(m68ki_instruction_index_table[i] < max)
+			stats[m68ki_instruction_index_table[i]].count += m68ki_opcode_counts[i];
+	return M68KI_NUM_OPCODE_HANDLERS + 1;
+#else
+	(void)stats;
+	(void)max;
+	return 0;
+#endif /* M68K_INSTRUCTION_STATS */
+}
+
+int m68k_get_opcode_counts(unsigned long long* counts)
+{
+#if M68K_INSTRUCTION_STATS
+	memcpy(counts, m68ki_opcode_counts, sizeof(m68ki_opcode_counts));
+	return 1;
+#else
+	(void)counts;
+	return 0;
+#endif /* M68K_INSTRUCTION_STATS */
+}
+
+int m68k_write_instruction_stats(const char* filename, int format)
+{
+#if M68K_INSTRUCTION_STATS
+	static m68k_handler_stats handlers[M68KI_NUM_OPCODE_HANDLERS+1];
+	unsigned long long ea_counts[M68K_OPINFO_NUM_EA] = {0};
+	int json = format == M68K_STATS_JSON;
+	const char* separator = "";
+	FILE* file;
+	uint count;
+	uint i;
+	int ok;
+
+	count = m68k_get_handler_stats(handlers, M68KI_NUM_OPCODE_HANDLERS+1);
+	for(i = 0; i < count; i++)
+		ea_counts[handlers[i].info->ea] += handlers[i].count;
+	qsort(handlers, count, sizeof(handlers[0]), m68ki_compare_handler_stats);
+
+	if((file = fopen(filename, "w")) == NULL)
+		return 0;
+
+	/* Handlers that ran, most run first */
+	if(json)
+		fprintf(file, "{\n\t\"handlers\": [");
+	else
+		fprintf(file, "kind,name,mnemonic,ea,count,cycles,taken,not_taken\n");
+	for(i = 0; i < count && handlers[i].count != 0; i++)
+	{
+		const m68k_handler_stats* h = &handlers[i];
+		int conditional = (h->info->flags & M68K_OPINFO_CONDITIONAL) != 0;
+
+		if(json)
+		{
+			fprintf(file, "%s\n\t\t{\"handler\": \"%s\", \"mnemonic\": \"%s\", \"ea\": \"%s\", \"count\": %llu, \"cycles\": %llu",
+					separator, h->info->handler, h->info->mnemonic, m68ki_ea_names[h->info->ea], h->count, h->cycles);
+			if(conditional)
+				fprintf(file, ", \"taken\": %llu, \"not_taken\": %llu", h->taken, h->count - h->taken);
+			fprintf(file, "}");
+			separator = ",";
+		}
+		else if(conditional)
+			fprintf(file, "handler,%s,%s,%s,%llu,%llu,%llu,%llu\n", h->info->handler, h->info->mnemonic,
+					m68ki_ea_names[h->info->ea], h->count, h->cycles, h->taken, h->count - h->taken);
+		else
+			fprintf(file, "handler,%s,%s,%s,%llu,%llu,,\n", h->info->handler, h->info->mnemonic,
+					m68ki_ea_names[h->info->ea], h->count, h->cycles);
+	}
+
+	/* Instructions run per effective address mode */
+	if(json)
+		fprintf(file, "\n\t],\n\t\"ea_modes\": {");
+	for(i = 0; i < M68K_OPINFO_NUM_EA; i++)
+	{
+		if(json)
+			fprintf(file, "%s\n\t\t\"%s\": %llu", i ? "," : "", m68ki_ea_names[i], ea_counts[i]);
+		else
+			fprintf(file, "ea,%s,,%s,%llu,,,\n", m68ki_ea_names[i], m68ki_ea_names[i], ea_counts[i]);
+	}
+
+	/* Opcodes that ran */
+	if(json)
+		fprintf(file, "\n\t},\n\t\"opcodes\": [");
+	separator = "";
+	for(i = 0; i < 0x10000; i++)
+	{
+		const m68k_opcode_info* info = &m68ki_opcode_info_table[m68ki_instruction_index_table[i]];
+
+		if(m68ki_opcode_counts[i] == 0)
+			continue;
+		if(json)
+		{
+			fprintf(file, "%s\n\t\t{\"opcode\": \"%04x\", \"handler\": \"%s\", \"count\": %llu}",
+					separator, i, info->handler, m68ki_opcode_counts[i]);
+			separator = ",";
+		}
+		else
+			fprintf(file, "opcode,%04x,%s,%s,%llu,,,\n", i, info->mnemonic, m68ki_ea_names[info->ea], m68ki_opcode_counts[i]);
+	}
+	if(json)
+		fprintf(file, "\n\t]\n}\n");
+
+	ok = !ferror(file);
+	return fclose(file) == 0 && ok;
+#else
+	(void)filename;
+	(void)format;
+	return 0;
+#endif /* M68K_INSTRUCTION_STATS */
+}
+
+void m68k_clear_instruction_stats(void)
+{
+#if M68K_INSTRUCTION_STATS
+	memset(m68ki_opcode_counts, 0, sizeof(m68ki_opcode_counts));
+	memset(m68ki_handler_cycles, 0, sizeof(m68ki_handler_cycles));
+	memset(m68ki_handler_taken, 0, sizeof(m68ki_handler_taken));
+#endif /* M68K_INSTRUCTION_STATS */
+}
+
+#if M68K_MEMORY_HEATMAP
+void m68ki_heatmap_add(uint address, uint kind)
+{
+	m68ki_heatmap_entry* block;
+	m68ki_heatmap_entry* line;
+
+	address = ADDRESS_68K(address);
+	block = m68ki_heatmap_blocks[address >> 24];
+	if(block == NULL)
+	{
+		block = calloc(1 << M68KI_HEATMAP_BLOCK_BITS, sizeof(*block));
+		if(block == NULL)
+			return;
+		m68ki_heatmap_blocks[address >> 24] = block;
+	}
+	line = &block[(address & 0xffffff) >> M68KI_HEATMAP_LINE_BITS];
+	line->count[kind]++;
+	if(line->stamp != m68ki_heatmap_stamp)
+	{
+		if(line->stamp == 0)
+			m68ki_heatmap_total++;
+		line->stamp = m68ki_heatmap_stamp;
+		m68ki_heatmap_lines++;
+	}
+}
+
+/* Record the working set of the interval that ended, and of any more the
+ * instruction that ended it covered.
+ */
+static void m68ki_heatmap_end_intervals(void)
+{
+	do
+	{
+		m68ki_heatmap_at -= m68ki_heatmap_period;
+		if(m68ki_working_set_count == m68ki_working_set_size)
+		{
+			uint size = m68ki_working_set_size ? m68ki_working_set_size * 2 : 1024;
+			m68k_working_set* points = realloc(m68ki_working_set, size * sizeof(*points));
+
+			if(points == NULL)
+				return;
+			m68ki_working_set = points;
+			m68ki_working_set_size = size;
+		}
+		m68ki_working_set[m68ki_working_set_count].lines = m68ki_heatmap_lines;
+		m68ki_working_set[m68ki_working_set_count].total = m68ki_heatmap_total;
+		m68ki_working_set_count++;
+		m68ki_heatmap_lines = 0;
+		if(++m68ki_heatmap_stamp == 0)
+			m68ki_heatmap_stamp = 1;
+	} while(GET_CYCLES() <= m68ki_heatmap_at);
+}
+#endif /* M68K_MEMORY_HEATMAP */
+
+unsigned int m68k_get_memory_heatmap(m68k_heatmap_line* lines, unsigned int max)
+{
+#if M68K_MEMORY_HEATMAP
+	uint count = 0;
+	uint b;
+	uint i;
+
+	for(b = 0; b < 256; b++)
+	{
+		const m68ki_heatmap_entry* block = m68ki_heatmap_blocks[b];
+
+		if(block == NULL)
+			continue;
+		for(i = 0; i < 1 << M68KI_HEATMAP_BLOCK_BITS; i++)
+		{
+			if(block[i].stamp == 0)
+				continue;
+			if(count < max)
+			{
+				lines[count].address = (b << 24) | (i << M68KI_HEATMAP_LINE_BITS);
+				lines[count].reads = block[i].count[M68KI_HEATMAP_READ];
+				lines[count].writes = block[i].count[M68KI_HEATMAP_WRITE];
+				lines[count].fetches = block[i].count[M68KI_HEATMAP_FETCH];
+			}
+			count++;
+		}
+	}
+	return count;
+#else
+	(void)lines;
+	(void)max;
+	return 0;
+#endif /* M68K_MEMORY_HEATMAP */
+}
+
+void m68k_set_working_set_interval(unsigned int cycles)
+{
+#if M68K_MEMORY_HEATMAP
+	m68ki_heatmap_period = cycles;
+	m68ki_heatmap_at = cycles ? GET_CYCLES() - (sint)cycles : INT_MIN;
+#else
+	(void)cycles;
+#endif /* M68K_MEMORY_HEATMAP */
+}
+
+unsigned int m68k_get_working_set(m68k_working_set* points, unsigned int max)
+{
+#if M68K_MEMORY_HEATMAP
+	if(max > m68ki_working_set_count)
+		max = m68ki_working_set_count;
+	if(max)
+		memcpy(points, m68ki_working_set, max * sizeof(*points));
+	return m68ki_working_set_count;
+#else
+	(void)points;
+	(void)max;
+	return 0;
+#endif /* M68K_MEMORY_HEATMAP */
+}
+
+int m68k_write_memory_heatmap(const char* filename, int format)
+{
+#if M68K_MEMORY_HEATMAP
+	int json = format == M68K_STATS_JSON;
+	m68k_heatmap_line* lines;
+	FILE* file;
+	uint count;
+	uint i;
+	int ok;
+
+	count = m68k_get_memory_heatmap(NULL, 0);
+	if((lines = malloc((count + 1) * sizeof(*lines))) == NULL)
+		return 0;
+	m68k_get_memory_heatmap(lines, count);
+	if((file = fopen(filename, "w")) == NULL)
+	{
+		free(lines);
+		return 0;
+	}
+
+	/* Lines accessed, in address order */
+	if(json)
+		fprintf(file, "{\n\t\"line_size\": %d,\n\t\"lines\": [", M68K_HEATMAP_LINE_SIZE);
+	else
+		fprintf(file, "kind,address,reads,writes,fetches,cycles,lines,total\n");
+	for(i = 0; i < count; i++)
+	{
+		if(json)
+			fprintf(file, "%s\n\t\t{\"address\": \"%08x\", \"reads\": %llu, \"writes\": %llu, \"fetches\": %llu}",
+					i ? "," : "", lines[i].address, lines[i].reads, lines[i].writes, lines[i].fetches);
+		else
+			fprintf(file, "line,%08x,%llu,%llu,%llu,,,\n", lines[i].address, lines[i].reads, lines[i].writes, lines[i].fetches);
+	}
+
+	/* Lines accessed in each interval, by the cycle count it ended at */
+	if(json)
+		fprintf(file, "\n\t],\n\t\"interval\": %u,\n\t\"working_set\": [", m68ki_heatmap_period);
+	for(i = 0; i < m68ki_working_set_count; i++)
+	{
+		unsigned long long cycles = (unsigned long long)(i + 1) * m68ki_heatmap_period;
+
+		if(json)
+			fprintf(file, "%s\n\t\t{\"cycles\": %llu, \"lines\": %u, \"total\": %u}",
+					i ? "," : "", cycles, m68ki_working_set[i].lines, m68ki_working_set[i].total);
+		else
+			fprintf(file, "working_set,,,,,%llu,%u,%u\n", cycles, m68ki_working_set[i].lines, m68ki_working_set[i].total);
+	}
+	if(json)
+		fprintf(file, "\n\t]\n}\n");
+
+	free(lines);
+	ok = !ferror(file);
+	return fclose(file) == 0 && ok;
+#else
+	(void)filename;
+	(void)format;
+	return 0;
+#endif /* M68K_MEMORY_HEATMAP */
+}
+
+void m68k_clear_memory_heatmap(void)
+{
+#if M68K_MEMORY_HEATMAP
+	uint b;
+
+	for(b = 0; b < 256; b++)
+	{
+		free(m68ki_heatmap_blocks[b]);
+		m68ki_heatmap_blocks[b] = NULL;
+	}
+	free(m68ki_working_set);
+	m68ki_working_set = NULL;
+	m68ki_working_set_count = 0;
+	m68ki_working_set_size = 0;
+	m68ki_heatmap_stamp = 1;
+	m68ki_heatmap_lines = 0;
+	m68ki_heatmap_total = 0;
+#endif /* M68K_MEMORY_HEATMAP */
+}
+
+#if M68K_INTERRUPT_LATENCY
+static unsigned long long m68ki_latency_cycles(void)
+{
+	return m68ki_latency_cycle_base + (m68ki_initial_cycles - GET_CYCLES());
+}
+
+static void m68ki_latency_add(m68k_latency_histogram* histogram, unsigned long long cycles)
+{
+	uint value = cycles > 0xffffffff ? 0xffffffff : (uint)cycles;
+	uint bucket = 0;
+
+	while(bucket < M68K_LATENCY_BUCKETS - 1 && (value >> bucket) != 0)
+		bucket++;
+	if(histogram->count == 0 || value < histogram->min)
+		histogram->min = value;
+	if(value > histogram->max)
+		histogram->max = value;
+	histogram->count++;
+	histogram->total += cycles;
+	histogram->buckets[bucket]++;
+}
+
+/* A level counts as raised from the first m68k_set_irq() that puts the line
+ * at it until its interrupt is taken, while higher levels come and go.
+ * Dropping the line below a level withdraws it.
+ */
+static void m68ki_latency_add_irq(uint int_level)
+{
+	m68ki_latency_pending &= (2 << int_level) - 1;
+	if(int_level && !(m68ki_latency_pending & (1 << int_level)))
+	{
+		m68ki_latency_pending |= 1 << int_level;
+		m68ki_latency_raised[int_level] = m68ki_latency_cycles();
+	}
+}
+
+/* Called by m68ki_exception_interrupt() before it acknowledges the
+ * interrupt, which may lower the line
+ */
+void m68ki_latency_add_interrupt(uint int_level)
+{
+	m68ki_latency_waited = (m68ki_latency_pending & (1 << int_level)) != 0;
+	if(m68ki_latency_waited)
+		m68ki_latency_wait = m68ki_latency_cycles() - m68ki_latency_raised[int_level];
+	m68ki_latency_pending &= ~(1 << int_level);
+}
+
+/* Called with the stack frame of the exception written */
+void m68ki_latency_add_taken(uint vector, uint int_level)
+{
+	if(int_level && m68ki_latency_waited)
+	{
+		m68ki_latency_add(&m68ki_level_latency[int_level], m68ki_latency_wait);
+		m68ki_latency_add(&m68ki_vector_latency[vector], m68ki_latency_wait);
+		m68ki_latency_waited = 0;
+	}
+	if(m68ki_latency_depth == M68KI_LATENCY_MAX_NESTING)
+		return;
+	m68ki_latency_stack[m68ki_latency_depth].vector = vector;
+	m68ki_latency_stack[m68ki_latency_depth].int_level = int_level;
+	m68ki_latency_stack[m68ki_latency_depth].frame = REG_A[7];
+	m68ki_latency_stack[m68ki_latency_depth].taken = m68ki_latency_cycles();
+	m68ki_latency_depth++;
+}
+
+/* Frames below A7 belong to exceptions the program never returned from */
+void m68ki_latency_add_rte(void)
+{
+	while(m68ki_latency_depth && m68ki_latency_stack[m68ki_latency_depth - 1].frame < REG_A[7])
+		m68ki_latency_depth--;
+	if(m68ki_latency_depth && m68ki_latency_stack[m68ki_latency_depth - 1].frame == REG_A[7])
+	{
+		unsigned long long service;
+
+		m68ki_latency_depth--;
+		service = m68ki_latency_cycles() - m68ki_latency_stack[m68ki_latency_depth].taken;
+		if(m68ki_latency_stack[m68ki_latency_depth].int_level)
+			m68ki_latency_add(&m68ki_level_service[m68ki_latency_stack[m68ki_latency_depth].int_level], service);
+		m68ki_latency_add(&m68ki_vector_service[m68ki_latency_stack[m68ki_latency_depth].vector], service);
+	}
+}
+
+static void m68ki_write_latency_histogram(FILE* file, int json, const char* kind, uint index,
+										  const char* measure, const m68k_latency_histogram* histogram)
+{
+	uint i;
+
+	if(histogram->count == 0)
+		return;
+	if(json)
+	{
+		fprintf(file, ",\n\t\t\t\"%s\": {\"count\": %llu, \"min\": %u, \"max\": %u, \"total\": %llu, \"buckets\": [",
+				measure, histogram->count, histogram->min, histogram->max, histogram->total);
+		for(i = 0; i < M68K_LATENCY_BUCKETS; i++)
+			fprintf(file, "%s%llu", i ? ", " : "", histogram->buckets[i]);
+		fprintf(file, "]}");
+		return;
+	}
+	fprintf(file, "%s,%u,%s,%llu,%u,%u,%llu", kind, index, measure,
+			histogram->count, histogram->min, histogram->max, histogram->total);
+	for(i = 0; i < M68K_LATENCY_BUCKETS; i++)
+		fprintf(file, ",%llu", histogram->buckets[i]);
+	fprintf(file, "\n");
+}
+#endif /* M68K_INTERRUPT_LATENCY */
+
+int m68k_get_interrupt_latency(unsigned int level, m68k_latency_histogram* latency, m68k_latency_histogram* service)
+{
+#if M68K_INTERRUPT_LATENCY
+	if(level < 1 || level > 7)
+		return 0;
+	if(latency != NULL)
+		*latency = m68ki_level_latency[level];
+	if(service != NULL)
+		*service = m68ki_level_service[level];
+	return 1;
+#else
+	(void)level;
+	(void)latency;
+	(void)service;
+	return 0;
+#endif /* M68K_INTERRUPT_LATENCY */
+}
+
+int m68k_get_exception_latency(unsigned int vector, m68k_latency_histogram* latency, m68k_latency_histogram* service)
+{
+#if M68K_INTERRUPT_LATENCY
+	if(vector > 255)
+		return 0;
+	if(latency != NULL)
+		*latency = m68ki_vector_latency[vector];
+	if(service != NULL)
+		*service = m68ki_vector_service[vector];
+	return 1;
+#else
+	(void)vector;
+	(void)latency;
+	(void)service;
+	return 0;
+#endif /* M68K_INTERRUPT_LATENCY */
+}
+
+int m68k_write_latency_histograms(const char* filename, int format)
+{
+#if M68K_INTERRUPT_LATENCY
+	int json = format == M68K_STATS_JSON;
+	const char* separator = "";
+	FILE* file;
+	uint i;
+	int ok;
+
+	if((file = fopen(filename, "w")) == NULL)
+		return 0;
+
+	/* Bucket n starts at 2^(n-1) cycles */
+	if(json)
+		fprintf(file, "{\n\t\"bucket_start\": [0");
+	else
+		fprintf(file, "kind,index,measure,count,min,max,total,0");
+	for(i = 1; i < M68K_LATENCY_BUCKETS; i++)
+		fprintf(file, json ? ", %lu" : ",%lu", 1ul << (i - 1));
+	fprintf(file, json ? "],\n\t\"levels\": [" : "\n");
+
+	for(i = 1; i < 8; i++)
+	{
+		if(m68ki_level_latency[i].count == 0 && m68ki_level_service[i].count == 0)
+			continue;
+		if(json)
+			fprintf(file, "%s\n\t\t{\n\t\t\t\"level\": %u", separator, i);
+		m68ki_write_latency_histogram(file, json, "level", i, "latency", &m68ki_level_latency[i]);
+		m68ki_write_latency_histogram(file, json, "level", i, "service", &m68ki_level_service[i]);
+		if(json)
+			fprintf(file, "\n\t\t}");
+		separator = ",";
+	}
+	if(json)
+		fprintf(file, "\n\t],\n\t\"vectors\": [");
+	separator = "";
+	for(i = 0; i < 256; i++)
+	{
+		if(m68ki_vector_latency[i].count == 0 && m68ki_vector_service[i].count == 0)
+			continue;
+		if(json)
+			fprintf(file, "%s\n\t\t{\n\t\t\t\"vector\": %u", separator, i);
+		m68ki_write_latency_histogram(file, json, "vector", i, "latency", &m68ki_vector_latency[i]);
+		m68ki_write_latency_histogram(file, json, "vector", i, "service", &m68ki_vector_service[i]);
+		if(json)
+			fprintf(file, "\n\t\t}");
+		separator = ",";
+	}
+	if(json)
+		fprintf(file, "\n\t]\n}\n");
+
+	ok = !ferror(file);
+	return fclose(file) == 0 && ok;
+#else
+	(void)filename;
+	(void)format;
+	return 0;
+#endif /* M68K_INTERRUPT_LATENCY */
+}
+
+void m68k_clear_latency_histograms(void)
+{
+#if M68K_INTERRUPT_LATENCY
+	memset(m68ki_level_latency, 0, sizeof(m68ki_level_latency));
+	memset(m68ki_level_service, 0, sizeof(m68ki_level_service));
+	memset(m68ki_vector_latency, 0, sizeof(m68ki_vector_latency));
+	memset(m68ki_vector_service, 0, sizeof(m68ki_vector_service));
+#endif /* M68K_INTERRUPT_LATENCY */
+}
+
+int m68k_get_perf_counters(m68k_perf_counters* counters)
+{
+#if M68K_PERF_COUNTERS
+	counters->instructions = m68ki_perf_instructions;
+	counters->cycles = m68ki_perf_cycles;
+	return 1;
+#else
+	(void)counters;
+	return 0;
+#endif /* M68K_PERF_COUNTERS */
+}
+
+void m68k_clear_perf_counters(void)
+{
+#if M68K_PERF_COUNTERS
+	m68ki_perf_instructions = 0;
+	m68ki_perf_cycles = 0;
+#endif /* M68K_PERF_COUNTERS */
+}
+
+#if M68K_TRACE_BUFFER
+static uint m68ki_trace_buffer_cycles(void)
+{
+	return m68ki_trace_buffer_cycle_base + (m68ki_initial_cycles - GET_CYCLES());
+}
+
+static void m68ki_trace_buffer_fire_trigger(void);
+
+/* Called by m68k_execute() before it sets up the cycle count */
+static void m68ki_trace_buffer_start_timeslice(void)
+{
+	m68ki_trace_buffer_cycle_base = m68ki_trace_buffer_cycles();
+	if(m68ki_trace_buffer_current != NULL)
+	{
+		m68ki_trace_buffer_current = NULL;
+		m68ki_trace_buffer_fire_trigger();
+	}
+}
+
+/* Take the next record in the ring, cleared, for an event at pc */
+static m68k_trace_record* m68ki_trace_buffer_new_record(uint pc)
+{
+	m68k_trace_record* record = &m68ki_trace_buffer[m68ki_trace_buffer_count++ & (M68K_TRACE_BUFFER_SIZE-1)];
+
+	memset(record, 0, sizeof(*record));
+	record->pc = ADDRESS_68K(pc);
+	record->cycles = m68ki_trace_buffer_cycles();
+	record->sr = m68ki_get_sr();
+	return record;
+}
+
+/* Note the first trigger of type that an event at value (and the size-1
+ * addresses after it) sets off.  It fires when the record is complete.
+ */
+static void m68ki_trace_buffer_check_triggers(uint type, uint value, uint size)
+{
+	uint i;
+
+	if(m68ki_trace_trigger_pending)
+		return;
+	for(i = 0; i < m68ki_trace_trigger_count; i++)
+		if(m68ki_trace_triggers[i].type == type &&
+		   (m68ki_trace_triggers[i].value == M68K_TRACE_TRIGGER_ANY || m68ki_trace_triggers[i].value - value < size))
+		{
+			m68ki_trace_trigger_pending = 1;
+			m68ki_trace_trigger_type = type;
+			m68ki_trace_trigger_value = type == M68K_TRACE_TRIGGER_WRITE ? value : m68ki_trace_triggers[i].value;
+			if(m68ki_trace_trigger_value == M68K_TRACE_TRIGGER_ANY)
+				m68ki_trace_trigger_value = value;
+			return;
+		}
+}
+
+static void m68ki_trace_buffer_fire_trigger(void)
+{
+	if(!m68ki_trace_trigger_pending)
+		return;
+	m68ki_trace_trigger_pending = 0;
+	if(m68ki_trace_trigger_callback != NULL)
+		m68ki_trace_trigger_callback(m68ki_trace_trigger_type, m68ki_trace_trigger_value);
+}
+
+/* Start recording the instruction at REG_PC.  The registers it changes are
+ * found by comparing them with REG_DA_SAVE when it is done.
+ */
+static void m68ki_trace_buffer_begin_record(void)
+{
+	m68k_trace_record* record;
+	uint length;
+	uint i;
+
+	/* A bus or address error ended the last instruction early */
+	m68ki_trace_buffer_fire_trigger();
+
+	record = m68ki_trace_buffer_new_record(REG_PC);
+	record->words[0] = m68k_read_disassembler_16(record->pc);
+	length = m68ki_opcode_info_table[m68ki_instruction_index_table[record->words[0]]].length;
+	for(i = 1; i < length && i < M68K_TRACE_MAX_WORDS; i++)
+		record->words[i] = m68k_read_disassembler_16(ADDRESS_68K(record->pc + i * 2));
+	m68ki_trace_buffer_current = record;
+	m68ki_trace_buffer_check_triggers(M68K_TRACE_TRIGGER_PC, record->pc, 1);
+}
+
+static void m68ki_trace_buffer_end_record(void)
+{
+	m68k_trace_record* record = m68ki_trace_buffer_current;
+	uint stored = 0;
+	uint i;
+
+	m68ki_trace_buffer_current = NULL;
+	for(i = 0; i < 16; i++)
+		if(REG_DA[i] != REG_DA_SAVE[i])
+		{
+			record->changed |= 1 << i;
+			if(stored < 2)
+				record->reg_value[stored++] = REG_DA[i];
+			else
+				record->flags |= M68K_TRACE_MORE_REGS;
+		}
+	m68ki_trace_buffer_fire_trigger();
+}
+
+void m68ki_trace_buffer_add_write(uint address, uint value, uint size)
+{
+	m68k_trace_record* record = m68ki_trace_buffer_current;
+
+	address = ADDRESS_68K(address);
+	if(record->flags & M68K_TRACE_WRITE_SIZE)
+		record->flags |= M68K_TRACE_MORE_WRITES;
+	else
+	{
+		record->flags |= size == 4 ? 3 : size;
+		record->write_address = address;
+		record->write_value = value;
+	}
+	m68ki_trace_buffer_check_triggers(M68K_TRACE_TRIGGER_WRITE, address, size);
+}
+
+/* Interrupts get a record of their own, other exceptions are noted in the
+ * record of the instruction that caused them.
+ */
+void m68ki_trace_buffer_add_exception(uint vector, int interrupt)
+{
+	m68k_trace_record* record = m68ki_trace_buffer_current;
+
+	if(interrupt || record == NULL)
+	{
+		record = m68ki_trace_buffer_new_record(REG_PC);
+		record->flags = M68K_TRACE_NO_INSTRUCTION;
+	}
+	if(record->flags & M68K_TRACE_EXCEPTION)
+		return;
+	record->flags |= M68K_TRACE_EXCEPTION;
+	record->vector = vector;
+	m68ki_trace_buffer_check_triggers(M68K_TRACE_TRIGGER_EXCEPTION, vector, 1);
+
+	/* Bus and address errors abandon the instruction */
+	if(vector == EXCEPTION_BUS_ERROR || vector == EXCEPTION_ADDRESS_ERROR)
+		m68ki_trace_buffer_current = NULL;
+	if(m68ki_trace_buffer_current == NULL)
+		m68ki_trace_buffer_fire_trigger();
+}
+#endif /* M68K_TRACE_BUFFER */
+
+#if M68K_SAMPLE_PC
+/* Report the instruction that used up the cycle a sample was due at, once
+ * for each sample period it covered.
+ */
+static void m68ki_take_samples(void)
+{
+	do
+	{
+		m68ki_sample_at -= m68ki_sample_period;
+		if(m68ki_sample_callback != NULL)
+			m68ki_sample_callback(ADDRESS_68K(REG_PPC));
+	} while(GET_CYCLES() <= m68ki_sample_at);
+}
+#endif /* M68K_SAMPLE_PC */
+
+void m68k_set_pc_sample_callback(void  (*callback)(unsigned int pc))
+{
+#if M68K_SAMPLE_PC
+	m68ki_sample_callback = callback;
+#else
+	(void)callback;
+#endif /* M68K_SAMPLE_PC */
+}
+
+void m68k_set_pc_sample_period(unsigned int cycles)
+{
+#if M68K_SAMPLE_PC
+	m68ki_sample_period = cycles;
+	m68ki_sample_at = cycles ? GET_CYCLES() - (sint)cycles : INT_MIN;
+#else
+	(void)cycles;
+#endif /* M68K_SAMPLE_PC */
+}
+
+void m68k_set_trace_trigger_callback(void  (*callback)(unsigned int type, unsigned int value))
+{
+#if M68K_TRACE_BUFFER
+	m68ki_trace_trigger_callback = callback;
+#else
+	(void)callback;
+#endif /* M68K_TRACE_BUFFER */
+}
+
+void m68k_trace_buffer_enable(int enable)
+{
+#if M68K_TRACE_BUFFER
+	m68ki_trace_buffer_enabled = enable;
+	if(!enable)
+		m68ki_trace_buffer_current = NULL;
+#else
+	(void)enable;
+#endif /* M68K_TRACE_BUFFER */
+}
+
+void m68k_trace_buffer_clear(void)
+{
+#if M68K_TRACE_BUFFER
+	m68ki_trace_buffer_count = 0;
+	m68ki_trace_buffer_current = NULL;
+	m68ki_trace_trigger_pending = 0;
+#endif /* M68K_TRACE_BUFFER */
+}
+
+int m68k_trace_buffer_add_trigger(unsigned int type, unsigned int value)
+{
+#if M68K_TRACE_BUFFER
+	if(m68ki_trace_trigger_count >= M68K_TRACE_MAX_TRIGGERS)
+		return 0;
+	m68ki_trace_triggers[m68ki_trace_trigger_count].type = type;
+	m68ki_trace_triggers[m68ki_trace_trigger_count].value = value;
+	m68ki_trace_trigger_count++;
+	return 1;
+#else
+	(void)type;
+	(void)value;
+	return 0;
+#endif /* M68K_TRACE_BUFFER */
+}
+
+void m68k_trace_buffer_clear_triggers(void)
+{
+#if M68K_TRACE_BUFFER
+	m68ki_trace_trigger_count = 0;
+	m68ki_trace_trigger_pending = 0;
+#endif /* M68K_TRACE_BUFFER */
+}
+
+unsigned int m68k_trace_buffer_get(m68k_trace_record* records, unsigned int count)
+{
+#if M68K_TRACE_BUFFER
+	uint available = m68ki_trace_buffer_count < M68K_TRACE_BUFFER_SIZE ? m68ki_trace_buffer_count : M68K_TRACE_BUFFER_SIZE;
+	uint i;
+
+	if(count > available)
+		count = available;
+	for(i = 0; i < count; i++)
+		records[i] = m68ki_trace_buffer[(m68ki_trace_buffer_count - count + i) & (M68K_TRACE_BUFFER_SIZE-1)];
+	return count;
+#else
+	(void)records;
+	(void)count;
+	return 0;
+#endif /* M68K_TRACE_BUFFER */
+}
+
+/* Trace files start with this, then the number of records as a 32-bit
+ * little-endian value, then the records with every field little-endian.
+ */
+static const char m68ki_trace_file_magic[8] = {'M', '6', '8', 'K', 'T', 'R', 'C', '1'};
+#define M68KI_TRACE_FILE_RECORD_SIZE 40
+
+#if M68K_TRACE_BUFFER
+static void m68ki_trace_put(uint8* p, uint value, uint size)
+{
+	uint i;
+
+	for(i = 0; i < size; i++)
+		p[i] = (value >> (i * 8)) & 0xff;
+}
+#endif /* M68K_TRACE_BUFFER */
+
+static uint m68ki_trace_get(const uint8* p, uint size)
+{
+	uint value = 0;
+	uint i;
+
+	for(i = 0; i < size; i++)
+		value |= (uint)p[i] << (i * 8);
+	return value;
+}
+
+int m68k_trace_buffer_write(const char* filename, unsigned int count)
+{
+#if M68K_TRACE_BUFFER
+	uint8 data[M68KI_TRACE_FILE_RECORD_SIZE];
+	uint available = m68ki_trace_buffer_count < M68K_TRACE_BUFFER_SIZE ? m68ki_trace_buffer_count : M68K_TRACE_BUFFER_SIZE;
+	FILE* file;
+	int ok;
+	uint i;
+	uint j;
+
+	if(count == 0 || count > available)
+		count = available;
+	if((file = fopen(filename, "wb")) == NULL)
+		return 0;
+	m68ki_trace_put(data, count, 4);
+	fwrite(m68ki_trace_file_magic, 1, sizeof(m68ki_trace_file_magic), file);
+	fwrite(data, 1, 4, file);
+	for(i = 0; i < count; i++)
+	{
+		const m68k_trace_record* record = &m68ki_trace_buffer[(m68ki_trace_buffer_count - count + i) & (M68K_TRACE_BUFFER_SIZE-1)];
+
+		m68ki_trace_put(data, record->pc, 4);
+		m68ki_trace_put(data + 4, record->cycles, 4);
+		for(j = 0; j < M68K_TRACE_MAX_WORDS; j++)
+			m68ki_trace_put(data + 8 + j * 2, record->words[j], 2);
+		m68ki_trace_put(data + 18, record->sr, 2);
+		m68ki_trace_put(data + 20, record->changed, 2);
+		data[22] = record->flags;
+		data[23] = record->vector;
+		m68ki_trace_put(data + 24, record->reg_value[0], 4);
+		m68ki_trace_put(data + 28, record->reg_value[1], 4);
+		m68ki_trace_put(data + 32, record->write_address, 4);
+		m68ki_trace_put(data + 36, record->write_value, 4);
+		fwrite(data, 1, sizeof(data), file);
+	}
+	ok = !ferror(file);
+	return fclose(file) == 0 && ok;
+#else
+	(void)filename;
+	(void)count;
+	return 0;
+#endif /* M68K_TRACE_BUFFER */
+}
+
+unsigned int m68k_trace_buffer_read(const char* filename, m68k_trace_record* records, unsigned int max)
+{
+	uint8 data[M68KI_TRACE_FILE_RECORD_SIZE];
+	FILE* file;
+	uint count;
+	uint i;
+	uint j;
+
+	if((file = fopen(filename, "rb")) == NULL)
+		return 0;
+	if(fread(data, 1, 12, file) != 12 || memcmp(data, m68ki_trace_file_magic, sizeof(m68ki_trace_file_magic)) != 0)
+	{
+		fclose(file);
+		return 0;
+	}
+	count = m68ki_trace_get(data + 8, 4);
+	if(count > max)
+		count = max;
+	for(i = 0; i < count; i++)
+	{
+		m68k_trace_record* record = &records[i];
+
+		if(fread(data, 1, sizeof(data), file) != sizeof(data))
+			break;
+		record->pc = m68ki_trace_get(data, 4);
+		record->cycles = m68ki_trace_get(data + 4, 4);
+		for(j = 0; j < M68K_TRACE_MAX_WORDS; j++)
+			record->words[j] = m68ki_trace_get(data + 8 + j * 2, 2);
+		record->sr = m68ki_trace_get(data + 18, 2);
+		record->changed = m68ki_trace_get(data + 20, 2);
+		record->flags = data[22];
+		record->vector = data[23];
+		record->reg_value[0] = m68ki_trace_get(data + 24, 4);
+		record->reg_value[1] = m68ki_trace_get(data + 28, 4);
+		record->write_address = m68ki_trace_get(data + 32, 4);
+		record->write_value = m68ki_trace_get(data + 36, 4);
+	}
+	fclose(file);
+	return i;
+}
+
 /* Set the CPU type. */
 void m68k_set_cpu_type(unsigned int cpu_type)
 {
@@ -785,6 +2007,7 @@ void m68k_set_cpu_type(unsigned int cpu_type)
 	{
 		case M68K_CPU_TYPE_68000:
 			CPU_TYPE         = CPU_TYPE_000;
+			m68ki_cpu.jump_table = JUMP_TABLE_000;
 			CPU_ADDRESS_MASK = 0x00ffffff;
 			CPU_SR_MASK      = 0xa71f; /* T1 -- S  -- -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
 			CYC_INSTRUCTION  = m68ki_cycles[0];
@@ -804,9 +2027,11 @@ void m68k_set_cpu_type(unsigned int cpu_type)
 			m68k_set_cpu_type(M68K_CPU_TYPE_68010);
 			CPU_ADDRESS_MASK = 0xffffffff;
 			CPU_TYPE         = CPU_TYPE_SCC070;
+			m68ki_cpu.jump_table = JUMP_TABLE();
 			return;
 		case M68K_CPU_TYPE_68010:
 			CPU_TYPE         = CPU_TYPE_010;
+			m68ki_cpu.jump_table = JUMP_TABLE_010;
 			CPU_ADDRESS_MASK = 0x00ffffff;
 			CPU_SR_MASK      = 0xa71f; /* T1 -- S  -- -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
 			CYC_INSTRUCTION  = m68ki_cycles[1];
@@ -824,6 +2049,7 @@ void m68k_set_cpu_type(unsigned int cpu_type)
 			return;
 		case M68K_CPU_TYPE_68EC020:
 			CPU_TYPE         = CPU_TYPE_EC020;
+			m68ki_cpu.jump_table = JUMP_TABLE();
 			CPU_ADDRESS_MASK = 0x00ffffff;
 			CPU_SR_MASK      = 0xf71f; /* T1 T0 S  M  -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
 			CYC_INSTRUCTION  = m68ki_cycles[2];
@@ -841,6 +2067,7 @@ void m68k_set_cpu_type(unsigned int cpu_type)
 			return;
 		case M68K_CPU_TYPE_68020:
 			CPU_TYPE         = CPU_TYPE_020;
+			m68ki_cpu.jump_table = JUMP_TABLE_020;
 			CPU_ADDRESS_MASK = 0xffffffff;
 			CPU_SR_MASK      = 0xf71f; /* T1 T0 S  M  -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
 			CYC_INSTRUCTION  = m68ki_cycles[2];
@@ -858,6 +2085,7 @@ void m68k_set_cpu_type(unsigned int cpu_type)
 			return;
 		case M68K_CPU_TYPE_68030:
 			CPU_TYPE         = CPU_TYPE_030;
+			m68ki_cpu.jump_table = JUMP_TABLE_030;
 			CPU_ADDRESS_MASK = 0xffffffff;
 			CPU_SR_MASK      = 0xf71f; /* T1 T0 S  M  -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
 			CYC_INSTRUCTION  = m68ki_cycles[3];
@@ -875,6 +2103,7 @@ void m68k_set_cpu_type(unsigned int cpu_type)
 			return;
 		case M68K_CPU_TYPE_68EC030:
 			CPU_TYPE         = CPU_TYPE_EC030;
+			m68ki_cpu.jump_table = JUMP_TABLE();
 			CPU_ADDRESS_MASK = 0xffffffff;
 			CPU_SR_MASK          = 0xf71f; /* T1 T0 S  M  -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
 			CYC_INSTRUCTION  = m68ki_cycles[3];
@@ -892,6 +2121,7 @@ void m68k_set_cpu_type(unsigned int cpu_type)
 			return;
 		case M68K_CPU_TYPE_68040:		// TODO: these values are not correct
 			CPU_TYPE         = CPU_TYPE_040;
+			m68ki_cpu.jump_table = JUMP_TABLE_040;
 			CPU_ADDRESS_MASK = 0xffffffff;
 			CPU_SR_MASK      = 0xf71f; /* T1 T0 S  M  -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
 			CYC_INSTRUCTION  = m68ki_cycles[4];
@@ -909,6 +2139,7 @@ void m68k_set_cpu_type(unsigned int cpu_type)
 			return;
 		case M68K_CPU_TYPE_68EC040: // Just a 68040 without pmmu apparently...
 			CPU_TYPE         = CPU_TYPE_EC040;
+			m68ki_cpu.jump_table = JUMP_TABLE();
 			CPU_ADDRESS_MASK = 0xffffffff;
 			CPU_SR_MASK      = 0xf71f; /* T1 T0 S  M  -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
 			CYC_INSTRUCTION  = m68ki_cycles[4];
@@ -926,6 +2157,7 @@ void m68k_set_cpu_type(unsigned int cpu_type)
 			return;
 		case M68K_CPU_TYPE_68LC040:
 			CPU_TYPE         = CPU_TYPE_LC040;
+			m68ki_cpu.jump_table = JUMP_TABLE();
 			m68ki_cpu.sr_mask          = 0xf71f; /* T1 T0 S  M  -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
 			m68ki_cpu.cyc_instruction  = m68ki_cycles[4];
 			m68ki_cpu.cyc_exception    = m68ki_exception_cycle_table[4];
@@ -943,7 +2175,7 @@ void m68k_set_cpu_type(unsigned int cpu_type)
 	}
 }
 
-static int ss_flag = 0;
+int ss_flag = 0;
 //extern int g_quit;
 
 /* breakpoint address table */
@@ -977,6 +2209,9 @@ extern void dump_bufword(const char *, saddr_t, saddr_t);
 extern unsigned short peek_word(saddr_t);
 extern void _find_addr(saddr_t addr, saddr_t *startp, saddr_t *endp);
 extern unsigned char g_ram[];
+#if M68K_TRACE_BUFFER
+extern void dump_trace(int count);
+#endif
 
 static int prompt_flag = 0;
 
@@ -993,6 +2228,11 @@ int m68k_execute(int num_cycles)
 		return rc;
 	}
 
+	m68ki_trace_buffer_timeslice(); /* auto-disable */
+	m68ki_sample_timeslice(num_cycles); /* auto-disable */
+	m68ki_heatmap_timeslice(num_cycles); /* auto-disable */
+	m68ki_latency_timeslice(); /* auto-disable */
+
 	/* Set our pool of clock cycles available */
 	SET_CYCLES(num_cycles);
 	m68ki_initial_cycles = num_cycles;
@@ -1067,16 +2307,33 @@ int m68k_execute(int num_cycles)
 			uint print_pc;
 			print_pc = (ss_flag && REG_PC != donext_addr) ? REG_PC : 0;
 			/* Read an instruction and call its handler */
+			m68ki_trace_buffer_begin(); /* auto-disable */
 			REG_IR = m68ki_read_imm_16();
-			m68ki_instruction_jump_table[REG_IR]();
+			m68ki_profile_handler(REG_IR); /* auto-disable */
+			m68ki_stats_begin(); /* auto-disable */
+			m68ki_dispatch(REG_IR);
 			USE_CYCLES(CYC_INSTRUCTION[REG_IR]);
+			m68ki_perf_instruction(); /* auto-disable */
+			m68ki_stats_end(); /* auto-disable */
+			m68ki_trace_buffer_end(); /* auto-disable */
+			m68ki_sample_pc(); /* auto-disable */
+			m68ki_heatmap_interval(); /* auto-disable */
 #if 1
+#if M68K_TRACE_BUFFER
+			/* the step listing comes from the trace buffer */
+			if (ss_flag && print_pc) dump_trace(1);
+#else
 			if (ss_flag && print_pc) fprintf(stderr,"%08X:%04X A0:%04X A1:%04X A2:%04X A4:%04X A5:%04X A6:%04X D0:%04X D1:%04X D2:%04X D3:%04X\n", print_pc, REG_IR, REG_A[0], REG_A[1], REG_A[2], REG_A[4], REG_A[5], REG_A[6], REG_D[0], REG_D[1], REG_D[2], REG_D[3]);
+#endif
 			/*if (ss_flag) fprintf(stderr,"%04X D0:%04X D1:%04X D2:%04X D3:%04X D4:%04X\n", REG_IR, REG_D[0], REG_D[1], REG_D[2], REG_D[3], REG_D[4]);*/
 			if (ss_flag) {
 				while (ss_flag) {
 					if (prompt_flag)
+#if M68K_TRACE_BUFFER
+						fprintf(stderr,"[.btvsdfl>");
+#else
 						fprintf(stderr,"[.btvsdf>");
+#endif
 					int c = getchar();
 					if (c == ' ') {
 						break;
@@ -1098,6 +2355,11 @@ int m68k_execute(int num_cycles)
 					} else if (c == 'f') {
 						extern void dump_find(void);
 						dump_find();
+#if M68K_TRACE_BUFFER
+					} else if (c == 'l') {
+						/* last instructions from the trace buffer */
+						dump_trace(16);
+#endif
 					} else if (c == '?') {
 						prompt_flag = !prompt_flag;
 					}
@@ -1114,6 +2376,8 @@ int m68k_execute(int num_cycles)
 	else
 		SET_CYCLES(0);
 
+	m68ki_perf_timeslice(m68ki_initial_cycles - GET_CYCLES()); /* auto-disable */
+
 	/* return how many clocks we used */
 	return m68ki_initial_cycles - GET_CYCLES();
 }
@@ -1152,6 +2416,7 @@ void m68k_set_irq(unsigned int int_level)
 {
 	uint old_level = CPU_INT_LEVEL;
 	CPU_INT_LEVEL = int_level << 8;
+	m68ki_latency_irq(int_level); /* auto-disable */
 
 	/* A transition from < 7 to 7 always interrupts (NMI) */
 	/* Note: Level 7 can also level trigger like a normal IRQ */
@@ -1183,15 +2448,6 @@ unsigned int m68k_get_virq(unsigned int level)
 
 void m68k_init(void)
 {
-	static uint emulation_initialized = 0;
-
-	/* The first call to this function initializes the opcode handler jump table */
-	if(!emulation_initialized)
-		{
-		m68ki_build_opcode_table();
-		emulation_initialized = 1;
-	}
-
 	m68k_set_int_ack_callback(NULL);
 	m68k_set_bkpt_ack_callback(NULL);
 	m68k_set_reset_instr_callback(NULL);
@@ -1202,6 +2458,8 @@ void m68k_init(void)
 	m68k_set_pc_changed_callback(NULL);
 	m68k_set_fc_callback(NULL);
 	m68k_set_instr_hook_callback(NULL);
+	m68k_set_call_hook_callback(NULL);
+	m68k_unmap_direct_memory();
 }
 
 /* Trigger a Bus Error exception */
@@ -1230,6 +2488,8 @@ void m68k_pulse_reset(void)
 	FLAG_INT_MASK = 0x0700;
 	CPU_INT_LEVEL = 0;
 	m68ki_cpu.virq_state = 0;
+	/* Forget the interrupts pending and being serviced */
+	m68ki_latency_reset(); /* auto-disable */
 	/* Reset VBR */
 	REG_VBR = 0;
 	/* Go to supervisor mode */
@@ -95,6 +95,15 @@ typedef uint32 uint64;
 #define S64(val) val
 #endif
 
+/* Placement hints for the opcode handlers, see M68K_PROFILE_HANDLERS */
+#ifdef __GNUC__
+#define M68KI_HOT  __attribute__((hot))
+#define M68KI_COLD __attribute__((cold))
+#else
+#define M68KI_HOT
+#define M68KI_COLD
+#endif
+
 #include "softfloat/milieu.h"
 #include "softfloat/softfloat.h"
 
@@ -146,6 +155,7 @@ typedef uint32 uint64;
 /* breakpoint addresses */
 extern uint breakpoint_addr[];		/* defined in m68cpu.c */
 extern void set_breakpoint_addr(uint addr);
+extern int ss_flag;					/* single stepping, defined in m68cpu.c */
 
 /* ======================================================================== */
 /* ============================ GENERAL DEFINES =========================== */
@@ -397,6 +407,7 @@ extern void set_breakpoint_addr(uint addr);
 #define CALLBACK_PC_CHANGED  m68ki_cpu.pc_changed_callback
 #define CALLBACK_SET_FC      m68ki_cpu.set_fc_callback
 #define CALLBACK_INSTR_HOOK  m68ki_cpu.instr_hook_callback
+#define CALLBACK_CALL_HOOK   m68ki_cpu.call_hook_callback
 
 
 
@@ -459,6 +470,21 @@ extern void set_breakpoint_addr(uint addr);
 	#define CPU_TYPE_IS_000(A)         1
 #endif
 
+/* CPU models that get their own opcode handler set */
+#if M68K_SPECIALIZE_HANDLERS
+	#define M68K_SPECIALIZE_000        1
+	#define M68K_SPECIALIZE_010        M68K_EMULATE_010
+	#define M68K_SPECIALIZE_020        M68K_EMULATE_020
+	#define M68K_SPECIALIZE_030        M68K_EMULATE_030
+	#define M68K_SPECIALIZE_040        M68K_EMULATE_040
+#else
+	#define M68K_SPECIALIZE_000        0
+	#define M68K_SPECIALIZE_010        0
+	#define M68K_SPECIALIZE_020        0
+	#define M68K_SPECIALIZE_030        0
+	#define M68K_SPECIALIZE_040        0
+#endif
+
 
 #if !M68K_SEPARATE_READS
 #define m68k_read_immediate_16(A) m68ki_read_program_16(A)
@@ -552,6 +578,16 @@ extern void set_breakpoint_addr(uint addr);
 	#define m68ki_instr_hook(pc)
 #endif /* M68K_INSTRUCTION_HOOK */
 
+#if M68K_CALL_HOOK
+	#if M68K_CALL_HOOK == OPT_SPECIFY_HANDLER
+		#define m68ki_call_hook(type, pc, target) M68K_CALL_HOOK_CALLBACK(type, ADDRESS_68K(pc), ADDRESS_68K(target))
+	#else
+		#define m68ki_call_hook(type, pc, target) CALLBACK_CALL_HOOK(type, ADDRESS_68K(pc), ADDRESS_68K(target))
+	#endif
+#else
+	#define m68ki_call_hook(type, pc, target)
+#endif /* M68K_CALL_HOOK */
+
 #if M68K_MONITOR_PC
 	#if M68K_MONITOR_PC == OPT_SPECIFY_HANDLER
 		#define m68ki_pc_changed(A) M68K_SET_PC_CALLBACK(ADDRESS_68K(A))
@@ -563,6 +599,62 @@ extern void set_breakpoint_addr(uint addr);
 #endif /* M68K_MONITOR_PC */
 
 
+/* Record memory writes and exceptions in the trace buffer */
+#if M68K_TRACE_BUFFER
+	#define m68ki_trace_buffer_recording() (m68ki_trace_buffer_current != NULL)
+	#define m68ki_trace_buffer_write(A, V, S) if(m68ki_trace_buffer_current) m68ki_trace_buffer_add_write(A, V, S)
+	#define m68ki_trace_buffer_exception(V) if(m68ki_trace_buffer_enabled) m68ki_trace_buffer_add_exception(V, 0)
+	#define m68ki_trace_buffer_interrupt(V) if(m68ki_trace_buffer_enabled) m68ki_trace_buffer_add_exception(V, 1)
+#else
+	#define m68ki_trace_buffer_recording() 0
+	#define m68ki_trace_buffer_write(A, V, S)
+	#define m68ki_trace_buffer_exception(V)
+	#define m68ki_trace_buffer_interrupt(V)
+#endif /* M68K_TRACE_BUFFER */
+
+
+/* Count taken conditional branches for the instruction statistics */
+#if M68K_INSTRUCTION_STATS
+	#define m68ki_stats_branch_taken() m68ki_stats_add_branch_taken()
+#else
+	#define m68ki_stats_branch_taken()
+#endif /* M68K_INSTRUCTION_STATS */
+
+
+/* Count memory accesses per line for the heatmap.  Reads in program space
+ * count as fetches.
+ */
+#if M68K_MEMORY_HEATMAP
+	#define m68ki_heatmap_read(A, FC) m68ki_heatmap_add(A, ((FC) & 3) == FUNCTION_CODE_USER_PROGRAM ? M68KI_HEATMAP_FETCH : M68KI_HEATMAP_READ)
+	#define m68ki_heatmap_write(A) m68ki_heatmap_add(A, M68KI_HEATMAP_WRITE)
+#else
+	#define m68ki_heatmap_read(A, FC)
+	#define m68ki_heatmap_write(A)
+#endif /* M68K_MEMORY_HEATMAP */
+
+
+/* Time interrupts from being raised to being taken, and exceptions from
+ * being taken to their rte
+ */
+#if M68K_INTERRUPT_LATENCY
+	#define m68ki_latency_interrupt(L) m68ki_latency_add_interrupt(L)
+	#define m68ki_latency_taken(V, L) m68ki_latency_add_taken(V, L)
+	#define m68ki_latency_rte() m68ki_latency_add_rte()
+#else
+	#define m68ki_latency_interrupt(L)
+	#define m68ki_latency_taken(V, L)
+	#define m68ki_latency_rte()
+#endif /* M68K_INTERRUPT_LATENCY */
+
+
+/* Count instructions run without going through m68k_execute()'s loop */
+#if M68K_PERF_COUNTERS
+	#define m68ki_perf_add_instructions(N) m68ki_perf_instructions += (N)
+#else
+	#define m68ki_perf_add_instructions(N)
+#endif /* M68K_PERF_COUNTERS */
+
+
 /* Enable or disable function code emulation */
 #if M68K_EMULATE_FC
 	#if M68K_EMULATE_FC == OPT_SPECIFY_HANDLER
@@ -853,7 +945,8 @@ extern jmp_buf m68ki_aerr_trap;
 
 
 /* Get the condition code register */
-#define m68ki_get_ccr() ((COND_XS() >> 4) | \
+#define m68ki_get_ccr() (m68ki_flags_sync(), \
+						 (COND_XS() >> 4) | \
 						 (COND_MI() >> 4) | \
 						 (COND_EQ() << 2) | \
 						 (COND_VS() >> 6) | \
@@ -869,6 +962,117 @@ extern jmp_buf m68ki_aerr_trap;
 
 
 
+/* ------------------------------ Lazy Flags ------------------------------ */
+
+/* The common ALU flag updates.  With M68K_LAZY_FLAGS on, these only record
+ * the operation and its operands, and m68ki_flags_sync() computes N, Z, V
+ * and C from them before anything looks at the flags.  X is always updated
+ * immediately since ADDX, SUBX and the shifts read it far more often than
+ * N, Z, V or C are read.
+ */
+#define LAZY_NONE    0
+#define LAZY_LOGIC_8 1
+#define LAZY_LOGIC_16 2
+#define LAZY_LOGIC_32 3
+#define LAZY_ADD_8   4
+#define LAZY_ADD_16  5
+#define LAZY_ADD_32  6
+#define LAZY_SUB_8   7
+#define LAZY_SUB_16  8
+#define LAZY_SUB_32  9
+
+#if M68K_LAZY_FLAGS
+
+#define m68ki_flags_record(OP, S, D, R) \
+	do { \
+		m68ki_cpu.lazy_op  = OP; \
+		m68ki_cpu.lazy_src = S; \
+		m68ki_cpu.lazy_dst = D; \
+		m68ki_cpu.lazy_res = R; \
+	} while(0)
+
+#define m68ki_flags_logic_8(R)  m68ki_flags_record(LAZY_LOGIC_8, 0, 0, R)
+#define m68ki_flags_logic_16(R) m68ki_flags_record(LAZY_LOGIC_16, 0, 0, R)
+#define m68ki_flags_logic_32(R) m68ki_flags_record(LAZY_LOGIC_32, 0, 0, R)
+#define m68ki_flags_cmp_8(S, D, R)  m68ki_flags_record(LAZY_SUB_8, S, D, R)
+#define m68ki_flags_cmp_16(S, D, R) m68ki_flags_record(LAZY_SUB_16, S, D, R)
+#define m68ki_flags_cmp_32(S, D, R) m68ki_flags_record(LAZY_SUB_32, S, D, R)
+#define m68ki_flags_sub_8(S, D, R) \
+	do { FLAG_X = CFLAG_8(R); m68ki_flags_record(LAZY_SUB_8, S, D, R); } while(0)
+#define m68ki_flags_sub_16(S, D, R) \
+	do { FLAG_X = CFLAG_16(R); m68ki_flags_record(LAZY_SUB_16, S, D, R); } while(0)
+#define m68ki_flags_sub_32(S, D, R) \
+	do { FLAG_X = CFLAG_SUB_32(S, D, R); m68ki_flags_record(LAZY_SUB_32, S, D, R); } while(0)
+#define m68ki_flags_add_8(S, D, R) \
+	do { FLAG_X = CFLAG_8(R); m68ki_flags_record(LAZY_ADD_8, S, D, R); } while(0)
+#define m68ki_flags_add_16(S, D, R) \
+	do { FLAG_X = CFLAG_16(R); m68ki_flags_record(LAZY_ADD_16, S, D, R); } while(0)
+#define m68ki_flags_add_32(S, D, R) \
+	do { FLAG_X = CFLAG_ADD_32(S, D, R); m68ki_flags_record(LAZY_ADD_32, S, D, R); } while(0)
+
+#define m68ki_flags_sync() \
+	(m68ki_cpu.lazy_op != LAZY_NONE ? m68ki_flags_materialize(&m68ki_cpu) : (void)0)
+
+#else
+
+#define m68ki_flags_logic_8(R) \
+	do { FLAG_N = NFLAG_8(R); FLAG_Z = R; FLAG_V = VFLAG_CLEAR; FLAG_C = CFLAG_CLEAR; } while(0)
+#define m68ki_flags_logic_16(R) \
+	do { FLAG_N = NFLAG_16(R); FLAG_Z = R; FLAG_V = VFLAG_CLEAR; FLAG_C = CFLAG_CLEAR; } while(0)
+#define m68ki_flags_logic_32(R) \
+	do { FLAG_N = NFLAG_32(R); FLAG_Z = R; FLAG_V = VFLAG_CLEAR; FLAG_C = CFLAG_CLEAR; } while(0)
+#define m68ki_flags_cmp_8(S, D, R) \
+	do { \
+		FLAG_N = NFLAG_8(R); \
+		FLAG_Z = MASK_OUT_ABOVE_8(R); \
+		FLAG_V = VFLAG_SUB_8(S, D, R); \
+		FLAG_C = CFLAG_8(R); \
+	} while(0)
+#define m68ki_flags_cmp_16(S, D, R) \
+	do { \
+		FLAG_N = NFLAG_16(R); \
+		FLAG_Z = MASK_OUT_ABOVE_16(R); \
+		FLAG_V = VFLAG_SUB_16(S, D, R); \
+		FLAG_C = CFLAG_16(R); \
+	} while(0)
+#define m68ki_flags_cmp_32(S, D, R) \
+	do { \
+		FLAG_N = NFLAG_32(R); \
+		FLAG_Z = MASK_OUT_ABOVE_32(R); \
+		FLAG_V = VFLAG_SUB_32(S, D, R); \
+		FLAG_C = CFLAG_SUB_32(S, D, R); \
+	} while(0)
+#define m68ki_flags_sub_8(S, D, R)  do { m68ki_flags_cmp_8(S, D, R); FLAG_X = FLAG_C; } while(0)
+#define m68ki_flags_sub_16(S, D, R) do { m68ki_flags_cmp_16(S, D, R); FLAG_X = FLAG_C; } while(0)
+#define m68ki_flags_sub_32(S, D, R) do { m68ki_flags_cmp_32(S, D, R); FLAG_X = FLAG_C; } while(0)
+#define m68ki_flags_add_8(S, D, R) \
+	do { \
+		FLAG_N = NFLAG_8(R); \
+		FLAG_V = VFLAG_ADD_8(S, D, R); \
+		FLAG_X = FLAG_C = CFLAG_8(R); \
+		FLAG_Z = MASK_OUT_ABOVE_8(R); \
+	} while(0)
+#define m68ki_flags_add_16(S, D, R) \
+	do { \
+		FLAG_N = NFLAG_16(R); \
+		FLAG_V = VFLAG_ADD_16(S, D, R); \
+		FLAG_X = FLAG_C = CFLAG_16(R); \
+		FLAG_Z = MASK_OUT_ABOVE_16(R); \
+	} while(0)
+#define m68ki_flags_add_32(S, D, R) \
+	do { \
+		FLAG_N = NFLAG_32(R); \
+		FLAG_V = VFLAG_ADD_32(S, D, R); \
+		FLAG_X = FLAG_C = CFLAG_ADD_32(S, D, R); \
+		FLAG_Z = MASK_OUT_ABOVE_32(R); \
+	} while(0)
+
+#define m68ki_flags_sync() ((void)0)
+
+#endif /* M68K_LAZY_FLAGS */
+
+
+
 /* ---------------------------- Cycle Counting ---------------------------- */
 
 #define ADD_CYCLES(A)    m68ki_remaining_cycles += (A)
@@ -943,6 +1147,8 @@ typedef struct
 	uint fpiar;        /* FPU Instruction Address Register (m68040) */
 	uint fpsr;         /* FPU Status Register (m68040) */
 	uint fpcr;         /* FPU Control Register (m68040) */
+	floatx80 fpcc_result; /* Last FPU result whose condition codes are not in fpsr yet */
+	uint fpcc_pending; /* fpcc_result must be folded into fpsr before it is read */
 	uint t1_flag;      /* Trace 1 */
 	uint t0_flag;      /* Trace 0 */
 	uint s_flag;       /* Supervisor */
@@ -952,6 +1158,10 @@ typedef struct
 	uint not_z_flag;   /* Zero, inverted for speedups */
 	uint v_flag;       /* Overflow */
 	uint c_flag;       /* Carry */
+	uint lazy_op;      /* Pending LAZY_xxx flag computation */
+	uint lazy_src;     /* Operands and result of the pending computation */
+	uint lazy_dst;
+	uint lazy_res;
 	uint int_mask;     /* I0-I2 */
 	uint int_level;    /* State of interrupt pins IPL0-IPL2 -- ASG: changed from ints_pending */
 	uint stopped;      /* Stopped state */
@@ -987,9 +1197,19 @@ typedef struct
 	uint mmu_tc;
 	uint16 mmu_sr;
 
+	void (*const *jump_table)(void); /* Opcode handlers for this CPU type, by opcode or by handler index */
 	const uint8* cyc_instruction;
 	const uint8* cyc_exception;
 
+	/* Host memory mapped with m68k_map_direct_memory() */
+	struct
+	{
+		uint base;
+		uint size;
+		uint8* ptr;
+	} direct_map[M68K_DIRECT_MAP_MAX];
+	uint direct_map_count;
+
 	/* Callbacks to host */
 	int  (*int_ack_callback)(int int_line);           /* Interrupt Acknowledge */
 	void (*bkpt_ack_callback)(unsigned int data);     /* Breakpoint Acknowledge */
@@ -1001,6 +1221,7 @@ typedef struct
 	void (*pc_changed_callback)(unsigned int new_pc); /* Called when the PC changes by a large amount */
 	void (*set_fc_callback)(unsigned int new_fc);     /* Called when the CPU function code changes */
 	void (*instr_hook_callback)(unsigned int pc);     /* Called every instruction cycle prior to execution */
+	void (*call_hook_callback)(int type, unsigned int pc, unsigned int target); /* Called after calls, returns and exceptions */
 
 } m68ki_cpu_core;
 
@@ -1014,16 +1235,52 @@ extern const uint     m68ki_shift_32_table[];
 extern const uint8    m68ki_exception_cycle_table[][256];
 extern uint           m68ki_address_space;
 extern const uint8    m68ki_ea_idx_cycle_table[];
+extern const m68k_opcode_info m68ki_opcode_info_table[];
 
 extern uint           m68ki_aerr_address;
 extern uint           m68ki_aerr_write_mode;
 extern uint           m68ki_aerr_fc;
 
+#if M68K_TRACE_BUFFER
+/* Record of the instruction being run, or NULL when not recording */
+extern m68k_trace_record* m68ki_trace_buffer_current;
+extern int                m68ki_trace_buffer_enabled;
+void m68ki_trace_buffer_add_write(uint address, uint value, uint size);
+void m68ki_trace_buffer_add_exception(uint vector, int interrupt);
+#endif /* M68K_TRACE_BUFFER */
+
+#if M68K_INSTRUCTION_STATS
+void m68ki_stats_add_branch_taken(void);
+#endif /* M68K_INSTRUCTION_STATS */
+
+#if M68K_MEMORY_HEATMAP
+enum
+{
+	M68KI_HEATMAP_READ,
+	M68KI_HEATMAP_WRITE,
+	M68KI_HEATMAP_FETCH
+};
+void m68ki_heatmap_add(uint address, uint kind);
+#endif /* M68K_MEMORY_HEATMAP */
+
+#if M68K_PERF_COUNTERS
+extern unsigned long long m68ki_perf_instructions;
+#endif /* M68K_PERF_COUNTERS */
+
+#if M68K_INTERRUPT_LATENCY
+void m68ki_latency_add_interrupt(uint int_level);
+void m68ki_latency_add_taken(uint vector, uint int_level);
+void m68ki_latency_add_rte(void);
+#endif /* M68K_INTERRUPT_LATENCY */
+
 /* Forward declarations to keep some of the macros happy */
 static inline uint m68ki_read_16_fc (uint address, uint fc);
 static inline uint m68ki_read_32_fc (uint address, uint fc);
 static inline uint m68ki_get_ea_ix(uint An);
 static inline void m68ki_check_interrupts(void);            /* ASG: check for interrupts */
+#if M68K_LAZY_FLAGS
+static inline void m68ki_flags_materialize(m68ki_cpu_core* cpu);
+#endif
 
 /* quick disassembly (used for logging) */
 char* m68ki_disassemble_quick(unsigned int pc, unsigned int cpu_type);
@@ -1136,6 +1393,7 @@ static inline uint m68ki_read_8_fc(uint address, uint fc)
 	    address = pmmu_translate_addr(address);
 #endif
 
+	m68ki_heatmap_read(address, fc); /* auto-disable (see m68kcpu.h) */
 	return m68k_read_memory_8(ADDRESS_68K(address));
 }
 static inline uint m68ki_read_16_fc(uint address, uint fc)
@@ -1149,6 +1407,7 @@ static inline uint m68ki_read_16_fc(uint address, uint fc)
 	    address = pmmu_translate_addr(address);
 #endif
 
+	m68ki_heatmap_read(address, fc); /* auto-disable (see m68kcpu.h) */
 	return m68k_read_memory_16(ADDRESS_68K(address));
 }
 static inline uint m68ki_read_32_fc(uint address, uint fc)
@@ -1162,6 +1421,7 @@ static inline uint m68ki_read_32_fc(uint address, uint fc)
 	    address = pmmu_translate_addr(address);
 #endif
 
+	m68ki_heatmap_read(address, fc); /* auto-disable (see m68kcpu.h) */
 	return m68k_read_memory_32(ADDRESS_68K(address));
 }
 
@@ -1169,12 +1429,14 @@ static inline void m68ki_write_8_fc(uint address, uint fc, uint value)
 {
 	(void)fc;
 	m68ki_set_fc(fc); /* auto-disable (see m68kcpu.h) */
+	m68ki_trace_buffer_write(address, value, 1); /* auto-disable (see m68kcpu.h) */
 
 #if M68K_EMULATE_PMMU
 	if (PMMU_ENABLED)
 	    address = pmmu_translate_addr(address);
 #endif
 
+	m68ki_heatmap_write(address); /* auto-disable (see m68kcpu.h) */
 	m68k_write_memory_8(ADDRESS_68K(address), value);
 }
 static inline void m68ki_write_16_fc(uint address, uint fc, uint value)
@@ -1182,12 +1444,14 @@ static inline void m68ki_write_16_fc(uint address, uint fc, uint value)
 	(void)fc;
 	m68ki_set_fc(fc); /* auto-disable (see m68kcpu.h) */
 	m68ki_check_address_error_010_less(address, MODE_WRITE, fc); /* auto-disable (see m68kcpu.h) */
+	m68ki_trace_buffer_write(address, value, 2); /* auto-disable (see m68kcpu.h) */
 
 #if M68K_EMULATE_PMMU
 	if (PMMU_ENABLED)
 	    address = pmmu_translate_addr(address);
 #endif
 
+	m68ki_heatmap_write(address); /* auto-disable (see m68kcpu.h) */
 	m68k_write_memory_16(ADDRESS_68K(address), value);
 }
 static inline void m68ki_write_32_fc(uint address, uint fc, uint value)
@@ -1195,12 +1459,14 @@ static inline void m68ki_write_32_fc(uint address, uint fc, uint value)
 	(void)fc;
 	m68ki_set_fc(fc); /* auto-disable (see m68kcpu.h) */
 	m68ki_check_address_error_010_less(address, MODE_WRITE, fc); /* auto-disable (see m68kcpu.h) */
+	m68ki_trace_buffer_write(address, value, 4); /* auto-disable (see m68kcpu.h) */
 
 #if M68K_EMULATE_PMMU
 	if (PMMU_ENABLED)
 	    address = pmmu_translate_addr(address);
 #endif
 
+	m68ki_heatmap_write(address); /* auto-disable (see m68kcpu.h) */
 	m68k_write_memory_32(ADDRESS_68K(address), value);
 }
 
@@ -1210,16 +1476,328 @@ static inline void m68ki_write_32_pd_fc(uint address, uint fc, uint value)
 	(void)fc;
 	m68ki_set_fc(fc); /* auto-disable (see m68kcpu.h) */
 	m68ki_check_address_error_010_less(address, MODE_WRITE, fc); /* auto-disable (see m68kcpu.h) */
+	m68ki_trace_buffer_write(address, value, 4); /* auto-disable (see m68kcpu.h) */
 
 #if M68K_EMULATE_PMMU
 	if (PMMU_ENABLED)
 	    address = pmmu_translate_addr(address);
 #endif
 
+	m68ki_heatmap_write(address); /* auto-disable (see m68kcpu.h) */
 	m68k_write_memory_32_pd(ADDRESS_68K(address), value);
 }
 #endif
 
+/* ------------------------- Direct Memory Access ------------------------- */
+
+/* Returns a host pointer to size bytes of memory at address if they lie
+ * entirely inside one block mapped with m68k_map_direct_memory(), or NULL if
+ * the access has to go through the memory callbacks.
+ */
+static inline uint8* m68ki_direct_lookup(uint address, uint size, uint fc)
+{
+	uint i;
+
+	(void)fc;
+#if M68K_EMULATE_PMMU
+	if (PMMU_ENABLED)
+		return NULL;
+#endif
+	if (ADDRESS_68K(address + size - 1) < ADDRESS_68K(address))
+		return NULL;
+	address = ADDRESS_68K(address);
+
+	for(i = 0; i < m68ki_cpu.direct_map_count; i++)
+	{
+		uint offset = address - m68ki_cpu.direct_map[i].base;
+		if(address >= m68ki_cpu.direct_map[i].base &&
+		   offset + size <= m68ki_cpu.direct_map[i].size)
+		{
+			m68ki_set_fc(fc); /* auto-disable (see m68kcpu.h) */
+			return m68ki_cpu.direct_map[i].ptr + offset;
+		}
+	}
+	return NULL;
+}
+
+/* As m68ki_direct_lookup() for word and long accesses.  Odd addresses always
+ * take the callback path so that address errors are still raised there.
+ */
+static inline uint8* m68ki_direct_ptr(uint address, uint size, uint fc)
+{
+	if (address & 1)
+		return NULL;
+	return m68ki_direct_lookup(address, size, fc);
+}
+
+/* Big-endian accessors for memory returned by m68ki_direct_ptr() */
+static inline uint m68ki_host_read_16(const uint8* p)
+{
+	return (p[0] << 8) | p[1];
+}
+static inline uint m68ki_host_read_32(const uint8* p)
+{
+	return ((uint)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+static inline void m68ki_host_write_16(uint8* p, uint value)
+{
+	p[0] = (value >> 8) & 0xff;
+	p[1] = value & 0xff;
+}
+static inline void m68ki_host_write_32(uint8* p, uint value)
+{
+	p[0] = (value >> 24) & 0xff;
+	p[1] = (value >> 16) & 0xff;
+	p[2] = (value >> 8) & 0xff;
+	p[3] = value & 0xff;
+}
+
+
+/* ---------------------------- Block Transfers --------------------------- */
+
+/* Number of registers in a MOVEM register list */
+static inline uint m68ki_bit_count_16(uint value)
+{
+#ifdef __GNUC__
+	return __builtin_popcount(value & 0xffff);
+#else
+	uint count = 0;
+
+	for(value &= 0xffff; value; value &= value - 1)
+		count++;
+	return count;
+#endif
+}
+
+/* MOVEM stores and loads through memory mapped with m68k_map_direct_memory().
+ * The count registers in register_list are moved to or from consecutive
+ * slots of size bytes starting at ea, the lowest numbered register at the
+ * lowest address.  predec selects the reversed register list of the
+ * predecrement mode.  Both return 0 without doing anything if the transfer
+ * has to go through the memory callbacks.
+ */
+static inline int m68ki_movem_store_direct(uint ea, uint register_list, uint count, uint size, int predec)
+{
+	uint8* p = m68ki_direct_ptr(ea, count * size, FLAG_S | FUNCTION_CODE_USER_DATA);
+	uint i;
+
+	if(p == NULL)
+		return 0;
+	for(i = 0; i < 16; i++)
+		if(register_list & (1 << (predec ? 15 - i : i)))
+		{
+			m68ki_trace_buffer_write(ea, REG_DA[i], size); /* auto-disable (see m68kcpu.h) */
+			m68ki_heatmap_write(ea); /* auto-disable (see m68kcpu.h) */
+			if(size == 4)
+				m68ki_host_write_32(p, REG_DA[i]);
+			else
+				m68ki_host_write_16(p, REG_DA[i]);
+			p += size;
+			ea += size;
+		}
+	return 1;
+}
+
+static inline int m68ki_movem_load_direct(uint ea, uint register_list, uint count, uint size)
+{
+	uint8* p = m68ki_direct_ptr(ea, count * size, FLAG_S | m68ki_get_address_space());
+	uint i;
+
+	if(p == NULL)
+		return 0;
+	for(i = 0; i < 16; i++)
+		if(register_list & (1 << i))
+		{
+			m68ki_heatmap_read(ea, FLAG_S | m68ki_get_address_space()); /* auto-disable (see m68kcpu.h) */
+			REG_DA[i] = size == 4 ? m68ki_host_read_32(p) : (uint)MAKE_INT_16(m68ki_host_read_16(p));
+			p += size;
+			ea += size;
+		}
+	return 1;
+}
+
+/* Called by dbf when it branches back to the instruction just before it.
+ * If that instruction is a move (Ay)+, (Ax)+ or move Dy, (Ax)+ and the
+ * memory involved is mapped with m68k_map_direct_memory(), as many
+ * iterations as fit in the current timeslice are done here in one go, with
+ * the same registers, flags, memory and cycle count the loop would have had.
+ * The final iteration, where dbf falls through, is always left to the
+ * handlers.
+ *
+ * The iterations done here skip everything m68k_execute() does around an
+ * instruction, so this stays off whenever one of those wants to see each
+ * of them: the instruction hook, breakpoints and single stepping, trace
+ * mode (T1), the trace buffer, the instruction statistics and the memory
+ * heatmap.  The performance counters are given the instructions skipped.
+ */
+static inline void m68ki_dbf_block_loop(uint* r_counter)
+{
+	static const uint move_sizes[4] = {0, 1, 4, 2};
+	uint8* code = m68ki_direct_ptr(REG_PC, 2, FLAG_S | FUNCTION_CODE_USER_PROGRAM);
+	uint8* src = NULL;
+	uint8* dst;
+	uint opcode;
+	uint size;
+	uint reg_x;
+	uint reg_y;
+	uint cycles;
+	uint count;
+	uint value = 0;
+	uint i;
+	sint available;
+
+	if(M68K_INSTRUCTION_STATS || M68K_MEMORY_HEATMAP || M68K_INSTRUCTION_HOOK != OPT_OFF)
+		return;
+	if(code == NULL || FLAG_T1 || m68ki_trace_buffer_recording() || breakpoint_addr[0] != 0 || ss_flag)
+		return;
+	opcode = m68ki_host_read_16(code);
+	size = move_sizes[(opcode >> 12) & 3];
+	if((opcode & 0xc000) || !size || ((opcode & 0x01f8) != 0x00d8 && (opcode & 0x01f8) != 0x00c0))
+		return;
+	reg_x = (opcode >> 9) & 7;
+	reg_y = opcode & 7;
+	if((opcode & 0x0038) && (reg_x == reg_y || (size == 1 && reg_y == 7)))
+		return;
+	if(size == 1 && reg_x == 7)
+		return;
+	/* A fill from the counter writes a different value every iteration */
+	if(!(opcode & 0x0038) && &REG_D[reg_y] == r_counter)
+		return;
+
+	/* Only run what the timeslice has room for, so interrupts are taken
+	 * at the same point as without the block transfer.
+	 */
+	cycles = CYC_INSTRUCTION[opcode] + CYC_INSTRUCTION[REG_IR] + CYC_DBCC_F_NOEXP;
+	available = GET_CYCLES() - CYC_INSTRUCTION[REG_IR];
+	count = MASK_OUT_ABOVE_16(*r_counter);
+	if(available <= 0 || cycles == 0)
+		return;
+	if(count > (uint)available / cycles)
+		count = (uint)available / cycles;
+	if(count == 0)
+		return;
+
+	/* Leave loops that overwrite their own code (the move, the dbf and its
+	 * displacement) to the handlers
+	 */
+	if(REG_A[reg_x] < REG_PC + 6 && REG_A[reg_x] + count * size > REG_PC)
+		return;
+	dst = m68ki_direct_ptr(REG_A[reg_x], count * size, FLAG_S | FUNCTION_CODE_USER_DATA);
+	if(opcode & 0x0038)
+		src = m68ki_direct_ptr(REG_A[reg_y], count * size, FLAG_S | m68ki_get_address_space());
+	else
+		value = REG_D[reg_y];
+	if(dst == NULL || ((opcode & 0x0038) && src == NULL))
+		return;
+
+	/* Element by element, in the order the loop accesses memory, so that
+	 * overlapping source and destination behave the same.
+	 */
+	for(i = 0; i < count * size; i += size)
+	{
+		if(src != NULL)
+			value = size == 4 ? m68ki_host_read_32(src + i) :
+					size == 2 ? m68ki_host_read_16(src + i) : src[i];
+		if(size == 4)
+			m68ki_host_write_32(dst + i, value);
+		else if(size == 2)
+			m68ki_host_write_16(dst + i, value);
+		else
+			dst[i] = value & 0xff;
+	}
+
+	/* A fill leaves the flags as the first iteration set them */
+	if(src != NULL)
+	{
+		REG_A[reg_y] += count * size;
+		if(size == 4)
+			m68ki_flags_logic_32(value);
+		else if(size == 2)
+			m68ki_flags_logic_16(value);
+		else
+			m68ki_flags_logic_8(value);
+	}
+	REG_A[reg_x] += count * size;
+	*r_counter = MASK_OUT_BELOW_16(*r_counter) | (MASK_OUT_ABOVE_16(*r_counter) - count);
+	USE_CYCLES(count * cycles);
+	m68ki_perf_add_instructions(2 * count); /* auto-disable (see m68kcpu.h) */
+}
+
+
+/* ------------------------------- Bit Fields ----------------------------- */
+
+/* A bit field operand in memory starts offset (0-7) bits into the byte at ea
+ * and is width (1-32) bits long, so it always lies in the 40 bits from ea to
+ * ea + 4.  The bit field instructions read and write that window as a long
+ * and the byte after it; the byte is only accessed (and is 0) when the field
+ * reaches into it.  Memory mapped with m68k_map_direct_memory() is accessed
+ * in place whatever the alignment, since the 68020+ have no address errors.
+ * The fields are contiguous, so there is no use for BMI2 pdep/pext; building
+ * with -mbmi2 lets the compiler use shlx/shrx/bzhi for the shifts and masks
+ * ("make bitfield_bench" compares the two).
+ */
+static inline uint m68ki_read_bitfield(uint ea, uint offset, uint width, uint* data_byte)
+{
+	uint size = (offset + width > 32) ? 5 : 4;
+	uint8* p = m68ki_direct_lookup(ea, size, FLAG_S | m68ki_get_address_space());
+	uint data_long;
+
+	if(p != NULL)
+	{
+		m68ki_heatmap_read(ea, FLAG_S | m68ki_get_address_space()); /* auto-disable (see m68kcpu.h) */
+		if(size == 5)
+		{
+			m68ki_heatmap_read(ea + 4, FLAG_S | m68ki_get_address_space()); /* auto-disable (see m68kcpu.h) */
+		}
+		*data_byte = (size == 5) ? p[4] : 0;
+		return m68ki_host_read_32(p);
+	}
+	data_long = m68ki_read_32(ea);
+	*data_byte = (size == 5) ? m68ki_read_8(ea + 4) : 0;
+	return data_long;
+}
+
+static inline void m68ki_write_bitfield(uint ea, uint offset, uint width, uint data_long, uint data_byte)
+{
+	uint size = (offset + width > 32) ? 5 : 4;
+	uint8* p = m68ki_direct_lookup(ea, size, FLAG_S | FUNCTION_CODE_USER_DATA);
+
+	if(p != NULL)
+	{
+		m68ki_trace_buffer_write(ea, data_long, 4); /* auto-disable (see m68kcpu.h) */
+		m68ki_heatmap_write(ea); /* auto-disable (see m68kcpu.h) */
+		m68ki_host_write_32(p, data_long);
+		if(size == 5)
+		{
+			m68ki_trace_buffer_write(ea + 4, data_byte, 1); /* auto-disable (see m68kcpu.h) */
+			m68ki_heatmap_write(ea + 4); /* auto-disable (see m68kcpu.h) */
+			p[4] = MASK_OUT_ABOVE_8(data_byte);
+		}
+		return;
+	}
+	m68ki_write_32(ea, data_long);
+	if(size == 5)
+		m68ki_write_8(ea + 4, data_byte);
+}
+
+/* Number of leading zero bits in the width bit value data, or width if data
+ * is 0.  bfffo adds this to the field offset.
+ */
+static inline uint m68ki_bitfield_ffo(uint data, uint width)
+{
+#if defined(__GNUC__) && !M68K_INT_GT_32_BIT
+	return data ? (uint)__builtin_clz(data) - (32 - width) : width;
+#else
+	uint count = 0;
+	uint bit;
+
+	for(bit = 1 << (width - 1); bit && !(data & bit); bit >>= 1)
+		count++;
+	return count;
+#endif
+}
+
+
 /* --------------------- Effective Address Calculation -------------------- */
 
 /* The program counter relative addressing modes cause operands to be
@@ -1470,9 +2048,12 @@ static inline void m68ki_jump(uint new_pc)
 
 static inline void m68ki_jump_vector(uint vector)
 {
+	m68ki_trace_buffer_exception(vector); /* auto-disable (see m68kcpu.h) */
 	REG_PC = (vector<<2) + REG_VBR;
 	REG_PC = m68ki_read_data_32(REG_PC);
 	m68ki_pc_changed(REG_PC);
+	m68ki_call_hook(M68K_CALL_EXCEPTION, REG_PPC, REG_PC); /* auto-disable (see m68kcpu.h) */
+	m68ki_latency_taken(vector, 0); /* auto-disable (see m68kcpu.h) */
 }
 
 
@@ -1535,6 +2116,75 @@ static inline void m68ki_set_sm_flag_nosp(uint value)
 }
 
 
+#if M68K_LAZY_FLAGS
+/* Compute N, Z, V and C from the last recorded ALU operation */
+static inline void m68ki_flags_materialize(m68ki_cpu_core* cpu)
+{
+	uint src = cpu->lazy_src;
+	uint dst = cpu->lazy_dst;
+	uint res = cpu->lazy_res;
+
+	switch(cpu->lazy_op)
+	{
+		case LAZY_LOGIC_8:
+			cpu->n_flag = NFLAG_8(res);
+			cpu->not_z_flag = res;
+			cpu->v_flag = VFLAG_CLEAR;
+			cpu->c_flag = CFLAG_CLEAR;
+			break;
+		case LAZY_LOGIC_16:
+			cpu->n_flag = NFLAG_16(res);
+			cpu->not_z_flag = res;
+			cpu->v_flag = VFLAG_CLEAR;
+			cpu->c_flag = CFLAG_CLEAR;
+			break;
+		case LAZY_LOGIC_32:
+			cpu->n_flag = NFLAG_32(res);
+			cpu->not_z_flag = res;
+			cpu->v_flag = VFLAG_CLEAR;
+			cpu->c_flag = CFLAG_CLEAR;
+			break;
+		case LAZY_ADD_8:
+			cpu->n_flag = NFLAG_8(res);
+			cpu->not_z_flag = MASK_OUT_ABOVE_8(res);
+			cpu->v_flag = VFLAG_ADD_8(src, dst, res);
+			cpu->c_flag = CFLAG_8(res);
+			break;
+		case LAZY_ADD_16:
+			cpu->n_flag = NFLAG_16(res);
+			cpu->not_z_flag = MASK_OUT_ABOVE_16(res);
+			cpu->v_flag = VFLAG_ADD_16(src, dst, res);
+			cpu->c_flag = CFLAG_16(res);
+			break;
+		case LAZY_ADD_32:
+			cpu->n_flag = NFLAG_32(res);
+			cpu->not_z_flag = MASK_OUT_ABOVE_32(res);
+			cpu->v_flag = VFLAG_ADD_32(src, dst, res);
+			cpu->c_flag = CFLAG_ADD_32(src, dst, res);
+			break;
+		case LAZY_SUB_8:
+			cpu->n_flag = NFLAG_8(res);
+			cpu->not_z_flag = MASK_OUT_ABOVE_8(res);
+			cpu->v_flag = VFLAG_SUB_8(src, dst, res);
+			cpu->c_flag = CFLAG_8(res);
+			break;
+		case LAZY_SUB_16:
+			cpu->n_flag = NFLAG_16(res);
+			cpu->not_z_flag = MASK_OUT_ABOVE_16(res);
+			cpu->v_flag = VFLAG_SUB_16(src, dst, res);
+			cpu->c_flag = CFLAG_16(res);
+			break;
+		case LAZY_SUB_32:
+			cpu->n_flag = NFLAG_32(res);
+			cpu->not_z_flag = MASK_OUT_ABOVE_32(res);
+			cpu->v_flag = VFLAG_SUB_32(src, dst, res);
+			cpu->c_flag = CFLAG_SUB_32(src, dst, res);
+			break;
+	}
+	cpu->lazy_op = LAZY_NONE;
+}
+#endif /* M68K_LAZY_FLAGS */
+
 /* Set the condition code register */
 static inline void m68ki_set_ccr(uint value)
 {
@@ -1543,6 +2193,9 @@ static inline void m68ki_set_ccr(uint value)
 	FLAG_Z = !BIT_2(value);
 	FLAG_V = BIT_1(value)  << 6;
 	FLAG_C = BIT_0(value)  << 8;
+#if M68K_LAZY_FLAGS
+	m68ki_cpu.lazy_op = LAZY_NONE;
+#endif
 }
 
 /* Set the status register but don't check for interrupts */
@@ -2082,6 +2735,8 @@ static inline void m68ki_exception_interrupt(uint int_level)
 	if(CPU_STOPPED)
 		return;
 
+	m68ki_latency_interrupt(int_level); /* auto-disable (see m68kcpu.h) */
+
 	/* Acknowledge the interrupt */
 	vector = m68ki_int_ack(int_level);
 
@@ -2099,6 +2754,8 @@ static inline void m68ki_exception_interrupt(uint int_level)
 		return;
 	}
 
+	m68ki_trace_buffer_interrupt(vector); /* auto-disable (see m68kcpu.h) */
+
 	/* Start exception processing */
 	sr = m68ki_init_exception();
 
@@ -2122,6 +2779,8 @@ static inline void m68ki_exception_interrupt(uint int_level)
 		m68ki_stack_frame_0001(REG_PC, sr, vector);
 	}
 
+	m68ki_call_hook(M68K_CALL_EXCEPTION, REG_PC, new_pc); /* auto-disable (see m68kcpu.h) */
+	m68ki_latency_taken(vector, int_level); /* auto-disable (see m68kcpu.h) */
 	m68ki_jump(new_pc);
 
 	/* Defer cycle counting until later */
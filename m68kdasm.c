@@ -36,8 +36,28 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <stdarg.h>
 #include "m68k.h"
 
+#ifndef M68K_DASM_PREBUILT_TABLES
+#define M68K_DASM_PREBUILT_TABLES OPT_OFF
+#endif
+
+/* Compiled with M68K_DASM_GENERATOR, this file is the program that writes
+ * the tables for M68K_DASM_PREBUILT_TABLES.  It builds them the slow way,
+ * and reads no memory.
+ */
+#ifdef M68K_DASM_GENERATOR
+#undef M68K_DASM_PREBUILT_TABLES
+#define M68K_DASM_PREBUILT_TABLES OPT_OFF
+#undef m68k_read_disassembler_8
+#undef m68k_read_disassembler_16
+#undef m68k_read_disassembler_32
+unsigned int m68k_read_disassembler_8  (unsigned int address);
+unsigned int m68k_read_disassembler_16 (unsigned int address);
+unsigned int m68k_read_disassembler_32 (unsigned int address);
+#endif
+
 #ifndef uint32
 #define uint32 uint
 #endif
@@ -139,8 +159,8 @@
 
 /* Opcode flags */
 #if M68K_COMPILE_FOR_MAME == OPT_ON
-#define SET_OPCODE_FLAGS(x)	g_opcode_type = x;
-#define COMBINE_OPCODE_FLAGS(x) ((x) | g_opcode_type | DASMFLAG_SUPPORTED)
+#define SET_OPCODE_FLAGS(x)	ctx->opcode_type = x;
+#define COMBINE_OPCODE_FLAGS(x) ((x) | ctx->opcode_type | DASMFLAG_SUPPORTED)
 #else
 #define SET_OPCODE_FLAGS(x)
 #define COMBINE_OPCODE_FLAGS(X) (X)
@@ -167,37 +187,43 @@ static int make_int_16(int value);
 static int make_int_32(int value);
 
 /* make a string of a hex value */
-static char* make_signed_hex_str_8(uint val);
-static char* make_signed_hex_str_16(uint val);
-static char* make_signed_hex_str_32(uint val);
+static char* make_signed_hex_str_8(m68k_dasm_context* ctx, uint val);
+static char* make_signed_hex_str_16(m68k_dasm_context* ctx, uint val);
+static char* make_signed_hex_str_32(m68k_dasm_context* ctx, uint val);
 
 /* make string of ea mode */
-static char* get_ea_mode_str(uint instruction, uint size);
+static char* get_ea_mode_str(m68k_dasm_context* ctx, uint instruction, uint size);
 
 char* get_ea_mode_str_8(uint instruction);
 char* get_ea_mode_str_16(uint instruction);
 char* get_ea_mode_str_32(uint instruction);
 
 /* make string of immediate value */
-static char* get_imm_str_s(uint size);
-static char* get_imm_str_u(uint size);
+static char* get_imm_str_s(m68k_dasm_context* ctx, uint size);
+static char* get_imm_str_u(m68k_dasm_context* ctx, uint size);
 
 char* get_imm_str_s8(void);
 char* get_imm_str_s16(void);
 char* get_imm_str_s32(void);
 
 /* Stuff to build the opcode handler jump table */
+#if !M68K_DASM_PREBUILT_TABLES
 static void  build_opcode_table(void);
 static int   valid_ea(uint opcode, uint mask);
 static int DECL_SPEC compare_nof_true_bits(const void *aptr, const void *bptr);
+#endif
+static void  init_tables(void);
 
 /* used to build opcode handler jump table */
 typedef struct
 {
-	void (*opcode_handler)(void); /* handler function */
+	void (*opcode_handler)(m68k_dasm_context* ctx); /* handler function */
 	uint mask;                    /* mask on opcode */
 	uint match;                   /* what to match after masking */
 	uint ea_mask;                 /* what ea modes are allowed */
+	uint mnemonic;                /* M68K_INSN_xxx */
+	uint size;                    /* size suffix in bytes */
+	uint flags;                   /* M68K_DASM_FLAG_xxx */
 } opcode_struct;
 
 
@@ -206,22 +232,41 @@ typedef struct
 /* ================================= DATA ================================= */
 /* ======================================================================== */
 
-/* Opcode handler jump table */
-static void (*g_instruction_table[0x10000])(void);
+/* CPU types that m68k_is_valid_instruction() tells apart */
+enum
+{
+	VALID_68000,
+	VALID_68010,
+	VALID_68020,
+	VALID_68030,
+	VALID_68040,
+	VALID_OTHER,
+	VALID_GROUP_COUNT
+};
+
+/* Validity group of each M68K_CPU_TYPE_xxx */
+static const unsigned char g_valid_group[] =
+{
+	VALID_OTHER, VALID_68000, VALID_68010, VALID_68020, VALID_68020, VALID_68030,
+	VALID_68030, VALID_68040, VALID_68040, VALID_68040, VALID_OTHER
+};
+
+#if M68K_DASM_PREBUILT_TABLES
+/* g_instruction_index and g_valid_instructions, written by the
+ * M68K_DASM_GENERATOR build of this file
+ */
+#include "m68kdasmtab.h"
+#else
+/* Opcode handler jump table, the index into g_opcode_info of each opcode */
+static unsigned short g_instruction_index[0x10000];
+/* One bit per opcode for each validity group, set if it is valid */
+static unsigned char g_valid_instructions[VALID_GROUP_COUNT][0x10000 / 8];
 /* Flag if disassembler initialized */
 static int  g_initialized = 0;
+#endif
 
-/* Address mask to simulate address lines */
-static unsigned int g_address_mask = 0xffffffff;
-
-static char g_dasm_str[100]; /* string to hold disassembly */
-static char g_helper_str[100]; /* string to hold helpful info */
-static uint g_cpu_pc;        /* program counter */
-static uint g_cpu_ir;        /* instruction register */
-static uint g_cpu_type;
-static uint g_opcode_type;
-static const unsigned char* g_rawop;
-static uint g_rawbasepc;
+/* State of the non-reentrant m68k_disassemble() interface */
+static m68k_dasm_context g_dasm_context;
 
 /* used by ops like asr, ror, addq, etc */
 static const uint g_3bit_qdata_table[8] = {8, 1, 2, 3, 4, 5, 6, 7};
@@ -258,76 +303,106 @@ static const char *const g_mmucond[16] =
 	"ws", "wc", "is", "ic", "gs", "gc", "cs", "cc"
 };
 
+/* Names of the M68K_INSN_xxx values */
+static const char *const g_mnemonic_names[M68K_INSN_COUNT] =
+{
+	"illegal", "line-a", "line-f", "abcd", "add", "adda", "addi", "addq",
+	"addx", "and", "andi", "asl", "asr", "bcc", "bchg", "bclr", "bfchg",
+	"bfclr", "bfexts", "bfextu", "bfffo", "bfins", "bfset", "bftst", "bkpt",
+	"bra", "bset", "bsr", "btst", "callm", "cas", "cas2", "chk", "chk2", "cinv",
+	"clr", "cmp", "cmp2", "cmpa", "cmpi", "cmpm", "cpbcc", "cpdbcc", "cpgen",
+	"cprestore", "cpsave", "cpscc", "cptrapcc", "cpush", "dbcc", "divs", "divu",
+	"eor", "eori", "exg", "ext", "extb", "fpu", "jmp", "jsr", "lea", "link",
+	"lsl", "lsr", "move", "move16", "movea", "movec", "movem", "movep", "moveq",
+	"moves", "muls", "mulu", "nbcd", "neg", "negx", "nop", "not", "or", "ori",
+	"pack", "pbcc", "pdbcc", "pea", "pflush", "pmmu", "reset", "rol", "ror",
+	"roxl", "roxr", "rtd", "rte", "rtm", "rtr", "rts", "sbcd", "scc", "stop",
+	"sub", "suba", "subi", "subq", "subx", "swap", "tas", "trap", "trapcc",
+	"trapv", "tst", "unlk", "unpk"
+};
+
 /* ======================================================================== */
 /* =========================== UTILITY FUNCTIONS ========================== */
 /* ======================================================================== */
 
 #define LIMIT_CPU_TYPES(ALLOWED_CPU_TYPES)	\
-	if(!(g_cpu_type & ALLOWED_CPU_TYPES))	\
+	if(!(ctx->cpu_type & ALLOWED_CPU_TYPES))	\
 	{										\
-		if((g_cpu_ir & 0xf000) == 0xf000)	\
-			d68000_1111();					\
-		else d68000_illegal();				\
+		if((ctx->ir & 0xf000) == 0xf000)	\
+			d68000_1111(ctx);				\
+		else d68000_illegal(ctx);			\
 		return;								\
 	}
 
-static uint dasm_read_imm_8(uint advance)
+/* Fetch bytes from the caller's buffer.  Anything outside it reads as 0. */
+static uint dasm_read_buffer(m68k_dasm_context* ctx, uint address, uint bytes)
+{
+	uint offset = address - ctx->buffer_address;
+	uint result = 0;
+	uint i;
+
+	for(i = 0; i < bytes; i++)
+	{
+		result <<= 8;
+		if(offset + i < ctx->buffer_size)
+			result |= ctx->buffer[offset + i];
+	}
+	return result;
+}
+
+static uint dasm_read_imm_8(m68k_dasm_context* ctx, uint advance)
 {
 	uint result;
-	if (g_rawop)
-		result = g_rawop[g_cpu_pc + 1 - g_rawbasepc];
+	if (ctx->buffer)
+		result = dasm_read_buffer(ctx, ctx->pc + 1, 1);
 	else
-		result = m68k_read_disassembler_16(g_cpu_pc & g_address_mask) & 0xff;
-	g_cpu_pc += advance;
+		result = m68k_read_disassembler_16(ctx->pc & ctx->address_mask) & 0xff;
+	ctx->pc += advance;
 	return result;
 }
 
-static uint dasm_read_imm_16(uint advance)
+static uint dasm_read_imm_16(m68k_dasm_context* ctx, uint advance)
 {
 	uint result;
-	if (g_rawop)
-		result = (g_rawop[g_cpu_pc + 0 - g_rawbasepc] << 8) |
-		          g_rawop[g_cpu_pc + 1 - g_rawbasepc];
+	if (ctx->buffer)
+		result = dasm_read_buffer(ctx, ctx->pc, 2);
 	else
-		result = m68k_read_disassembler_16(g_cpu_pc & g_address_mask) & 0xffff;
-	g_cpu_pc += advance;
+		result = m68k_read_disassembler_16(ctx->pc & ctx->address_mask) & 0xffff;
+	ctx->pc += advance;
 	return result;
 }
 
-static uint dasm_read_imm_32(uint advance)
+static uint dasm_read_imm_32(m68k_dasm_context* ctx, uint advance)
 {
 	uint result;
-	if (g_rawop)
-		result = (g_rawop[g_cpu_pc + 0 - g_rawbasepc] << 24) |
-		         (g_rawop[g_cpu_pc + 1 - g_rawbasepc] << 16) |
-		         (g_rawop[g_cpu_pc + 2 - g_rawbasepc] << 8) |
-		          g_rawop[g_cpu_pc + 3 - g_rawbasepc];
+	if (ctx->buffer)
+		result = dasm_read_buffer(ctx, ctx->pc, 4);
 	else
-		result = m68k_read_disassembler_32(g_cpu_pc & g_address_mask) & 0xffffffff;
-	g_cpu_pc += advance;
+		result = m68k_read_disassembler_32(ctx->pc & ctx->address_mask) & 0xffffffff;
+	ctx->pc += advance;
 	return result;
 }
 
-#define read_imm_8()  dasm_read_imm_8(2)
-#define read_imm_16() dasm_read_imm_16(2)
-#define read_imm_32() dasm_read_imm_32(4)
+#define read_imm_8()  dasm_read_imm_8(ctx, 2)
+#define read_imm_16() dasm_read_imm_16(ctx, 2)
+#define read_imm_32() dasm_read_imm_32(ctx, 4)
 
-#define peek_imm_8()  dasm_read_imm_8(0)
-#define peek_imm_16() dasm_read_imm_16(0)
-#define peek_imm_32() dasm_read_imm_32(0)
+#define peek_imm_8()  dasm_read_imm_8(ctx, 0)
+#define peek_imm_16() dasm_read_imm_16(ctx, 0)
+#define peek_imm_32() dasm_read_imm_32(ctx, 0)
 
 /* Fake a split interface */
-#define get_ea_mode_str_8(instruction) get_ea_mode_str(instruction, 0)
-#define get_ea_mode_str_16(instruction) get_ea_mode_str(instruction, 1)
-#define get_ea_mode_str_32(instruction) get_ea_mode_str(instruction, 2)
+#define get_ea_mode_str_8(instruction) get_ea_mode_str(ctx, instruction, 0)
+#define get_ea_mode_str_16(instruction) get_ea_mode_str(ctx, instruction, 1)
+#define get_ea_mode_str_32(instruction) get_ea_mode_str(ctx, instruction, 2)
 
-#define get_imm_str_s8() get_imm_str_s(0)
-#define get_imm_str_s16() get_imm_str_s(1)
-#define get_imm_str_s32() get_imm_str_s(2)
+#define get_imm_str_s8() get_imm_str_s(ctx, 0)
+#define get_imm_str_s16() get_imm_str_s(ctx, 1)
+#define get_imm_str_s32() get_imm_str_s(ctx, 2)
 
-#define get_imm_str_u8() get_imm_str_u(0)
-#define get_imm_str_u16() get_imm_str_u(1)
-#define get_imm_str_u32() get_imm_str_u(2)
+#define get_imm_str_u8() get_imm_str_u(ctx, 0)
+#define get_imm_str_u16() get_imm_str_u(ctx, 1)
+#define get_imm_str_u32() get_imm_str_u(ctx, 2)
 
 static int sext_7bit_int(int value)
 {
@@ -351,10 +426,147 @@ static int make_int_32(int value)
 	return (value & 0x80000000) ? value | ~0xffffffff : value & 0xffffffff;
 }
 
+/* Write the instruction text.  Does nothing when the caller only wants the
+ * decoded instruction.
+ */
+static void dasm_print(m68k_dasm_context* ctx, const char* format, ...)
+{
+	va_list args;
+
+	if(!ctx->text)
+		return;
+	va_start(args, format);
+	vsprintf(ctx->str, format, args);
+	va_end(args);
+}
+
+/* Operand recording.  Operands are appended in the order they appear in the
+ * instruction text, so a handler must not record two operands in one
+ * argument list (the evaluation order is unspecified).
+ */
+static m68k_dasm_operand* dasm_add_operand(m68k_dasm_context* ctx, uint type)
+{
+	m68k_dasm_instruction* insn = ctx->insn;
+	m68k_dasm_operand* op;
+
+	if(insn->operand_count < M68K_DASM_MAX_OPERANDS)
+		insn->operand_count++;
+	op = &insn->operands[insn->operand_count - 1];
+	memset(op, 0, sizeof(*op));
+	op->type = type;
+	return op;
+}
+
+static uint dasm_reg(m68k_dasm_context* ctx, uint type, uint reg)
+{
+	dasm_add_operand(ctx, type)->reg = reg;
+	return reg;
+}
+
+#define dasm_dreg(reg) dasm_reg(ctx, M68K_DASM_OPERAND_DREG, reg)
+#define dasm_areg(reg) dasm_reg(ctx, M68K_DASM_OPERAND_AREG, reg)
+#define dasm_ai(reg)   dasm_reg(ctx, M68K_DASM_OPERAND_AI, reg)
+#define dasm_pi(reg)   dasm_reg(ctx, M68K_DASM_OPERAND_PI, reg)
+#define dasm_pd(reg)   dasm_reg(ctx, M68K_DASM_OPERAND_PD, reg)
+#define dasm_fpreg(reg) dasm_reg(ctx, M68K_DASM_OPERAND_FPREG, reg)
+
+/* Dn or An, as selected by the D/A bit of an extension word */
+#define dasm_da_reg(is_a, reg) dasm_reg(ctx, (is_a) ? M68K_DASM_OPERAND_AREG : M68K_DASM_OPERAND_DREG, reg)
+
+static uint dasm_value(m68k_dasm_context* ctx, uint type, uint value)
+{
+	dasm_add_operand(ctx, type)->value = value;
+	return value;
+}
+
+#define dasm_imm(value)      dasm_value(ctx, M68K_DASM_OPERAND_IMM, value)
+#define dasm_reglist(value)  dasm_value(ctx, M68K_DASM_OPERAND_REGLIST, value)
+#define dasm_control(value)  dasm_value(ctx, M68K_DASM_OPERAND_CONTROL, value)
+#define dasm_special(type)   dasm_add_operand(ctx, type)
+
+/* Record the {offset:width} of a bit field instruction */
+static void dasm_bitfield(m68k_dasm_context* ctx, uint extension)
+{
+	m68k_dasm_operand* op = dasm_add_operand(ctx, M68K_DASM_OPERAND_BITFIELD);
+
+	if(BIT_B(extension))
+	{
+		op->flags |= M68K_DASM_OPFLAG_REG_OFFSET;
+		op->reg = (extension>>6)&7;
+	}
+	else
+		op->reg = (extension>>6)&31;
+	if(BIT_5(extension))
+	{
+		op->flags |= M68K_DASM_OPFLAG_REG_WIDTH;
+		op->index = extension&7;
+	}
+	else
+		op->index = g_5bit_data_table[extension&31];
+}
+
+/* Record a register pair such as Dh:Dl */
+static void dasm_regpair(m68k_dasm_context* ctx, uint reg, uint index)
+{
+	m68k_dasm_operand* op = dasm_add_operand(ctx, M68K_DASM_OPERAND_REGPAIR);
+
+	op->reg = reg;
+	op->index = index;
+}
+
+/* chk2 and cmp2 share their opcodes, bit 11 of the extension word tells them
+ * apart.
+ */
+static void dasm_chk2_cmp2(m68k_dasm_context* ctx, uint extension)
+{
+	if(BIT_B(extension))
+		return;
+	ctx->insn->mnemonic = M68K_INSN_CMP2;
+	ctx->insn->flags &= ~M68K_DASM_FLAG_TRAP;
+}
+
+/* Forget what was decoded so far, for opcodes that turn out not to be valid
+ * instructions on the selected CPU.
+ */
+static void dasm_invalid(m68k_dasm_context* ctx, uint mnemonic)
+{
+	m68k_dasm_instruction* insn = ctx->insn;
+
+	insn->mnemonic = mnemonic;
+	insn->size = 0;
+	insn->condition = 0;
+	insn->flags = M68K_DASM_FLAG_TRAP;
+	insn->target = 0;
+	insn->operand_count = 0;
+}
+
+/* Record (d16,An) for the operands that are not effective addresses */
+static void dasm_displacement(m68k_dasm_context* ctx, uint reg, uint displacement)
+{
+	m68k_dasm_operand* op = dasm_add_operand(ctx, M68K_DASM_OPERAND_DI);
+
+	op->reg = reg;
+	op->displacement = make_int_16(displacement);
+}
+
+/* Record a branch target */
+static uint dasm_target(m68k_dasm_context* ctx, uint address)
+{
+	address &= 0xffffffff;
+	dasm_add_operand(ctx, M68K_DASM_OPERAND_TARGET)->value = address;
+	ctx->insn->target = address;
+	ctx->insn->flags |= M68K_DASM_FLAG_TARGET;
+	return address;
+}
+
 /* Get string representation of hex values */
-static char* make_signed_hex_str_8(uint val)
+static char* make_signed_hex_str_8(m68k_dasm_context* ctx, uint val)
 {
-	static char str[20];
+	char* str = ctx->hex_str[0];
+
+	*str = 0;
+	if(!ctx->text)
+		return str;
 
 	val &= 0xff;
 
@@ -368,9 +580,13 @@ static char* make_signed_hex_str_8(uint val)
 	return str;
 }
 
-static char* make_signed_hex_str_16(uint val)
+static char* make_signed_hex_str_16(m68k_dasm_context* ctx, uint val)
 {
-	static char str[20];
+	char* str = ctx->hex_str[1];
+
+	*str = 0;
+	if(!ctx->text)
+		return str;
 
 	val &= 0xffff;
 
@@ -384,9 +600,13 @@ static char* make_signed_hex_str_16(uint val)
 	return str;
 }
 
-static char* make_signed_hex_str_32(uint val)
+static char* make_signed_hex_str_32(m68k_dasm_context* ctx, uint val)
 {
-	static char str[20];
+	char* str = ctx->hex_str[2];
+
+	*str = 0;
+	if(!ctx->text)
+		return str;
 
 	val &= 0xffffffff;
 
@@ -402,36 +622,66 @@ static char* make_signed_hex_str_32(uint val)
 
 
 /* make string of immediate value */
-static char* get_imm_str_s(uint size)
+static char* get_imm_str_s(m68k_dasm_context* ctx, uint size)
 {
-	static char str[15];
+	char* str = ctx->imm_str[0];
 	if(size == 0)
-		sprintf(str, "#%s", make_signed_hex_str_8(read_imm_8()));
+		sprintf(str, "#%s", make_signed_hex_str_8(ctx, dasm_imm(read_imm_8())));
 	else if(size == 1)
-		sprintf(str, "#%s", make_signed_hex_str_16(read_imm_16()));
+		sprintf(str, "#%s", make_signed_hex_str_16(ctx, dasm_imm(read_imm_16())));
 	else
-		sprintf(str, "#%s", make_signed_hex_str_32(read_imm_32()));
+		sprintf(str, "#%s", make_signed_hex_str_32(ctx, dasm_imm(read_imm_32())));
 	return str;
 }
 
-static char* get_imm_str_u(uint size)
+static char* get_imm_str_u(m68k_dasm_context* ctx, uint size)
 {
-	static char str[15];
+	char* str = ctx->imm_str[1];
 	if(size == 0)
-		sprintf(str, "#$%x", read_imm_8() & 0xff);
+		sprintf(str, "#$%x", dasm_imm(read_imm_8() & 0xff));
 	else if(size == 1)
-		sprintf(str, "#$%x", read_imm_16() & 0xffff);
+		sprintf(str, "#$%x", dasm_imm(read_imm_16() & 0xffff));
 	else
-		sprintf(str, "#$%x", read_imm_32() & 0xffffffff);
+		sprintf(str, "#$%x", dasm_imm(read_imm_32() & 0xffffffff));
 	return str;
 }
 
+/* Record the index register and displacements of an indexed mode */
+static void record_index_extension(m68k_dasm_operand* op, uint extension, uint base, uint outer)
+{
+	op->index = (EXT_INDEX_AR(extension) ? 8 : 0) | EXT_INDEX_REGISTER(extension);
+	op->scale = 1 << EXT_INDEX_SCALE(extension);
+	op->flags |= EXT_INDEX_LONG(extension) ? M68K_DASM_OPFLAG_INDEX_LONG : 0;
+
+	if(!EXT_FULL(extension))
+	{
+		op->flags |= M68K_DASM_OPFLAG_INDEX;
+		op->displacement = make_int_8(extension);
+		return;
+	}
+	if(EXT_EFFECTIVE_ZERO(extension))
+	{
+		op->flags = M68K_DASM_OPFLAG_NO_BASE;
+		op->index = op->scale = 0;
+		return;
+	}
+	if(EXT_INDEX_REGISTER_PRESENT(extension))
+		op->flags |= M68K_DASM_OPFLAG_INDEX;
+	if(!EXT_BASE_REGISTER_PRESENT(extension))
+		op->flags |= M68K_DASM_OPFLAG_NO_BASE;
+	if((extension&7) > 0)
+		op->flags |= M68K_DASM_OPFLAG_INDIRECT;
+	if((extension&7) > 4)
+		op->flags |= M68K_DASM_OPFLAG_POSTINDEX;
+	op->displacement = EXT_BASE_DISPLACEMENT_LONG(extension) ? make_int_32(base) : make_int_16(base);
+	op->outer = EXT_OUTER_DISPLACEMENT_LONG(extension) ? make_int_32(outer) : make_int_16(outer);
+}
+
 /* Make string of effective address mode */
-static char* get_ea_mode_str(uint instruction, uint size)
+static char* get_ea_mode_str(m68k_dasm_context* ctx, uint instruction, uint size)
 {
-	static char b1[64];
-	static char b2[64];
-	static char* mode = b2;
+	m68k_dasm_operand* op = dasm_add_operand(ctx, M68K_DASM_OPERAND_NONE);
+	char* mode;
 	uint extension;
 	uint base;
 	uint outer;
@@ -443,47 +693,69 @@ static char* get_ea_mode_str(uint instruction, uint size)
 	uint temp_value;
 
 	/* Switch buffers so we don't clobber on a double-call to this function */
-	mode = mode == b1 ? b2 : b1;
+	ctx->ea_str_index ^= 1;
+	mode = ctx->ea_str[ctx->ea_str_index];
+	*mode = 0;
 
+	op->reg = instruction&7;
 	switch(instruction & 0x3f)
 	{
 		case 0x00: case 0x01: case 0x02: case 0x03: case 0x04: case 0x05: case 0x06: case 0x07:
 		/* data register direct */
-			sprintf(mode, "D%d", instruction&7);
+			op->type = M68K_DASM_OPERAND_DREG;
+			if(ctx->text)
+				sprintf(mode, "D%d", instruction&7);
 			break;
 		case 0x08: case 0x09: case 0x0a: case 0x0b: case 0x0c: case 0x0d: case 0x0e: case 0x0f:
 		/* address register direct */
-			sprintf(mode, "A%d", instruction&7);
+			op->type = M68K_DASM_OPERAND_AREG;
+			if(ctx->text)
+				sprintf(mode, "A%d", instruction&7);
 			break;
 		case 0x10: case 0x11: case 0x12: case 0x13: case 0x14: case 0x15: case 0x16: case 0x17:
 		/* address register indirect */
-			sprintf(mode, "(A%d)", instruction&7);
+			op->type = M68K_DASM_OPERAND_AI;
+			if(ctx->text)
+				sprintf(mode, "(A%d)", instruction&7);
 			break;
 		case 0x18: case 0x19: case 0x1a: case 0x1b: case 0x1c: case 0x1d: case 0x1e: case 0x1f:
 		/* address register indirect with postincrement */
-			sprintf(mode, "(A%d)+", instruction&7);
+			op->type = M68K_DASM_OPERAND_PI;
+			if(ctx->text)
+				sprintf(mode, "(A%d)+", instruction&7);
 			break;
 		case 0x20: case 0x21: case 0x22: case 0x23: case 0x24: case 0x25: case 0x26: case 0x27:
 		/* address register indirect with predecrement */
-			sprintf(mode, "-(A%d)", instruction&7);
+			op->type = M68K_DASM_OPERAND_PD;
+			if(ctx->text)
+				sprintf(mode, "-(A%d)", instruction&7);
 			break;
 		case 0x28: case 0x29: case 0x2a: case 0x2b: case 0x2c: case 0x2d: case 0x2e: case 0x2f:
 		/* address register indirect with displacement*/
-			sprintf(mode, "(%s,A%d)", make_signed_hex_str_16(read_imm_16()), instruction&7);
+			temp_value = read_imm_16();
+			op->type = M68K_DASM_OPERAND_DI;
+			op->displacement = make_int_16(temp_value);
+			if(ctx->text)
+				sprintf(mode, "(%s,A%d)", make_signed_hex_str_16(ctx, temp_value), instruction&7);
 			break;
 		case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
 		/* address register indirect with index */
+			op->type = M68K_DASM_OPERAND_IX;
 			extension = read_imm_16();
 
 			if(EXT_FULL(extension))
 			{
 				if(EXT_EFFECTIVE_ZERO(extension))
 				{
+					record_index_extension(op, extension, 0, 0);
 					strcpy(mode, "0");
 					break;
 				}
 				base = EXT_BASE_DISPLACEMENT_PRESENT(extension) ? (EXT_BASE_DISPLACEMENT_LONG(extension) ? read_imm_32() : read_imm_16()) : 0;
 				outer = EXT_OUTER_DISPLACEMENT_PRESENT(extension) ? (EXT_OUTER_DISPLACEMENT_LONG(extension) ? read_imm_32() : read_imm_16()) : 0;
+				record_index_extension(op, extension, base, outer);
+				if(!ctx->text)
+					break;
 				if(EXT_BASE_REGISTER_PRESENT(extension))
 					sprintf(base_reg, "A%d", instruction&7);
 				else
@@ -506,11 +778,11 @@ static char* get_ea_mode_str(uint instruction, uint size)
 				{
 					if (EXT_BASE_DISPLACEMENT_LONG(extension))
 					{
-						strcat(mode, make_signed_hex_str_32(base));
+						strcat(mode, make_signed_hex_str_32(ctx, base));
 					}
 					else
 					{
-						strcat(mode, make_signed_hex_str_16(base));
+						strcat(mode, make_signed_hex_str_16(ctx, base));
 					}
 					comma = 1;
 				}
@@ -542,47 +814,71 @@ static char* get_ea_mode_str(uint instruction, uint size)
 				{
 					if(comma)
 						strcat(mode, ",");
-					strcat(mode, make_signed_hex_str_16(outer));
+					strcat(mode, make_signed_hex_str_16(ctx, outer));
 				}
 				strcat(mode, ")");
 				break;
 			}
 
+			record_index_extension(op, extension, 0, 0);
+			if(!ctx->text)
+				break;
 			if(EXT_8BIT_DISPLACEMENT(extension) == 0)
 				sprintf(mode, "(A%d,%c%d.%c", instruction&7, EXT_INDEX_AR(extension) ? 'A' : 'D', EXT_INDEX_REGISTER(extension), EXT_INDEX_LONG(extension) ? 'l' : 'w');
 			else
-				sprintf(mode, "(%s,A%d,%c%d.%c", make_signed_hex_str_8(extension), instruction&7, EXT_INDEX_AR(extension) ? 'A' : 'D', EXT_INDEX_REGISTER(extension), EXT_INDEX_LONG(extension) ? 'l' : 'w');
+				sprintf(mode, "(%s,A%d,%c%d.%c", make_signed_hex_str_8(ctx, extension), instruction&7, EXT_INDEX_AR(extension) ? 'A' : 'D', EXT_INDEX_REGISTER(extension), EXT_INDEX_LONG(extension) ? 'l' : 'w');
 			if(EXT_INDEX_SCALE(extension))
 				sprintf(mode+strlen(mode), "*%d", 1 << EXT_INDEX_SCALE(extension));
 			strcat(mode, ")");
 			break;
 		case 0x38:
 		/* absolute short address */
-			sprintf(mode, "$%x.w", read_imm_16());
+			temp_value = read_imm_16();
+			op->type = M68K_DASM_OPERAND_AW;
+			op->value = make_int_16(temp_value);
+			op->flags = M68K_DASM_OPFLAG_ADDRESS;
+			if(ctx->text)
+				sprintf(mode, "$%x.w", temp_value);
 			break;
 		case 0x39:
 		/* absolute long address */
-			sprintf(mode, "$%x.l", read_imm_32());
+			temp_value = read_imm_32();
+			op->type = M68K_DASM_OPERAND_AL;
+			op->value = temp_value;
+			op->flags = M68K_DASM_OPFLAG_ADDRESS;
+			if(ctx->text)
+				sprintf(mode, "$%x.l", temp_value);
 			break;
 		case 0x3a:
 		/* program counter with displacement */
 			temp_value = read_imm_16();
-			sprintf(mode, "(%s,PC)", make_signed_hex_str_16(temp_value));
-			sprintf(g_helper_str, "; ($%x)", (make_int_16(temp_value) + g_cpu_pc-2) & 0xffffffff);
+			op->type = M68K_DASM_OPERAND_PCDI;
+			op->displacement = make_int_16(temp_value);
+			op->value = (make_int_16(temp_value) + ctx->pc-2) & 0xffffffff;
+			op->flags = M68K_DASM_OPFLAG_ADDRESS;
+			if(!ctx->text)
+				break;
+			sprintf(mode, "(%s,PC)", make_signed_hex_str_16(ctx, temp_value));
+			sprintf(ctx->helper_str, "; ($%x)", op->value);
 			break;
 		case 0x3b:
 		/* program counter with index */
+			op->type = M68K_DASM_OPERAND_PCIX;
 			extension = read_imm_16();
 
 			if(EXT_FULL(extension))
 			{
 				if(EXT_EFFECTIVE_ZERO(extension))
 				{
+					record_index_extension(op, extension, 0, 0);
 					strcpy(mode, "0");
 					break;
 				}
 				base = EXT_BASE_DISPLACEMENT_PRESENT(extension) ? (EXT_BASE_DISPLACEMENT_LONG(extension) ? read_imm_32() : read_imm_16()) : 0;
 				outer = EXT_OUTER_DISPLACEMENT_PRESENT(extension) ? (EXT_OUTER_DISPLACEMENT_LONG(extension) ? read_imm_32() : read_imm_16()) : 0;
+				record_index_extension(op, extension, base, outer);
+				if(!ctx->text)
+					break;
 				if(EXT_BASE_REGISTER_PRESENT(extension))
 					strcpy(base_reg, "PC");
 				else
@@ -603,7 +899,7 @@ static char* get_ea_mode_str(uint instruction, uint size)
 					strcat(mode, "[");
 				if(base)
 				{
-					strcat(mode, make_signed_hex_str_16(base));
+					strcat(mode, make_signed_hex_str_16(ctx, base));
 					comma = 1;
 				}
 				if(*base_reg)
@@ -634,26 +930,38 @@ static char* get_ea_mode_str(uint instruction, uint size)
 				{
 					if(comma)
 						strcat(mode, ",");
-					strcat(mode, make_signed_hex_str_16(outer));
+					strcat(mode, make_signed_hex_str_16(ctx, outer));
 				}
 				strcat(mode, ")");
 				break;
 			}
 
+			record_index_extension(op, extension, 0, 0);
+			if(!ctx->text)
+				break;
 			if(EXT_8BIT_DISPLACEMENT(extension) == 0)
 				sprintf(mode, "(PC,%c%d.%c", EXT_INDEX_AR(extension) ? 'A' : 'D', EXT_INDEX_REGISTER(extension), EXT_INDEX_LONG(extension) ? 'l' : 'w');
 			else
-				sprintf(mode, "(%s,PC,%c%d.%c", make_signed_hex_str_8(extension), EXT_INDEX_AR(extension) ? 'A' : 'D', EXT_INDEX_REGISTER(extension), EXT_INDEX_LONG(extension) ? 'l' : 'w');
+				sprintf(mode, "(%s,PC,%c%d.%c", make_signed_hex_str_8(ctx, extension), EXT_INDEX_AR(extension) ? 'A' : 'D', EXT_INDEX_REGISTER(extension), EXT_INDEX_LONG(extension) ? 'l' : 'w');
 			if(EXT_INDEX_SCALE(extension))
 				sprintf(mode+strlen(mode), "*%d", 1 << EXT_INDEX_SCALE(extension));
 			strcat(mode, ")");
 			break;
 		case 0x3c:
 		/* Immediate */
-			sprintf(mode, "%s", get_imm_str_u(size));
+			op->type = M68K_DASM_OPERAND_IMM;
+			if(size == 0)
+				op->value = read_imm_8() & 0xff;
+			else if(size == 1)
+				op->value = read_imm_16() & 0xffff;
+			else
+				op->value = read_imm_32() & 0xffffffff;
+			if(ctx->text)
+				sprintf(mode, "#$%x", op->value);
 			break;
 		default:
-			sprintf(mode, "INVALID %x", instruction & 0x3f);
+			if(ctx->text)
+				sprintf(mode, "INVALID %x", instruction & 0x3f);
 	}
 	return mode;
 }
@@ -698,314 +1006,382 @@ static char* get_ea_mode_str(uint instruction, uint size)
  * al  : absolute long
  */
 
-static void d68000_illegal(void)
+static void d68000_illegal(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "dc.w $%04x; ILLEGAL", g_cpu_ir);
+	dasm_invalid(ctx, M68K_INSN_ILLEGAL);
+	dasm_print(ctx, "dc.w $%04x; ILLEGAL", ctx->ir);
 }
 
-static void d68000_1010(void)
+static void d68000_1010(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "dc.w    $%04x; opcode 1010", g_cpu_ir);
+	dasm_invalid(ctx, M68K_INSN_LINE_A);
+	dasm_print(ctx, "dc.w    $%04x; opcode 1010", ctx->ir);
 }
 
 
-static void d68000_1111(void)
+static void d68000_1111(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "dc.w    $%04x; opcode 1111", g_cpu_ir);
+	dasm_invalid(ctx, M68K_INSN_LINE_F);
+	dasm_print(ctx, "dc.w    $%04x; opcode 1111", ctx->ir);
 }
 
 
-static void d68000_abcd_rr(void)
+static void d68000_abcd_rr(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "abcd    D%d, D%d", g_cpu_ir&7, (g_cpu_ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "abcd    D%d, D%d", ctx->ir&7, (ctx->ir>>9)&7);
 }
 
 
-static void d68000_abcd_mm(void)
+static void d68000_abcd_mm(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "abcd    -(A%d), -(A%d)", g_cpu_ir&7, (g_cpu_ir>>9)&7);
+	dasm_pd(ctx->ir&7);
+	dasm_pd((ctx->ir>>9)&7);
+	dasm_print(ctx, "abcd    -(A%d), -(A%d)", ctx->ir&7, (ctx->ir>>9)&7);
 }
 
-static void d68000_add_er_8(void)
+static void d68000_add_er_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "add.b   %s, D%d", get_ea_mode_str_8(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_print(ctx, "add.b   %s, D%d", get_ea_mode_str_8(ctx->ir), (ctx->ir>>9)&7);
+	dasm_dreg((ctx->ir>>9)&7);
 }
 
 
-static void d68000_add_er_16(void)
+static void d68000_add_er_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "add.w   %s, D%d", get_ea_mode_str_16(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_print(ctx, "add.w   %s, D%d", get_ea_mode_str_16(ctx->ir), (ctx->ir>>9)&7);
+	dasm_dreg((ctx->ir>>9)&7);
 }
 
-static void d68000_add_er_32(void)
+static void d68000_add_er_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "add.l   %s, D%d", get_ea_mode_str_32(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_print(ctx, "add.l   %s, D%d", get_ea_mode_str_32(ctx->ir), (ctx->ir>>9)&7);
+	dasm_dreg((ctx->ir>>9)&7);
 }
 
-static void d68000_add_re_8(void)
+static void d68000_add_re_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "add.b   D%d, %s", (g_cpu_ir>>9)&7, get_ea_mode_str_8(g_cpu_ir));
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "add.b   D%d, %s", (ctx->ir>>9)&7, get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68000_add_re_16(void)
+static void d68000_add_re_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "add.w   D%d, %s", (g_cpu_ir>>9)&7, get_ea_mode_str_16(g_cpu_ir));
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "add.w   D%d, %s", (ctx->ir>>9)&7, get_ea_mode_str_16(ctx->ir));
 }
 
-static void d68000_add_re_32(void)
+static void d68000_add_re_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "add.l   D%d, %s", (g_cpu_ir>>9)&7, get_ea_mode_str_32(g_cpu_ir));
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "add.l   D%d, %s", (ctx->ir>>9)&7, get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68000_adda_16(void)
+static void d68000_adda_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "adda.w  %s, A%d", get_ea_mode_str_16(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_print(ctx, "adda.w  %s, A%d", get_ea_mode_str_16(ctx->ir), (ctx->ir>>9)&7);
+	dasm_areg((ctx->ir>>9)&7);
 }
 
-static void d68000_adda_32(void)
+static void d68000_adda_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "adda.l  %s, A%d", get_ea_mode_str_32(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_print(ctx, "adda.l  %s, A%d", get_ea_mode_str_32(ctx->ir), (ctx->ir>>9)&7);
+	dasm_areg((ctx->ir>>9)&7);
 }
 
-static void d68000_addi_8(void)
+static void d68000_addi_8(m68k_dasm_context* ctx)
 {
 	char* str = get_imm_str_s8();
-	sprintf(g_dasm_str, "addi.b  %s, %s", str, get_ea_mode_str_8(g_cpu_ir));
+	dasm_print(ctx, "addi.b  %s, %s", str, get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68000_addi_16(void)
+static void d68000_addi_16(m68k_dasm_context* ctx)
 {
 	char* str = get_imm_str_s16();
-	sprintf(g_dasm_str, "addi.w  %s, %s", str, get_ea_mode_str_16(g_cpu_ir));
+	dasm_print(ctx, "addi.w  %s, %s", str, get_ea_mode_str_16(ctx->ir));
 }
 
-static void d68000_addi_32(void)
+static void d68000_addi_32(m68k_dasm_context* ctx)
 {
 	char* str = get_imm_str_s32();
-	sprintf(g_dasm_str, "addi.l  %s, %s", str, get_ea_mode_str_32(g_cpu_ir));
+	dasm_print(ctx, "addi.l  %s, %s", str, get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68000_addq_8(void)
+static void d68000_addq_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "addq.b  #%d, %s", g_3bit_qdata_table[(g_cpu_ir>>9)&7], get_ea_mode_str_8(g_cpu_ir));
+	dasm_imm(g_3bit_qdata_table[(ctx->ir>>9)&7]);
+	dasm_print(ctx, "addq.b  #%d, %s", g_3bit_qdata_table[(ctx->ir>>9)&7], get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68000_addq_16(void)
+static void d68000_addq_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "addq.w  #%d, %s", g_3bit_qdata_table[(g_cpu_ir>>9)&7], get_ea_mode_str_16(g_cpu_ir));
+	dasm_imm(g_3bit_qdata_table[(ctx->ir>>9)&7]);
+	dasm_print(ctx, "addq.w  #%d, %s", g_3bit_qdata_table[(ctx->ir>>9)&7], get_ea_mode_str_16(ctx->ir));
 }
 
-static void d68000_addq_32(void)
+static void d68000_addq_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "addq.l  #%d, %s", g_3bit_qdata_table[(g_cpu_ir>>9)&7], get_ea_mode_str_32(g_cpu_ir));
+	dasm_imm(g_3bit_qdata_table[(ctx->ir>>9)&7]);
+	dasm_print(ctx, "addq.l  #%d, %s", g_3bit_qdata_table[(ctx->ir>>9)&7], get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68000_addx_rr_8(void)
+static void d68000_addx_rr_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "addx.b  D%d, D%d", g_cpu_ir&7, (g_cpu_ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "addx.b  D%d, D%d", ctx->ir&7, (ctx->ir>>9)&7);
 }
 
-static void d68000_addx_rr_16(void)
+static void d68000_addx_rr_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "addx.w  D%d, D%d", g_cpu_ir&7, (g_cpu_ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "addx.w  D%d, D%d", ctx->ir&7, (ctx->ir>>9)&7);
 }
 
-static void d68000_addx_rr_32(void)
+static void d68000_addx_rr_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "addx.l  D%d, D%d", g_cpu_ir&7, (g_cpu_ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "addx.l  D%d, D%d", ctx->ir&7, (ctx->ir>>9)&7);
 }
 
-static void d68000_addx_mm_8(void)
+static void d68000_addx_mm_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "addx.b  -(A%d), -(A%d)", g_cpu_ir&7, (g_cpu_ir>>9)&7);
+	dasm_pd(ctx->ir&7);
+	dasm_pd((ctx->ir>>9)&7);
+	dasm_print(ctx, "addx.b  -(A%d), -(A%d)", ctx->ir&7, (ctx->ir>>9)&7);
 }
 
-static void d68000_addx_mm_16(void)
+static void d68000_addx_mm_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "addx.w  -(A%d), -(A%d)", g_cpu_ir&7, (g_cpu_ir>>9)&7);
+	dasm_pd(ctx->ir&7);
+	dasm_pd((ctx->ir>>9)&7);
+	dasm_print(ctx, "addx.w  -(A%d), -(A%d)", ctx->ir&7, (ctx->ir>>9)&7);
 }
 
-static void d68000_addx_mm_32(void)
+static void d68000_addx_mm_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "addx.l  -(A%d), -(A%d)", g_cpu_ir&7, (g_cpu_ir>>9)&7);
+	dasm_pd(ctx->ir&7);
+	dasm_pd((ctx->ir>>9)&7);
+	dasm_print(ctx, "addx.l  -(A%d), -(A%d)", ctx->ir&7, (ctx->ir>>9)&7);
 }
 
-static void d68000_and_er_8(void)
+static void d68000_and_er_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "and.b   %s, D%d", get_ea_mode_str_8(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_print(ctx, "and.b   %s, D%d", get_ea_mode_str_8(ctx->ir), (ctx->ir>>9)&7);
+	dasm_dreg((ctx->ir>>9)&7);
 }
 
-static void d68000_and_er_16(void)
+static void d68000_and_er_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "and.w   %s, D%d", get_ea_mode_str_16(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_print(ctx, "and.w   %s, D%d", get_ea_mode_str_16(ctx->ir), (ctx->ir>>9)&7);
+	dasm_dreg((ctx->ir>>9)&7);
 }
 
-static void d68000_and_er_32(void)
+static void d68000_and_er_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "and.l   %s, D%d", get_ea_mode_str_32(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_print(ctx, "and.l   %s, D%d", get_ea_mode_str_32(ctx->ir), (ctx->ir>>9)&7);
+	dasm_dreg((ctx->ir>>9)&7);
 }
 
-static void d68000_and_re_8(void)
+static void d68000_and_re_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "and.b   D%d, %s", (g_cpu_ir>>9)&7, get_ea_mode_str_8(g_cpu_ir));
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "and.b   D%d, %s", (ctx->ir>>9)&7, get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68000_and_re_16(void)
+static void d68000_and_re_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "and.w   D%d, %s", (g_cpu_ir>>9)&7, get_ea_mode_str_16(g_cpu_ir));
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "and.w   D%d, %s", (ctx->ir>>9)&7, get_ea_mode_str_16(ctx->ir));
 }
 
-static void d68000_and_re_32(void)
+static void d68000_and_re_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "and.l   D%d, %s", (g_cpu_ir>>9)&7, get_ea_mode_str_32(g_cpu_ir));
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "and.l   D%d, %s", (ctx->ir>>9)&7, get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68000_andi_8(void)
+static void d68000_andi_8(m68k_dasm_context* ctx)
 {
 	char* str = get_imm_str_u8();
-	sprintf(g_dasm_str, "andi.b  %s, %s", str, get_ea_mode_str_8(g_cpu_ir));
+	dasm_print(ctx, "andi.b  %s, %s", str, get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68000_andi_16(void)
+static void d68000_andi_16(m68k_dasm_context* ctx)
 {
 	char* str = get_imm_str_u16();
-	sprintf(g_dasm_str, "andi.w  %s, %s", str, get_ea_mode_str_16(g_cpu_ir));
+	dasm_print(ctx, "andi.w  %s, %s", str, get_ea_mode_str_16(ctx->ir));
 }
 
-static void d68000_andi_32(void)
+static void d68000_andi_32(m68k_dasm_context* ctx)
 {
 	char* str = get_imm_str_u32();
-	sprintf(g_dasm_str, "andi.l  %s, %s", str, get_ea_mode_str_32(g_cpu_ir));
+	dasm_print(ctx, "andi.l  %s, %s", str, get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68000_andi_to_ccr(void)
+static void d68000_andi_to_ccr(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "andi    %s, CCR", get_imm_str_u8());
+	dasm_print(ctx, "andi    %s, CCR", get_imm_str_u8());
+	dasm_special(M68K_DASM_OPERAND_CCR);
 }
 
-static void d68000_andi_to_sr(void)
+static void d68000_andi_to_sr(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "andi    %s, SR", get_imm_str_u16());
+	dasm_print(ctx, "andi    %s, SR", get_imm_str_u16());
+	dasm_special(M68K_DASM_OPERAND_SR);
 }
 
-static void d68000_asr_s_8(void)
+static void d68000_asr_s_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "asr.b   #%d, D%d", g_3bit_qdata_table[(g_cpu_ir>>9)&7], g_cpu_ir&7);
+	dasm_imm(g_3bit_qdata_table[(ctx->ir>>9)&7]);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "asr.b   #%d, D%d", g_3bit_qdata_table[(ctx->ir>>9)&7], ctx->ir&7);
 }
 
-static void d68000_asr_s_16(void)
+static void d68000_asr_s_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "asr.w   #%d, D%d", g_3bit_qdata_table[(g_cpu_ir>>9)&7], g_cpu_ir&7);
+	dasm_imm(g_3bit_qdata_table[(ctx->ir>>9)&7]);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "asr.w   #%d, D%d", g_3bit_qdata_table[(ctx->ir>>9)&7], ctx->ir&7);
 }
 
-static void d68000_asr_s_32(void)
+static void d68000_asr_s_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "asr.l   #%d, D%d", g_3bit_qdata_table[(g_cpu_ir>>9)&7], g_cpu_ir&7);
+	dasm_imm(g_3bit_qdata_table[(ctx->ir>>9)&7]);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "asr.l   #%d, D%d", g_3bit_qdata_table[(ctx->ir>>9)&7], ctx->ir&7);
 }
 
-static void d68000_asr_r_8(void)
+static void d68000_asr_r_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "asr.b   D%d, D%d", (g_cpu_ir>>9)&7, g_cpu_ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "asr.b   D%d, D%d", (ctx->ir>>9)&7, ctx->ir&7);
 }
 
-static void d68000_asr_r_16(void)
+static void d68000_asr_r_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "asr.w   D%d, D%d", (g_cpu_ir>>9)&7, g_cpu_ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "asr.w   D%d, D%d", (ctx->ir>>9)&7, ctx->ir&7);
 }
 
-static void d68000_asr_r_32(void)
+static void d68000_asr_r_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "asr.l   D%d, D%d", (g_cpu_ir>>9)&7, g_cpu_ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "asr.l   D%d, D%d", (ctx->ir>>9)&7, ctx->ir&7);
 }
 
-static void d68000_asr_ea(void)
+static void d68000_asr_ea(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "asr.w   %s", get_ea_mode_str_16(g_cpu_ir));
+	dasm_print(ctx, "asr.w   %s", get_ea_mode_str_16(ctx->ir));
 }
 
-static void d68000_asl_s_8(void)
+static void d68000_asl_s_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "asl.b   #%d, D%d", g_3bit_qdata_table[(g_cpu_ir>>9)&7], g_cpu_ir&7);
+	dasm_imm(g_3bit_qdata_table[(ctx->ir>>9)&7]);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "asl.b   #%d, D%d", g_3bit_qdata_table[(ctx->ir>>9)&7], ctx->ir&7);
 }
 
-static void d68000_asl_s_16(void)
+static void d68000_asl_s_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "asl.w   #%d, D%d", g_3bit_qdata_table[(g_cpu_ir>>9)&7], g_cpu_ir&7);
+	dasm_imm(g_3bit_qdata_table[(ctx->ir>>9)&7]);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "asl.w   #%d, D%d", g_3bit_qdata_table[(ctx->ir>>9)&7], ctx->ir&7);
 }
 
-static void d68000_asl_s_32(void)
+static void d68000_asl_s_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "asl.l   #%d, D%d", g_3bit_qdata_table[(g_cpu_ir>>9)&7], g_cpu_ir&7);
+	dasm_imm(g_3bit_qdata_table[(ctx->ir>>9)&7]);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "asl.l   #%d, D%d", g_3bit_qdata_table[(ctx->ir>>9)&7], ctx->ir&7);
 }
 
-static void d68000_asl_r_8(void)
+static void d68000_asl_r_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "asl.b   D%d, D%d", (g_cpu_ir>>9)&7, g_cpu_ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "asl.b   D%d, D%d", (ctx->ir>>9)&7, ctx->ir&7);
 }
 
-static void d68000_asl_r_16(void)
+static void d68000_asl_r_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "asl.w   D%d, D%d", (g_cpu_ir>>9)&7, g_cpu_ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "asl.w   D%d, D%d", (ctx->ir>>9)&7, ctx->ir&7);
 }
 
-static void d68000_asl_r_32(void)
+static void d68000_asl_r_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "asl.l   D%d, D%d", (g_cpu_ir>>9)&7, g_cpu_ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "asl.l   D%d, D%d", (ctx->ir>>9)&7, ctx->ir&7);
 }
 
-static void d68000_asl_ea(void)
+static void d68000_asl_ea(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "asl.w   %s", get_ea_mode_str_16(g_cpu_ir));
+	dasm_print(ctx, "asl.w   %s", get_ea_mode_str_16(ctx->ir));
 }
 
-static void d68000_bcc_8(void)
+static void d68000_bcc_8(m68k_dasm_context* ctx)
 {
-	uint temp_pc = g_cpu_pc;
-	sprintf(g_dasm_str, "b%-2s     $%x", g_cc[(g_cpu_ir>>8)&0xf], temp_pc + make_int_8(g_cpu_ir));
+	uint temp_pc = ctx->pc;
+	ctx->insn->condition = (ctx->ir>>8)&0xf;
+	dasm_print(ctx, "b%-2s     $%x", g_cc[(ctx->ir>>8)&0xf], dasm_target(ctx, temp_pc + make_int_8(ctx->ir)));
 }
 
-static void d68000_bcc_16(void)
+static void d68000_bcc_16(m68k_dasm_context* ctx)
 {
-	uint temp_pc = g_cpu_pc;
-	sprintf(g_dasm_str, "b%-2s     $%x", g_cc[(g_cpu_ir>>8)&0xf], temp_pc + make_int_16(read_imm_16()));
+	uint temp_pc = ctx->pc;
+	ctx->insn->condition = (ctx->ir>>8)&0xf;
+	dasm_print(ctx, "b%-2s     $%x", g_cc[(ctx->ir>>8)&0xf], dasm_target(ctx, temp_pc + make_int_16(read_imm_16())));
 }
 
-static void d68020_bcc_32(void)
+static void d68020_bcc_32(m68k_dasm_context* ctx)
 {
-	uint temp_pc = g_cpu_pc;
+	uint temp_pc = ctx->pc;
 	LIMIT_CPU_TYPES(M68020_PLUS);
-	sprintf(g_dasm_str, "b%-2s     $%x; (2+)", g_cc[(g_cpu_ir>>8)&0xf], temp_pc + read_imm_32());
+	ctx->insn->condition = (ctx->ir>>8)&0xf;
+	dasm_print(ctx, "b%-2s     $%x; (2+)", g_cc[(ctx->ir>>8)&0xf], dasm_target(ctx, temp_pc + read_imm_32()));
 }
 
-static void d68000_bchg_r(void)
+static void d68000_bchg_r(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "bchg    D%d, %s", (g_cpu_ir>>9)&7, get_ea_mode_str_8(g_cpu_ir));
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "bchg    D%d, %s", (ctx->ir>>9)&7, get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68000_bchg_s(void)
+static void d68000_bchg_s(m68k_dasm_context* ctx)
 {
 	char* str = get_imm_str_u8();
-	sprintf(g_dasm_str, "bchg    %s, %s", str, get_ea_mode_str_8(g_cpu_ir));
+	dasm_print(ctx, "bchg    %s, %s", str, get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68000_bclr_r(void)
+static void d68000_bclr_r(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "bclr    D%d, %s", (g_cpu_ir>>9)&7, get_ea_mode_str_8(g_cpu_ir));
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "bclr    D%d, %s", (ctx->ir>>9)&7, get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68000_bclr_s(void)
+static void d68000_bclr_s(m68k_dasm_context* ctx)
 {
 	char* str = get_imm_str_u8();
-	sprintf(g_dasm_str, "bclr    %s, %s", str, get_ea_mode_str_8(g_cpu_ir));
+	dasm_print(ctx, "bclr    %s, %s", str, get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68010_bkpt(void)
+static void d68010_bkpt(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68010_PLUS);
-	sprintf(g_dasm_str, "bkpt #%d; (1+)", g_cpu_ir&7);
+	dasm_imm(ctx->ir&7);
+	dasm_print(ctx, "bkpt #%d; (1+)", ctx->ir&7);
 }
 
-static void d68020_bfchg(void)
+static void d68020_bfchg(m68k_dasm_context* ctx)
 {
 	uint extension;
 	char offset[3];
@@ -1023,10 +1399,11 @@ static void d68020_bfchg(void)
 		sprintf(width, "D%d", extension&7);
 	else
 		sprintf(width, "%d", g_5bit_data_table[extension&31]);
-	sprintf(g_dasm_str, "bfchg   %s {%s:%s}; (2+)", get_ea_mode_str_8(g_cpu_ir), offset, width);
+	dasm_print(ctx, "bfchg   %s {%s:%s}; (2+)", get_ea_mode_str_8(ctx->ir), offset, width);
+	dasm_bitfield(ctx, extension);
 }
 
-static void d68020_bfclr(void)
+static void d68020_bfclr(m68k_dasm_context* ctx)
 {
 	uint extension;
 	char offset[3];
@@ -1044,10 +1421,11 @@ static void d68020_bfclr(void)
 		sprintf(width, "D%d", extension&7);
 	else
 		sprintf(width, "%d", g_5bit_data_table[extension&31]);
-	sprintf(g_dasm_str, "bfclr   %s {%s:%s}; (2+)", get_ea_mode_str_8(g_cpu_ir), offset, width);
+	dasm_print(ctx, "bfclr   %s {%s:%s}; (2+)", get_ea_mode_str_8(ctx->ir), offset, width);
+	dasm_bitfield(ctx, extension);
 }
 
-static void d68020_bfexts(void)
+static void d68020_bfexts(m68k_dasm_context* ctx)
 {
 	uint extension;
 	char offset[3];
@@ -1065,10 +1443,12 @@ static void d68020_bfexts(void)
 		sprintf(width, "D%d", extension&7);
 	else
 		sprintf(width, "%d", g_5bit_data_table[extension&31]);
-	sprintf(g_dasm_str, "bfexts  %s {%s:%s}, D%d; (2+)", get_ea_mode_str_8(g_cpu_ir), offset, width, (extension>>12)&7);
+	dasm_print(ctx, "bfexts  %s {%s:%s}, D%d; (2+)", get_ea_mode_str_8(ctx->ir), offset, width, (extension>>12)&7);
+	dasm_bitfield(ctx, extension);
+	dasm_dreg((extension>>12)&7);
 }
 
-static void d68020_bfextu(void)
+static void d68020_bfextu(m68k_dasm_context* ctx)
 {
 	uint extension;
 	char offset[3];
@@ -1086,10 +1466,12 @@ static void d68020_bfextu(void)
 		sprintf(width, "D%d", extension&7);
 	else
 		sprintf(width, "%d", g_5bit_data_table[extension&31]);
-	sprintf(g_dasm_str, "bfextu  %s {%s:%s}, D%d; (2+)", get_ea_mode_str_8(g_cpu_ir), offset, width, (extension>>12)&7);
+	dasm_print(ctx, "bfextu  %s {%s:%s}, D%d; (2+)", get_ea_mode_str_8(ctx->ir), offset, width, (extension>>12)&7);
+	dasm_bitfield(ctx, extension);
+	dasm_dreg((extension>>12)&7);
 }
 
-static void d68020_bfffo(void)
+static void d68020_bfffo(m68k_dasm_context* ctx)
 {
 	uint extension;
 	char offset[3];
@@ -1107,10 +1489,12 @@ static void d68020_bfffo(void)
 		sprintf(width, "D%d", extension&7);
 	else
 		sprintf(width, "%d", g_5bit_data_table[extension&31]);
-	sprintf(g_dasm_str, "bfffo   %s {%s:%s}, D%d; (2+)", get_ea_mode_str_8(g_cpu_ir), offset, width, (extension>>12)&7);
+	dasm_print(ctx, "bfffo   %s {%s:%s}, D%d; (2+)", get_ea_mode_str_8(ctx->ir), offset, width, (extension>>12)&7);
+	dasm_bitfield(ctx, extension);
+	dasm_dreg((extension>>12)&7);
 }
 
-static void d68020_bfins(void)
+static void d68020_bfins(m68k_dasm_context* ctx)
 {
 	uint extension;
 	char offset[3];
@@ -1128,10 +1512,12 @@ static void d68020_bfins(void)
 		sprintf(width, "D%d", extension&7);
 	else
 		sprintf(width, "%d", g_5bit_data_table[extension&31]);
-	sprintf(g_dasm_str, "bfins   D%d, %s {%s:%s}; (2+)", (extension>>12)&7, get_ea_mode_str_8(g_cpu_ir), offset, width);
+	dasm_dreg((extension>>12)&7);
+	dasm_print(ctx, "bfins   D%d, %s {%s:%s}; (2+)", (extension>>12)&7, get_ea_mode_str_8(ctx->ir), offset, width);
+	dasm_bitfield(ctx, extension);
 }
 
-static void d68020_bfset(void)
+static void d68020_bfset(m68k_dasm_context* ctx)
 {
 	uint extension;
 	char offset[3];
@@ -1149,10 +1535,11 @@ static void d68020_bfset(void)
 		sprintf(width, "D%d", extension&7);
 	else
 		sprintf(width, "%d", g_5bit_data_table[extension&31]);
-	sprintf(g_dasm_str, "bfset   %s {%s:%s}; (2+)", get_ea_mode_str_8(g_cpu_ir), offset, width);
+	dasm_print(ctx, "bfset   %s {%s:%s}; (2+)", get_ea_mode_str_8(ctx->ir), offset, width);
+	dasm_bitfield(ctx, extension);
 }
 
-static void d68020_bftst(void)
+static void d68020_bftst(m68k_dasm_context* ctx)
 {
 	uint extension;
 	char offset[3];
@@ -1170,106 +1557,115 @@ static void d68020_bftst(void)
 		sprintf(width, "D%d", extension&7);
 	else
 		sprintf(width, "%d", g_5bit_data_table[extension&31]);
-	sprintf(g_dasm_str, "bftst   %s {%s:%s}; (2+)", get_ea_mode_str_8(g_cpu_ir), offset, width);
+	dasm_print(ctx, "bftst   %s {%s:%s}; (2+)", get_ea_mode_str_8(ctx->ir), offset, width);
+	dasm_bitfield(ctx, extension);
 }
 
-static void d68000_bra_8(void)
+static void d68000_bra_8(m68k_dasm_context* ctx)
 {
-	uint temp_pc = g_cpu_pc;
-	sprintf(g_dasm_str, "bra     $%x", temp_pc + make_int_8(g_cpu_ir));
+	uint temp_pc = ctx->pc;
+	dasm_print(ctx, "bra     $%x", dasm_target(ctx, temp_pc + make_int_8(ctx->ir)));
 }
 
-static void d68000_bra_16(void)
+static void d68000_bra_16(m68k_dasm_context* ctx)
 {
-	uint temp_pc = g_cpu_pc;
-	sprintf(g_dasm_str, "bra     $%x", temp_pc + make_int_16(read_imm_16()));
+	uint temp_pc = ctx->pc;
+	dasm_print(ctx, "bra     $%x", dasm_target(ctx, temp_pc + make_int_16(read_imm_16())));
 }
 
-static void d68020_bra_32(void)
+static void d68020_bra_32(m68k_dasm_context* ctx)
 {
-	uint temp_pc = g_cpu_pc;
+	uint temp_pc = ctx->pc;
 	LIMIT_CPU_TYPES(M68020_PLUS);
-	sprintf(g_dasm_str, "bra     $%x; (2+)", temp_pc + read_imm_32());
+	dasm_print(ctx, "bra     $%x; (2+)", dasm_target(ctx, temp_pc + read_imm_32()));
 }
 
-static void d68000_bset_r(void)
+static void d68000_bset_r(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "bset    D%d, %s", (g_cpu_ir>>9)&7, get_ea_mode_str_8(g_cpu_ir));
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "bset    D%d, %s", (ctx->ir>>9)&7, get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68000_bset_s(void)
+static void d68000_bset_s(m68k_dasm_context* ctx)
 {
 	char* str = get_imm_str_u8();
-	sprintf(g_dasm_str, "bset    %s, %s", str, get_ea_mode_str_8(g_cpu_ir));
+	dasm_print(ctx, "bset    %s, %s", str, get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68000_bsr_8(void)
+static void d68000_bsr_8(m68k_dasm_context* ctx)
 {
-	uint temp_pc = g_cpu_pc;
-	sprintf(g_dasm_str, "bsr     $%x", temp_pc + make_int_8(g_cpu_ir));
+	uint temp_pc = ctx->pc;
+	dasm_print(ctx, "bsr     $%x", dasm_target(ctx, temp_pc + make_int_8(ctx->ir)));
 	SET_OPCODE_FLAGS(DASMFLAG_STEP_OVER);
 }
 
-static void d68000_bsr_16(void)
+static void d68000_bsr_16(m68k_dasm_context* ctx)
 {
-	uint temp_pc = g_cpu_pc;
-	sprintf(g_dasm_str, "bsr     $%x", temp_pc + make_int_16(read_imm_16()));
+	uint temp_pc = ctx->pc;
+	dasm_print(ctx, "bsr     $%x", dasm_target(ctx, temp_pc + make_int_16(read_imm_16())));
 	SET_OPCODE_FLAGS(DASMFLAG_STEP_OVER);
 }
 
-static void d68020_bsr_32(void)
+static void d68020_bsr_32(m68k_dasm_context* ctx)
 {
-	uint temp_pc = g_cpu_pc;
+	uint temp_pc = ctx->pc;
 	LIMIT_CPU_TYPES(M68020_PLUS);
-	sprintf(g_dasm_str, "bsr     $%x; (2+)", temp_pc + read_imm_32());
+	dasm_print(ctx, "bsr     $%x; (2+)", dasm_target(ctx, temp_pc + read_imm_32()));
 	SET_OPCODE_FLAGS(DASMFLAG_STEP_OVER);
 }
 
-static void d68000_btst_r(void)
+static void d68000_btst_r(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "btst    D%d, %s", (g_cpu_ir>>9)&7, get_ea_mode_str_8(g_cpu_ir));
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "btst    D%d, %s", (ctx->ir>>9)&7, get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68000_btst_s(void)
+static void d68000_btst_s(m68k_dasm_context* ctx)
 {
 	char* str = get_imm_str_u8();
-	sprintf(g_dasm_str, "btst    %s, %s", str, get_ea_mode_str_8(g_cpu_ir));
+	dasm_print(ctx, "btst    %s, %s", str, get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68020_callm(void)
+static void d68020_callm(m68k_dasm_context* ctx)
 {
 	char* str;
 	LIMIT_CPU_TYPES(M68020_ONLY);
 	str = get_imm_str_u8();
 
-	sprintf(g_dasm_str, "callm   %s, %s; (2)", str, get_ea_mode_str_8(g_cpu_ir));
+	dasm_print(ctx, "callm   %s, %s; (2)", str, get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68020_cas_8(void)
+static void d68020_cas_8(m68k_dasm_context* ctx)
 {
 	uint extension;
 	LIMIT_CPU_TYPES(M68020_PLUS);
 	extension = read_imm_16();
-	sprintf(g_dasm_str, "cas.b   D%d, D%d, %s; (2+)", extension&7, (extension>>6)&7, get_ea_mode_str_8(g_cpu_ir));
+	dasm_dreg(extension&7);
+	dasm_dreg((extension>>6)&7);
+	dasm_print(ctx, "cas.b   D%d, D%d, %s; (2+)", extension&7, (extension>>6)&7, get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68020_cas_16(void)
+static void d68020_cas_16(m68k_dasm_context* ctx)
 {
 	uint extension;
 	LIMIT_CPU_TYPES(M68020_PLUS);
 	extension = read_imm_16();
-	sprintf(g_dasm_str, "cas.w   D%d, D%d, %s; (2+)", extension&7, (extension>>6)&7, get_ea_mode_str_16(g_cpu_ir));
+	dasm_dreg(extension&7);
+	dasm_dreg((extension>>6)&7);
+	dasm_print(ctx, "cas.w   D%d, D%d, %s; (2+)", extension&7, (extension>>6)&7, get_ea_mode_str_16(ctx->ir));
 }
 
-static void d68020_cas_32(void)
+static void d68020_cas_32(m68k_dasm_context* ctx)
 {
 	uint extension;
 	LIMIT_CPU_TYPES(M68020_PLUS);
 	extension = read_imm_16();
-	sprintf(g_dasm_str, "cas.l   D%d, D%d, %s; (2+)", extension&7, (extension>>6)&7, get_ea_mode_str_32(g_cpu_ir));
+	dasm_dreg(extension&7);
+	dasm_dreg((extension>>6)&7);
+	dasm_print(ctx, "cas.l   D%d, D%d, %s; (2+)", extension&7, (extension>>6)&7, get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68020_cas2_16(void)
+static void d68020_cas2_16(m68k_dasm_context* ctx)
 {
 /* CAS2 Dc1:Dc2,Du1:Dc2:(Rn1):(Rn2)
 f e d c b a 9 8 7 6 5 4 3 2 1 0
@@ -1280,440 +1676,520 @@ f e d c b a 9 8 7 6 5 4 3 2 1 0
 	uint extension;
 	LIMIT_CPU_TYPES(M68020_PLUS);
 	extension = read_imm_32();
-	sprintf(g_dasm_str, "cas2.w  D%d:D%d, D%d:D%d, (%c%d):(%c%d); (2+)",
+	dasm_regpair(ctx, (extension>>16)&7, extension&7);
+	dasm_regpair(ctx, (extension>>22)&7, (extension>>6)&7);
+	dasm_regpair(ctx, (extension>>28)&15, (extension>>12)&15);
+	dasm_print(ctx, "cas2.w  D%d:D%d, D%d:D%d, (%c%d):(%c%d); (2+)",
 		(extension>>16)&7, extension&7, (extension>>22)&7, (extension>>6)&7,
 		BIT_1F(extension) ? 'A' : 'D', (extension>>28)&7,
 		BIT_F(extension) ? 'A' : 'D', (extension>>12)&7);
 }
 
-static void d68020_cas2_32(void)
+static void d68020_cas2_32(m68k_dasm_context* ctx)
 {
 	uint extension;
 	LIMIT_CPU_TYPES(M68020_PLUS);
 	extension = read_imm_32();
-	sprintf(g_dasm_str, "cas2.l  D%d:D%d, D%d:D%d, (%c%d):(%c%d); (2+)",
+	dasm_regpair(ctx, (extension>>16)&7, extension&7);
+	dasm_regpair(ctx, (extension>>22)&7, (extension>>6)&7);
+	dasm_regpair(ctx, (extension>>28)&15, (extension>>12)&15);
+	dasm_print(ctx, "cas2.l  D%d:D%d, D%d:D%d, (%c%d):(%c%d); (2+)",
 		(extension>>16)&7, extension&7, (extension>>22)&7, (extension>>6)&7,
 		BIT_1F(extension) ? 'A' : 'D', (extension>>28)&7,
 		BIT_F(extension) ? 'A' : 'D', (extension>>12)&7);
 }
 
-static void d68000_chk_16(void)
+static void d68000_chk_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "chk.w   %s, D%d", get_ea_mode_str_16(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_print(ctx, "chk.w   %s, D%d", get_ea_mode_str_16(ctx->ir), (ctx->ir>>9)&7);
+	dasm_dreg((ctx->ir>>9)&7);
 	SET_OPCODE_FLAGS(DASMFLAG_STEP_OVER);
 }
 
-static void d68020_chk_32(void)
+static void d68020_chk_32(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68020_PLUS);
-	sprintf(g_dasm_str, "chk.l   %s, D%d; (2+)", get_ea_mode_str_32(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_print(ctx, "chk.l   %s, D%d; (2+)", get_ea_mode_str_32(ctx->ir), (ctx->ir>>9)&7);
+	dasm_dreg((ctx->ir>>9)&7);
 	SET_OPCODE_FLAGS(DASMFLAG_STEP_OVER);
 }
 
-static void d68020_chk2_cmp2_8(void)
+static void d68020_chk2_cmp2_8(m68k_dasm_context* ctx)
 {
 	uint extension;
 	LIMIT_CPU_TYPES(M68020_PLUS);
 	extension = read_imm_16();
-	sprintf(g_dasm_str, "%s.b  %s, %c%d; (2+)", BIT_B(extension) ? "chk2" : "cmp2", get_ea_mode_str_8(g_cpu_ir), BIT_F(extension) ? 'A' : 'D', (extension>>12)&7);
+	dasm_chk2_cmp2(ctx, extension);
+	dasm_print(ctx, "%s.b  %s, %c%d; (2+)", BIT_B(extension) ? "chk2" : "cmp2", get_ea_mode_str_8(ctx->ir), BIT_F(extension) ? 'A' : 'D', (extension>>12)&7);
+	dasm_da_reg(BIT_F(extension), (extension>>12)&7);
 }
 
-static void d68020_chk2_cmp2_16(void)
+static void d68020_chk2_cmp2_16(m68k_dasm_context* ctx)
 {
 	uint extension;
 	LIMIT_CPU_TYPES(M68020_PLUS);
 	extension = read_imm_16();
-	sprintf(g_dasm_str, "%s.w  %s, %c%d; (2+)", BIT_B(extension) ? "chk2" : "cmp2", get_ea_mode_str_16(g_cpu_ir), BIT_F(extension) ? 'A' : 'D', (extension>>12)&7);
+	dasm_chk2_cmp2(ctx, extension);
+	dasm_print(ctx, "%s.w  %s, %c%d; (2+)", BIT_B(extension) ? "chk2" : "cmp2", get_ea_mode_str_16(ctx->ir), BIT_F(extension) ? 'A' : 'D', (extension>>12)&7);
+	dasm_da_reg(BIT_F(extension), (extension>>12)&7);
 }
 
-static void d68020_chk2_cmp2_32(void)
+static void d68020_chk2_cmp2_32(m68k_dasm_context* ctx)
 {
 	uint extension;
 	LIMIT_CPU_TYPES(M68020_PLUS);
 	extension = read_imm_16();
-	sprintf(g_dasm_str, "%s.l  %s, %c%d; (2+)", BIT_B(extension) ? "chk2" : "cmp2", get_ea_mode_str_32(g_cpu_ir), BIT_F(extension) ? 'A' : 'D', (extension>>12)&7);
+	dasm_chk2_cmp2(ctx, extension);
+	dasm_print(ctx, "%s.l  %s, %c%d; (2+)", BIT_B(extension) ? "chk2" : "cmp2", get_ea_mode_str_32(ctx->ir), BIT_F(extension) ? 'A' : 'D', (extension>>12)&7);
+	dasm_da_reg(BIT_F(extension), (extension>>12)&7);
 }
 
-static void d68040_cinv(void)
+static void d68040_cinv(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68040_PLUS);
-	switch((g_cpu_ir>>3)&3)
+	switch((ctx->ir>>3)&3)
 	{
 		case 0:
-			sprintf(g_dasm_str, "cinv (illegal scope); (4)");
+			dasm_print(ctx, "cinv (illegal scope); (4)");
 			break;
 		case 1:
-			sprintf(g_dasm_str, "cinvl   %d, (A%d); (4)", (g_cpu_ir>>6)&3, g_cpu_ir&7);
+			dasm_ai(ctx->ir&7);
+			dasm_print(ctx, "cinvl   %d, (A%d); (4)", (ctx->ir>>6)&3, ctx->ir&7);
 			break;
 		case 2:
-			sprintf(g_dasm_str, "cinvp   %d, (A%d); (4)", (g_cpu_ir>>6)&3, g_cpu_ir&7);
+			dasm_ai(ctx->ir&7);
+			dasm_print(ctx, "cinvp   %d, (A%d); (4)", (ctx->ir>>6)&3, ctx->ir&7);
 			break;
 		case 3:
-			sprintf(g_dasm_str, "cinva   %d; (4)", (g_cpu_ir>>6)&3);
+			dasm_print(ctx, "cinva   %d; (4)", (ctx->ir>>6)&3);
 			break;
 	}
 }
 
-static void d68000_clr_8(void)
+static void d68000_clr_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "clr.b   %s", get_ea_mode_str_8(g_cpu_ir));
+	dasm_print(ctx, "clr.b   %s", get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68000_clr_16(void)
+static void d68000_clr_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "clr.w   %s", get_ea_mode_str_16(g_cpu_ir));
+	dasm_print(ctx, "clr.w   %s", get_ea_mode_str_16(ctx->ir));
 }
 
-static void d68000_clr_32(void)
+static void d68000_clr_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "clr.l   %s", get_ea_mode_str_32(g_cpu_ir));
+	dasm_print(ctx, "clr.l   %s", get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68000_cmp_8(void)
+static void d68000_cmp_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "cmp.b   %s, D%d", get_ea_mode_str_8(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_print(ctx, "cmp.b   %s, D%d", get_ea_mode_str_8(ctx->ir), (ctx->ir>>9)&7);
+	dasm_dreg((ctx->ir>>9)&7);
 }
 
-static void d68000_cmp_16(void)
+static void d68000_cmp_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "cmp.w   %s, D%d", get_ea_mode_str_16(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_print(ctx, "cmp.w   %s, D%d", get_ea_mode_str_16(ctx->ir), (ctx->ir>>9)&7);
+	dasm_dreg((ctx->ir>>9)&7);
 }
 
-static void d68000_cmp_32(void)
+static void d68000_cmp_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "cmp.l   %s, D%d", get_ea_mode_str_32(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_print(ctx, "cmp.l   %s, D%d", get_ea_mode_str_32(ctx->ir), (ctx->ir>>9)&7);
+	dasm_dreg((ctx->ir>>9)&7);
 }
 
-static void d68000_cmpa_16(void)
+static void d68000_cmpa_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "cmpa.w  %s, A%d", get_ea_mode_str_16(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_print(ctx, "cmpa.w  %s, A%d", get_ea_mode_str_16(ctx->ir), (ctx->ir>>9)&7);
+	dasm_areg((ctx->ir>>9)&7);
 }
 
-static void d68000_cmpa_32(void)
+static void d68000_cmpa_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "cmpa.l  %s, A%d", get_ea_mode_str_32(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_print(ctx, "cmpa.l  %s, A%d", get_ea_mode_str_32(ctx->ir), (ctx->ir>>9)&7);
+	dasm_areg((ctx->ir>>9)&7);
 }
 
-static void d68000_cmpi_8(void)
+static void d68000_cmpi_8(m68k_dasm_context* ctx)
 {
 	char* str = get_imm_str_s8();
-	sprintf(g_dasm_str, "cmpi.b  %s, %s", str, get_ea_mode_str_8(g_cpu_ir));
+	dasm_print(ctx, "cmpi.b  %s, %s", str, get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68020_cmpi_pcdi_8(void)
+static void d68020_cmpi_pcdi_8(m68k_dasm_context* ctx)
 {
 	char* str;
 	LIMIT_CPU_TYPES(M68010_PLUS);
 	str = get_imm_str_s8();
-	sprintf(g_dasm_str, "cmpi.b  %s, %s; (2+)", str, get_ea_mode_str_8(g_cpu_ir));
+	dasm_print(ctx, "cmpi.b  %s, %s; (2+)", str, get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68020_cmpi_pcix_8(void)
+static void d68020_cmpi_pcix_8(m68k_dasm_context* ctx)
 {
 	char* str;
 	LIMIT_CPU_TYPES(M68010_PLUS);
 	str = get_imm_str_s8();
-	sprintf(g_dasm_str, "cmpi.b  %s, %s; (2+)", str, get_ea_mode_str_8(g_cpu_ir));
+	dasm_print(ctx, "cmpi.b  %s, %s; (2+)", str, get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68000_cmpi_16(void)
+static void d68000_cmpi_16(m68k_dasm_context* ctx)
 {
 	char* str;
 	str = get_imm_str_s16();
-	sprintf(g_dasm_str, "cmpi.w  %s, %s", str, get_ea_mode_str_16(g_cpu_ir));
+	dasm_print(ctx, "cmpi.w  %s, %s", str, get_ea_mode_str_16(ctx->ir));
 }
 
-static void d68020_cmpi_pcdi_16(void)
+static void d68020_cmpi_pcdi_16(m68k_dasm_context* ctx)
 {
 	char* str;
 	LIMIT_CPU_TYPES(M68010_PLUS);
 	str = get_imm_str_s16();
-	sprintf(g_dasm_str, "cmpi.w  %s, %s; (2+)", str, get_ea_mode_str_16(g_cpu_ir));
+	dasm_print(ctx, "cmpi.w  %s, %s; (2+)", str, get_ea_mode_str_16(ctx->ir));
 }
 
-static void d68020_cmpi_pcix_16(void)
+static void d68020_cmpi_pcix_16(m68k_dasm_context* ctx)
 {
 	char* str;
 	LIMIT_CPU_TYPES(M68010_PLUS);
 	str = get_imm_str_s16();
-	sprintf(g_dasm_str, "cmpi.w  %s, %s; (2+)", str, get_ea_mode_str_16(g_cpu_ir));
+	dasm_print(ctx, "cmpi.w  %s, %s; (2+)", str, get_ea_mode_str_16(ctx->ir));
 }
 
-static void d68000_cmpi_32(void)
+static void d68000_cmpi_32(m68k_dasm_context* ctx)
 {
 	char* str;
 	str = get_imm_str_s32();
-	sprintf(g_dasm_str, "cmpi.l  %s, %s", str, get_ea_mode_str_32(g_cpu_ir));
+	dasm_print(ctx, "cmpi.l  %s, %s", str, get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68020_cmpi_pcdi_32(void)
+static void d68020_cmpi_pcdi_32(m68k_dasm_context* ctx)
 {
 	char* str;
 	LIMIT_CPU_TYPES(M68010_PLUS);
 	str = get_imm_str_s32();
-	sprintf(g_dasm_str, "cmpi.l  %s, %s; (2+)", str, get_ea_mode_str_32(g_cpu_ir));
+	dasm_print(ctx, "cmpi.l  %s, %s; (2+)", str, get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68020_cmpi_pcix_32(void)
+static void d68020_cmpi_pcix_32(m68k_dasm_context* ctx)
 {
 	char* str;
 	LIMIT_CPU_TYPES(M68010_PLUS);
 	str = get_imm_str_s32();
-	sprintf(g_dasm_str, "cmpi.l  %s, %s; (2+)", str, get_ea_mode_str_32(g_cpu_ir));
+	dasm_print(ctx, "cmpi.l  %s, %s; (2+)", str, get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68000_cmpm_8(void)
+static void d68000_cmpm_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "cmpm.b  (A%d)+, (A%d)+", g_cpu_ir&7, (g_cpu_ir>>9)&7);
+	dasm_pi(ctx->ir&7);
+	dasm_pi((ctx->ir>>9)&7);
+	dasm_print(ctx, "cmpm.b  (A%d)+, (A%d)+", ctx->ir&7, (ctx->ir>>9)&7);
 }
 
-static void d68000_cmpm_16(void)
+static void d68000_cmpm_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "cmpm.w  (A%d)+, (A%d)+", g_cpu_ir&7, (g_cpu_ir>>9)&7);
+	dasm_pi(ctx->ir&7);
+	dasm_pi((ctx->ir>>9)&7);
+	dasm_print(ctx, "cmpm.w  (A%d)+, (A%d)+", ctx->ir&7, (ctx->ir>>9)&7);
 }
 
-static void d68000_cmpm_32(void)
+static void d68000_cmpm_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "cmpm.l  (A%d)+, (A%d)+", g_cpu_ir&7, (g_cpu_ir>>9)&7);
+	dasm_pi(ctx->ir&7);
+	dasm_pi((ctx->ir>>9)&7);
+	dasm_print(ctx, "cmpm.l  (A%d)+, (A%d)+", ctx->ir&7, (ctx->ir>>9)&7);
 }
 
-static void d68020_cpbcc_16(void)
+static void d68020_cpbcc_16(m68k_dasm_context* ctx)
 {
 	uint extension;
-	uint new_pc = g_cpu_pc;
+	uint new_pc = ctx->pc;
 	LIMIT_CPU_TYPES(M68020_PLUS);
 	extension = read_imm_16();
 	new_pc += make_int_16(read_imm_16());
-	sprintf(g_dasm_str, "%db%-4s  %s; %x (extension = %x) (2-3)", (g_cpu_ir>>9)&7, g_cpcc[g_cpu_ir&0x3f], get_imm_str_s16(), new_pc, extension);
+	ctx->insn->condition = ctx->ir&0x3f;
+	dasm_print(ctx, "%db%-4s  %s; %x (extension = %x) (2-3)", (ctx->ir>>9)&7, g_cpcc[ctx->ir&0x3f], get_imm_str_s16(), new_pc, extension);
+	dasm_target(ctx, new_pc);
 }
 
-static void d68020_cpbcc_32(void)
+static void d68020_cpbcc_32(m68k_dasm_context* ctx)
 {
 	uint extension;
-	uint new_pc = g_cpu_pc;
+	uint new_pc = ctx->pc;
 	LIMIT_CPU_TYPES(M68020_PLUS);
 	extension = read_imm_16();
 	new_pc += read_imm_32();
-	sprintf(g_dasm_str, "%db%-4s  %s; %x (extension = %x) (2-3)", (g_cpu_ir>>9)&7, g_cpcc[g_cpu_ir&0x3f], get_imm_str_s16(), new_pc, extension);
+	ctx->insn->condition = ctx->ir&0x3f;
+	dasm_print(ctx, "%db%-4s  %s; %x (extension = %x) (2-3)", (ctx->ir>>9)&7, g_cpcc[ctx->ir&0x3f], get_imm_str_s16(), new_pc, extension);
+	dasm_target(ctx, new_pc);
 }
 
-static void d68020_cpdbcc(void)
+static void d68020_cpdbcc(m68k_dasm_context* ctx)
 {
 	uint extension1;
 	uint extension2;
-	uint new_pc = g_cpu_pc;
+	uint new_pc = ctx->pc;
 	LIMIT_CPU_TYPES(M68020_PLUS);
 	extension1 = read_imm_16();
 	extension2 = read_imm_16();
 	new_pc += make_int_16(read_imm_16());
-	sprintf(g_dasm_str, "%ddb%-4s D%d,%s; %x (extension = %x) (2-3)", (g_cpu_ir>>9)&7, g_cpcc[extension1&0x3f], g_cpu_ir&7, get_imm_str_s16(), new_pc, extension2);
+	ctx->insn->condition = extension1&0x3f;
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "%ddb%-4s D%d,%s; %x (extension = %x) (2-3)", (ctx->ir>>9)&7, g_cpcc[extension1&0x3f], ctx->ir&7, get_imm_str_s16(), new_pc, extension2);
+	dasm_target(ctx, new_pc);
 }
 
-static void d68020_cpgen(void)
+static void d68020_cpgen(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68020_PLUS);
-	sprintf(g_dasm_str, "%dgen    %s; (2-3)", (g_cpu_ir>>9)&7, get_imm_str_u32());
+	dasm_print(ctx, "%dgen    %s; (2-3)", (ctx->ir>>9)&7, get_imm_str_u32());
 }
 
-static void d68020_cprestore(void)
+static void d68020_cprestore(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68020_PLUS);
-	if (((g_cpu_ir>>9)&7) == 1)
+	if (((ctx->ir>>9)&7) == 1)
 	{
-		sprintf(g_dasm_str, "frestore %s", get_ea_mode_str_8(g_cpu_ir));
+		dasm_print(ctx, "frestore %s", get_ea_mode_str_8(ctx->ir));
 	}
 	else
 	{
-		sprintf(g_dasm_str, "%drestore %s; (2-3)", (g_cpu_ir>>9)&7, get_ea_mode_str_8(g_cpu_ir));
+		dasm_print(ctx, "%drestore %s; (2-3)", (ctx->ir>>9)&7, get_ea_mode_str_8(ctx->ir));
 	}
 }
 
-static void d68020_cpsave(void)
+static void d68020_cpsave(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68020_PLUS);
-	if (((g_cpu_ir>>9)&7) == 1)
+	if (((ctx->ir>>9)&7) == 1)
 	{
-		sprintf(g_dasm_str, "fsave   %s", get_ea_mode_str_8(g_cpu_ir));
+		dasm_print(ctx, "fsave   %s", get_ea_mode_str_8(ctx->ir));
 	}
 	else
 	{
-		sprintf(g_dasm_str, "%dsave   %s; (2-3)", (g_cpu_ir>>9)&7, get_ea_mode_str_8(g_cpu_ir));
+		dasm_print(ctx, "%dsave   %s; (2-3)", (ctx->ir>>9)&7, get_ea_mode_str_8(ctx->ir));
 	}
 }
 
-static void d68020_cpscc(void)
+static void d68020_cpscc(m68k_dasm_context* ctx)
 {
 	uint extension1;
 	uint extension2;
 	LIMIT_CPU_TYPES(M68020_PLUS);
 	extension1 = read_imm_16();
 	extension2 = read_imm_16();
-	sprintf(g_dasm_str, "%ds%-4s  %s; (extension = %x) (2-3)", (g_cpu_ir>>9)&7, g_cpcc[extension1&0x3f], get_ea_mode_str_8(g_cpu_ir), extension2);
+	ctx->insn->condition = extension1&0x3f;
+	dasm_print(ctx, "%ds%-4s  %s; (extension = %x) (2-3)", (ctx->ir>>9)&7, g_cpcc[extension1&0x3f], get_ea_mode_str_8(ctx->ir), extension2);
 }
 
-static void d68020_cptrapcc_0(void)
+static void d68020_cptrapcc_0(m68k_dasm_context* ctx)
 {
 	uint extension1;
 	uint extension2;
 	LIMIT_CPU_TYPES(M68020_PLUS);
 	extension1 = read_imm_16();
 	extension2 = read_imm_16();
-	sprintf(g_dasm_str, "%dtrap%-4s; (extension = %x) (2-3)", (g_cpu_ir>>9)&7, g_cpcc[extension1&0x3f], extension2);
+	ctx->insn->condition = extension1&0x3f;
+	dasm_print(ctx, "%dtrap%-4s; (extension = %x) (2-3)", (ctx->ir>>9)&7, g_cpcc[extension1&0x3f], extension2);
 }
 
-static void d68020_cptrapcc_16(void)
+static void d68020_cptrapcc_16(m68k_dasm_context* ctx)
 {
 	uint extension1;
 	uint extension2;
 	LIMIT_CPU_TYPES(M68020_PLUS);
 	extension1 = read_imm_16();
 	extension2 = read_imm_16();
-	sprintf(g_dasm_str, "%dtrap%-4s %s; (extension = %x) (2-3)", (g_cpu_ir>>9)&7, g_cpcc[extension1&0x3f], get_imm_str_u16(), extension2);
+	ctx->insn->condition = extension1&0x3f;
+	dasm_print(ctx, "%dtrap%-4s %s; (extension = %x) (2-3)", (ctx->ir>>9)&7, g_cpcc[extension1&0x3f], get_imm_str_u16(), extension2);
 }
 
-static void d68020_cptrapcc_32(void)
+static void d68020_cptrapcc_32(m68k_dasm_context* ctx)
 {
 	uint extension1;
 	uint extension2;
 	LIMIT_CPU_TYPES(M68020_PLUS);
 	extension1 = read_imm_16();
 	extension2 = read_imm_16();
-	sprintf(g_dasm_str, "%dtrap%-4s %s; (extension = %x) (2-3)", (g_cpu_ir>>9)&7, g_cpcc[extension1&0x3f], get_imm_str_u32(), extension2);
+	ctx->insn->condition = extension1&0x3f;
+	dasm_print(ctx, "%dtrap%-4s %s; (extension = %x) (2-3)", (ctx->ir>>9)&7, g_cpcc[extension1&0x3f], get_imm_str_u32(), extension2);
 }
 
-static void d68040_cpush(void)
+static void d68040_cpush(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68040_PLUS);
-	switch((g_cpu_ir>>3)&3)
+	switch((ctx->ir>>3)&3)
 	{
 		case 0:
-			sprintf(g_dasm_str, "cpush (illegal scope); (4)");
+			dasm_print(ctx, "cpush (illegal scope); (4)");
 			break;
 		case 1:
-			sprintf(g_dasm_str, "cpushl  %d, (A%d); (4)", (g_cpu_ir>>6)&3, g_cpu_ir&7);
+			dasm_ai(ctx->ir&7);
+			dasm_print(ctx, "cpushl  %d, (A%d); (4)", (ctx->ir>>6)&3, ctx->ir&7);
 			break;
 		case 2:
-			sprintf(g_dasm_str, "cpushp  %d, (A%d); (4)", (g_cpu_ir>>6)&3, g_cpu_ir&7);
+			dasm_ai(ctx->ir&7);
+			dasm_print(ctx, "cpushp  %d, (A%d); (4)", (ctx->ir>>6)&3, ctx->ir&7);
 			break;
 		case 3:
-			sprintf(g_dasm_str, "cpusha  %d; (4)", (g_cpu_ir>>6)&3);
+			dasm_print(ctx, "cpusha  %d; (4)", (ctx->ir>>6)&3);
 			break;
 	}
 }
 
-static void d68000_dbra(void)
+static void d68000_dbra(m68k_dasm_context* ctx)
 {
-	uint temp_pc = g_cpu_pc;
-	sprintf(g_dasm_str, "dbra    D%d, $%x", g_cpu_ir & 7, temp_pc + make_int_16(read_imm_16()));
+	uint temp_pc = ctx->pc;
+	ctx->insn->condition = 1;
+	dasm_dreg(ctx->ir & 7);
+	dasm_print(ctx, "dbra    D%d, $%x", ctx->ir & 7, dasm_target(ctx, temp_pc + make_int_16(read_imm_16())));
 	SET_OPCODE_FLAGS(DASMFLAG_STEP_OVER);
 }
 
-static void d68000_dbcc(void)
+static void d68000_dbcc(m68k_dasm_context* ctx)
 {
-	uint temp_pc = g_cpu_pc;
-	sprintf(g_dasm_str, "db%-2s    D%d, $%x", g_cc[(g_cpu_ir>>8)&0xf], g_cpu_ir & 7, temp_pc + make_int_16(read_imm_16()));
+	uint temp_pc = ctx->pc;
+	ctx->insn->condition = (ctx->ir>>8)&0xf;
+	dasm_dreg(ctx->ir & 7);
+	dasm_print(ctx, "db%-2s    D%d, $%x", g_cc[(ctx->ir>>8)&0xf], ctx->ir & 7, dasm_target(ctx, temp_pc + make_int_16(read_imm_16())));
 	SET_OPCODE_FLAGS(DASMFLAG_STEP_OVER);
 }
 
-static void d68000_divs(void)
+static void d68000_divs(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "divs.w  %s, D%d", get_ea_mode_str_16(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_print(ctx, "divs.w  %s, D%d", get_ea_mode_str_16(ctx->ir), (ctx->ir>>9)&7);
+	dasm_dreg((ctx->ir>>9)&7);
 }
 
-static void d68000_divu(void)
+static void d68000_divu(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "divu.w  %s, D%d", get_ea_mode_str_16(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_print(ctx, "divu.w  %s, D%d", get_ea_mode_str_16(ctx->ir), (ctx->ir>>9)&7);
+	dasm_dreg((ctx->ir>>9)&7);
 }
 
-static void d68020_divl(void)
+static void d68020_divl(m68k_dasm_context* ctx)
 {
 	uint extension;
 	LIMIT_CPU_TYPES(M68020_PLUS);
 	extension = read_imm_16();
 
+	if(BIT_B(extension))
+		ctx->insn->mnemonic = M68K_INSN_DIVS;
 	if(BIT_A(extension))
-		sprintf(g_dasm_str, "div%c.l  %s, D%d:D%d; (2+)", BIT_B(extension) ? 's' : 'u', get_ea_mode_str_32(g_cpu_ir), extension&7, (extension>>12)&7);
+		dasm_print(ctx, "div%c.l  %s, D%d:D%d; (2+)", BIT_B(extension) ? 's' : 'u', get_ea_mode_str_32(ctx->ir), extension&7, (extension>>12)&7);
 	else if((extension&7) == ((extension>>12)&7))
-		sprintf(g_dasm_str, "div%c.l  %s, D%d; (2+)", BIT_B(extension) ? 's' : 'u', get_ea_mode_str_32(g_cpu_ir), (extension>>12)&7);
+		dasm_print(ctx, "div%c.l  %s, D%d; (2+)", BIT_B(extension) ? 's' : 'u', get_ea_mode_str_32(ctx->ir), (extension>>12)&7);
 	else
-		sprintf(g_dasm_str, "div%cl.l %s, D%d:D%d; (2+)", BIT_B(extension) ? 's' : 'u', get_ea_mode_str_32(g_cpu_ir), extension&7, (extension>>12)&7);
+		dasm_print(ctx, "div%cl.l %s, D%d:D%d; (2+)", BIT_B(extension) ? 's' : 'u', get_ea_mode_str_32(ctx->ir), extension&7, (extension>>12)&7);
+	if((extension&7) == ((extension>>12)&7) && !BIT_A(extension))
+		dasm_dreg((extension>>12)&7);
+	else
+		dasm_regpair(ctx, extension&7, (extension>>12)&7);
 }
 
-static void d68000_eor_8(void)
+static void d68000_eor_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "eor.b   D%d, %s", (g_cpu_ir>>9)&7, get_ea_mode_str_8(g_cpu_ir));
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "eor.b   D%d, %s", (ctx->ir>>9)&7, get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68000_eor_16(void)
+static void d68000_eor_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "eor.w   D%d, %s", (g_cpu_ir>>9)&7, get_ea_mode_str_16(g_cpu_ir));
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "eor.w   D%d, %s", (ctx->ir>>9)&7, get_ea_mode_str_16(ctx->ir));
 }
 
-static void d68000_eor_32(void)
+static void d68000_eor_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "eor.l   D%d, %s", (g_cpu_ir>>9)&7, get_ea_mode_str_32(g_cpu_ir));
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "eor.l   D%d, %s", (ctx->ir>>9)&7, get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68000_eori_8(void)
+static void d68000_eori_8(m68k_dasm_context* ctx)
 {
 	char* str = get_imm_str_u8();
-	sprintf(g_dasm_str, "eori.b  %s, %s", str, get_ea_mode_str_8(g_cpu_ir));
+	dasm_print(ctx, "eori.b  %s, %s", str, get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68000_eori_16(void)
+static void d68000_eori_16(m68k_dasm_context* ctx)
 {
 	char* str = get_imm_str_u16();
-	sprintf(g_dasm_str, "eori.w  %s, %s", str, get_ea_mode_str_16(g_cpu_ir));
+	dasm_print(ctx, "eori.w  %s, %s", str, get_ea_mode_str_16(ctx->ir));
 }
 
-static void d68000_eori_32(void)
+static void d68000_eori_32(m68k_dasm_context* ctx)
 {
 	char* str = get_imm_str_u32();
-	sprintf(g_dasm_str, "eori.l  %s, %s", str, get_ea_mode_str_32(g_cpu_ir));
+	dasm_print(ctx, "eori.l  %s, %s", str, get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68000_eori_to_ccr(void)
+static void d68000_eori_to_ccr(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "eori    %s, CCR", get_imm_str_u8());
+	dasm_print(ctx, "eori    %s, CCR", get_imm_str_u8());
+	dasm_special(M68K_DASM_OPERAND_CCR);
 }
 
-static void d68000_eori_to_sr(void)
+static void d68000_eori_to_sr(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "eori    %s, SR", get_imm_str_u16());
+	dasm_print(ctx, "eori    %s, SR", get_imm_str_u16());
+	dasm_special(M68K_DASM_OPERAND_SR);
 }
 
-static void d68000_exg_dd(void)
+static void d68000_exg_dd(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "exg     D%d, D%d", (g_cpu_ir>>9)&7, g_cpu_ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "exg     D%d, D%d", (ctx->ir>>9)&7, ctx->ir&7);
 }
 
-static void d68000_exg_aa(void)
+static void d68000_exg_aa(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "exg     A%d, A%d", (g_cpu_ir>>9)&7, g_cpu_ir&7);
+	dasm_areg((ctx->ir>>9)&7);
+	dasm_areg(ctx->ir&7);
+	dasm_print(ctx, "exg     A%d, A%d", (ctx->ir>>9)&7, ctx->ir&7);
 }
 
-static void d68000_exg_da(void)
+static void d68000_exg_da(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "exg     D%d, A%d", (g_cpu_ir>>9)&7, g_cpu_ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_areg(ctx->ir&7);
+	dasm_print(ctx, "exg     D%d, A%d", (ctx->ir>>9)&7, ctx->ir&7);
 }
 
-static void d68000_ext_16(void)
+static void d68000_ext_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "ext.w   D%d", g_cpu_ir&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "ext.w   D%d", ctx->ir&7);
 }
 
-static void d68000_ext_32(void)
+static void d68000_ext_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "ext.l   D%d", g_cpu_ir&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "ext.l   D%d", ctx->ir&7);
 }
 
-static void d68020_extb_32(void)
+static void d68020_extb_32(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68020_PLUS);
-	sprintf(g_dasm_str, "extb.l  D%d; (2+)", g_cpu_ir&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "extb.l  D%d; (2+)", ctx->ir&7);
+}
+
+/* The FMOVEM register mask lists FP7-FP0 for the postincrement and control
+ * modes and FP0-FP7 for predecrement.  Return it with bit n = FPn.
+ */
+static uint fpu_register_list(uint w2)
+{
+	uint list = 0;
+	int i;
+
+	for (i = 0; i < 8; i++)
+		if (w2 & (1<<i))
+			list |= 1 << (((w2>>12) & 1) ? 7-i : i);
+	return list;
 }
 
-static void d68040_fpu(void)
+static void d68040_fpu(m68k_dasm_context* ctx)
 {
 	char float_data_format[8][3] =
 	{
@@ -1731,7 +2207,9 @@ static void d68040_fpu(void)
 	// special override for FMOVECR
 	if ((((w2 >> 13) & 0x7) == 2) && (((w2>>10)&0x7) == 7))
 	{
-		sprintf(g_dasm_str, "fmovecr   #$%0x, fp%d", (w2&0x7f), dst_reg);
+		dasm_imm(w2&0x7f);
+		dasm_fpreg(dst_reg);
+		dasm_print(ctx, "fmovecr   #$%0x, fp%d", (w2&0x7f), dst_reg);
 		return;
 	}
 
@@ -1801,29 +2279,35 @@ static void d68040_fpu(void)
 
 			if (w2 & 0x4000)
 			{
-				sprintf(g_dasm_str, "%s%s   %s, FP%d", mnemonic, float_data_format[src], get_ea_mode_str_32(g_cpu_ir), dst_reg);
+				dasm_print(ctx, "%s%s   %s, FP%d", mnemonic, float_data_format[src], get_ea_mode_str_32(ctx->ir), dst_reg);
+				dasm_fpreg(dst_reg);
 			}
 			else
 			{
-				sprintf(g_dasm_str, "%s.x   FP%d, FP%d", mnemonic, src, dst_reg);
+				dasm_fpreg(src);
+				dasm_fpreg(dst_reg);
+				dasm_print(ctx, "%s.x   FP%d, FP%d", mnemonic, src, dst_reg);
 			}
 			break;
 		}
 
 		case 0x3:
 		{
+			dasm_fpreg(dst_reg);
 			switch ((w2>>10)&7)
 			{
 				case 3:		// packed decimal w/fixed k-factor
-					sprintf(g_dasm_str, "fmove%s   FP%d, %s {#%d}", float_data_format[(w2>>10)&7], dst_reg, get_ea_mode_str_32(g_cpu_ir), sext_7bit_int(w2&0x7f));
+					dasm_print(ctx, "fmove%s   FP%d, %s {#%d}", float_data_format[(w2>>10)&7], dst_reg, get_ea_mode_str_32(ctx->ir), sext_7bit_int(w2&0x7f));
+					dasm_imm(sext_7bit_int(w2&0x7f));
 					break;
 
 				case 7:		// packed decimal w/dynamic k-factor (register)
-					sprintf(g_dasm_str, "fmove%s   FP%d, %s {D%d}", float_data_format[(w2>>10)&7], dst_reg, get_ea_mode_str_32(g_cpu_ir), (w2>>4)&7);
+					dasm_print(ctx, "fmove%s   FP%d, %s {D%d}", float_data_format[(w2>>10)&7], dst_reg, get_ea_mode_str_32(ctx->ir), (w2>>4)&7);
+					dasm_dreg((w2>>4)&7);
 					break;
 
 				default:
-					sprintf(g_dasm_str, "fmove%s   FP%d, %s", float_data_format[(w2>>10)&7], dst_reg, get_ea_mode_str_32(g_cpu_ir));
+					dasm_print(ctx, "fmove%s   FP%d, %s", float_data_format[(w2>>10)&7], dst_reg, get_ea_mode_str_32(ctx->ir));
 					break;
 			}
 			break;
@@ -1831,22 +2315,30 @@ static void d68040_fpu(void)
 
 		case 0x4:	// ea to control
 		{
-			sprintf(g_dasm_str, "fmovem.l   %s, ", get_ea_mode_str_32(g_cpu_ir));
-			if (w2 & 0x1000) strcat(g_dasm_str, "fpcr");
-			if (w2 & 0x0800) strcat(g_dasm_str, "/fpsr");
-			if (w2 & 0x0400) strcat(g_dasm_str, "/fpiar");
+			dasm_print(ctx, "fmovem.l   %s, ", get_ea_mode_str_32(ctx->ir));
+			dasm_value(ctx, M68K_DASM_OPERAND_FPCONTROL, w2 & 0x1c00);
+			if (!ctx->text)
+				break;
+			if (w2 & 0x1000) strcat(ctx->str, "fpcr");
+			if (w2 & 0x0800) strcat(ctx->str, "/fpsr");
+			if (w2 & 0x0400) strcat(ctx->str, "/fpiar");
 			break;
 		}
 
 		case 0x5:	// control to ea
 		{
-			
-			strcpy(g_dasm_str, "fmovem.l   ");
-			if (w2 & 0x1000) strcat(g_dasm_str, "fpcr");
-			if (w2 & 0x0800) strcat(g_dasm_str, "/fpsr");
-			if (w2 & 0x0400) strcat(g_dasm_str, "/fpiar");
-			strcat(g_dasm_str, ", ");
-			strcat(g_dasm_str, get_ea_mode_str_32(g_cpu_ir));
+			char* ea_str;
+
+			dasm_value(ctx, M68K_DASM_OPERAND_FPCONTROL, w2 & 0x1c00);
+			ea_str = get_ea_mode_str_32(ctx->ir);
+			if (!ctx->text)
+				break;
+			strcpy(ctx->str, "fmovem.l   ");
+			if (w2 & 0x1000) strcat(ctx->str, "fpcr");
+			if (w2 & 0x0800) strcat(ctx->str, "/fpsr");
+			if (w2 & 0x0400) strcat(ctx->str, "/fpiar");
+			strcat(ctx->str, ", ");
+			strcat(ctx->str, ea_str);
 			break;
 		}
 
@@ -1856,13 +2348,17 @@ static void d68040_fpu(void)
 
 			if ((w2>>11) & 1)	// dynamic register list
 			{
-				sprintf(g_dasm_str, "fmovem.x   %s, D%d", get_ea_mode_str_32(g_cpu_ir), (w2>>4)&7);
+				dasm_print(ctx, "fmovem.x   %s, D%d", get_ea_mode_str_32(ctx->ir), (w2>>4)&7);
+				dasm_dreg((w2>>4)&7);
 			}
 			else	// static register list
 			{
 				int i;
 
-				sprintf(g_dasm_str, "fmovem.x   %s, ", get_ea_mode_str_32(g_cpu_ir));
+				dasm_print(ctx, "fmovem.x   %s, ", get_ea_mode_str_32(ctx->ir));
+				dasm_value(ctx, M68K_DASM_OPERAND_FPLIST, fpu_register_list(w2));
+				if (!ctx->text)
+					break;
 
 				for (i = 0; i < 8; i++)
 				{
@@ -1876,7 +2372,7 @@ static void d68040_fpu(void)
 						{
 							sprintf(temp, "FP%d ", i);
 						}
-						strcat(g_dasm_str, temp);
+						strcat(ctx->str, temp);
 					}
 				}
 			}
@@ -1889,13 +2385,20 @@ static void d68040_fpu(void)
 
 			if ((w2>>11) & 1)	// dynamic register list
 			{
-				sprintf(g_dasm_str, "fmovem.x   D%d, %s", (w2>>4)&7, get_ea_mode_str_32(g_cpu_ir));
+				dasm_dreg((w2>>4)&7);
+				dasm_print(ctx, "fmovem.x   D%d, %s", (w2>>4)&7, get_ea_mode_str_32(ctx->ir));
 			}
 			else	// static register list
 			{
 				int i;
+				char* ea_str;
+
+				dasm_value(ctx, M68K_DASM_OPERAND_FPLIST, fpu_register_list(w2));
+				ea_str = get_ea_mode_str_32(ctx->ir);
+				if (!ctx->text)
+					break;
 
-				sprintf(g_dasm_str, "fmovem.x   ");
+				dasm_print(ctx, "fmovem.x   ");
 
 				for (i = 0; i < 8; i++)
 				{
@@ -1909,181 +2412,218 @@ static void d68040_fpu(void)
 						{
 							sprintf(temp, "FP%d ", i);
 						}
-						strcat(g_dasm_str, temp);
+						strcat(ctx->str, temp);
 					}
 				}
 
-				strcat(g_dasm_str, ", ");
-				strcat(g_dasm_str, get_ea_mode_str_32(g_cpu_ir));
+				strcat(ctx->str, ", ");
+				strcat(ctx->str, ea_str);
 			}
 			break;
 		}
 
 		default:
 		{
-			sprintf(g_dasm_str, "FPU (?) ");
+			dasm_print(ctx, "FPU (?) ");
 			break;
 		}
 	}
 }
 
-static void d68000_jmp(void)
+static void d68000_jmp(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "jmp     %s", get_ea_mode_str_32(g_cpu_ir));
+	dasm_print(ctx, "jmp     %s", get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68000_jsr(void)
+static void d68000_jsr(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "jsr     %s", get_ea_mode_str_32(g_cpu_ir));
+	dasm_print(ctx, "jsr     %s", get_ea_mode_str_32(ctx->ir));
 	SET_OPCODE_FLAGS(DASMFLAG_STEP_OVER);
 }
 
-static void d68000_lea(void)
+static void d68000_lea(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "lea     %s, A%d", get_ea_mode_str_32(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_print(ctx, "lea     %s, A%d", get_ea_mode_str_32(ctx->ir), (ctx->ir>>9)&7);
+	dasm_areg((ctx->ir>>9)&7);
 }
 
-static void d68000_link_16(void)
+static void d68000_link_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "link    A%d, %s", g_cpu_ir&7, get_imm_str_s16());
+	dasm_areg(ctx->ir&7);
+	dasm_print(ctx, "link    A%d, %s", ctx->ir&7, get_imm_str_s16());
 }
 
-static void d68020_link_32(void)
+static void d68020_link_32(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68020_PLUS);
-	sprintf(g_dasm_str, "link    A%d, %s; (2+)", g_cpu_ir&7, get_imm_str_s32());
+	dasm_areg(ctx->ir&7);
+	dasm_print(ctx, "link    A%d, %s; (2+)", ctx->ir&7, get_imm_str_s32());
 }
 
-static void d68000_lsr_s_8(void)
+static void d68000_lsr_s_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "lsr.b   #%d, D%d", g_3bit_qdata_table[(g_cpu_ir>>9)&7], g_cpu_ir&7);
+	dasm_imm(g_3bit_qdata_table[(ctx->ir>>9)&7]);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "lsr.b   #%d, D%d", g_3bit_qdata_table[(ctx->ir>>9)&7], ctx->ir&7);
 }
 
-static void d68000_lsr_s_16(void)
+static void d68000_lsr_s_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "lsr.w   #%d, D%d", g_3bit_qdata_table[(g_cpu_ir>>9)&7], g_cpu_ir&7);
+	dasm_imm(g_3bit_qdata_table[(ctx->ir>>9)&7]);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "lsr.w   #%d, D%d", g_3bit_qdata_table[(ctx->ir>>9)&7], ctx->ir&7);
 }
 
-static void d68000_lsr_s_32(void)
+static void d68000_lsr_s_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "lsr.l   #%d, D%d", g_3bit_qdata_table[(g_cpu_ir>>9)&7], g_cpu_ir&7);
+	dasm_imm(g_3bit_qdata_table[(ctx->ir>>9)&7]);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "lsr.l   #%d, D%d", g_3bit_qdata_table[(ctx->ir>>9)&7], ctx->ir&7);
 }
 
-static void d68000_lsr_r_8(void)
+static void d68000_lsr_r_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "lsr.b   D%d, D%d", (g_cpu_ir>>9)&7, g_cpu_ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "lsr.b   D%d, D%d", (ctx->ir>>9)&7, ctx->ir&7);
 }
 
-static void d68000_lsr_r_16(void)
+static void d68000_lsr_r_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "lsr.w   D%d, D%d", (g_cpu_ir>>9)&7, g_cpu_ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "lsr.w   D%d, D%d", (ctx->ir>>9)&7, ctx->ir&7);
 }
 
-static void d68000_lsr_r_32(void)
+static void d68000_lsr_r_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "lsr.l   D%d, D%d", (g_cpu_ir>>9)&7, g_cpu_ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "lsr.l   D%d, D%d", (ctx->ir>>9)&7, ctx->ir&7);
 }
 
-static void d68000_lsr_ea(void)
+static void d68000_lsr_ea(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "lsr.w   %s", get_ea_mode_str_32(g_cpu_ir));
+	dasm_print(ctx, "lsr.w   %s", get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68000_lsl_s_8(void)
+static void d68000_lsl_s_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "lsl.b   #%d, D%d", g_3bit_qdata_table[(g_cpu_ir>>9)&7], g_cpu_ir&7);
+	dasm_imm(g_3bit_qdata_table[(ctx->ir>>9)&7]);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "lsl.b   #%d, D%d", g_3bit_qdata_table[(ctx->ir>>9)&7], ctx->ir&7);
 }
 
-static void d68000_lsl_s_16(void)
+static void d68000_lsl_s_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "lsl.w   #%d, D%d", g_3bit_qdata_table[(g_cpu_ir>>9)&7], g_cpu_ir&7);
+	dasm_imm(g_3bit_qdata_table[(ctx->ir>>9)&7]);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "lsl.w   #%d, D%d", g_3bit_qdata_table[(ctx->ir>>9)&7], ctx->ir&7);
 }
 
-static void d68000_lsl_s_32(void)
+static void d68000_lsl_s_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "lsl.l   #%d, D%d", g_3bit_qdata_table[(g_cpu_ir>>9)&7], g_cpu_ir&7);
+	dasm_imm(g_3bit_qdata_table[(ctx->ir>>9)&7]);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "lsl.l   #%d, D%d", g_3bit_qdata_table[(ctx->ir>>9)&7], ctx->ir&7);
 }
 
-static void d68000_lsl_r_8(void)
+static void d68000_lsl_r_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "lsl.b   D%d, D%d", (g_cpu_ir>>9)&7, g_cpu_ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "lsl.b   D%d, D%d", (ctx->ir>>9)&7, ctx->ir&7);
 }
 
-static void d68000_lsl_r_16(void)
+static void d68000_lsl_r_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "lsl.w   D%d, D%d", (g_cpu_ir>>9)&7, g_cpu_ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "lsl.w   D%d, D%d", (ctx->ir>>9)&7, ctx->ir&7);
 }
 
-static void d68000_lsl_r_32(void)
+static void d68000_lsl_r_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "lsl.l   D%d, D%d", (g_cpu_ir>>9)&7, g_cpu_ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "lsl.l   D%d, D%d", (ctx->ir>>9)&7, ctx->ir&7);
 }
 
-static void d68000_lsl_ea(void)
+static void d68000_lsl_ea(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "lsl.w   %s", get_ea_mode_str_32(g_cpu_ir));
+	dasm_print(ctx, "lsl.w   %s", get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68000_move_8(void)
+static void d68000_move_8(m68k_dasm_context* ctx)
 {
-	char* str = get_ea_mode_str_8(g_cpu_ir);
-	sprintf(g_dasm_str, "move.b  %s, %s", str, get_ea_mode_str_8(((g_cpu_ir>>9) & 7) | ((g_cpu_ir>>3) & 0x38)));
+	char* str = get_ea_mode_str_8(ctx->ir);
+	dasm_print(ctx, "move.b  %s, %s", str, get_ea_mode_str_8(((ctx->ir>>9) & 7) | ((ctx->ir>>3) & 0x38)));
 }
 
-static void d68000_move_16(void)
+static void d68000_move_16(m68k_dasm_context* ctx)
 {
-	char* str = get_ea_mode_str_16(g_cpu_ir);
-	sprintf(g_dasm_str, "move.w  %s, %s", str, get_ea_mode_str_16(((g_cpu_ir>>9) & 7) | ((g_cpu_ir>>3) & 0x38)));
+	char* str = get_ea_mode_str_16(ctx->ir);
+	dasm_print(ctx, "move.w  %s, %s", str, get_ea_mode_str_16(((ctx->ir>>9) & 7) | ((ctx->ir>>3) & 0x38)));
 }
 
-static void d68000_move_32(void)
+static void d68000_move_32(m68k_dasm_context* ctx)
 {
-	char* str = get_ea_mode_str_32(g_cpu_ir);
-	sprintf(g_dasm_str, "move.l  %s, %s", str, get_ea_mode_str_32(((g_cpu_ir>>9) & 7) | ((g_cpu_ir>>3) & 0x38)));
+	char* str = get_ea_mode_str_32(ctx->ir);
+	dasm_print(ctx, "move.l  %s, %s", str, get_ea_mode_str_32(((ctx->ir>>9) & 7) | ((ctx->ir>>3) & 0x38)));
 }
 
-static void d68000_movea_16(void)
+static void d68000_movea_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "movea.w %s, A%d", get_ea_mode_str_16(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_print(ctx, "movea.w %s, A%d", get_ea_mode_str_16(ctx->ir), (ctx->ir>>9)&7);
+	dasm_areg((ctx->ir>>9)&7);
 }
 
-static void d68000_movea_32(void)
+static void d68000_movea_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "movea.l %s, A%d", get_ea_mode_str_32(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_print(ctx, "movea.l %s, A%d", get_ea_mode_str_32(ctx->ir), (ctx->ir>>9)&7);
+	dasm_areg((ctx->ir>>9)&7);
 }
 
-static void d68000_move_to_ccr(void)
+static void d68000_move_to_ccr(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "move    %s, CCR", get_ea_mode_str_8(g_cpu_ir));
+	dasm_print(ctx, "move    %s, CCR", get_ea_mode_str_8(ctx->ir));
+	dasm_special(M68K_DASM_OPERAND_CCR);
 }
 
-static void d68010_move_fr_ccr(void)
+static void d68010_move_fr_ccr(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68010_PLUS);
-	sprintf(g_dasm_str, "move    CCR, %s; (1+)", get_ea_mode_str_8(g_cpu_ir));
+	dasm_special(M68K_DASM_OPERAND_CCR);
+	dasm_print(ctx, "move    CCR, %s; (1+)", get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68000_move_fr_sr(void)
+static void d68000_move_fr_sr(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "move    SR, %s", get_ea_mode_str_16(g_cpu_ir));
+	dasm_special(M68K_DASM_OPERAND_SR);
+	dasm_print(ctx, "move    SR, %s", get_ea_mode_str_16(ctx->ir));
 }
 
-static void d68000_move_to_sr(void)
+static void d68000_move_to_sr(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "move    %s, SR", get_ea_mode_str_16(g_cpu_ir));
+	dasm_print(ctx, "move    %s, SR", get_ea_mode_str_16(ctx->ir));
+	dasm_special(M68K_DASM_OPERAND_SR);
 }
 
-static void d68000_move_fr_usp(void)
+static void d68000_move_fr_usp(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "move    USP, A%d", g_cpu_ir&7);
+	dasm_special(M68K_DASM_OPERAND_USP);
+	dasm_areg(ctx->ir&7);
+	dasm_print(ctx, "move    USP, A%d", ctx->ir&7);
 }
 
-static void d68000_move_to_usp(void)
+static void d68000_move_to_usp(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "move    A%d, USP", g_cpu_ir&7);
+	dasm_areg(ctx->ir&7);
+	dasm_special(M68K_DASM_OPERAND_USP);
+	dasm_print(ctx, "move    A%d, USP", ctx->ir&7);
 }
 
-static void d68010_movec(void)
+static void d68010_movec(m68k_dasm_context* ctx)
 {
 	uint extension;
 	char* reg_name;
@@ -2158,17 +2698,37 @@ static void d68010_movec(void)
 			processor = "4+";
 			break;
 		default:
-			reg_name = make_signed_hex_str_16(extension & 0xfff);
+			reg_name = make_signed_hex_str_16(ctx, extension & 0xfff);
 			processor = "?";
 	}
 
-	if(BIT_0(g_cpu_ir))
-		sprintf(g_dasm_str, "movec %c%d, %s; (%s)", BIT_F(extension) ? 'A' : 'D', (extension>>12)&7, reg_name, processor);
+	if(BIT_0(ctx->ir))
+	{
+		dasm_da_reg(BIT_F(extension), (extension>>12)&7);
+		dasm_control(extension & 0xfff);
+		dasm_print(ctx, "movec %c%d, %s; (%s)", BIT_F(extension) ? 'A' : 'D', (extension>>12)&7, reg_name, processor);
+	}
 	else
-		sprintf(g_dasm_str, "movec %s, %c%d; (%s)", reg_name, BIT_F(extension) ? 'A' : 'D', (extension>>12)&7, processor);
+	{
+		dasm_control(extension & 0xfff);
+		dasm_da_reg(BIT_F(extension), (extension>>12)&7);
+		dasm_print(ctx, "movec %s, %c%d; (%s)", reg_name, BIT_F(extension) ? 'A' : 'D', (extension>>12)&7, processor);
+	}
+}
+
+/* The predecrement form of MOVEM has its register mask reversed */
+static uint movem_pd_list(uint data)
+{
+	uint list = 0;
+	uint i;
+
+	for(i=0;i<16;i++)
+		if(data&(1<<(15-i)))
+			list |= 1<<i;
+	return list;
 }
 
-static void d68000_movem_pd_16(void)
+static void d68000_movem_pd_16(m68k_dasm_context* ctx)
 {
 	uint data = read_imm_16();
 	char buffer[40];
@@ -2213,10 +2773,11 @@ static void d68000_movem_pd_16(void)
 				sprintf(buffer+strlen(buffer), "-A%d", first + run_length);
 		}
 	}
-	sprintf(g_dasm_str, "movem.w %s, %s", buffer, get_ea_mode_str_16(g_cpu_ir));
+	dasm_reglist(movem_pd_list(data));
+	dasm_print(ctx, "movem.w %s, %s", buffer, get_ea_mode_str_16(ctx->ir));
 }
 
-static void d68000_movem_pd_32(void)
+static void d68000_movem_pd_32(m68k_dasm_context* ctx)
 {
 	uint data = read_imm_16();
 	char buffer[40];
@@ -2261,10 +2822,11 @@ static void d68000_movem_pd_32(void)
 				sprintf(buffer+strlen(buffer), "-A%d", first + run_length);
 		}
 	}
-	sprintf(g_dasm_str, "movem.l %s, %s", buffer, get_ea_mode_str_32(g_cpu_ir));
+	dasm_reglist(movem_pd_list(data));
+	dasm_print(ctx, "movem.l %s, %s", buffer, get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68000_movem_er_16(void)
+static void d68000_movem_er_16(m68k_dasm_context* ctx)
 {
 	uint data = read_imm_16();
 	char buffer[40];
@@ -2309,10 +2871,11 @@ static void d68000_movem_er_16(void)
 				sprintf(buffer+strlen(buffer), "-A%d", first + run_length);
 		}
 	}
-	sprintf(g_dasm_str, "movem.w %s, %s", get_ea_mode_str_16(g_cpu_ir), buffer);
+	dasm_print(ctx, "movem.w %s, %s", get_ea_mode_str_16(ctx->ir), buffer);
+	dasm_reglist(data);
 }
 
-static void d68000_movem_er_32(void)
+static void d68000_movem_er_32(m68k_dasm_context* ctx)
 {
 	uint data = read_imm_16();
 	char buffer[40];
@@ -2357,10 +2920,11 @@ static void d68000_movem_er_32(void)
 				sprintf(buffer+strlen(buffer), "-A%d", first + run_length);
 		}
 	}
-	sprintf(g_dasm_str, "movem.l %s, %s", get_ea_mode_str_32(g_cpu_ir), buffer);
+	dasm_print(ctx, "movem.l %s, %s", get_ea_mode_str_32(ctx->ir), buffer);
+	dasm_reglist(data);
 }
 
-static void d68000_movem_re_16(void)
+static void d68000_movem_re_16(m68k_dasm_context* ctx)
 {
 	uint data = read_imm_16();
 	char buffer[40];
@@ -2405,10 +2969,11 @@ static void d68000_movem_re_16(void)
 				sprintf(buffer+strlen(buffer), "-A%d", first + run_length);
 		}
 	}
-	sprintf(g_dasm_str, "movem.w %s, %s", buffer, get_ea_mode_str_16(g_cpu_ir));
+	dasm_reglist(data);
+	dasm_print(ctx, "movem.w %s, %s", buffer, get_ea_mode_str_16(ctx->ir));
 }
 
-static void d68000_movem_re_32(void)
+static void d68000_movem_re_32(m68k_dasm_context* ctx)
 {
 	uint data = read_imm_16();
 	char buffer[40];
@@ -2453,703 +3018,854 @@ static void d68000_movem_re_32(void)
 				sprintf(buffer+strlen(buffer), "-A%d", first + run_length);
 		}
 	}
-	sprintf(g_dasm_str, "movem.l %s, %s", buffer, get_ea_mode_str_32(g_cpu_ir));
+	dasm_reglist(data);
+	dasm_print(ctx, "movem.l %s, %s", buffer, get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68000_movep_re_16(void)
+static void d68000_movep_re_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "movep.w D%d, ($%x,A%d)", (g_cpu_ir>>9)&7, read_imm_16(), g_cpu_ir&7);
+	uint displacement = read_imm_16();
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_displacement(ctx, ctx->ir&7, displacement);
+	dasm_print(ctx, "movep.w D%d, ($%x,A%d)", (ctx->ir>>9)&7, displacement, ctx->ir&7);
 }
 
-static void d68000_movep_re_32(void)
+static void d68000_movep_re_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "movep.l D%d, ($%x,A%d)", (g_cpu_ir>>9)&7, read_imm_16(), g_cpu_ir&7);
+	uint displacement = read_imm_16();
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_displacement(ctx, ctx->ir&7, displacement);
+	dasm_print(ctx, "movep.l D%d, ($%x,A%d)", (ctx->ir>>9)&7, displacement, ctx->ir&7);
 }
 
-static void d68000_movep_er_16(void)
+static void d68000_movep_er_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "movep.w ($%x,A%d), D%d", read_imm_16(), g_cpu_ir&7, (g_cpu_ir>>9)&7);
+	uint displacement = read_imm_16();
+	dasm_displacement(ctx, ctx->ir&7, displacement);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "movep.w ($%x,A%d), D%d", displacement, ctx->ir&7, (ctx->ir>>9)&7);
 }
 
-static void d68000_movep_er_32(void)
+static void d68000_movep_er_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "movep.l ($%x,A%d), D%d", read_imm_16(), g_cpu_ir&7, (g_cpu_ir>>9)&7);
+	uint displacement = read_imm_16();
+	dasm_displacement(ctx, ctx->ir&7, displacement);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "movep.l ($%x,A%d), D%d", displacement, ctx->ir&7, (ctx->ir>>9)&7);
 }
 
-static void d68010_moves_8(void)
+static void d68010_moves_8(m68k_dasm_context* ctx)
 {
 	uint extension;
 	LIMIT_CPU_TYPES(M68010_PLUS);
 	extension = read_imm_16();
 	if(BIT_B(extension))
-		sprintf(g_dasm_str, "moves.b %c%d, %s; (1+)", BIT_F(extension) ? 'A' : 'D', (extension>>12)&7, get_ea_mode_str_8(g_cpu_ir));
+	{
+		dasm_da_reg(BIT_F(extension), (extension>>12)&7);
+		dasm_print(ctx, "moves.b %c%d, %s; (1+)", BIT_F(extension) ? 'A' : 'D', (extension>>12)&7, get_ea_mode_str_8(ctx->ir));
+	}
 	else
-		sprintf(g_dasm_str, "moves.b %s, %c%d; (1+)", get_ea_mode_str_8(g_cpu_ir), BIT_F(extension) ? 'A' : 'D', (extension>>12)&7);
+	{
+		dasm_print(ctx, "moves.b %s, %c%d; (1+)", get_ea_mode_str_8(ctx->ir), BIT_F(extension) ? 'A' : 'D', (extension>>12)&7);
+		dasm_da_reg(BIT_F(extension), (extension>>12)&7);
+	}
 }
 
-static void d68010_moves_16(void)
+static void d68010_moves_16(m68k_dasm_context* ctx)
 {
 	uint extension;
 	LIMIT_CPU_TYPES(M68010_PLUS);
 	extension = read_imm_16();
 	if(BIT_B(extension))
-		sprintf(g_dasm_str, "moves.w %c%d, %s; (1+)", BIT_F(extension) ? 'A' : 'D', (extension>>12)&7, get_ea_mode_str_16(g_cpu_ir));
+	{
+		dasm_da_reg(BIT_F(extension), (extension>>12)&7);
+		dasm_print(ctx, "moves.w %c%d, %s; (1+)", BIT_F(extension) ? 'A' : 'D', (extension>>12)&7, get_ea_mode_str_16(ctx->ir));
+	}
 	else
-		sprintf(g_dasm_str, "moves.w %s, %c%d; (1+)", get_ea_mode_str_16(g_cpu_ir), BIT_F(extension) ? 'A' : 'D', (extension>>12)&7);
+	{
+		dasm_print(ctx, "moves.w %s, %c%d; (1+)", get_ea_mode_str_16(ctx->ir), BIT_F(extension) ? 'A' : 'D', (extension>>12)&7);
+		dasm_da_reg(BIT_F(extension), (extension>>12)&7);
+	}
 }
 
-static void d68010_moves_32(void)
+static void d68010_moves_32(m68k_dasm_context* ctx)
 {
 	uint extension;
 	LIMIT_CPU_TYPES(M68010_PLUS);
 	extension = read_imm_16();
 	if(BIT_B(extension))
-		sprintf(g_dasm_str, "moves.l %c%d, %s; (1+)", BIT_F(extension) ? 'A' : 'D', (extension>>12)&7, get_ea_mode_str_32(g_cpu_ir));
+	{
+		dasm_da_reg(BIT_F(extension), (extension>>12)&7);
+		dasm_print(ctx, "moves.l %c%d, %s; (1+)", BIT_F(extension) ? 'A' : 'D', (extension>>12)&7, get_ea_mode_str_32(ctx->ir));
+	}
 	else
-		sprintf(g_dasm_str, "moves.l %s, %c%d; (1+)", get_ea_mode_str_32(g_cpu_ir), BIT_F(extension) ? 'A' : 'D', (extension>>12)&7);
+	{
+		dasm_print(ctx, "moves.l %s, %c%d; (1+)", get_ea_mode_str_32(ctx->ir), BIT_F(extension) ? 'A' : 'D', (extension>>12)&7);
+		dasm_da_reg(BIT_F(extension), (extension>>12)&7);
+	}
 }
 
-static void d68000_moveq(void)
+static void d68000_moveq(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "moveq   #%s, D%d", make_signed_hex_str_8(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_imm(make_int_8(ctx->ir));
+	dasm_print(ctx, "moveq   #%s, D%d", make_signed_hex_str_8(ctx, ctx->ir), (ctx->ir>>9)&7);
+	dasm_dreg((ctx->ir>>9)&7);
 }
 
-static void d68040_move16_pi_pi(void)
+static void d68040_move16_pi_pi(m68k_dasm_context* ctx)
 {
+	uint extension;
 	LIMIT_CPU_TYPES(M68040_PLUS);
-	sprintf(g_dasm_str, "move16  (A%d)+, (A%d)+; (4)", g_cpu_ir&7, (read_imm_16()>>12)&7);
+	extension = read_imm_16();
+	dasm_pi(ctx->ir&7);
+	dasm_pi((extension>>12)&7);
+	dasm_print(ctx, "move16  (A%d)+, (A%d)+; (4)", ctx->ir&7, (extension>>12)&7);
 }
 
-static void d68040_move16_pi_al(void)
+static void d68040_move16_pi_al(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68040_PLUS);
-	sprintf(g_dasm_str, "move16  (A%d)+, %s; (4)", g_cpu_ir&7, get_imm_str_u32());
+	dasm_pi(ctx->ir&7);
+	dasm_print(ctx, "move16  (A%d)+, %s; (4)", ctx->ir&7, get_imm_str_u32());
 }
 
-static void d68040_move16_al_pi(void)
+static void d68040_move16_al_pi(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68040_PLUS);
-	sprintf(g_dasm_str, "move16  %s, (A%d)+; (4)", get_imm_str_u32(), g_cpu_ir&7);
+	dasm_print(ctx, "move16  %s, (A%d)+; (4)", get_imm_str_u32(), ctx->ir&7);
+	dasm_pi(ctx->ir&7);
 }
 
-static void d68040_move16_ai_al(void)
+static void d68040_move16_ai_al(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68040_PLUS);
-	sprintf(g_dasm_str, "move16  (A%d), %s; (4)", g_cpu_ir&7, get_imm_str_u32());
+	dasm_ai(ctx->ir&7);
+	dasm_print(ctx, "move16  (A%d), %s; (4)", ctx->ir&7, get_imm_str_u32());
 }
 
-static void d68040_move16_al_ai(void)
+static void d68040_move16_al_ai(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68040_PLUS);
-	sprintf(g_dasm_str, "move16  %s, (A%d); (4)", get_imm_str_u32(), g_cpu_ir&7);
+	dasm_print(ctx, "move16  %s, (A%d); (4)", get_imm_str_u32(), ctx->ir&7);
+	dasm_ai(ctx->ir&7);
 }
 
-static void d68000_muls(void)
+static void d68000_muls(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "muls.w  %s, D%d", get_ea_mode_str_16(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_print(ctx, "muls.w  %s, D%d", get_ea_mode_str_16(ctx->ir), (ctx->ir>>9)&7);
+	dasm_dreg((ctx->ir>>9)&7);
 }
 
-static void d68000_mulu(void)
+static void d68000_mulu(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "mulu.w  %s, D%d", get_ea_mode_str_16(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_print(ctx, "mulu.w  %s, D%d", get_ea_mode_str_16(ctx->ir), (ctx->ir>>9)&7);
+	dasm_dreg((ctx->ir>>9)&7);
 }
 
-static void d68020_mull(void)
+static void d68020_mull(m68k_dasm_context* ctx)
 {
 	uint extension;
 	LIMIT_CPU_TYPES(M68020_PLUS);
 	extension = read_imm_16();
 
+	if(BIT_B(extension))
+		ctx->insn->mnemonic = M68K_INSN_MULS;
 	if(BIT_A(extension))
-		sprintf(g_dasm_str, "mul%c.l %s, D%d:D%d; (2+)", BIT_B(extension) ? 's' : 'u', get_ea_mode_str_32(g_cpu_ir), extension&7, (extension>>12)&7);
+	{
+		dasm_print(ctx, "mul%c.l %s, D%d:D%d; (2+)", BIT_B(extension) ? 's' : 'u', get_ea_mode_str_32(ctx->ir), extension&7, (extension>>12)&7);
+		dasm_regpair(ctx, extension&7, (extension>>12)&7);
+	}
 	else
-		sprintf(g_dasm_str, "mul%c.l  %s, D%d; (2+)", BIT_B(extension) ? 's' : 'u', get_ea_mode_str_32(g_cpu_ir), (extension>>12)&7);
+	{
+		dasm_print(ctx, "mul%c.l  %s, D%d; (2+)", BIT_B(extension) ? 's' : 'u', get_ea_mode_str_32(ctx->ir), (extension>>12)&7);
+		dasm_dreg((extension>>12)&7);
+	}
 }
 
-static void d68000_nbcd(void)
+static void d68000_nbcd(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "nbcd    %s", get_ea_mode_str_8(g_cpu_ir));
+	dasm_print(ctx, "nbcd    %s", get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68000_neg_8(void)
+static void d68000_neg_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "neg.b   %s", get_ea_mode_str_8(g_cpu_ir));
+	dasm_print(ctx, "neg.b   %s", get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68000_neg_16(void)
+static void d68000_neg_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "neg.w   %s", get_ea_mode_str_16(g_cpu_ir));
+	dasm_print(ctx, "neg.w   %s", get_ea_mode_str_16(ctx->ir));
 }
 
-static void d68000_neg_32(void)
+static void d68000_neg_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "neg.l   %s", get_ea_mode_str_32(g_cpu_ir));
+	dasm_print(ctx, "neg.l   %s", get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68000_negx_8(void)
+static void d68000_negx_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "negx.b  %s", get_ea_mode_str_8(g_cpu_ir));
+	dasm_print(ctx, "negx.b  %s", get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68000_negx_16(void)
+static void d68000_negx_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "negx.w  %s", get_ea_mode_str_16(g_cpu_ir));
+	dasm_print(ctx, "negx.w  %s", get_ea_mode_str_16(ctx->ir));
 }
 
-static void d68000_negx_32(void)
+static void d68000_negx_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "negx.l  %s", get_ea_mode_str_32(g_cpu_ir));
+	dasm_print(ctx, "negx.l  %s", get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68000_nop(void)
+static void d68000_nop(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "nop");
+	dasm_print(ctx, "nop");
 }
 
-static void d68000_not_8(void)
+static void d68000_not_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "not.b   %s", get_ea_mode_str_8(g_cpu_ir));
+	dasm_print(ctx, "not.b   %s", get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68000_not_16(void)
+static void d68000_not_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "not.w   %s", get_ea_mode_str_16(g_cpu_ir));
+	dasm_print(ctx, "not.w   %s", get_ea_mode_str_16(ctx->ir));
 }
 
-static void d68000_not_32(void)
+static void d68000_not_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "not.l   %s", get_ea_mode_str_32(g_cpu_ir));
+	dasm_print(ctx, "not.l   %s", get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68000_or_er_8(void)
+static void d68000_or_er_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "or.b    %s, D%d", get_ea_mode_str_8(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_print(ctx, "or.b    %s, D%d", get_ea_mode_str_8(ctx->ir), (ctx->ir>>9)&7);
+	dasm_dreg((ctx->ir>>9)&7);
 }
 
-static void d68000_or_er_16(void)
+static void d68000_or_er_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "or.w    %s, D%d", get_ea_mode_str_16(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_print(ctx, "or.w    %s, D%d", get_ea_mode_str_16(ctx->ir), (ctx->ir>>9)&7);
+	dasm_dreg((ctx->ir>>9)&7);
 }
 
-static void d68000_or_er_32(void)
+static void d68000_or_er_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "or.l    %s, D%d", get_ea_mode_str_32(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_print(ctx, "or.l    %s, D%d", get_ea_mode_str_32(ctx->ir), (ctx->ir>>9)&7);
+	dasm_dreg((ctx->ir>>9)&7);
 }
 
-static void d68000_or_re_8(void)
+static void d68000_or_re_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "or.b    D%d, %s", (g_cpu_ir>>9)&7, get_ea_mode_str_8(g_cpu_ir));
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "or.b    D%d, %s", (ctx->ir>>9)&7, get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68000_or_re_16(void)
+static void d68000_or_re_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "or.w    D%d, %s", (g_cpu_ir>>9)&7, get_ea_mode_str_16(g_cpu_ir));
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "or.w    D%d, %s", (ctx->ir>>9)&7, get_ea_mode_str_16(ctx->ir));
 }
 
-static void d68000_or_re_32(void)
+static void d68000_or_re_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "or.l    D%d, %s", (g_cpu_ir>>9)&7, get_ea_mode_str_32(g_cpu_ir));
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "or.l    D%d, %s", (ctx->ir>>9)&7, get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68000_ori_8(void)
+static void d68000_ori_8(m68k_dasm_context* ctx)
 {
 	char* str = get_imm_str_u8();
-	sprintf(g_dasm_str, "ori.b   %s, %s", str, get_ea_mode_str_8(g_cpu_ir));
+	dasm_print(ctx, "ori.b   %s, %s", str, get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68000_ori_16(void)
+static void d68000_ori_16(m68k_dasm_context* ctx)
 {
 	char* str = get_imm_str_u16();
-	sprintf(g_dasm_str, "ori.w   %s, %s", str, get_ea_mode_str_16(g_cpu_ir));
+	dasm_print(ctx, "ori.w   %s, %s", str, get_ea_mode_str_16(ctx->ir));
 }
 
-static void d68000_ori_32(void)
+static void d68000_ori_32(m68k_dasm_context* ctx)
 {
 	char* str = get_imm_str_u32();
-	sprintf(g_dasm_str, "ori.l   %s, %s", str, get_ea_mode_str_32(g_cpu_ir));
+	dasm_print(ctx, "ori.l   %s, %s", str, get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68000_ori_to_ccr(void)
+static void d68000_ori_to_ccr(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "ori     %s, CCR", get_imm_str_u8());
+	dasm_print(ctx, "ori     %s, CCR", get_imm_str_u8());
+	dasm_special(M68K_DASM_OPERAND_CCR);
 }
 
-static void d68000_ori_to_sr(void)
+static void d68000_ori_to_sr(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "ori     %s, SR", get_imm_str_u16());
+	dasm_print(ctx, "ori     %s, SR", get_imm_str_u16());
+	dasm_special(M68K_DASM_OPERAND_SR);
 }
 
-static void d68020_pack_rr(void)
+static void d68020_pack_rr(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68020_PLUS);
-	sprintf(g_dasm_str, "pack    D%d, D%d, %s; (2+)", g_cpu_ir&7, (g_cpu_ir>>9)&7, get_imm_str_u16());
+	dasm_dreg(ctx->ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "pack    D%d, D%d, %s; (2+)", ctx->ir&7, (ctx->ir>>9)&7, get_imm_str_u16());
 }
 
-static void d68020_pack_mm(void)
+static void d68020_pack_mm(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68020_PLUS);
-	sprintf(g_dasm_str, "pack    -(A%d), -(A%d), %s; (2+)", g_cpu_ir&7, (g_cpu_ir>>9)&7, get_imm_str_u16());
+	dasm_pd(ctx->ir&7);
+	dasm_pd((ctx->ir>>9)&7);
+	dasm_print(ctx, "pack    -(A%d), -(A%d), %s; (2+)", ctx->ir&7, (ctx->ir>>9)&7, get_imm_str_u16());
 }
 
-static void d68000_pea(void)
+static void d68000_pea(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "pea     %s", get_ea_mode_str_32(g_cpu_ir));
+	dasm_print(ctx, "pea     %s", get_ea_mode_str_32(ctx->ir));
 }
 
 // this is a 68040-specific form of PFLUSH
-static void d68040_pflush(void)
+static void d68040_pflush(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68040_PLUS);
 
-	if (g_cpu_ir & 0x10)
+	if (ctx->ir & 0x10)
 	{
-		sprintf(g_dasm_str, "pflusha%s", (g_cpu_ir & 8) ? "" : "n");
+		dasm_print(ctx, "pflusha%s", (ctx->ir & 8) ? "" : "n");
 	}
 	else
 	{
-		sprintf(g_dasm_str, "pflush%s(A%d)", (g_cpu_ir & 8) ? "" : "n", g_cpu_ir & 7);
+		dasm_ai(ctx->ir & 7);
+		dasm_print(ctx, "pflush%s(A%d)", (ctx->ir & 8) ? "" : "n", ctx->ir & 7);
 	}
 }
 
-static void d68000_reset(void)
+static void d68000_reset(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "reset");
+	dasm_print(ctx, "reset");
 }
 
-static void d68000_ror_s_8(void)
+static void d68000_ror_s_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "ror.b   #%d, D%d", g_3bit_qdata_table[(g_cpu_ir>>9)&7], g_cpu_ir&7);
+	dasm_imm(g_3bit_qdata_table[(ctx->ir>>9)&7]);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "ror.b   #%d, D%d", g_3bit_qdata_table[(ctx->ir>>9)&7], ctx->ir&7);
 }
 
-static void d68000_ror_s_16(void)
+static void d68000_ror_s_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "ror.w   #%d, D%d", g_3bit_qdata_table[(g_cpu_ir>>9)&7],g_cpu_ir&7);
+	dasm_imm(g_3bit_qdata_table[(ctx->ir>>9)&7]);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "ror.w   #%d, D%d", g_3bit_qdata_table[(ctx->ir>>9)&7], ctx->ir&7);
 }
 
-static void d68000_ror_s_32(void)
+static void d68000_ror_s_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "ror.l   #%d, D%d", g_3bit_qdata_table[(g_cpu_ir>>9)&7], g_cpu_ir&7);
+	dasm_imm(g_3bit_qdata_table[(ctx->ir>>9)&7]);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "ror.l   #%d, D%d", g_3bit_qdata_table[(ctx->ir>>9)&7], ctx->ir&7);
 }
 
-static void d68000_ror_r_8(void)
+static void d68000_ror_r_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "ror.b   D%d, D%d", (g_cpu_ir>>9)&7, g_cpu_ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "ror.b   D%d, D%d", (ctx->ir>>9)&7, ctx->ir&7);
 }
 
-static void d68000_ror_r_16(void)
+static void d68000_ror_r_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "ror.w   D%d, D%d", (g_cpu_ir>>9)&7, g_cpu_ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "ror.w   D%d, D%d", (ctx->ir>>9)&7, ctx->ir&7);
 }
 
-static void d68000_ror_r_32(void)
+static void d68000_ror_r_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "ror.l   D%d, D%d", (g_cpu_ir>>9)&7, g_cpu_ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "ror.l   D%d, D%d", (ctx->ir>>9)&7, ctx->ir&7);
 }
 
-static void d68000_ror_ea(void)
+static void d68000_ror_ea(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "ror.w   %s", get_ea_mode_str_32(g_cpu_ir));
+	dasm_print(ctx, "ror.w   %s", get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68000_rol_s_8(void)
+static void d68000_rol_s_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "rol.b   #%d, D%d", g_3bit_qdata_table[(g_cpu_ir>>9)&7], g_cpu_ir&7);
+	dasm_imm(g_3bit_qdata_table[(ctx->ir>>9)&7]);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "rol.b   #%d, D%d", g_3bit_qdata_table[(ctx->ir>>9)&7], ctx->ir&7);
 }
 
-static void d68000_rol_s_16(void)
+static void d68000_rol_s_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "rol.w   #%d, D%d", g_3bit_qdata_table[(g_cpu_ir>>9)&7], g_cpu_ir&7);
+	dasm_imm(g_3bit_qdata_table[(ctx->ir>>9)&7]);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "rol.w   #%d, D%d", g_3bit_qdata_table[(ctx->ir>>9)&7], ctx->ir&7);
 }
 
-static void d68000_rol_s_32(void)
+static void d68000_rol_s_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "rol.l   #%d, D%d", g_3bit_qdata_table[(g_cpu_ir>>9)&7], g_cpu_ir&7);
+	dasm_imm(g_3bit_qdata_table[(ctx->ir>>9)&7]);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "rol.l   #%d, D%d", g_3bit_qdata_table[(ctx->ir>>9)&7], ctx->ir&7);
 }
 
-static void d68000_rol_r_8(void)
+static void d68000_rol_r_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "rol.b   D%d, D%d", (g_cpu_ir>>9)&7, g_cpu_ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "rol.b   D%d, D%d", (ctx->ir>>9)&7, ctx->ir&7);
 }
 
-static void d68000_rol_r_16(void)
+static void d68000_rol_r_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "rol.w   D%d, D%d", (g_cpu_ir>>9)&7, g_cpu_ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "rol.w   D%d, D%d", (ctx->ir>>9)&7, ctx->ir&7);
 }
 
-static void d68000_rol_r_32(void)
+static void d68000_rol_r_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "rol.l   D%d, D%d", (g_cpu_ir>>9)&7, g_cpu_ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "rol.l   D%d, D%d", (ctx->ir>>9)&7, ctx->ir&7);
 }
 
-static void d68000_rol_ea(void)
+static void d68000_rol_ea(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "rol.w   %s", get_ea_mode_str_32(g_cpu_ir));
+	dasm_print(ctx, "rol.w   %s", get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68000_roxr_s_8(void)
+static void d68000_roxr_s_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "roxr.b  #%d, D%d", g_3bit_qdata_table[(g_cpu_ir>>9)&7], g_cpu_ir&7);
+	dasm_imm(g_3bit_qdata_table[(ctx->ir>>9)&7]);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "roxr.b  #%d, D%d", g_3bit_qdata_table[(ctx->ir>>9)&7], ctx->ir&7);
 }
 
-static void d68000_roxr_s_16(void)
+static void d68000_roxr_s_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "roxr.w  #%d, D%d", g_3bit_qdata_table[(g_cpu_ir>>9)&7], g_cpu_ir&7);
+	dasm_imm(g_3bit_qdata_table[(ctx->ir>>9)&7]);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "roxr.w  #%d, D%d", g_3bit_qdata_table[(ctx->ir>>9)&7], ctx->ir&7);
 }
 
 
-static void d68000_roxr_s_32(void)
+static void d68000_roxr_s_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "roxr.l  #%d, D%d", g_3bit_qdata_table[(g_cpu_ir>>9)&7], g_cpu_ir&7);
+	dasm_imm(g_3bit_qdata_table[(ctx->ir>>9)&7]);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "roxr.l  #%d, D%d", g_3bit_qdata_table[(ctx->ir>>9)&7], ctx->ir&7);
 }
 
-static void d68000_roxr_r_8(void)
+static void d68000_roxr_r_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "roxr.b  D%d, D%d", (g_cpu_ir>>9)&7, g_cpu_ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "roxr.b  D%d, D%d", (ctx->ir>>9)&7, ctx->ir&7);
 }
 
-static void d68000_roxr_r_16(void)
+static void d68000_roxr_r_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "roxr.w  D%d, D%d", (g_cpu_ir>>9)&7, g_cpu_ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "roxr.w  D%d, D%d", (ctx->ir>>9)&7, ctx->ir&7);
 }
 
-static void d68000_roxr_r_32(void)
+static void d68000_roxr_r_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "roxr.l  D%d, D%d", (g_cpu_ir>>9)&7, g_cpu_ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "roxr.l  D%d, D%d", (ctx->ir>>9)&7, ctx->ir&7);
 }
 
-static void d68000_roxr_ea(void)
+static void d68000_roxr_ea(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "roxr.w  %s", get_ea_mode_str_32(g_cpu_ir));
+	dasm_print(ctx, "roxr.w  %s", get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68000_roxl_s_8(void)
+static void d68000_roxl_s_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "roxl.b  #%d, D%d", g_3bit_qdata_table[(g_cpu_ir>>9)&7], g_cpu_ir&7);
+	dasm_imm(g_3bit_qdata_table[(ctx->ir>>9)&7]);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "roxl.b  #%d, D%d", g_3bit_qdata_table[(ctx->ir>>9)&7], ctx->ir&7);
 }
 
-static void d68000_roxl_s_16(void)
+static void d68000_roxl_s_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "roxl.w  #%d, D%d", g_3bit_qdata_table[(g_cpu_ir>>9)&7], g_cpu_ir&7);
+	dasm_imm(g_3bit_qdata_table[(ctx->ir>>9)&7]);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "roxl.w  #%d, D%d", g_3bit_qdata_table[(ctx->ir>>9)&7], ctx->ir&7);
 }
 
-static void d68000_roxl_s_32(void)
+static void d68000_roxl_s_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "roxl.l  #%d, D%d", g_3bit_qdata_table[(g_cpu_ir>>9)&7], g_cpu_ir&7);
+	dasm_imm(g_3bit_qdata_table[(ctx->ir>>9)&7]);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "roxl.l  #%d, D%d", g_3bit_qdata_table[(ctx->ir>>9)&7], ctx->ir&7);
 }
 
-static void d68000_roxl_r_8(void)
+static void d68000_roxl_r_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "roxl.b  D%d, D%d", (g_cpu_ir>>9)&7, g_cpu_ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "roxl.b  D%d, D%d", (ctx->ir>>9)&7, ctx->ir&7);
 }
 
-static void d68000_roxl_r_16(void)
+static void d68000_roxl_r_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "roxl.w  D%d, D%d", (g_cpu_ir>>9)&7, g_cpu_ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "roxl.w  D%d, D%d", (ctx->ir>>9)&7, ctx->ir&7);
 }
 
-static void d68000_roxl_r_32(void)
+static void d68000_roxl_r_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "roxl.l  D%d, D%d", (g_cpu_ir>>9)&7, g_cpu_ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "roxl.l  D%d, D%d", (ctx->ir>>9)&7, ctx->ir&7);
 }
 
-static void d68000_roxl_ea(void)
+static void d68000_roxl_ea(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "roxl.w  %s", get_ea_mode_str_32(g_cpu_ir));
+	dasm_print(ctx, "roxl.w  %s", get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68010_rtd(void)
+static void d68010_rtd(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68010_PLUS);
-	sprintf(g_dasm_str, "rtd     %s; (1+)", get_imm_str_s16());
+	dasm_print(ctx, "rtd     %s; (1+)", get_imm_str_s16());
 	SET_OPCODE_FLAGS(DASMFLAG_STEP_OUT);
 }
 
-static void d68000_rte(void)
+static void d68000_rte(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "rte");
+	dasm_print(ctx, "rte");
 	SET_OPCODE_FLAGS(DASMFLAG_STEP_OUT);
 }
 
-static void d68020_rtm(void)
+static void d68020_rtm(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68020_ONLY);
-	sprintf(g_dasm_str, "rtm     %c%d; (2+)", BIT_3(g_cpu_ir) ? 'A' : 'D', g_cpu_ir&7);
+	dasm_da_reg(BIT_3(ctx->ir), ctx->ir&7);
+	dasm_print(ctx, "rtm     %c%d; (2+)", BIT_3(ctx->ir) ? 'A' : 'D', ctx->ir&7);
 	SET_OPCODE_FLAGS(DASMFLAG_STEP_OUT);
 }
 
-static void d68000_rtr(void)
+static void d68000_rtr(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "rtr");
+	dasm_print(ctx, "rtr");
 	SET_OPCODE_FLAGS(DASMFLAG_STEP_OUT);
 }
 
-static void d68000_rts(void)
+static void d68000_rts(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "rts");
+	dasm_print(ctx, "rts");
 	SET_OPCODE_FLAGS(DASMFLAG_STEP_OUT);
 }
 
-static void d68000_sbcd_rr(void)
+static void d68000_sbcd_rr(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "sbcd    D%d, D%d", g_cpu_ir&7, (g_cpu_ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "sbcd    D%d, D%d", ctx->ir&7, (ctx->ir>>9)&7);
 }
 
-static void d68000_sbcd_mm(void)
+static void d68000_sbcd_mm(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "sbcd    -(A%d), -(A%d)", g_cpu_ir&7, (g_cpu_ir>>9)&7);
+	dasm_pd(ctx->ir&7);
+	dasm_pd((ctx->ir>>9)&7);
+	dasm_print(ctx, "sbcd    -(A%d), -(A%d)", ctx->ir&7, (ctx->ir>>9)&7);
 }
 
-static void d68000_scc(void)
+static void d68000_scc(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "s%-2s     %s", g_cc[(g_cpu_ir>>8)&0xf], get_ea_mode_str_8(g_cpu_ir));
+	ctx->insn->condition = (ctx->ir>>8)&0xf;
+	dasm_print(ctx, "s%-2s     %s", g_cc[(ctx->ir>>8)&0xf], get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68000_stop(void)
+static void d68000_stop(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "stop    %s", get_imm_str_s16());
+	dasm_print(ctx, "stop    %s", get_imm_str_s16());
 }
 
-static void d68000_sub_er_8(void)
+static void d68000_sub_er_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "sub.b   %s, D%d", get_ea_mode_str_8(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_print(ctx, "sub.b   %s, D%d", get_ea_mode_str_8(ctx->ir), (ctx->ir>>9)&7);
+	dasm_dreg((ctx->ir>>9)&7);
 }
 
-static void d68000_sub_er_16(void)
+static void d68000_sub_er_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "sub.w   %s, D%d", get_ea_mode_str_16(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_print(ctx, "sub.w   %s, D%d", get_ea_mode_str_16(ctx->ir), (ctx->ir>>9)&7);
+	dasm_dreg((ctx->ir>>9)&7);
 }
 
-static void d68000_sub_er_32(void)
+static void d68000_sub_er_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "sub.l   %s, D%d", get_ea_mode_str_32(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_print(ctx, "sub.l   %s, D%d", get_ea_mode_str_32(ctx->ir), (ctx->ir>>9)&7);
+	dasm_dreg((ctx->ir>>9)&7);
 }
 
-static void d68000_sub_re_8(void)
+static void d68000_sub_re_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "sub.b   D%d, %s", (g_cpu_ir>>9)&7, get_ea_mode_str_8(g_cpu_ir));
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "sub.b   D%d, %s", (ctx->ir>>9)&7, get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68000_sub_re_16(void)
+static void d68000_sub_re_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "sub.w   D%d, %s", (g_cpu_ir>>9)&7, get_ea_mode_str_16(g_cpu_ir));
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "sub.w   D%d, %s", (ctx->ir>>9)&7, get_ea_mode_str_16(ctx->ir));
 }
 
-static void d68000_sub_re_32(void)
+static void d68000_sub_re_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "sub.l   D%d, %s", (g_cpu_ir>>9)&7, get_ea_mode_str_32(g_cpu_ir));
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "sub.l   D%d, %s", (ctx->ir>>9)&7, get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68000_suba_16(void)
+static void d68000_suba_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "suba.w  %s, A%d", get_ea_mode_str_16(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_print(ctx, "suba.w  %s, A%d", get_ea_mode_str_16(ctx->ir), (ctx->ir>>9)&7);
+	dasm_areg((ctx->ir>>9)&7);
 }
 
-static void d68000_suba_32(void)
+static void d68000_suba_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "suba.l  %s, A%d", get_ea_mode_str_32(g_cpu_ir), (g_cpu_ir>>9)&7);
+	dasm_print(ctx, "suba.l  %s, A%d", get_ea_mode_str_32(ctx->ir), (ctx->ir>>9)&7);
+	dasm_areg((ctx->ir>>9)&7);
 }
 
-static void d68000_subi_8(void)
+static void d68000_subi_8(m68k_dasm_context* ctx)
 {
 	char* str = get_imm_str_s8();
-	sprintf(g_dasm_str, "subi.b  %s, %s", str, get_ea_mode_str_8(g_cpu_ir));
+	dasm_print(ctx, "subi.b  %s, %s", str, get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68000_subi_16(void)
+static void d68000_subi_16(m68k_dasm_context* ctx)
 {
 	char* str = get_imm_str_s16();
-	sprintf(g_dasm_str, "subi.w  %s, %s", str, get_ea_mode_str_16(g_cpu_ir));
+	dasm_print(ctx, "subi.w  %s, %s", str, get_ea_mode_str_16(ctx->ir));
 }
 
-static void d68000_subi_32(void)
+static void d68000_subi_32(m68k_dasm_context* ctx)
 {
 	char* str = get_imm_str_s32();
-	sprintf(g_dasm_str, "subi.l  %s, %s", str, get_ea_mode_str_32(g_cpu_ir));
+	dasm_print(ctx, "subi.l  %s, %s", str, get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68000_subq_8(void)
+static void d68000_subq_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "subq.b  #%d, %s", g_3bit_qdata_table[(g_cpu_ir>>9)&7], get_ea_mode_str_8(g_cpu_ir));
+	dasm_imm(g_3bit_qdata_table[(ctx->ir>>9)&7]);
+	dasm_print(ctx, "subq.b  #%d, %s", g_3bit_qdata_table[(ctx->ir>>9)&7], get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68000_subq_16(void)
+static void d68000_subq_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "subq.w  #%d, %s", g_3bit_qdata_table[(g_cpu_ir>>9)&7], get_ea_mode_str_16(g_cpu_ir));
+	dasm_imm(g_3bit_qdata_table[(ctx->ir>>9)&7]);
+	dasm_print(ctx, "subq.w  #%d, %s", g_3bit_qdata_table[(ctx->ir>>9)&7], get_ea_mode_str_16(ctx->ir));
 }
 
-static void d68000_subq_32(void)
+static void d68000_subq_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "subq.l  #%d, %s", g_3bit_qdata_table[(g_cpu_ir>>9)&7], get_ea_mode_str_32(g_cpu_ir));
+	dasm_imm(g_3bit_qdata_table[(ctx->ir>>9)&7]);
+	dasm_print(ctx, "subq.l  #%d, %s", g_3bit_qdata_table[(ctx->ir>>9)&7], get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68000_subx_rr_8(void)
+static void d68000_subx_rr_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "subx.b  D%d, D%d", g_cpu_ir&7, (g_cpu_ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "subx.b  D%d, D%d", ctx->ir&7, (ctx->ir>>9)&7);
 }
 
-static void d68000_subx_rr_16(void)
+static void d68000_subx_rr_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "subx.w  D%d, D%d", g_cpu_ir&7, (g_cpu_ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "subx.w  D%d, D%d", ctx->ir&7, (ctx->ir>>9)&7);
 }
 
-static void d68000_subx_rr_32(void)
+static void d68000_subx_rr_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "subx.l  D%d, D%d", g_cpu_ir&7, (g_cpu_ir>>9)&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "subx.l  D%d, D%d", ctx->ir&7, (ctx->ir>>9)&7);
 }
 
-static void d68000_subx_mm_8(void)
+static void d68000_subx_mm_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "subx.b  -(A%d), -(A%d)", g_cpu_ir&7, (g_cpu_ir>>9)&7);
+	dasm_pd(ctx->ir&7);
+	dasm_pd((ctx->ir>>9)&7);
+	dasm_print(ctx, "subx.b  -(A%d), -(A%d)", ctx->ir&7, (ctx->ir>>9)&7);
 }
 
-static void d68000_subx_mm_16(void)
+static void d68000_subx_mm_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "subx.w  -(A%d), -(A%d)", g_cpu_ir&7, (g_cpu_ir>>9)&7);
+	dasm_pd(ctx->ir&7);
+	dasm_pd((ctx->ir>>9)&7);
+	dasm_print(ctx, "subx.w  -(A%d), -(A%d)", ctx->ir&7, (ctx->ir>>9)&7);
 }
 
-static void d68000_subx_mm_32(void)
+static void d68000_subx_mm_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "subx.l  -(A%d), -(A%d)", g_cpu_ir&7, (g_cpu_ir>>9)&7);
+	dasm_pd(ctx->ir&7);
+	dasm_pd((ctx->ir>>9)&7);
+	dasm_print(ctx, "subx.l  -(A%d), -(A%d)", ctx->ir&7, (ctx->ir>>9)&7);
 }
 
-static void d68000_swap(void)
+static void d68000_swap(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "swap    D%d", g_cpu_ir&7);
+	dasm_dreg(ctx->ir&7);
+	dasm_print(ctx, "swap    D%d", ctx->ir&7);
 }
 
-static void d68000_tas(void)
+static void d68000_tas(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "tas     %s", get_ea_mode_str_8(g_cpu_ir));
+	dasm_print(ctx, "tas     %s", get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68000_trap(void)
+static void d68000_trap(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "trap    #$%x", g_cpu_ir&0xf);
+	dasm_imm(ctx->ir&0xf);
+	dasm_print(ctx, "trap    #$%x", ctx->ir&0xf);
 }
 
-static void d68020_trapcc_0(void)
+static void d68020_trapcc_0(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68020_PLUS);
-	sprintf(g_dasm_str, "trap%-2s; (2+)", g_cc[(g_cpu_ir>>8)&0xf]);
+	ctx->insn->condition = (ctx->ir>>8)&0xf;
+	dasm_print(ctx, "trap%-2s; (2+)", g_cc[(ctx->ir>>8)&0xf]);
 	SET_OPCODE_FLAGS(DASMFLAG_STEP_OVER);
 }
 
-static void d68020_trapcc_16(void)
+static void d68020_trapcc_16(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68020_PLUS);
-	sprintf(g_dasm_str, "trap%-2s  %s; (2+)", g_cc[(g_cpu_ir>>8)&0xf], get_imm_str_u16());
+	ctx->insn->condition = (ctx->ir>>8)&0xf;
+	dasm_print(ctx, "trap%-2s  %s; (2+)", g_cc[(ctx->ir>>8)&0xf], get_imm_str_u16());
 	SET_OPCODE_FLAGS(DASMFLAG_STEP_OVER);
 }
 
-static void d68020_trapcc_32(void)
+static void d68020_trapcc_32(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68020_PLUS);
-	sprintf(g_dasm_str, "trap%-2s  %s; (2+)", g_cc[(g_cpu_ir>>8)&0xf], get_imm_str_u32());
+	ctx->insn->condition = (ctx->ir>>8)&0xf;
+	dasm_print(ctx, "trap%-2s  %s; (2+)", g_cc[(ctx->ir>>8)&0xf], get_imm_str_u32());
 	SET_OPCODE_FLAGS(DASMFLAG_STEP_OVER);
 }
 
-static void d68000_trapv(void)
+static void d68000_trapv(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "trapv");
+	dasm_print(ctx, "trapv");
 	SET_OPCODE_FLAGS(DASMFLAG_STEP_OVER);
 }
 
-static void d68000_tst_8(void)
+static void d68000_tst_8(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "tst.b   %s", get_ea_mode_str_8(g_cpu_ir));
+	dasm_print(ctx, "tst.b   %s", get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68020_tst_pcdi_8(void)
+static void d68020_tst_pcdi_8(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68020_PLUS);
-	sprintf(g_dasm_str, "tst.b   %s; (2+)", get_ea_mode_str_8(g_cpu_ir));
+	dasm_print(ctx, "tst.b   %s; (2+)", get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68020_tst_pcix_8(void)
+static void d68020_tst_pcix_8(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68020_PLUS);
-	sprintf(g_dasm_str, "tst.b   %s; (2+)", get_ea_mode_str_8(g_cpu_ir));
+	dasm_print(ctx, "tst.b   %s; (2+)", get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68020_tst_i_8(void)
+static void d68020_tst_i_8(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68020_PLUS);
-	sprintf(g_dasm_str, "tst.b   %s; (2+)", get_ea_mode_str_8(g_cpu_ir));
+	dasm_print(ctx, "tst.b   %s; (2+)", get_ea_mode_str_8(ctx->ir));
 }
 
-static void d68000_tst_16(void)
+static void d68000_tst_16(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "tst.w   %s", get_ea_mode_str_16(g_cpu_ir));
+	dasm_print(ctx, "tst.w   %s", get_ea_mode_str_16(ctx->ir));
 }
 
-static void d68020_tst_a_16(void)
+static void d68020_tst_a_16(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68020_PLUS);
-	sprintf(g_dasm_str, "tst.w   %s; (2+)", get_ea_mode_str_16(g_cpu_ir));
+	dasm_print(ctx, "tst.w   %s; (2+)", get_ea_mode_str_16(ctx->ir));
 }
 
-static void d68020_tst_pcdi_16(void)
+static void d68020_tst_pcdi_16(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68020_PLUS);
-	sprintf(g_dasm_str, "tst.w   %s; (2+)", get_ea_mode_str_16(g_cpu_ir));
+	dasm_print(ctx, "tst.w   %s; (2+)", get_ea_mode_str_16(ctx->ir));
 }
 
-static void d68020_tst_pcix_16(void)
+static void d68020_tst_pcix_16(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68020_PLUS);
-	sprintf(g_dasm_str, "tst.w   %s; (2+)", get_ea_mode_str_16(g_cpu_ir));
+	dasm_print(ctx, "tst.w   %s; (2+)", get_ea_mode_str_16(ctx->ir));
 }
 
-static void d68020_tst_i_16(void)
+static void d68020_tst_i_16(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68020_PLUS);
-	sprintf(g_dasm_str, "tst.w   %s; (2+)", get_ea_mode_str_16(g_cpu_ir));
+	dasm_print(ctx, "tst.w   %s; (2+)", get_ea_mode_str_16(ctx->ir));
 }
 
-static void d68000_tst_32(void)
+static void d68000_tst_32(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "tst.l   %s", get_ea_mode_str_32(g_cpu_ir));
+	dasm_print(ctx, "tst.l   %s", get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68020_tst_a_32(void)
+static void d68020_tst_a_32(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68020_PLUS);
-	sprintf(g_dasm_str, "tst.l   %s; (2+)", get_ea_mode_str_32(g_cpu_ir));
+	dasm_print(ctx, "tst.l   %s; (2+)", get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68020_tst_pcdi_32(void)
+static void d68020_tst_pcdi_32(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68020_PLUS);
-	sprintf(g_dasm_str, "tst.l   %s; (2+)", get_ea_mode_str_32(g_cpu_ir));
+	dasm_print(ctx, "tst.l   %s; (2+)", get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68020_tst_pcix_32(void)
+static void d68020_tst_pcix_32(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68020_PLUS);
-	sprintf(g_dasm_str, "tst.l   %s; (2+)", get_ea_mode_str_32(g_cpu_ir));
+	dasm_print(ctx, "tst.l   %s; (2+)", get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68020_tst_i_32(void)
+static void d68020_tst_i_32(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68020_PLUS);
-	sprintf(g_dasm_str, "tst.l   %s; (2+)", get_ea_mode_str_32(g_cpu_ir));
+	dasm_print(ctx, "tst.l   %s; (2+)", get_ea_mode_str_32(ctx->ir));
 }
 
-static void d68000_unlk(void)
+static void d68000_unlk(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "unlk    A%d", g_cpu_ir&7);
+	dasm_areg(ctx->ir&7);
+	dasm_print(ctx, "unlk    A%d", ctx->ir&7);
 }
 
-static void d68020_unpk_rr(void)
+static void d68020_unpk_rr(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68020_PLUS);
-	sprintf(g_dasm_str, "unpk    D%d, D%d, %s; (2+)", g_cpu_ir&7, (g_cpu_ir>>9)&7, get_imm_str_u16());
+	dasm_dreg(ctx->ir&7);
+	dasm_dreg((ctx->ir>>9)&7);
+	dasm_print(ctx, "unpk    D%d, D%d, %s; (2+)", ctx->ir&7, (ctx->ir>>9)&7, get_imm_str_u16());
 }
 
-static void d68020_unpk_mm(void)
+static void d68020_unpk_mm(m68k_dasm_context* ctx)
 {
 	LIMIT_CPU_TYPES(M68020_PLUS);
-	sprintf(g_dasm_str, "unpk    -(A%d), -(A%d), %s; (2+)", g_cpu_ir&7, (g_cpu_ir>>9)&7, get_imm_str_u16());
+	dasm_pd(ctx->ir&7);
+	dasm_pd((ctx->ir>>9)&7);
+	dasm_print(ctx, "unpk    -(A%d), -(A%d), %s; (2+)", ctx->ir&7, (ctx->ir>>9)&7, get_imm_str_u16());
 }
 
 
@@ -3162,53 +3878,53 @@ static void d68020_unpk_mm(void)
 // PMOVE 3: 011xxxx000000000
 // PTEST:   100xxxxxxxxxxxxx
 // PFLUSHR:  1010000000000000
-static void d68851_p000(void)
+static void d68851_p000(m68k_dasm_context* ctx)
 {
 	char* str;
 	uint modes = read_imm_16();
 
 	// do this after fetching the second PMOVE word so we properly get the 3rd if necessary
-	str = get_ea_mode_str_32(g_cpu_ir);
+	str = get_ea_mode_str_32(ctx->ir);
 
 	if ((modes & 0xfde0) == 0x2000)	// PLOAD
 	{
 		if (modes & 0x0200)
 		{
-	 		sprintf(g_dasm_str, "pload  #%d, %s", (modes>>10)&7, str);
+	 		dasm_print(ctx, "pload  #%d, %s", (modes>>10)&7, str);
 		}
 		else
 		{
-	 		sprintf(g_dasm_str, "pload  %s, #%d", str, (modes>>10)&7);
+	 		dasm_print(ctx, "pload  %s, #%d", str, (modes>>10)&7);
 		}
 		return;
 	}
 
 	if ((modes & 0xe200) == 0x2000)	// PFLUSH
 	{
-		sprintf(g_dasm_str, "pflushr %x, %x, %s", modes & 0x1f, (modes>>5)&0xf, str);
+		dasm_print(ctx, "pflushr %x, %x, %s", modes & 0x1f, (modes>>5)&0xf, str);
 		return;
 	}
 
 	if (modes == 0xa000)	// PFLUSHR
 	{
-		sprintf(g_dasm_str, "pflushr %s", str);
+		dasm_print(ctx, "pflushr %s", str);
 	}
 
 	if (modes == 0x2800)	// PVALID (FORMAT 1)
 	{
-		sprintf(g_dasm_str, "pvalid VAL, %s", str);
+		dasm_print(ctx, "pvalid VAL, %s", str);
 		return;
 	}
 
 	if ((modes & 0xfff8) == 0x2c00)	// PVALID (FORMAT 2)
 	{
-		sprintf(g_dasm_str, "pvalid A%d, %s", modes & 0xf, str);
+		dasm_print(ctx, "pvalid A%d, %s", modes & 0xf, str);
 		return;
 	}
 
 	if ((modes & 0xe000) == 0x8000)	// PTEST
 	{
-		sprintf(g_dasm_str, "ptest #%d, %s", modes & 0x1f, str);
+		dasm_print(ctx, "ptest #%d, %s", modes & 0x1f, str);
 		return;
 	}
 
@@ -3220,22 +3936,22 @@ static void d68851_p000(void)
 			{
 				if (modes & 0x0200)
 				{
-			 		sprintf(g_dasm_str, "pmovefd  %s, %s", g_mmuregs[(modes>>10)&7], str);
+			 		dasm_print(ctx, "pmovefd  %s, %s", g_mmuregs[(modes>>10)&7], str);
 				}
 				else
 				{
-			 		sprintf(g_dasm_str, "pmovefd  %s, %s", str, g_mmuregs[(modes>>10)&7]);
+			 		dasm_print(ctx, "pmovefd  %s, %s", str, g_mmuregs[(modes>>10)&7]);
 				}
 			}
 			else
 			{
 				if (modes & 0x0200)
 				{
-			 		sprintf(g_dasm_str, "pmove  %s, %s", g_mmuregs[(modes>>10)&7], str);
+			 		dasm_print(ctx, "pmove  %s, %s", g_mmuregs[(modes>>10)&7], str);
 				}
 				else
 				{
-			 		sprintf(g_dasm_str, "pmove  %s, %s", str, g_mmuregs[(modes>>10)&7]);
+			 		dasm_print(ctx, "pmove  %s, %s", str, g_mmuregs[(modes>>10)&7]);
 				}
 			}
 			break;
@@ -3243,46 +3959,49 @@ static void d68851_p000(void)
 		case 3:	// MC68030 to/from status reg
 			if (modes & 0x0200)
 			{
-		 		sprintf(g_dasm_str, "pmove  mmusr, %s", str);
+		 		dasm_print(ctx, "pmove  mmusr, %s", str);
 			}
 			else
 			{
-		 		sprintf(g_dasm_str, "pmove  %s, mmusr", str);
+		 		dasm_print(ctx, "pmove  %s, mmusr", str);
 			}
 			break;
 
 		default:
-			sprintf(g_dasm_str, "pmove [unknown form] %s", str);
+			dasm_print(ctx, "pmove [unknown form] %s", str);
 			break;
 	}
 }
 
-static void d68851_pbcc16(void)
+static void d68851_pbcc16(m68k_dasm_context* ctx)
 {
-	uint32 temp_pc = g_cpu_pc;
+	uint32 temp_pc = ctx->pc;
 
-	sprintf(g_dasm_str, "pb%s %x", g_mmucond[g_cpu_ir&0xf], temp_pc + make_int_16(read_imm_16()));
+	ctx->insn->condition = ctx->ir&0xf;
+	dasm_print(ctx, "pb%s %x", g_mmucond[ctx->ir&0xf], dasm_target(ctx, temp_pc + make_int_16(read_imm_16())));
 }
 
-static void d68851_pbcc32(void)
+static void d68851_pbcc32(m68k_dasm_context* ctx)
 {
-	uint32 temp_pc = g_cpu_pc;
+	uint32 temp_pc = ctx->pc;
 
-	sprintf(g_dasm_str, "pb%s %x", g_mmucond[g_cpu_ir&0xf], temp_pc + make_int_32(read_imm_32()));
+	ctx->insn->condition = ctx->ir&0xf;
+	dasm_print(ctx, "pb%s %x", g_mmucond[ctx->ir&0xf], dasm_target(ctx, temp_pc + make_int_32(read_imm_32())));
 }
 
-static void d68851_pdbcc(void)
+static void d68851_pdbcc(m68k_dasm_context* ctx)
 {
-	uint32 temp_pc = g_cpu_pc;
+	uint32 temp_pc = ctx->pc;
 	uint16 modes = read_imm_16();
 
-	sprintf(g_dasm_str, "pb%s %x", g_mmucond[modes&0xf], temp_pc + make_int_16(read_imm_16()));
+	ctx->insn->condition = modes&0xf;
+	dasm_print(ctx, "pb%s %x", g_mmucond[modes&0xf], dasm_target(ctx, temp_pc + make_int_16(read_imm_16())));
 }
 
 // PScc:  0000000000xxxxxx
-static void d68851_p001(void)
+static void d68851_p001(m68k_dasm_context* ctx)
 {
-	sprintf(g_dasm_str, "MMU 001 group");
+	dasm_print(ctx, "MMU 001 group");
 }
 
 /* ======================================================================== */
@@ -3306,315 +4025,327 @@ static void d68851_p001(void)
 
 static const opcode_struct g_opcode_info[] =
 {
-/*  opcode handler             mask    match   ea mask */
-	{d68000_1010         , 0xf000, 0xa000, 0x000},
-	{d68000_1111         , 0xf000, 0xf000, 0x000},
-	{d68000_abcd_rr      , 0xf1f8, 0xc100, 0x000},
-	{d68000_abcd_mm      , 0xf1f8, 0xc108, 0x000},
-	{d68000_add_er_8     , 0xf1c0, 0xd000, 0xbff},
-	{d68000_add_er_16    , 0xf1c0, 0xd040, 0xfff},
-	{d68000_add_er_32    , 0xf1c0, 0xd080, 0xfff},
-	{d68000_add_re_8     , 0xf1c0, 0xd100, 0x3f8},
-	{d68000_add_re_16    , 0xf1c0, 0xd140, 0x3f8},
-	{d68000_add_re_32    , 0xf1c0, 0xd180, 0x3f8},
-	{d68000_adda_16      , 0xf1c0, 0xd0c0, 0xfff},
-	{d68000_adda_32      , 0xf1c0, 0xd1c0, 0xfff},
-	{d68000_addi_8       , 0xffc0, 0x0600, 0xbf8},
-	{d68000_addi_16      , 0xffc0, 0x0640, 0xbf8},
-	{d68000_addi_32      , 0xffc0, 0x0680, 0xbf8},
-	{d68000_addq_8       , 0xf1c0, 0x5000, 0xbf8},
-	{d68000_addq_16      , 0xf1c0, 0x5040, 0xff8},
-	{d68000_addq_32      , 0xf1c0, 0x5080, 0xff8},
-	{d68000_addx_rr_8    , 0xf1f8, 0xd100, 0x000},
-	{d68000_addx_rr_16   , 0xf1f8, 0xd140, 0x000},
-	{d68000_addx_rr_32   , 0xf1f8, 0xd180, 0x000},
-	{d68000_addx_mm_8    , 0xf1f8, 0xd108, 0x000},
-	{d68000_addx_mm_16   , 0xf1f8, 0xd148, 0x000},
-	{d68000_addx_mm_32   , 0xf1f8, 0xd188, 0x000},
-	{d68000_and_er_8     , 0xf1c0, 0xc000, 0xbff},
-	{d68000_and_er_16    , 0xf1c0, 0xc040, 0xbff},
-	{d68000_and_er_32    , 0xf1c0, 0xc080, 0xbff},
-	{d68000_and_re_8     , 0xf1c0, 0xc100, 0x3f8},
-	{d68000_and_re_16    , 0xf1c0, 0xc140, 0x3f8},
-	{d68000_and_re_32    , 0xf1c0, 0xc180, 0x3f8},
-	{d68000_andi_to_ccr  , 0xffff, 0x023c, 0x000},
-	{d68000_andi_to_sr   , 0xffff, 0x027c, 0x000},
-	{d68000_andi_8       , 0xffc0, 0x0200, 0xbf8},
-	{d68000_andi_16      , 0xffc0, 0x0240, 0xbf8},
-	{d68000_andi_32      , 0xffc0, 0x0280, 0xbf8},
-	{d68000_asr_s_8      , 0xf1f8, 0xe000, 0x000},
-	{d68000_asr_s_16     , 0xf1f8, 0xe040, 0x000},
-	{d68000_asr_s_32     , 0xf1f8, 0xe080, 0x000},
-	{d68000_asr_r_8      , 0xf1f8, 0xe020, 0x000},
-	{d68000_asr_r_16     , 0xf1f8, 0xe060, 0x000},
-	{d68000_asr_r_32     , 0xf1f8, 0xe0a0, 0x000},
-	{d68000_asr_ea       , 0xffc0, 0xe0c0, 0x3f8},
-	{d68000_asl_s_8      , 0xf1f8, 0xe100, 0x000},
-	{d68000_asl_s_16     , 0xf1f8, 0xe140, 0x000},
-	{d68000_asl_s_32     , 0xf1f8, 0xe180, 0x000},
-	{d68000_asl_r_8      , 0xf1f8, 0xe120, 0x000},
-	{d68000_asl_r_16     , 0xf1f8, 0xe160, 0x000},
-	{d68000_asl_r_32     , 0xf1f8, 0xe1a0, 0x000},
-	{d68000_asl_ea       , 0xffc0, 0xe1c0, 0x3f8},
-	{d68000_bcc_8        , 0xf000, 0x6000, 0x000},
-	{d68000_bcc_16       , 0xf0ff, 0x6000, 0x000},
-	{d68020_bcc_32       , 0xf0ff, 0x60ff, 0x000},
-	{d68000_bchg_r       , 0xf1c0, 0x0140, 0xbf8},
-	{d68000_bchg_s       , 0xffc0, 0x0840, 0xbf8},
-	{d68000_bclr_r       , 0xf1c0, 0x0180, 0xbf8},
-	{d68000_bclr_s       , 0xffc0, 0x0880, 0xbf8},
-	{d68020_bfchg        , 0xffc0, 0xeac0, 0xa78},
-	{d68020_bfclr        , 0xffc0, 0xecc0, 0xa78},
-	{d68020_bfexts       , 0xffc0, 0xebc0, 0xa7b},
-	{d68020_bfextu       , 0xffc0, 0xe9c0, 0xa7b},
-	{d68020_bfffo        , 0xffc0, 0xedc0, 0xa7b},
-	{d68020_bfins        , 0xffc0, 0xefc0, 0xa78},
-	{d68020_bfset        , 0xffc0, 0xeec0, 0xa78},
-	{d68020_bftst        , 0xffc0, 0xe8c0, 0xa7b},
-	{d68010_bkpt         , 0xfff8, 0x4848, 0x000},
-	{d68000_bra_8        , 0xff00, 0x6000, 0x000},
-	{d68000_bra_16       , 0xffff, 0x6000, 0x000},
-	{d68020_bra_32       , 0xffff, 0x60ff, 0x000},
-	{d68000_bset_r       , 0xf1c0, 0x01c0, 0xbf8},
-	{d68000_bset_s       , 0xffc0, 0x08c0, 0xbf8},
-	{d68000_bsr_8        , 0xff00, 0x6100, 0x000},
-	{d68000_bsr_16       , 0xffff, 0x6100, 0x000},
-	{d68020_bsr_32       , 0xffff, 0x61ff, 0x000},
-	{d68000_btst_r       , 0xf1c0, 0x0100, 0xbff},
-	{d68000_btst_s       , 0xffc0, 0x0800, 0xbfb},
-	{d68020_callm        , 0xffc0, 0x06c0, 0x27b},
-	{d68020_cas_8        , 0xffc0, 0x0ac0, 0x3f8},
-	{d68020_cas_16       , 0xffc0, 0x0cc0, 0x3f8},
-	{d68020_cas_32       , 0xffc0, 0x0ec0, 0x3f8},
-	{d68020_cas2_16      , 0xffff, 0x0cfc, 0x000},
-	{d68020_cas2_32      , 0xffff, 0x0efc, 0x000},
-	{d68000_chk_16       , 0xf1c0, 0x4180, 0xbff},
-	{d68020_chk_32       , 0xf1c0, 0x4100, 0xbff},
-	{d68020_chk2_cmp2_8  , 0xffc0, 0x00c0, 0x27b},
-	{d68020_chk2_cmp2_16 , 0xffc0, 0x02c0, 0x27b},
-	{d68020_chk2_cmp2_32 , 0xffc0, 0x04c0, 0x27b},
-	{d68040_cinv         , 0xff20, 0xf400, 0x000},
-	{d68000_clr_8        , 0xffc0, 0x4200, 0xbf8},
-	{d68000_clr_16       , 0xffc0, 0x4240, 0xbf8},
-	{d68000_clr_32       , 0xffc0, 0x4280, 0xbf8},
-	{d68000_cmp_8        , 0xf1c0, 0xb000, 0xbff},
-	{d68000_cmp_16       , 0xf1c0, 0xb040, 0xfff},
-	{d68000_cmp_32       , 0xf1c0, 0xb080, 0xfff},
-	{d68000_cmpa_16      , 0xf1c0, 0xb0c0, 0xfff},
-	{d68000_cmpa_32      , 0xf1c0, 0xb1c0, 0xfff},
-	{d68000_cmpi_8       , 0xffc0, 0x0c00, 0xbf8},
-	{d68020_cmpi_pcdi_8  , 0xffff, 0x0c3a, 0x000},
-	{d68020_cmpi_pcix_8  , 0xffff, 0x0c3b, 0x000},
-	{d68000_cmpi_16      , 0xffc0, 0x0c40, 0xbf8},
-	{d68020_cmpi_pcdi_16 , 0xffff, 0x0c7a, 0x000},
-	{d68020_cmpi_pcix_16 , 0xffff, 0x0c7b, 0x000},
-	{d68000_cmpi_32      , 0xffc0, 0x0c80, 0xbf8},
-	{d68020_cmpi_pcdi_32 , 0xffff, 0x0cba, 0x000},
-	{d68020_cmpi_pcix_32 , 0xffff, 0x0cbb, 0x000},
-	{d68000_cmpm_8       , 0xf1f8, 0xb108, 0x000},
-	{d68000_cmpm_16      , 0xf1f8, 0xb148, 0x000},
-	{d68000_cmpm_32      , 0xf1f8, 0xb188, 0x000},
-	{d68020_cpbcc_16     , 0xf1c0, 0xf080, 0x000},
-	{d68020_cpbcc_32     , 0xf1c0, 0xf0c0, 0x000},
-	{d68020_cpdbcc       , 0xf1f8, 0xf048, 0x000},
-	{d68020_cpgen        , 0xf1c0, 0xf000, 0x000},
-	{d68020_cprestore    , 0xf1c0, 0xf140, 0x37f},
-	{d68020_cpsave       , 0xf1c0, 0xf100, 0x2f8},
-	{d68020_cpscc        , 0xf1c0, 0xf040, 0xbf8},
-	{d68020_cptrapcc_0   , 0xf1ff, 0xf07c, 0x000},
-	{d68020_cptrapcc_16  , 0xf1ff, 0xf07a, 0x000},
-	{d68020_cptrapcc_32  , 0xf1ff, 0xf07b, 0x000},
-	{d68040_cpush        , 0xff20, 0xf420, 0x000},
-	{d68000_dbcc         , 0xf0f8, 0x50c8, 0x000},
-	{d68000_dbra         , 0xfff8, 0x51c8, 0x000},
-	{d68000_divs         , 0xf1c0, 0x81c0, 0xbff},
-	{d68000_divu         , 0xf1c0, 0x80c0, 0xbff},
-	{d68020_divl         , 0xffc0, 0x4c40, 0xbff},
-	{d68000_eor_8        , 0xf1c0, 0xb100, 0xbf8},
-	{d68000_eor_16       , 0xf1c0, 0xb140, 0xbf8},
-	{d68000_eor_32       , 0xf1c0, 0xb180, 0xbf8},
-	{d68000_eori_to_ccr  , 0xffff, 0x0a3c, 0x000},
-	{d68000_eori_to_sr   , 0xffff, 0x0a7c, 0x000},
-	{d68000_eori_8       , 0xffc0, 0x0a00, 0xbf8},
-	{d68000_eori_16      , 0xffc0, 0x0a40, 0xbf8},
-	{d68000_eori_32      , 0xffc0, 0x0a80, 0xbf8},
-	{d68000_exg_dd       , 0xf1f8, 0xc140, 0x000},
-	{d68000_exg_aa       , 0xf1f8, 0xc148, 0x000},
-	{d68000_exg_da       , 0xf1f8, 0xc188, 0x000},
-	{d68020_extb_32      , 0xfff8, 0x49c0, 0x000},
-	{d68000_ext_16       , 0xfff8, 0x4880, 0x000},
-	{d68000_ext_32       , 0xfff8, 0x48c0, 0x000},
-	{d68040_fpu          , 0xffc0, 0xf200, 0x000},
-	{d68000_illegal      , 0xffff, 0x4afc, 0x000},
-	{d68000_jmp          , 0xffc0, 0x4ec0, 0x27b},
-	{d68000_jsr          , 0xffc0, 0x4e80, 0x27b},
-	{d68000_lea          , 0xf1c0, 0x41c0, 0x27b},
-	{d68000_link_16      , 0xfff8, 0x4e50, 0x000},
-	{d68020_link_32      , 0xfff8, 0x4808, 0x000},
-	{d68000_lsr_s_8      , 0xf1f8, 0xe008, 0x000},
-	{d68000_lsr_s_16     , 0xf1f8, 0xe048, 0x000},
-	{d68000_lsr_s_32     , 0xf1f8, 0xe088, 0x000},
-	{d68000_lsr_r_8      , 0xf1f8, 0xe028, 0x000},
-	{d68000_lsr_r_16     , 0xf1f8, 0xe068, 0x000},
-	{d68000_lsr_r_32     , 0xf1f8, 0xe0a8, 0x000},
-	{d68000_lsr_ea       , 0xffc0, 0xe2c0, 0x3f8},
-	{d68000_lsl_s_8      , 0xf1f8, 0xe108, 0x000},
-	{d68000_lsl_s_16     , 0xf1f8, 0xe148, 0x000},
-	{d68000_lsl_s_32     , 0xf1f8, 0xe188, 0x000},
-	{d68000_lsl_r_8      , 0xf1f8, 0xe128, 0x000},
-	{d68000_lsl_r_16     , 0xf1f8, 0xe168, 0x000},
-	{d68000_lsl_r_32     , 0xf1f8, 0xe1a8, 0x000},
-	{d68000_lsl_ea       , 0xffc0, 0xe3c0, 0x3f8},
-	{d68000_move_8       , 0xf000, 0x1000, 0xbff},
-	{d68000_move_16      , 0xf000, 0x3000, 0xfff},
-	{d68000_move_32      , 0xf000, 0x2000, 0xfff},
-	{d68000_movea_16     , 0xf1c0, 0x3040, 0xfff},
-	{d68000_movea_32     , 0xf1c0, 0x2040, 0xfff},
-	{d68000_move_to_ccr  , 0xffc0, 0x44c0, 0xbff},
-	{d68010_move_fr_ccr  , 0xffc0, 0x42c0, 0xbf8},
-	{d68000_move_to_sr   , 0xffc0, 0x46c0, 0xbff},
-	{d68000_move_fr_sr   , 0xffc0, 0x40c0, 0xbf8},
-	{d68000_move_to_usp  , 0xfff8, 0x4e60, 0x000},
-	{d68000_move_fr_usp  , 0xfff8, 0x4e68, 0x000},
-	{d68010_movec        , 0xfffe, 0x4e7a, 0x000},
-	{d68000_movem_pd_16  , 0xfff8, 0x48a0, 0x000},
-	{d68000_movem_pd_32  , 0xfff8, 0x48e0, 0x000},
-	{d68000_movem_re_16  , 0xffc0, 0x4880, 0x2f8},
-	{d68000_movem_re_32  , 0xffc0, 0x48c0, 0x2f8},
-	{d68000_movem_er_16  , 0xffc0, 0x4c80, 0x37b},
-	{d68000_movem_er_32  , 0xffc0, 0x4cc0, 0x37b},
-	{d68000_movep_er_16  , 0xf1f8, 0x0108, 0x000},
-	{d68000_movep_er_32  , 0xf1f8, 0x0148, 0x000},
-	{d68000_movep_re_16  , 0xf1f8, 0x0188, 0x000},
-	{d68000_movep_re_32  , 0xf1f8, 0x01c8, 0x000},
-	{d68010_moves_8      , 0xffc0, 0x0e00, 0x3f8},
-	{d68010_moves_16     , 0xffc0, 0x0e40, 0x3f8},
-	{d68010_moves_32     , 0xffc0, 0x0e80, 0x3f8},
-	{d68000_moveq        , 0xf100, 0x7000, 0x000},
-	{d68040_move16_pi_pi , 0xfff8, 0xf620, 0x000},
-	{d68040_move16_pi_al , 0xfff8, 0xf600, 0x000},
-	{d68040_move16_al_pi , 0xfff8, 0xf608, 0x000},
-	{d68040_move16_ai_al , 0xfff8, 0xf610, 0x000},
-	{d68040_move16_al_ai , 0xfff8, 0xf618, 0x000},
-	{d68000_muls         , 0xf1c0, 0xc1c0, 0xbff},
-	{d68000_mulu         , 0xf1c0, 0xc0c0, 0xbff},
-	{d68020_mull         , 0xffc0, 0x4c00, 0xbff},
-	{d68000_nbcd         , 0xffc0, 0x4800, 0xbf8},
-	{d68000_neg_8        , 0xffc0, 0x4400, 0xbf8},
-	{d68000_neg_16       , 0xffc0, 0x4440, 0xbf8},
-	{d68000_neg_32       , 0xffc0, 0x4480, 0xbf8},
-	{d68000_negx_8       , 0xffc0, 0x4000, 0xbf8},
-	{d68000_negx_16      , 0xffc0, 0x4040, 0xbf8},
-	{d68000_negx_32      , 0xffc0, 0x4080, 0xbf8},
-	{d68000_nop          , 0xffff, 0x4e71, 0x000},
-	{d68000_not_8        , 0xffc0, 0x4600, 0xbf8},
-	{d68000_not_16       , 0xffc0, 0x4640, 0xbf8},
-	{d68000_not_32       , 0xffc0, 0x4680, 0xbf8},
-	{d68000_or_er_8      , 0xf1c0, 0x8000, 0xbff},
-	{d68000_or_er_16     , 0xf1c0, 0x8040, 0xbff},
-	{d68000_or_er_32     , 0xf1c0, 0x8080, 0xbff},
-	{d68000_or_re_8      , 0xf1c0, 0x8100, 0x3f8},
-	{d68000_or_re_16     , 0xf1c0, 0x8140, 0x3f8},
-	{d68000_or_re_32     , 0xf1c0, 0x8180, 0x3f8},
-	{d68000_ori_to_ccr   , 0xffff, 0x003c, 0x000},
-	{d68000_ori_to_sr    , 0xffff, 0x007c, 0x000},
-	{d68000_ori_8        , 0xffc0, 0x0000, 0xbf8},
-	{d68000_ori_16       , 0xffc0, 0x0040, 0xbf8},
-	{d68000_ori_32       , 0xffc0, 0x0080, 0xbf8},
-	{d68020_pack_rr      , 0xf1f8, 0x8140, 0x000},
-	{d68020_pack_mm      , 0xf1f8, 0x8148, 0x000},
-	{d68000_pea          , 0xffc0, 0x4840, 0x27b},
-	{d68040_pflush       , 0xffe0, 0xf500, 0x000},
-	{d68000_reset        , 0xffff, 0x4e70, 0x000},
-	{d68000_ror_s_8      , 0xf1f8, 0xe018, 0x000},
-	{d68000_ror_s_16     , 0xf1f8, 0xe058, 0x000},
-	{d68000_ror_s_32     , 0xf1f8, 0xe098, 0x000},
-	{d68000_ror_r_8      , 0xf1f8, 0xe038, 0x000},
-	{d68000_ror_r_16     , 0xf1f8, 0xe078, 0x000},
-	{d68000_ror_r_32     , 0xf1f8, 0xe0b8, 0x000},
-	{d68000_ror_ea       , 0xffc0, 0xe6c0, 0x3f8},
-	{d68000_rol_s_8      , 0xf1f8, 0xe118, 0x000},
-	{d68000_rol_s_16     , 0xf1f8, 0xe158, 0x000},
-	{d68000_rol_s_32     , 0xf1f8, 0xe198, 0x000},
-	{d68000_rol_r_8      , 0xf1f8, 0xe138, 0x000},
-	{d68000_rol_r_16     , 0xf1f8, 0xe178, 0x000},
-	{d68000_rol_r_32     , 0xf1f8, 0xe1b8, 0x000},
-	{d68000_rol_ea       , 0xffc0, 0xe7c0, 0x3f8},
-	{d68000_roxr_s_8     , 0xf1f8, 0xe010, 0x000},
-	{d68000_roxr_s_16    , 0xf1f8, 0xe050, 0x000},
-	{d68000_roxr_s_32    , 0xf1f8, 0xe090, 0x000},
-	{d68000_roxr_r_8     , 0xf1f8, 0xe030, 0x000},
-	{d68000_roxr_r_16    , 0xf1f8, 0xe070, 0x000},
-	{d68000_roxr_r_32    , 0xf1f8, 0xe0b0, 0x000},
-	{d68000_roxr_ea      , 0xffc0, 0xe4c0, 0x3f8},
-	{d68000_roxl_s_8     , 0xf1f8, 0xe110, 0x000},
-	{d68000_roxl_s_16    , 0xf1f8, 0xe150, 0x000},
-	{d68000_roxl_s_32    , 0xf1f8, 0xe190, 0x000},
-	{d68000_roxl_r_8     , 0xf1f8, 0xe130, 0x000},
-	{d68000_roxl_r_16    , 0xf1f8, 0xe170, 0x000},
-	{d68000_roxl_r_32    , 0xf1f8, 0xe1b0, 0x000},
-	{d68000_roxl_ea      , 0xffc0, 0xe5c0, 0x3f8},
-	{d68010_rtd          , 0xffff, 0x4e74, 0x000},
-	{d68000_rte          , 0xffff, 0x4e73, 0x000},
-	{d68020_rtm          , 0xfff0, 0x06c0, 0x000},
-	{d68000_rtr          , 0xffff, 0x4e77, 0x000},
-	{d68000_rts          , 0xffff, 0x4e75, 0x000},
-	{d68000_sbcd_rr      , 0xf1f8, 0x8100, 0x000},
-	{d68000_sbcd_mm      , 0xf1f8, 0x8108, 0x000},
-	{d68000_scc          , 0xf0c0, 0x50c0, 0xbf8},
-	{d68000_stop         , 0xffff, 0x4e72, 0x000},
-	{d68000_sub_er_8     , 0xf1c0, 0x9000, 0xbff},
-	{d68000_sub_er_16    , 0xf1c0, 0x9040, 0xfff},
-	{d68000_sub_er_32    , 0xf1c0, 0x9080, 0xfff},
-	{d68000_sub_re_8     , 0xf1c0, 0x9100, 0x3f8},
-	{d68000_sub_re_16    , 0xf1c0, 0x9140, 0x3f8},
-	{d68000_sub_re_32    , 0xf1c0, 0x9180, 0x3f8},
-	{d68000_suba_16      , 0xf1c0, 0x90c0, 0xfff},
-	{d68000_suba_32      , 0xf1c0, 0x91c0, 0xfff},
-	{d68000_subi_8       , 0xffc0, 0x0400, 0xbf8},
-	{d68000_subi_16      , 0xffc0, 0x0440, 0xbf8},
-	{d68000_subi_32      , 0xffc0, 0x0480, 0xbf8},
-	{d68000_subq_8       , 0xf1c0, 0x5100, 0xbf8},
-	{d68000_subq_16      , 0xf1c0, 0x5140, 0xff8},
-	{d68000_subq_32      , 0xf1c0, 0x5180, 0xff8},
-	{d68000_subx_rr_8    , 0xf1f8, 0x9100, 0x000},
-	{d68000_subx_rr_16   , 0xf1f8, 0x9140, 0x000},
-	{d68000_subx_rr_32   , 0xf1f8, 0x9180, 0x000},
-	{d68000_subx_mm_8    , 0xf1f8, 0x9108, 0x000},
-	{d68000_subx_mm_16   , 0xf1f8, 0x9148, 0x000},
-	{d68000_subx_mm_32   , 0xf1f8, 0x9188, 0x000},
-	{d68000_swap         , 0xfff8, 0x4840, 0x000},
-	{d68000_tas          , 0xffc0, 0x4ac0, 0xbf8},
-	{d68000_trap         , 0xfff0, 0x4e40, 0x000},
-	{d68020_trapcc_0     , 0xf0ff, 0x50fc, 0x000},
-	{d68020_trapcc_16    , 0xf0ff, 0x50fa, 0x000},
-	{d68020_trapcc_32    , 0xf0ff, 0x50fb, 0x000},
-	{d68000_trapv        , 0xffff, 0x4e76, 0x000},
-	{d68000_tst_8        , 0xffc0, 0x4a00, 0xbf8},
-	{d68020_tst_pcdi_8   , 0xffff, 0x4a3a, 0x000},
-	{d68020_tst_pcix_8   , 0xffff, 0x4a3b, 0x000},
-	{d68020_tst_i_8      , 0xffff, 0x4a3c, 0x000},
-	{d68000_tst_16       , 0xffc0, 0x4a40, 0xbf8},
-	{d68020_tst_a_16     , 0xfff8, 0x4a48, 0x000},
-	{d68020_tst_pcdi_16  , 0xffff, 0x4a7a, 0x000},
-	{d68020_tst_pcix_16  , 0xffff, 0x4a7b, 0x000},
-	{d68020_tst_i_16     , 0xffff, 0x4a7c, 0x000},
-	{d68000_tst_32       , 0xffc0, 0x4a80, 0xbf8},
-	{d68020_tst_a_32     , 0xfff8, 0x4a88, 0x000},
-	{d68020_tst_pcdi_32  , 0xffff, 0x4aba, 0x000},
-	{d68020_tst_pcix_32  , 0xffff, 0x4abb, 0x000},
-	{d68020_tst_i_32     , 0xffff, 0x4abc, 0x000},
-	{d68000_unlk         , 0xfff8, 0x4e58, 0x000},
-	{d68020_unpk_rr      , 0xf1f8, 0x8180, 0x000},
-	{d68020_unpk_mm      , 0xf1f8, 0x8188, 0x000},
-	{d68851_p000         , 0xffc0, 0xf000, 0x000},
-	{d68851_pbcc16       , 0xffc0, 0xf080, 0x000},
-	{d68851_pbcc32       , 0xffc0, 0xf0c0, 0x000},
-	{d68851_pdbcc        , 0xfff8, 0xf048, 0x000},
-	{d68851_p001         , 0xffc0, 0xf040, 0x000},
-	{0, 0, 0, 0}
+/*  opcode handler             mask    match   ea mask  mnemonic             size  flags */
+	{d68000_1010         , 0xf000, 0xa000, 0x000, M68K_INSN_LINE_A,     0, M68K_DASM_FLAG_TRAP},
+	{d68000_1111         , 0xf000, 0xf000, 0x000, M68K_INSN_LINE_F,     0, M68K_DASM_FLAG_TRAP},
+	{d68000_abcd_rr      , 0xf1f8, 0xc100, 0x000, M68K_INSN_ABCD,       0, 0},
+	{d68000_abcd_mm      , 0xf1f8, 0xc108, 0x000, M68K_INSN_ABCD,       0, 0},
+	{d68000_add_er_8     , 0xf1c0, 0xd000, 0xbff, M68K_INSN_ADD,        1, 0},
+	{d68000_add_er_16    , 0xf1c0, 0xd040, 0xfff, M68K_INSN_ADD,        2, 0},
+	{d68000_add_er_32    , 0xf1c0, 0xd080, 0xfff, M68K_INSN_ADD,        4, 0},
+	{d68000_add_re_8     , 0xf1c0, 0xd100, 0x3f8, M68K_INSN_ADD,        1, 0},
+	{d68000_add_re_16    , 0xf1c0, 0xd140, 0x3f8, M68K_INSN_ADD,        2, 0},
+	{d68000_add_re_32    , 0xf1c0, 0xd180, 0x3f8, M68K_INSN_ADD,        4, 0},
+	{d68000_adda_16      , 0xf1c0, 0xd0c0, 0xfff, M68K_INSN_ADDA,       2, 0},
+	{d68000_adda_32      , 0xf1c0, 0xd1c0, 0xfff, M68K_INSN_ADDA,       4, 0},
+	{d68000_addi_8       , 0xffc0, 0x0600, 0xbf8, M68K_INSN_ADDI,       1, 0},
+	{d68000_addi_16      , 0xffc0, 0x0640, 0xbf8, M68K_INSN_ADDI,       2, 0},
+	{d68000_addi_32      , 0xffc0, 0x0680, 0xbf8, M68K_INSN_ADDI,       4, 0},
+	{d68000_addq_8       , 0xf1c0, 0x5000, 0xbf8, M68K_INSN_ADDQ,       1, 0},
+	{d68000_addq_16      , 0xf1c0, 0x5040, 0xff8, M68K_INSN_ADDQ,       2, 0},
+	{d68000_addq_32      , 0xf1c0, 0x5080, 0xff8, M68K_INSN_ADDQ,       4, 0},
+	{d68000_addx_rr_8    , 0xf1f8, 0xd100, 0x000, M68K_INSN_ADDX,       1, 0},
+	{d68000_addx_rr_16   , 0xf1f8, 0xd140, 0x000, M68K_INSN_ADDX,       2, 0},
+	{d68000_addx_rr_32   , 0xf1f8, 0xd180, 0x000, M68K_INSN_ADDX,       4, 0},
+	{d68000_addx_mm_8    , 0xf1f8, 0xd108, 0x000, M68K_INSN_ADDX,       1, 0},
+	{d68000_addx_mm_16   , 0xf1f8, 0xd148, 0x000, M68K_INSN_ADDX,       2, 0},
+	{d68000_addx_mm_32   , 0xf1f8, 0xd188, 0x000, M68K_INSN_ADDX,       4, 0},
+	{d68000_and_er_8     , 0xf1c0, 0xc000, 0xbff, M68K_INSN_AND,        1, 0},
+	{d68000_and_er_16    , 0xf1c0, 0xc040, 0xbff, M68K_INSN_AND,        2, 0},
+	{d68000_and_er_32    , 0xf1c0, 0xc080, 0xbff, M68K_INSN_AND,        4, 0},
+	{d68000_and_re_8     , 0xf1c0, 0xc100, 0x3f8, M68K_INSN_AND,        1, 0},
+	{d68000_and_re_16    , 0xf1c0, 0xc140, 0x3f8, M68K_INSN_AND,        2, 0},
+	{d68000_and_re_32    , 0xf1c0, 0xc180, 0x3f8, M68K_INSN_AND,        4, 0},
+	{d68000_andi_to_ccr  , 0xffff, 0x023c, 0x000, M68K_INSN_ANDI,       0, 0},
+	{d68000_andi_to_sr   , 0xffff, 0x027c, 0x000, M68K_INSN_ANDI,       0, 0},
+	{d68000_andi_8       , 0xffc0, 0x0200, 0xbf8, M68K_INSN_ANDI,       1, 0},
+	{d68000_andi_16      , 0xffc0, 0x0240, 0xbf8, M68K_INSN_ANDI,       2, 0},
+	{d68000_andi_32      , 0xffc0, 0x0280, 0xbf8, M68K_INSN_ANDI,       4, 0},
+	{d68000_asr_s_8      , 0xf1f8, 0xe000, 0x000, M68K_INSN_ASR,        1, 0},
+	{d68000_asr_s_16     , 0xf1f8, 0xe040, 0x000, M68K_INSN_ASR,        2, 0},
+	{d68000_asr_s_32     , 0xf1f8, 0xe080, 0x000, M68K_INSN_ASR,        4, 0},
+	{d68000_asr_r_8      , 0xf1f8, 0xe020, 0x000, M68K_INSN_ASR,        1, 0},
+	{d68000_asr_r_16     , 0xf1f8, 0xe060, 0x000, M68K_INSN_ASR,        2, 0},
+	{d68000_asr_r_32     , 0xf1f8, 0xe0a0, 0x000, M68K_INSN_ASR,        4, 0},
+	{d68000_asr_ea       , 0xffc0, 0xe0c0, 0x3f8, M68K_INSN_ASR,        2, 0},
+	{d68000_asl_s_8      , 0xf1f8, 0xe100, 0x000, M68K_INSN_ASL,        1, 0},
+	{d68000_asl_s_16     , 0xf1f8, 0xe140, 0x000, M68K_INSN_ASL,        2, 0},
+	{d68000_asl_s_32     , 0xf1f8, 0xe180, 0x000, M68K_INSN_ASL,        4, 0},
+	{d68000_asl_r_8      , 0xf1f8, 0xe120, 0x000, M68K_INSN_ASL,        1, 0},
+	{d68000_asl_r_16     , 0xf1f8, 0xe160, 0x000, M68K_INSN_ASL,        2, 0},
+	{d68000_asl_r_32     , 0xf1f8, 0xe1a0, 0x000, M68K_INSN_ASL,        4, 0},
+	{d68000_asl_ea       , 0xffc0, 0xe1c0, 0x3f8, M68K_INSN_ASL,        2, 0},
+	{d68000_bcc_8        , 0xf000, 0x6000, 0x000, M68K_INSN_BCC,        0, M68K_DASM_FLAG_BRANCH|M68K_DASM_FLAG_CONDITIONAL},
+	{d68000_bcc_16       , 0xf0ff, 0x6000, 0x000, M68K_INSN_BCC,        0, M68K_DASM_FLAG_BRANCH|M68K_DASM_FLAG_CONDITIONAL},
+	{d68020_bcc_32       , 0xf0ff, 0x60ff, 0x000, M68K_INSN_BCC,        0, M68K_DASM_FLAG_BRANCH|M68K_DASM_FLAG_CONDITIONAL},
+	{d68000_bchg_r       , 0xf1c0, 0x0140, 0xbf8, M68K_INSN_BCHG,       0, 0},
+	{d68000_bchg_s       , 0xffc0, 0x0840, 0xbf8, M68K_INSN_BCHG,       0, 0},
+	{d68000_bclr_r       , 0xf1c0, 0x0180, 0xbf8, M68K_INSN_BCLR,       0, 0},
+	{d68000_bclr_s       , 0xffc0, 0x0880, 0xbf8, M68K_INSN_BCLR,       0, 0},
+	{d68020_bfchg        , 0xffc0, 0xeac0, 0xa78, M68K_INSN_BFCHG,      0, 0},
+	{d68020_bfclr        , 0xffc0, 0xecc0, 0xa78, M68K_INSN_BFCLR,      0, 0},
+	{d68020_bfexts       , 0xffc0, 0xebc0, 0xa7b, M68K_INSN_BFEXTS,     0, 0},
+	{d68020_bfextu       , 0xffc0, 0xe9c0, 0xa7b, M68K_INSN_BFEXTU,     0, 0},
+	{d68020_bfffo        , 0xffc0, 0xedc0, 0xa7b, M68K_INSN_BFFFO,      0, 0},
+	{d68020_bfins        , 0xffc0, 0xefc0, 0xa78, M68K_INSN_BFINS,      0, 0},
+	{d68020_bfset        , 0xffc0, 0xeec0, 0xa78, M68K_INSN_BFSET,      0, 0},
+	{d68020_bftst        , 0xffc0, 0xe8c0, 0xa7b, M68K_INSN_BFTST,      0, 0},
+	{d68010_bkpt         , 0xfff8, 0x4848, 0x000, M68K_INSN_BKPT,       0, M68K_DASM_FLAG_TRAP},
+	{d68000_bra_8        , 0xff00, 0x6000, 0x000, M68K_INSN_BRA,        0, M68K_DASM_FLAG_BRANCH},
+	{d68000_bra_16       , 0xffff, 0x6000, 0x000, M68K_INSN_BRA,        0, M68K_DASM_FLAG_BRANCH},
+	{d68020_bra_32       , 0xffff, 0x60ff, 0x000, M68K_INSN_BRA,        0, M68K_DASM_FLAG_BRANCH},
+	{d68000_bset_r       , 0xf1c0, 0x01c0, 0xbf8, M68K_INSN_BSET,       0, 0},
+	{d68000_bset_s       , 0xffc0, 0x08c0, 0xbf8, M68K_INSN_BSET,       0, 0},
+	{d68000_bsr_8        , 0xff00, 0x6100, 0x000, M68K_INSN_BSR,        0, M68K_DASM_FLAG_BRANCH|M68K_DASM_FLAG_CALL},
+	{d68000_bsr_16       , 0xffff, 0x6100, 0x000, M68K_INSN_BSR,        0, M68K_DASM_FLAG_BRANCH|M68K_DASM_FLAG_CALL},
+	{d68020_bsr_32       , 0xffff, 0x61ff, 0x000, M68K_INSN_BSR,        0, M68K_DASM_FLAG_BRANCH|M68K_DASM_FLAG_CALL},
+	{d68000_btst_r       , 0xf1c0, 0x0100, 0xbff, M68K_INSN_BTST,       0, 0},
+	{d68000_btst_s       , 0xffc0, 0x0800, 0xbfb, M68K_INSN_BTST,       0, 0},
+	{d68020_callm        , 0xffc0, 0x06c0, 0x27b, M68K_INSN_CALLM,      0, M68K_DASM_FLAG_BRANCH|M68K_DASM_FLAG_CALL},
+	{d68020_cas_8        , 0xffc0, 0x0ac0, 0x3f8, M68K_INSN_CAS,        1, 0},
+	{d68020_cas_16       , 0xffc0, 0x0cc0, 0x3f8, M68K_INSN_CAS,        2, 0},
+	{d68020_cas_32       , 0xffc0, 0x0ec0, 0x3f8, M68K_INSN_CAS,        4, 0},
+	{d68020_cas2_16      , 0xffff, 0x0cfc, 0x000, M68K_INSN_CAS2,       2, 0},
+	{d68020_cas2_32      , 0xffff, 0x0efc, 0x000, M68K_INSN_CAS2,       4, 0},
+	{d68000_chk_16       , 0xf1c0, 0x4180, 0xbff, M68K_INSN_CHK,        2, M68K_DASM_FLAG_TRAP},
+	{d68020_chk_32       , 0xf1c0, 0x4100, 0xbff, M68K_INSN_CHK,        4, M68K_DASM_FLAG_TRAP},
+	{d68020_chk2_cmp2_8  , 0xffc0, 0x00c0, 0x27b, M68K_INSN_CHK2,       1, M68K_DASM_FLAG_TRAP},
+	{d68020_chk2_cmp2_16 , 0xffc0, 0x02c0, 0x27b, M68K_INSN_CHK2,       2, M68K_DASM_FLAG_TRAP},
+	{d68020_chk2_cmp2_32 , 0xffc0, 0x04c0, 0x27b, M68K_INSN_CHK2,       4, M68K_DASM_FLAG_TRAP},
+	{d68040_cinv         , 0xff20, 0xf400, 0x000, M68K_INSN_CINV,       0, 0},
+	{d68000_clr_8        , 0xffc0, 0x4200, 0xbf8, M68K_INSN_CLR,        1, 0},
+	{d68000_clr_16       , 0xffc0, 0x4240, 0xbf8, M68K_INSN_CLR,        2, 0},
+	{d68000_clr_32       , 0xffc0, 0x4280, 0xbf8, M68K_INSN_CLR,        4, 0},
+	{d68000_cmp_8        , 0xf1c0, 0xb000, 0xbff, M68K_INSN_CMP,        1, 0},
+	{d68000_cmp_16       , 0xf1c0, 0xb040, 0xfff, M68K_INSN_CMP,        2, 0},
+	{d68000_cmp_32       , 0xf1c0, 0xb080, 0xfff, M68K_INSN_CMP,        4, 0},
+	{d68000_cmpa_16      , 0xf1c0, 0xb0c0, 0xfff, M68K_INSN_CMPA,       2, 0},
+	{d68000_cmpa_32      , 0xf1c0, 0xb1c0, 0xfff, M68K_INSN_CMPA,       4, 0},
+	{d68000_cmpi_8       , 0xffc0, 0x0c00, 0xbf8, M68K_INSN_CMPI,       1, 0},
+	{d68020_cmpi_pcdi_8  , 0xffff, 0x0c3a, 0x000, M68K_INSN_CMPI,       1, 0},
+	{d68020_cmpi_pcix_8  , 0xffff, 0x0c3b, 0x000, M68K_INSN_CMPI,       1, 0},
+	{d68000_cmpi_16      , 0xffc0, 0x0c40, 0xbf8, M68K_INSN_CMPI,       2, 0},
+	{d68020_cmpi_pcdi_16 , 0xffff, 0x0c7a, 0x000, M68K_INSN_CMPI,       2, 0},
+	{d68020_cmpi_pcix_16 , 0xffff, 0x0c7b, 0x000, M68K_INSN_CMPI,       2, 0},
+	{d68000_cmpi_32      , 0xffc0, 0x0c80, 0xbf8, M68K_INSN_CMPI,       4, 0},
+	{d68020_cmpi_pcdi_32 , 0xffff, 0x0cba, 0x000, M68K_INSN_CMPI,       4, 0},
+	{d68020_cmpi_pcix_32 , 0xffff, 0x0cbb, 0x000, M68K_INSN_CMPI,       4, 0},
+	{d68000_cmpm_8       , 0xf1f8, 0xb108, 0x000, M68K_INSN_CMPM,       1, 0},
+	{d68000_cmpm_16      , 0xf1f8, 0xb148, 0x000, M68K_INSN_CMPM,       2, 0},
+	{d68000_cmpm_32      , 0xf1f8, 0xb188, 0x000, M68K_INSN_CMPM,       4, 0},
+	{d68020_cpbcc_16     , 0xf1c0, 0xf080, 0x000, M68K_INSN_CPBCC,      0, M68K_DASM_FLAG_BRANCH|M68K_DASM_FLAG_CONDITIONAL},
+	{d68020_cpbcc_32     , 0xf1c0, 0xf0c0, 0x000, M68K_INSN_CPBCC,      0, M68K_DASM_FLAG_BRANCH|M68K_DASM_FLAG_CONDITIONAL},
+	{d68020_cpdbcc       , 0xf1f8, 0xf048, 0x000, M68K_INSN_CPDBCC,     0, M68K_DASM_FLAG_BRANCH|M68K_DASM_FLAG_CONDITIONAL},
+	{d68020_cpgen        , 0xf1c0, 0xf000, 0x000, M68K_INSN_CPGEN,      0, 0},
+	{d68020_cprestore    , 0xf1c0, 0xf140, 0x37f, M68K_INSN_CPRESTORE,  0, 0},
+	{d68020_cpsave       , 0xf1c0, 0xf100, 0x2f8, M68K_INSN_CPSAVE,     0, 0},
+	{d68020_cpscc        , 0xf1c0, 0xf040, 0xbf8, M68K_INSN_CPSCC,      0, 0},
+	{d68020_cptrapcc_0   , 0xf1ff, 0xf07c, 0x000, M68K_INSN_CPTRAPCC,   0, M68K_DASM_FLAG_TRAP|M68K_DASM_FLAG_CONDITIONAL},
+	{d68020_cptrapcc_16  , 0xf1ff, 0xf07a, 0x000, M68K_INSN_CPTRAPCC,   0, M68K_DASM_FLAG_TRAP|M68K_DASM_FLAG_CONDITIONAL},
+	{d68020_cptrapcc_32  , 0xf1ff, 0xf07b, 0x000, M68K_INSN_CPTRAPCC,   0, M68K_DASM_FLAG_TRAP|M68K_DASM_FLAG_CONDITIONAL},
+	{d68040_cpush        , 0xff20, 0xf420, 0x000, M68K_INSN_CPUSH,      0, 0},
+	{d68000_dbcc         , 0xf0f8, 0x50c8, 0x000, M68K_INSN_DBCC,       0, M68K_DASM_FLAG_BRANCH|M68K_DASM_FLAG_CONDITIONAL},
+	{d68000_dbra         , 0xfff8, 0x51c8, 0x000, M68K_INSN_DBCC,       0, M68K_DASM_FLAG_BRANCH|M68K_DASM_FLAG_CONDITIONAL},
+	{d68000_divs         , 0xf1c0, 0x81c0, 0xbff, M68K_INSN_DIVS,       2, 0},
+	{d68000_divu         , 0xf1c0, 0x80c0, 0xbff, M68K_INSN_DIVU,       2, 0},
+	{d68020_divl         , 0xffc0, 0x4c40, 0xbff, M68K_INSN_DIVU,       4, 0},
+	{d68000_eor_8        , 0xf1c0, 0xb100, 0xbf8, M68K_INSN_EOR,        1, 0},
+	{d68000_eor_16       , 0xf1c0, 0xb140, 0xbf8, M68K_INSN_EOR,        2, 0},
+	{d68000_eor_32       , 0xf1c0, 0xb180, 0xbf8, M68K_INSN_EOR,        4, 0},
+	{d68000_eori_to_ccr  , 0xffff, 0x0a3c, 0x000, M68K_INSN_EORI,       0, 0},
+	{d68000_eori_to_sr   , 0xffff, 0x0a7c, 0x000, M68K_INSN_EORI,       0, 0},
+	{d68000_eori_8       , 0xffc0, 0x0a00, 0xbf8, M68K_INSN_EORI,       1, 0},
+	{d68000_eori_16      , 0xffc0, 0x0a40, 0xbf8, M68K_INSN_EORI,       2, 0},
+	{d68000_eori_32      , 0xffc0, 0x0a80, 0xbf8, M68K_INSN_EORI,       4, 0},
+	{d68000_exg_dd       , 0xf1f8, 0xc140, 0x000, M68K_INSN_EXG,        0, 0},
+	{d68000_exg_aa       , 0xf1f8, 0xc148, 0x000, M68K_INSN_EXG,        0, 0},
+	{d68000_exg_da       , 0xf1f8, 0xc188, 0x000, M68K_INSN_EXG,        0, 0},
+	{d68020_extb_32      , 0xfff8, 0x49c0, 0x000, M68K_INSN_EXTB,       4, 0},
+	{d68000_ext_16       , 0xfff8, 0x4880, 0x000, M68K_INSN_EXT,        2, 0},
+	{d68000_ext_32       , 0xfff8, 0x48c0, 0x000, M68K_INSN_EXT,        4, 0},
+	{d68040_fpu          , 0xffc0, 0xf200, 0x000, M68K_INSN_FPU,        0, 0},
+	{d68000_illegal      , 0xffff, 0x4afc, 0x000, M68K_INSN_ILLEGAL,    0, M68K_DASM_FLAG_TRAP},
+	{d68000_jmp          , 0xffc0, 0x4ec0, 0x27b, M68K_INSN_JMP,        0, M68K_DASM_FLAG_BRANCH},
+	{d68000_jsr          , 0xffc0, 0x4e80, 0x27b, M68K_INSN_JSR,        0, M68K_DASM_FLAG_BRANCH|M68K_DASM_FLAG_CALL},
+	{d68000_lea          , 0xf1c0, 0x41c0, 0x27b, M68K_INSN_LEA,        0, 0},
+	{d68000_link_16      , 0xfff8, 0x4e50, 0x000, M68K_INSN_LINK,       0, 0},
+	{d68020_link_32      , 0xfff8, 0x4808, 0x000, M68K_INSN_LINK,       0, 0},
+	{d68000_lsr_s_8      , 0xf1f8, 0xe008, 0x000, M68K_INSN_LSR,        1, 0},
+	{d68000_lsr_s_16     , 0xf1f8, 0xe048, 0x000, M68K_INSN_LSR,        2, 0},
+	{d68000_lsr_s_32     , 0xf1f8, 0xe088, 0x000, M68K_INSN_LSR,        4, 0},
+	{d68000_lsr_r_8      , 0xf1f8, 0xe028, 0x000, M68K_INSN_LSR,        1, 0},
+	{d68000_lsr_r_16     , 0xf1f8, 0xe068, 0x000, M68K_INSN_LSR,        2, 0},
+	{d68000_lsr_r_32     , 0xf1f8, 0xe0a8, 0x000, M68K_INSN_LSR,        4, 0},
+	{d68000_lsr_ea       , 0xffc0, 0xe2c0, 0x3f8, M68K_INSN_LSR,        2, 0},
+	{d68000_lsl_s_8      , 0xf1f8, 0xe108, 0x000, M68K_INSN_LSL,        1, 0},
+	{d68000_lsl_s_16     , 0xf1f8, 0xe148, 0x000, M68K_INSN_LSL,        2, 0},
+	{d68000_lsl_s_32     , 0xf1f8, 0xe188, 0x000, M68K_INSN_LSL,        4, 0},
+	{d68000_lsl_r_8      , 0xf1f8, 0xe128, 0x000, M68K_INSN_LSL,        1, 0},
+	{d68000_lsl_r_16     , 0xf1f8, 0xe168, 0x000, M68K_INSN_LSL,        2, 0},
+	{d68000_lsl_r_32     , 0xf1f8, 0xe1a8, 0x000, M68K_INSN_LSL,        4, 0},
+	{d68000_lsl_ea       , 0xffc0, 0xe3c0, 0x3f8, M68K_INSN_LSL,        2, 0},
+	{d68000_move_8       , 0xf000, 0x1000, 0xbff, M68K_INSN_MOVE,       1, 0},
+	{d68000_move_16      , 0xf000, 0x3000, 0xfff, M68K_INSN_MOVE,       2, 0},
+	{d68000_move_32      , 0xf000, 0x2000, 0xfff, M68K_INSN_MOVE,       4, 0},
+	{d68000_movea_16     , 0xf1c0, 0x3040, 0xfff, M68K_INSN_MOVEA,      2, 0},
+	{d68000_movea_32     , 0xf1c0, 0x2040, 0xfff, M68K_INSN_MOVEA,      4, 0},
+	{d68000_move_to_ccr  , 0xffc0, 0x44c0, 0xbff, M68K_INSN_MOVE,       0, 0},
+	{d68010_move_fr_ccr  , 0xffc0, 0x42c0, 0xbf8, M68K_INSN_MOVE,       0, 0},
+	{d68000_move_to_sr   , 0xffc0, 0x46c0, 0xbff, M68K_INSN_MOVE,       0, 0},
+	{d68000_move_fr_sr   , 0xffc0, 0x40c0, 0xbf8, M68K_INSN_MOVE,       0, 0},
+	{d68000_move_to_usp  , 0xfff8, 0x4e60, 0x000, M68K_INSN_MOVE,       0, 0},
+	{d68000_move_fr_usp  , 0xfff8, 0x4e68, 0x000, M68K_INSN_MOVE,       0, 0},
+	{d68010_movec        , 0xfffe, 0x4e7a, 0x000, M68K_INSN_MOVEC,      0, 0},
+	{d68000_movem_pd_16  , 0xfff8, 0x48a0, 0x000, M68K_INSN_MOVEM,      2, 0},
+	{d68000_movem_pd_32  , 0xfff8, 0x48e0, 0x000, M68K_INSN_MOVEM,      4, 0},
+	{d68000_movem_re_16  , 0xffc0, 0x4880, 0x2f8, M68K_INSN_MOVEM,      2, 0},
+	{d68000_movem_re_32  , 0xffc0, 0x48c0, 0x2f8, M68K_INSN_MOVEM,      4, 0},
+	{d68000_movem_er_16  , 0xffc0, 0x4c80, 0x37b, M68K_INSN_MOVEM,      2, 0},
+	{d68000_movem_er_32  , 0xffc0, 0x4cc0, 0x37b, M68K_INSN_MOVEM,      4, 0},
+	{d68000_movep_er_16  , 0xf1f8, 0x0108, 0x000, M68K_INSN_MOVEP,      2, 0},
+	{d68000_movep_er_32  , 0xf1f8, 0x0148, 0x000, M68K_INSN_MOVEP,      4, 0},
+	{d68000_movep_re_16  , 0xf1f8, 0x0188, 0x000, M68K_INSN_MOVEP,      2, 0},
+	{d68000_movep_re_32  , 0xf1f8, 0x01c8, 0x000, M68K_INSN_MOVEP,      4, 0},
+	{d68010_moves_8      , 0xffc0, 0x0e00, 0x3f8, M68K_INSN_MOVES,      1, 0},
+	{d68010_moves_16     , 0xffc0, 0x0e40, 0x3f8, M68K_INSN_MOVES,      2, 0},
+	{d68010_moves_32     , 0xffc0, 0x0e80, 0x3f8, M68K_INSN_MOVES,      4, 0},
+	{d68000_moveq        , 0xf100, 0x7000, 0x000, M68K_INSN_MOVEQ,      0, 0},
+	{d68040_move16_pi_pi , 0xfff8, 0xf620, 0x000, M68K_INSN_MOVE16,     0, 0},
+	{d68040_move16_pi_al , 0xfff8, 0xf600, 0x000, M68K_INSN_MOVE16,     0, 0},
+	{d68040_move16_al_pi , 0xfff8, 0xf608, 0x000, M68K_INSN_MOVE16,     0, 0},
+	{d68040_move16_ai_al , 0xfff8, 0xf610, 0x000, M68K_INSN_MOVE16,     0, 0},
+	{d68040_move16_al_ai , 0xfff8, 0xf618, 0x000, M68K_INSN_MOVE16,     0, 0},
+	{d68000_muls         , 0xf1c0, 0xc1c0, 0xbff, M68K_INSN_MULS,       2, 0},
+	{d68000_mulu         , 0xf1c0, 0xc0c0, 0xbff, M68K_INSN_MULU,       2, 0},
+	{d68020_mull         , 0xffc0, 0x4c00, 0xbff, M68K_INSN_MULU,       4, 0},
+	{d68000_nbcd         , 0xffc0, 0x4800, 0xbf8, M68K_INSN_NBCD,       0, 0},
+	{d68000_neg_8        , 0xffc0, 0x4400, 0xbf8, M68K_INSN_NEG,        1, 0},
+	{d68000_neg_16       , 0xffc0, 0x4440, 0xbf8, M68K_INSN_NEG,        2, 0},
+	{d68000_neg_32       , 0xffc0, 0x4480, 0xbf8, M68K_INSN_NEG,        4, 0},
+	{d68000_negx_8       , 0xffc0, 0x4000, 0xbf8, M68K_INSN_NEGX,       1, 0},
+	{d68000_negx_16      , 0xffc0, 0x4040, 0xbf8, M68K_INSN_NEGX,       2, 0},
+	{d68000_negx_32      , 0xffc0, 0x4080, 0xbf8, M68K_INSN_NEGX,       4, 0},
+	{d68000_nop          , 0xffff, 0x4e71, 0x000, M68K_INSN_NOP,        0, 0},
+	{d68000_not_8        , 0xffc0, 0x4600, 0xbf8, M68K_INSN_NOT,        1, 0},
+	{d68000_not_16       , 0xffc0, 0x4640, 0xbf8, M68K_INSN_NOT,        2, 0},
+	{d68000_not_32       , 0xffc0, 0x4680, 0xbf8, M68K_INSN_NOT,        4, 0},
+	{d68000_or_er_8      , 0xf1c0, 0x8000, 0xbff, M68K_INSN_OR,         1, 0},
+	{d68000_or_er_16     , 0xf1c0, 0x8040, 0xbff, M68K_INSN_OR,         2, 0},
+	{d68000_or_er_32     , 0xf1c0, 0x8080, 0xbff, M68K_INSN_OR,         4, 0},
+	{d68000_or_re_8      , 0xf1c0, 0x8100, 0x3f8, M68K_INSN_OR,         1, 0},
+	{d68000_or_re_16     , 0xf1c0, 0x8140, 0x3f8, M68K_INSN_OR,         2, 0},
+	{d68000_or_re_32     , 0xf1c0, 0x8180, 0x3f8, M68K_INSN_OR,         4, 0},
+	{d68000_ori_to_ccr   , 0xffff, 0x003c, 0x000, M68K_INSN_ORI,        0, 0},
+	{d68000_ori_to_sr    , 0xffff, 0x007c, 0x000, M68K_INSN_ORI,        0, 0},
+	{d68000_ori_8        , 0xffc0, 0x0000, 0xbf8, M68K_INSN_ORI,        1, 0},
+	{d68000_ori_16       , 0xffc0, 0x0040, 0xbf8, M68K_INSN_ORI,        2, 0},
+	{d68000_ori_32       , 0xffc0, 0x0080, 0xbf8, M68K_INSN_ORI,        4, 0},
+	{d68020_pack_rr      , 0xf1f8, 0x8140, 0x000, M68K_INSN_PACK,       0, 0},
+	{d68020_pack_mm      , 0xf1f8, 0x8148, 0x000, M68K_INSN_PACK,       0, 0},
+	{d68000_pea          , 0xffc0, 0x4840, 0x27b, M68K_INSN_PEA,        0, 0},
+	{d68040_pflush       , 0xffe0, 0xf500, 0x000, M68K_INSN_PFLUSH,     0, 0},
+	{d68000_reset        , 0xffff, 0x4e70, 0x000, M68K_INSN_RESET,      0, 0},
+	{d68000_ror_s_8      , 0xf1f8, 0xe018, 0x000, M68K_INSN_ROR,        1, 0},
+	{d68000_ror_s_16     , 0xf1f8, 0xe058, 0x000, M68K_INSN_ROR,        2, 0},
+	{d68000_ror_s_32     , 0xf1f8, 0xe098, 0x000, M68K_INSN_ROR,        4, 0},
+	{d68000_ror_r_8      , 0xf1f8, 0xe038, 0x000, M68K_INSN_ROR,        1, 0},
+	{d68000_ror_r_16     , 0xf1f8, 0xe078, 0x000, M68K_INSN_ROR,        2, 0},
+	{d68000_ror_r_32     , 0xf1f8, 0xe0b8, 0x000, M68K_INSN_ROR,        4, 0},
+	{d68000_ror_ea       , 0xffc0, 0xe6c0, 0x3f8, M68K_INSN_ROR,        2, 0},
+	{d68000_rol_s_8      , 0xf1f8, 0xe118, 0x000, M68K_INSN_ROL,        1, 0},
+	{d68000_rol_s_16     , 0xf1f8, 0xe158, 0x000, M68K_INSN_ROL,        2, 0},
+	{d68000_rol_s_32     , 0xf1f8, 0xe198, 0x000, M68K_INSN_ROL,        4, 0},
+	{d68000_rol_r_8      , 0xf1f8, 0xe138, 0x000, M68K_INSN_ROL,        1, 0},
+	{d68000_rol_r_16     , 0xf1f8, 0xe178, 0x000, M68K_INSN_ROL,        2, 0},
+	{d68000_rol_r_32     , 0xf1f8, 0xe1b8, 0x000, M68K_INSN_ROL,        4, 0},
+	{d68000_rol_ea       , 0xffc0, 0xe7c0, 0x3f8, M68K_INSN_ROL,        2, 0},
+	{d68000_roxr_s_8     , 0xf1f8, 0xe010, 0x000, M68K_INSN_ROXR,       1, 0},
+	{d68000_roxr_s_16    , 0xf1f8, 0xe050, 0x000, M68K_INSN_ROXR,       2, 0},
+	{d68000_roxr_s_32    , 0xf1f8, 0xe090, 0x000, M68K_INSN_ROXR,       4, 0},
+	{d68000_roxr_r_8     , 0xf1f8, 0xe030, 0x000, M68K_INSN_ROXR,       1, 0},
+	{d68000_roxr_r_16    , 0xf1f8, 0xe070, 0x000, M68K_INSN_ROXR,       2, 0},
+	{d68000_roxr_r_32    , 0xf1f8, 0xe0b0, 0x000, M68K_INSN_ROXR,       4, 0},
+	{d68000_roxr_ea      , 0xffc0, 0xe4c0, 0x3f8, M68K_INSN_ROXR,       2, 0},
+	{d68000_roxl_s_8     , 0xf1f8, 0xe110, 0x000, M68K_INSN_ROXL,       1, 0},
+	{d68000_roxl_s_16    , 0xf1f8, 0xe150, 0x000, M68K_INSN_ROXL,       2, 0},
+	{d68000_roxl_s_32    , 0xf1f8, 0xe190, 0x000, M68K_INSN_ROXL,       4, 0},
+	{d68000_roxl_r_8     , 0xf1f8, 0xe130, 0x000, M68K_INSN_ROXL,       1, 0},
+	{d68000_roxl_r_16    , 0xf1f8, 0xe170, 0x000, M68K_INSN_ROXL,       2, 0},
+	{d68000_roxl_r_32    , 0xf1f8, 0xe1b0, 0x000, M68K_INSN_ROXL,       4, 0},
+	{d68000_roxl_ea      , 0xffc0, 0xe5c0, 0x3f8, M68K_INSN_ROXL,       2, 0},
+	{d68010_rtd          , 0xffff, 0x4e74, 0x000, M68K_INSN_RTD,        0, M68K_DASM_FLAG_BRANCH|M68K_DASM_FLAG_RETURN},
+	{d68000_rte          , 0xffff, 0x4e73, 0x000, M68K_INSN_RTE,        0, M68K_DASM_FLAG_BRANCH|M68K_DASM_FLAG_RETURN},
+	{d68020_rtm          , 0xfff0, 0x06c0, 0x000, M68K_INSN_RTM,        0, M68K_DASM_FLAG_BRANCH|M68K_DASM_FLAG_RETURN},
+	{d68000_rtr          , 0xffff, 0x4e77, 0x000, M68K_INSN_RTR,        0, M68K_DASM_FLAG_BRANCH|M68K_DASM_FLAG_RETURN},
+	{d68000_rts          , 0xffff, 0x4e75, 0x000, M68K_INSN_RTS,        0, M68K_DASM_FLAG_BRANCH|M68K_DASM_FLAG_RETURN},
+	{d68000_sbcd_rr      , 0xf1f8, 0x8100, 0x000, M68K_INSN_SBCD,       0, 0},
+	{d68000_sbcd_mm      , 0xf1f8, 0x8108, 0x000, M68K_INSN_SBCD,       0, 0},
+	{d68000_scc          , 0xf0c0, 0x50c0, 0xbf8, M68K_INSN_SCC,        0, 0},
+	{d68000_stop         , 0xffff, 0x4e72, 0x000, M68K_INSN_STOP,       0, 0},
+	{d68000_sub_er_8     , 0xf1c0, 0x9000, 0xbff, M68K_INSN_SUB,        1, 0},
+	{d68000_sub_er_16    , 0xf1c0, 0x9040, 0xfff, M68K_INSN_SUB,        2, 0},
+	{d68000_sub_er_32    , 0xf1c0, 0x9080, 0xfff, M68K_INSN_SUB,        4, 0},
+	{d68000_sub_re_8     , 0xf1c0, 0x9100, 0x3f8, M68K_INSN_SUB,        1, 0},
+	{d68000_sub_re_16    , 0xf1c0, 0x9140, 0x3f8, M68K_INSN_SUB,        2, 0},
+	{d68000_sub_re_32    , 0xf1c0, 0x9180, 0x3f8, M68K_INSN_SUB,        4, 0},
+	{d68000_suba_16      , 0xf1c0, 0x90c0, 0xfff, M68K_INSN_SUBA,       2, 0},
+	{d68000_suba_32      , 0xf1c0, 0x91c0, 0xfff, M68K_INSN_SUBA,       4, 0},
+	{d68000_subi_8       , 0xffc0, 0x0400, 0xbf8, M68K_INSN_SUBI,       1, 0},
+	{d68000_subi_16      , 0xffc0, 0x0440, 0xbf8, M68K_INSN_SUBI,       2, 0},
+	{d68000_subi_32      , 0xffc0, 0x0480, 0xbf8, M68K_INSN_SUBI,       4, 0},
+	{d68000_subq_8       , 0xf1c0, 0x5100, 0xbf8, M68K_INSN_SUBQ,       1, 0},
+	{d68000_subq_16      , 0xf1c0, 0x5140, 0xff8, M68K_INSN_SUBQ,       2, 0},
+	{d68000_subq_32      , 0xf1c0, 0x5180, 0xff8, M68K_INSN_SUBQ,       4, 0},
+	{d68000_subx_rr_8    , 0xf1f8, 0x9100, 0x000, M68K_INSN_SUBX,       1, 0},
+	{d68000_subx_rr_16   , 0xf1f8, 0x9140, 0x000, M68K_INSN_SUBX,       2, 0},
+	{d68000_subx_rr_32   , 0xf1f8, 0x9180, 0x000, M68K_INSN_SUBX,       4, 0},
+	{d68000_subx_mm_8    , 0xf1f8, 0x9108, 0x000, M68K_INSN_SUBX,       1, 0},
+	{d68000_subx_mm_16   , 0xf1f8, 0x9148, 0x000, M68K_INSN_SUBX,       2, 0},
+	{d68000_subx_mm_32   , 0xf1f8, 0x9188, 0x000, M68K_INSN_SUBX,       4, 0},
+	{d68000_swap         , 0xfff8, 0x4840, 0x000, M68K_INSN_SWAP,       0, 0},
+	{d68000_tas          , 0xffc0, 0x4ac0, 0xbf8, M68K_INSN_TAS,        0, 0},
+	{d68000_trap         , 0xfff0, 0x4e40, 0x000, M68K_INSN_TRAP,       0, M68K_DASM_FLAG_TRAP},
+	{d68020_trapcc_0     , 0xf0ff, 0x50fc, 0x000, M68K_INSN_TRAPCC,     0, M68K_DASM_FLAG_TRAP|M68K_DASM_FLAG_CONDITIONAL},
+	{d68020_trapcc_16    , 0xf0ff, 0x50fa, 0x000, M68K_INSN_TRAPCC,     0, M68K_DASM_FLAG_TRAP|M68K_DASM_FLAG_CONDITIONAL},
+	{d68020_trapcc_32    , 0xf0ff, 0x50fb, 0x000, M68K_INSN_TRAPCC,     0, M68K_DASM_FLAG_TRAP|M68K_DASM_FLAG_CONDITIONAL},
+	{d68000_trapv        , 0xffff, 0x4e76, 0x000, M68K_INSN_TRAPV,      0, M68K_DASM_FLAG_TRAP},
+	{d68000_tst_8        , 0xffc0, 0x4a00, 0xbf8, M68K_INSN_TST,        1, 0},
+	{d68020_tst_pcdi_8   , 0xffff, 0x4a3a, 0x000, M68K_INSN_TST,        1, 0},
+	{d68020_tst_pcix_8   , 0xffff, 0x4a3b, 0x000, M68K_INSN_TST,        1, 0},
+	{d68020_tst_i_8      , 0xffff, 0x4a3c, 0x000, M68K_INSN_TST,        1, 0},
+	{d68000_tst_16       , 0xffc0, 0x4a40, 0xbf8, M68K_INSN_TST,        2, 0},
+	{d68020_tst_a_16     , 0xfff8, 0x4a48, 0x000, M68K_INSN_TST,        2, 0},
+	{d68020_tst_pcdi_16  , 0xffff, 0x4a7a, 0x000, M68K_INSN_TST,        2, 0},
+	{d68020_tst_pcix_16  , 0xffff, 0x4a7b, 0x000, M68K_INSN_TST,        2, 0},
+	{d68020_tst_i_16     , 0xffff, 0x4a7c, 0x000, M68K_INSN_TST,        2, 0},
+	{d68000_tst_32       , 0xffc0, 0x4a80, 0xbf8, M68K_INSN_TST,        4, 0},
+	{d68020_tst_a_32     , 0xfff8, 0x4a88, 0x000, M68K_INSN_TST,        4, 0},
+	{d68020_tst_pcdi_32  , 0xffff, 0x4aba, 0x000, M68K_INSN_TST,        4, 0},
+	{d68020_tst_pcix_32  , 0xffff, 0x4abb, 0x000, M68K_INSN_TST,        4, 0},
+	{d68020_tst_i_32     , 0xffff, 0x4abc, 0x000, M68K_INSN_TST,        4, 0},
+	{d68000_unlk         , 0xfff8, 0x4e58, 0x000, M68K_INSN_UNLK,       0, 0},
+	{d68020_unpk_rr      , 0xf1f8, 0x8180, 0x000, M68K_INSN_UNPK,       0, 0},
+	{d68020_unpk_mm      , 0xf1f8, 0x8188, 0x000, M68K_INSN_UNPK,       0, 0},
+	{d68851_p000         , 0xffc0, 0xf000, 0x000, M68K_INSN_PMMU,       0, 0},
+	{d68851_pbcc16       , 0xffc0, 0xf080, 0x000, M68K_INSN_PBCC,       0, M68K_DASM_FLAG_BRANCH|M68K_DASM_FLAG_CONDITIONAL},
+	{d68851_pbcc32       , 0xffc0, 0xf0c0, 0x000, M68K_INSN_PBCC,       0, M68K_DASM_FLAG_BRANCH|M68K_DASM_FLAG_CONDITIONAL},
+	{d68851_pdbcc        , 0xfff8, 0xf048, 0x000, M68K_INSN_PDBCC,      0, M68K_DASM_FLAG_BRANCH|M68K_DASM_FLAG_CONDITIONAL},
+	{d68851_p001         , 0xffc0, 0xf040, 0x000, M68K_INSN_PMMU,       0, 0},
+	/* Last, what opcodes that match nothing decode as */
+	{d68000_illegal      , 0x0000, 0x0000, 0x000, M68K_INSN_ILLEGAL,    0, M68K_DASM_FLAG_TRAP}
 };
 
+#define ILLEGAL_INDEX (ARRAY_LENGTH(g_opcode_info) - 1)
+
+#if M68K_DASM_PREBUILT_TABLES
+/* Fails to compile if m68kdasmtab.h is older than g_opcode_info */
+typedef char dasm_tables_match_opcode_info[ARRAY_LENGTH(g_opcode_info) == DASM_TABLE_OPCODE_COUNT ? 1 : -1];
+
+static void init_tables(void)
+{
+}
+#else
+
 /* Check if opcode is using a valid ea mode */
 static int valid_ea(uint opcode, uint mask)
 {
@@ -3659,11 +4390,13 @@ static int valid_ea(uint opcode, uint mask)
 
 }
 
-/* Used by qsort */
+/* Used by qsort on indexes into g_opcode_info */
 static int DECL_SPEC compare_nof_true_bits(const void *aptr, const void *bptr)
 {
-	uint a = ((const opcode_struct*)aptr)->mask;
-	uint b = ((const opcode_struct*)bptr)->mask;
+	uint ia = *(const unsigned short*)aptr;
+	uint ib = *(const unsigned short*)bptr;
+	uint a = g_opcode_info[ia].mask;
+	uint b = g_opcode_info[ib].mask;
 
 	a = ((a & 0xAAAA) >> 1) + (a & 0x5555);
 	a = ((a & 0xCCCC) >> 2) + (a & 0x3333);
@@ -3675,328 +4408,474 @@ static int DECL_SPEC compare_nof_true_bits(const void *aptr, const void *bptr)
 	b = ((b & 0xF0F0) >> 4) + (b & 0x0F0F);
 	b = ((b & 0xFF00) >> 8) + (b & 0x00FF);
 
-	return b - a; /* reversed to get greatest to least sorting */
-}
-
-/* build the opcode handler jump table */
-static void build_opcode_table(void)
-{
-	uint i;
-	uint opcode;
-	opcode_struct* ostruct;
-	opcode_struct opcode_info[ARRAY_LENGTH(g_opcode_info)];
-
-	memcpy(opcode_info, g_opcode_info, sizeof(g_opcode_info));
-	qsort((void *)opcode_info, ARRAY_LENGTH(opcode_info)-1, sizeof(opcode_info[0]), compare_nof_true_bits);
-
-	for(i=0;i<0x10000;i++)
-	{
-		g_instruction_table[i] = d68000_illegal; /* default to illegal */
-		opcode = i;
-		/* search through opcode info for a match */
-		for(ostruct = opcode_info;ostruct->opcode_handler != 0;ostruct++)
-		{
-			/* match opcode mask and allowed ea modes */
-			if((opcode & ostruct->mask) == ostruct->match)
-			{
-				/* Handle destination ea for move instructions */
-				if((ostruct->opcode_handler == d68000_move_8 ||
-					 ostruct->opcode_handler == d68000_move_16 ||
-					 ostruct->opcode_handler == d68000_move_32) &&
-					 !valid_ea(((opcode>>9)&7) | ((opcode>>3)&0x38), 0xbf8))
-						continue;
-				if(valid_ea(opcode, ostruct->ea_mask))
-				{
-					g_instruction_table[i] = ostruct->opcode_handler;
-					break;
-				}
-			}
-		}
-	}
-}
-
-
-
-/* ======================================================================== */
-/* ================================= API ================================== */
-/* ======================================================================== */
-
-/* Disasemble one instruction at pc and store in str_buff */
-unsigned int m68k_disassemble(char* str_buff, unsigned int pc, unsigned int cpu_type)
-{
-	if(!g_initialized)
-	{
-		build_opcode_table();
-		g_initialized = 1;
-	}
-	switch(cpu_type)
-	{
-		case M68K_CPU_TYPE_68000:
-			g_cpu_type = TYPE_68000;
-			g_address_mask = 0x00ffffff;
-			break;
-		case M68K_CPU_TYPE_68010:
-			g_cpu_type = TYPE_68010;
-			g_address_mask = 0x00ffffff;
-			break;
-		case M68K_CPU_TYPE_68EC020:
-			g_cpu_type = TYPE_68020;
-			g_address_mask = 0x00ffffff;
-			break;
-		case M68K_CPU_TYPE_68020:
-			g_cpu_type = TYPE_68020;
-			g_address_mask = 0xffffffff;
-			break;
-		case M68K_CPU_TYPE_68EC030:
-		case M68K_CPU_TYPE_68030:
-			g_cpu_type = TYPE_68030;
-			g_address_mask = 0xffffffff;
-			break;
-		case M68K_CPU_TYPE_68040:
-		case M68K_CPU_TYPE_68EC040:
-		case M68K_CPU_TYPE_68LC040:
-			g_cpu_type = TYPE_68040;
-			g_address_mask = 0xffffffff;
-			break;
-		default:
-			return 0;
-	}
-
-	g_cpu_pc = pc;
-	g_helper_str[0] = 0;
-	g_cpu_ir = read_imm_16();
-	g_opcode_type = 0;
-	g_instruction_table[g_cpu_ir]();
-	sprintf(str_buff, "%s%s", g_dasm_str, g_helper_str);
-	return COMBINE_OPCODE_FLAGS(g_cpu_pc - pc);
+	if(a != b)
+		return b - a; /* reversed to get greatest to least sorting */
+	return ia - ib;   /* keep the table order, so any qsort gives the same tables */
 }
 
-char* m68ki_disassemble_quick(unsigned int pc, unsigned int cpu_type)
-{
-	static char buff[100];
-	buff[0] = 0;
-	m68k_disassemble(buff, pc, cpu_type);
-	return buff;
-}
-
-unsigned int m68k_disassemble_raw(char* str_buff, unsigned int pc, const unsigned char* opdata, const unsigned char* argdata, unsigned int cpu_type)
-{
-	unsigned int result;
-	(void)argdata;
-
-	g_rawop = opdata;
-	g_rawbasepc = pc;
-	result = m68k_disassemble(str_buff, pc, cpu_type);
-	g_rawop = NULL;
-	return result;
-}
-
-/* Check if the instruction is a valid one */
-unsigned int m68k_is_valid_instruction(unsigned int instruction, unsigned int cpu_type)
+/* Check if an opcode handler exists on a CPU type */
+static int handler_is_valid(void (*handler)(m68k_dasm_context* ctx), unsigned int cpu_type)
 {
-	if(!g_initialized)
-	{
-		build_opcode_table();
-		g_initialized = 1;
-	}
-
-	instruction &= 0xffff;
-	if(g_instruction_table[instruction] == d68000_illegal)
+	if(handler == d68000_illegal)
 		return 0;
 
 	switch(cpu_type)
 	{
 		case M68K_CPU_TYPE_68000:
-			if(g_instruction_table[instruction] == d68010_bkpt)
+			if(handler == d68010_bkpt)
 				return 0;
-			if(g_instruction_table[instruction] == d68010_move_fr_ccr)
+			if(handler == d68010_move_fr_ccr)
 				return 0;
-			if(g_instruction_table[instruction] == d68010_movec)
+			if(handler == d68010_movec)
 				return 0;
-			if(g_instruction_table[instruction] == d68010_moves_8)
+			if(handler == d68010_moves_8)
 				return 0;
-			if(g_instruction_table[instruction] == d68010_moves_16)
+			if(handler == d68010_moves_16)
 				return 0;
-			if(g_instruction_table[instruction] == d68010_moves_32)
+			if(handler == d68010_moves_32)
 				return 0;
-			if(g_instruction_table[instruction] == d68010_rtd)
+			if(handler == d68010_rtd)
 				return 0;
 			// Fallthrough
 		case M68K_CPU_TYPE_68010:
-			if(g_instruction_table[instruction] == d68020_bcc_32)
+			if(handler == d68020_bcc_32)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_bfchg)
+			if(handler == d68020_bfchg)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_bfclr)
+			if(handler == d68020_bfclr)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_bfexts)
+			if(handler == d68020_bfexts)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_bfextu)
+			if(handler == d68020_bfextu)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_bfffo)
+			if(handler == d68020_bfffo)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_bfins)
+			if(handler == d68020_bfins)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_bfset)
+			if(handler == d68020_bfset)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_bftst)
+			if(handler == d68020_bftst)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_bra_32)
+			if(handler == d68020_bra_32)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_bsr_32)
+			if(handler == d68020_bsr_32)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_callm)
+			if(handler == d68020_callm)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_cas_8)
+			if(handler == d68020_cas_8)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_cas_16)
+			if(handler == d68020_cas_16)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_cas_32)
+			if(handler == d68020_cas_32)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_cas2_16)
+			if(handler == d68020_cas2_16)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_cas2_32)
+			if(handler == d68020_cas2_32)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_chk_32)
+			if(handler == d68020_chk_32)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_chk2_cmp2_8)
+			if(handler == d68020_chk2_cmp2_8)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_chk2_cmp2_16)
+			if(handler == d68020_chk2_cmp2_16)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_chk2_cmp2_32)
+			if(handler == d68020_chk2_cmp2_32)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_cmpi_pcdi_8)
+			if(handler == d68020_cmpi_pcdi_8)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_cmpi_pcix_8)
+			if(handler == d68020_cmpi_pcix_8)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_cmpi_pcdi_16)
+			if(handler == d68020_cmpi_pcdi_16)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_cmpi_pcix_16)
+			if(handler == d68020_cmpi_pcix_16)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_cmpi_pcdi_32)
+			if(handler == d68020_cmpi_pcdi_32)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_cmpi_pcix_32)
+			if(handler == d68020_cmpi_pcix_32)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_cpbcc_16)
+			if(handler == d68020_cpbcc_16)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_cpbcc_32)
+			if(handler == d68020_cpbcc_32)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_cpdbcc)
+			if(handler == d68020_cpdbcc)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_cpgen)
+			if(handler == d68020_cpgen)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_cprestore)
+			if(handler == d68020_cprestore)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_cpsave)
+			if(handler == d68020_cpsave)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_cpscc)
+			if(handler == d68020_cpscc)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_cptrapcc_0)
+			if(handler == d68020_cptrapcc_0)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_cptrapcc_16)
+			if(handler == d68020_cptrapcc_16)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_cptrapcc_32)
+			if(handler == d68020_cptrapcc_32)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_divl)
+			if(handler == d68020_divl)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_extb_32)
+			if(handler == d68020_extb_32)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_link_32)
+			if(handler == d68020_link_32)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_mull)
+			if(handler == d68020_mull)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_pack_rr)
+			if(handler == d68020_pack_rr)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_pack_mm)
+			if(handler == d68020_pack_mm)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_rtm)
+			if(handler == d68020_rtm)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_trapcc_0)
+			if(handler == d68020_trapcc_0)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_trapcc_16)
+			if(handler == d68020_trapcc_16)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_trapcc_32)
+			if(handler == d68020_trapcc_32)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_tst_pcdi_8)
+			if(handler == d68020_tst_pcdi_8)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_tst_pcix_8)
+			if(handler == d68020_tst_pcix_8)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_tst_i_8)
+			if(handler == d68020_tst_i_8)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_tst_a_16)
+			if(handler == d68020_tst_a_16)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_tst_pcdi_16)
+			if(handler == d68020_tst_pcdi_16)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_tst_pcix_16)
+			if(handler == d68020_tst_pcix_16)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_tst_i_16)
+			if(handler == d68020_tst_i_16)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_tst_a_32)
+			if(handler == d68020_tst_a_32)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_tst_pcdi_32)
+			if(handler == d68020_tst_pcdi_32)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_tst_pcix_32)
+			if(handler == d68020_tst_pcix_32)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_tst_i_32)
+			if(handler == d68020_tst_i_32)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_unpk_rr)
+			if(handler == d68020_unpk_rr)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_unpk_mm)
+			if(handler == d68020_unpk_mm)
 				return 0;
 			// Fallthrough
 		case M68K_CPU_TYPE_68EC020:
 		case M68K_CPU_TYPE_68020:
 		case M68K_CPU_TYPE_68030:
 		case M68K_CPU_TYPE_68EC030:
-			if(g_instruction_table[instruction] == d68040_cinv)
+			if(handler == d68040_cinv)
 				return 0;
-			if(g_instruction_table[instruction] == d68040_cpush)
+			if(handler == d68040_cpush)
 				return 0;
-			if(g_instruction_table[instruction] == d68040_move16_pi_pi)
+			if(handler == d68040_move16_pi_pi)
 				return 0;
-			if(g_instruction_table[instruction] == d68040_move16_pi_al)
+			if(handler == d68040_move16_pi_al)
 				return 0;
-			if(g_instruction_table[instruction] == d68040_move16_al_pi)
+			if(handler == d68040_move16_al_pi)
 				return 0;
-			if(g_instruction_table[instruction] == d68040_move16_ai_al)
+			if(handler == d68040_move16_ai_al)
 				return 0;
-			if(g_instruction_table[instruction] == d68040_move16_al_ai)
+			if(handler == d68040_move16_al_ai)
 				return 0;
 			// Fallthrough
 		case M68K_CPU_TYPE_68040:
 		case M68K_CPU_TYPE_68EC040:
 		case M68K_CPU_TYPE_68LC040:
-			if(g_instruction_table[instruction] == d68020_cpbcc_16)
+			if(handler == d68020_cpbcc_16)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_cpbcc_32)
+			if(handler == d68020_cpbcc_32)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_cpdbcc)
+			if(handler == d68020_cpdbcc)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_cpgen)
+			if(handler == d68020_cpgen)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_cprestore)
+			if(handler == d68020_cprestore)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_cpsave)
+			if(handler == d68020_cpsave)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_cpscc)
+			if(handler == d68020_cpscc)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_cptrapcc_0)
+			if(handler == d68020_cptrapcc_0)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_cptrapcc_16)
+			if(handler == d68020_cptrapcc_16)
 				return 0;
-			if(g_instruction_table[instruction] == d68020_cptrapcc_32)
+			if(handler == d68020_cptrapcc_32)
 				return 0;
-			if(g_instruction_table[instruction] == d68040_pflush)
+			if(handler == d68040_pflush)
 				return 0;
 	}
 	if(cpu_type != M68K_CPU_TYPE_68020 && cpu_type != M68K_CPU_TYPE_68EC020 &&
-	  (g_instruction_table[instruction] == d68020_callm ||
-	  g_instruction_table[instruction] == d68020_rtm))
+	  (handler == d68020_callm ||
+	  handler == d68020_rtm))
 		return 0;
 
 	return 1;
 }
 
+/* build the opcode handler jump table and the validity bitmaps */
+static void build_opcode_table(void)
+{
+	/* A CPU type of each validity group */
+	static const uint group_cpu_types[VALID_GROUP_COUNT] =
+	{
+		M68K_CPU_TYPE_68000, M68K_CPU_TYPE_68010, M68K_CPU_TYPE_68020,
+		M68K_CPU_TYPE_68030, M68K_CPU_TYPE_68040, M68K_CPU_TYPE_INVALID
+	};
+	/* g_opcode_info sorted by how specific the mask is */
+	unsigned short order[ILLEGAL_INDEX];
+	uint i, j;
+	uint group;
+	uint opcode;
+	const opcode_struct* ostruct;
+
+	for(i=0;i<ILLEGAL_INDEX;i++)
+		order[i] = i;
+	qsort((void *)order, ILLEGAL_INDEX, sizeof(order[0]), compare_nof_true_bits);
+
+	memset(g_valid_instructions, 0, sizeof(g_valid_instructions));
+	for(i=0;i<0x10000;i++)
+	{
+		g_instruction_index[i] = ILLEGAL_INDEX; /* default to illegal */
+		opcode = i;
+		/* search through opcode info for a match */
+		for(j=0;j<ILLEGAL_INDEX;j++)
+		{
+			ostruct = &g_opcode_info[order[j]];
+			/* match opcode mask and allowed ea modes */
+			if((opcode & ostruct->mask) == ostruct->match)
+			{
+				/* Handle destination ea for move instructions */
+				if((ostruct->opcode_handler == d68000_move_8 ||
+					 ostruct->opcode_handler == d68000_move_16 ||
+					 ostruct->opcode_handler == d68000_move_32) &&
+					 !valid_ea(((opcode>>9)&7) | ((opcode>>3)&0x38), 0xbf8))
+						continue;
+				if(valid_ea(opcode, ostruct->ea_mask))
+				{
+					g_instruction_index[i] = order[j];
+					break;
+				}
+			}
+		}
+		for(group=0;group<VALID_GROUP_COUNT;group++)
+			if(handler_is_valid(g_opcode_info[g_instruction_index[i]].opcode_handler, group_cpu_types[group]))
+				g_valid_instructions[group][i >> 3] |= 1 << (i & 7);
+	}
+}
+
+static void init_tables(void)
+{
+	if(!g_initialized)
+	{
+		build_opcode_table();
+		g_initialized = 1;
+	}
+}
+
+#endif /* M68K_DASM_PREBUILT_TABLES */
+
+
+
+/* ======================================================================== */
+/* ================================= API ================================== */
+/* ======================================================================== */
+
+static int dasm_set_cpu_type(m68k_dasm_context* ctx, unsigned int cpu_type)
+{
+	switch(cpu_type)
+	{
+		case M68K_CPU_TYPE_68000:
+			ctx->cpu_type = TYPE_68000;
+			ctx->address_mask = 0x00ffffff;
+			break;
+		case M68K_CPU_TYPE_68010:
+			ctx->cpu_type = TYPE_68010;
+			ctx->address_mask = 0x00ffffff;
+			break;
+		case M68K_CPU_TYPE_68EC020:
+			ctx->cpu_type = TYPE_68020;
+			ctx->address_mask = 0x00ffffff;
+			break;
+		case M68K_CPU_TYPE_68020:
+			ctx->cpu_type = TYPE_68020;
+			ctx->address_mask = 0xffffffff;
+			break;
+		case M68K_CPU_TYPE_68EC030:
+		case M68K_CPU_TYPE_68030:
+			ctx->cpu_type = TYPE_68030;
+			ctx->address_mask = 0xffffffff;
+			break;
+		case M68K_CPU_TYPE_68040:
+		case M68K_CPU_TYPE_68EC040:
+		case M68K_CPU_TYPE_68LC040:
+			ctx->cpu_type = TYPE_68040;
+			ctx->address_mask = 0xffffffff;
+			break;
+		default:
+			return 0;
+	}
+	return 1;
+}
+
+int m68k_dasm_init_context(m68k_dasm_context* ctx, unsigned int cpu_type)
+{
+	init_tables();
+	memset(ctx, 0, sizeof(*ctx));
+	return dasm_set_cpu_type(ctx, cpu_type);
+}
+
+void m68k_dasm_set_buffer(m68k_dasm_context* ctx, const unsigned char* data, unsigned int address, unsigned int size)
+{
+	ctx->buffer = data;
+	ctx->buffer_address = address;
+	ctx->buffer_size = data ? size : 0;
+}
+
+unsigned int m68k_dasm_decode(m68k_dasm_context* ctx, unsigned int pc, m68k_dasm_instruction* insn, char* str_buff)
+{
+	m68k_dasm_instruction scratch;
+	const opcode_struct* ostruct;
+	const m68k_dasm_operand* op;
+
+	if(insn == NULL)
+		insn = &scratch;
+	ctx->insn = insn;
+	ctx->text = str_buff != NULL;
+	ctx->pc = pc;
+	ctx->helper_str[0] = 0;
+	ctx->opcode_type = 0;
+	ctx->ir = read_imm_16();
+
+	ostruct = &g_opcode_info[g_instruction_index[ctx->ir]];
+	insn->pc = pc;
+	insn->opcode = ctx->ir;
+	insn->mnemonic = ostruct->mnemonic;
+	insn->size = ostruct->size;
+	insn->condition = 0;
+	insn->flags = ostruct->flags;
+	insn->target = 0;
+	insn->operand_count = 0;
+	ostruct->opcode_handler(ctx);
+	insn->length = ctx->pc - pc;
+
+	/* jmp and jsr to an absolute or PC relative address */
+	if((insn->flags & (M68K_DASM_FLAG_BRANCH | M68K_DASM_FLAG_TARGET)) == M68K_DASM_FLAG_BRANCH && insn->operand_count == 1)
+	{
+		op = &insn->operands[0];
+		if(op->flags & M68K_DASM_OPFLAG_ADDRESS)
+		{
+			insn->target = op->value;
+			insn->flags |= M68K_DASM_FLAG_TARGET;
+		}
+	}
+
+	if(str_buff != NULL)
+		sprintf(str_buff, "%s%s", ctx->str, ctx->helper_str);
+	return insn->length;
+}
+
+const char* m68k_dasm_mnemonic_name(unsigned int mnemonic)
+{
+	if(mnemonic >= M68K_INSN_COUNT)
+		return "?";
+	return g_mnemonic_names[mnemonic];
+}
+
+/* Disasemble one instruction at pc and store in str_buff */
+unsigned int m68k_disassemble(char* str_buff, unsigned int pc, unsigned int cpu_type)
+{
+	m68k_dasm_context* ctx = &g_dasm_context;
+	uint length;
+
+	init_tables();
+	if(!dasm_set_cpu_type(ctx, cpu_type))
+		return 0;
+
+	length = m68k_dasm_decode(ctx, pc, NULL, str_buff);
+	return COMBINE_OPCODE_FLAGS(length);
+}
+
+char* m68ki_disassemble_quick(unsigned int pc, unsigned int cpu_type)
+{
+	static char buff[100];
+	buff[0] = 0;
+	m68k_disassemble(buff, pc, cpu_type);
+	return buff;
+}
+
+unsigned int m68k_disassemble_raw(char* str_buff, unsigned int pc, const unsigned char* opdata, const unsigned char* argdata, unsigned int cpu_type)
+{
+	unsigned int result;
+	(void)argdata;
+
+	m68k_dasm_set_buffer(&g_dasm_context, opdata, pc, 0xffffffff);
+	result = m68k_disassemble(str_buff, pc, cpu_type);
+	m68k_dasm_set_buffer(&g_dasm_context, NULL, 0, 0);
+	return result;
+}
+
+/* Check if the instruction is a valid one */
+unsigned int m68k_is_valid_instruction(unsigned int instruction, unsigned int cpu_type)
+{
+	uint group = cpu_type < ARRAY_LENGTH(g_valid_group) ? g_valid_group[cpu_type] : VALID_OTHER;
+
+	init_tables();
+	instruction &= 0xffff;
+	return (g_valid_instructions[group][instruction >> 3] >> (instruction & 7)) & 1;
+}
+
+
+#ifdef M68K_DASM_GENERATOR
+
+unsigned int m68k_read_disassembler_8(unsigned int address)  {(void)address; return 0;}
+unsigned int m68k_read_disassembler_16(unsigned int address) {(void)address; return 0;}
+unsigned int m68k_read_disassembler_32(unsigned int address) {(void)address; return 0;}
+
+/* Write g_instruction_index and g_valid_instructions as C source */
+int main(int argc, char* argv[])
+{
+	FILE* filep;
+	uint i;
+	uint group;
+
+	if(argc != 2)
+	{
+		fprintf(stderr, "Usage: %s <output file>\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+	if((filep = fopen(argv[1], "w")) == NULL)
+	{
+		fprintf(stderr, "Unable to create %s\n", argv[1]);
+		return EXIT_FAILURE;
+	}
+	build_opcode_table();
+
+	fprintf(filep, "/* Generated from m68kdasm.c with M68K_DASM_GENERATOR.  Do not edit. */\n\n");
+	fprintf(filep, "#define DASM_TABLE_OPCODE_COUNT %u\n\n", (uint)ARRAY_LENGTH(g_opcode_info));
+	fprintf(filep, "static const unsigned short g_instruction_index[0x10000] =\n{\n");
+	for(i=0;i<0x10000;i++)
+		fprintf(filep, "%s%u,%s", (i & 15) ? "" : "\t", g_instruction_index[i], (i & 15) == 15 ? "\n" : "");
+	fprintf(filep, "};\n\n");
+	fprintf(filep, "static const unsigned char g_valid_instructions[VALID_GROUP_COUNT][0x10000 / 8] =\n{\n");
+	for(group=0;group<VALID_GROUP_COUNT;group++)
+	{
+		fprintf(filep, "\t{\n");
+		for(i=0;i<0x2000;i++)
+			fprintf(filep, "%s0x%02x,%s", (i & 15) ? "" : "\t\t", g_valid_instructions[group][i], (i & 15) == 15 ? "\n" : "");
+		fprintf(filep, "\t},\n");
+	}
+	fprintf(filep, "};\n");
+
+	if(fclose(filep) != 0)
+	{
+		fprintf(stderr, "Unable to write %s\n", argv[1]);
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
+
+#endif /* M68K_DASM_GENERATOR */
+
 // f028 2215 0008
 
 /* ======================================================================== */
@@ -1,6 +1,7 @@
 #include <math.h>
 #include <stdio.h>
 #include <stdarg.h>
+#include <string.h>
 
 extern void exit(int);
 
@@ -65,6 +66,14 @@ static inline floatx80 load_extended_float80(uint32 ea)
 	uint32 d1,d2;
 	uint16 d3;
 	floatx80 fp;
+	uint8 *p = m68ki_direct_ptr(ea, 12, FLAG_S | m68ki_get_address_space());
+
+	if (p != NULL)
+	{
+		fp.high = m68ki_host_read_16(p);
+		fp.low = ((uint64)m68ki_host_read_32(p+4)<<32) | m68ki_host_read_32(p+8);
+		return fp;
+	}
 
 	d3 = m68ki_read_16(ea);
 	d1 = m68ki_read_32(ea+4);
@@ -78,6 +87,20 @@ static inline floatx80 load_extended_float80(uint32 ea)
 
 static inline void store_extended_float80(uint32 ea, floatx80 fpr)
 {
+	uint8 *p = m68ki_direct_ptr(ea, 12, FLAG_S | FUNCTION_CODE_USER_DATA);
+
+	if (p != NULL)
+	{
+		m68ki_trace_buffer_write(ea, fpr.high << 16, 4); /* auto-disable (see m68kcpu.h) */
+		m68ki_trace_buffer_write(ea + 4, (fpr.low>>32)&0xffffffff, 4);
+		m68ki_trace_buffer_write(ea + 8, fpr.low&0xffffffff, 4);
+		m68ki_host_write_16(p, fpr.high);
+		m68ki_host_write_16(p+2, 0);
+		m68ki_host_write_32(p+4, (fpr.low>>32)&0xffffffff);
+		m68ki_host_write_32(p+8, fpr.low&0xffffffff);
+		return;
+	}
+
 	m68ki_write_16(ea+0, fpr.high);
 	m68ki_write_16(ea+2, 0);
 	m68ki_write_32(ea+4, (fpr.low>>32)&0xffffffff);
@@ -267,8 +290,25 @@ static inline void store_pack_float80(uint32 ea, int k, floatx80 fpr)
 	m68ki_write_32(ea+8, dw3);
 }
 
+// Condition codes are evaluated lazily: SET_CONDITION_CODES() only records
+// the result, and GET_FPSR() folds it into FPSR whenever FPSR is about to
+// be read or tested.
 static inline void SET_CONDITION_CODES(floatx80 reg)
 {
+	m68ki_cpu.fpcc_result = reg;
+	m68ki_cpu.fpcc_pending = 1;
+}
+
+static uint GET_FPSR(void)
+{
+	floatx80 reg = m68ki_cpu.fpcc_result;
+
+	if (!m68ki_cpu.fpcc_pending)
+	{
+		return REG_FPSR;
+	}
+	m68ki_cpu.fpcc_pending = 0;
+
 	REG_FPSR &= ~(FPCC_N|FPCC_Z|FPCC_I|FPCC_NAN);
 
 	// sign flag
@@ -294,13 +334,16 @@ static inline void SET_CONDITION_CODES(floatx80 reg)
 	{
 		REG_FPSR |= FPCC_NAN;
 	}
+
+	return REG_FPSR;
 }
 
 static inline int TEST_CONDITION(int condition)
 {
-	int n = (REG_FPSR & FPCC_N) != 0;
-	int z = (REG_FPSR & FPCC_Z) != 0;
-	int nan = (REG_FPSR & FPCC_NAN) != 0;
+	uint fpsr = GET_FPSR();
+	int n = (fpsr & FPCC_N) != 0;
+	int z = (fpsr & FPCC_Z) != 0;
+	int nan = (fpsr & FPCC_NAN) != 0;
 	int r = 0;
 	switch (condition)
 	{
@@ -1180,6 +1223,11 @@ static void fpgen_rm_reg(uint16 w2)
 
 
 
+	// The transcendentals (FSIN ... FLOG2, FSINCOS) go through the host libm:
+	// the operand is rounded to a double with fx80_to_double() and the result
+	// converted back.  They only have double precision: 53 of the 64 mantissa
+	// bits, and operands outside the double exponent range overflow to
+	// infinity or underflow to zero first.  "make fpu_bench" times them.
 	switch (opmode)
 	{
 		case 0x00:		// FMOVE
@@ -1197,6 +1245,13 @@ static void fpgen_rm_reg(uint16 w2)
 	  		SET_CONDITION_CODES(REG_FP[dst]);  // JFF needs update condition codes
 			break;
 		}
+		case 0x02:		// FSINH
+		{
+			REG_FP[dst] = double_to_fx80(sinh(fx80_to_double(source)));
+			SET_CONDITION_CODES(REG_FP[dst]);
+			USE_CYCLES(687);
+			break;
+		}
 		case 0x03:		// FsintRZ
 		{
 			sint32 temp;
@@ -1212,6 +1267,104 @@ static void fpgen_rm_reg(uint16 w2)
 			USE_CYCLES(109);
 			break;
 		}
+		case 0x06:		// FLOGNP1
+		{
+			REG_FP[dst] = double_to_fx80(log1p(fx80_to_double(source)));
+			SET_CONDITION_CODES(REG_FP[dst]);
+			USE_CYCLES(571);
+			break;
+		}
+		case 0x08:		// FETOXM1
+		{
+			REG_FP[dst] = double_to_fx80(expm1(fx80_to_double(source)));
+			SET_CONDITION_CODES(REG_FP[dst]);
+			USE_CYCLES(545);
+			break;
+		}
+		case 0x09:		// FTANH
+		{
+			REG_FP[dst] = double_to_fx80(tanh(fx80_to_double(source)));
+			SET_CONDITION_CODES(REG_FP[dst]);
+			USE_CYCLES(661);
+			break;
+		}
+		case 0x0a:		// FATAN
+		{
+			REG_FP[dst] = double_to_fx80(atan(fx80_to_double(source)));
+			SET_CONDITION_CODES(REG_FP[dst]);
+			USE_CYCLES(403);
+			break;
+		}
+		case 0x0c:		// FASIN
+		{
+			REG_FP[dst] = double_to_fx80(asin(fx80_to_double(source)));
+			SET_CONDITION_CODES(REG_FP[dst]);
+			USE_CYCLES(581);
+			break;
+		}
+		case 0x0d:		// FATANH
+		{
+			REG_FP[dst] = double_to_fx80(atanh(fx80_to_double(source)));
+			SET_CONDITION_CODES(REG_FP[dst]);
+			USE_CYCLES(693);
+			break;
+		}
+		case 0x0e:		// FSIN
+		{
+			REG_FP[dst] = double_to_fx80(sin(fx80_to_double(source)));
+			SET_CONDITION_CODES(REG_FP[dst]);
+			USE_CYCLES(391);
+			break;
+		}
+		case 0x0f:		// FTAN
+		{
+			REG_FP[dst] = double_to_fx80(tan(fx80_to_double(source)));
+			SET_CONDITION_CODES(REG_FP[dst]);
+			USE_CYCLES(473);
+			break;
+		}
+		case 0x10:		// FETOX
+		{
+			REG_FP[dst] = double_to_fx80(exp(fx80_to_double(source)));
+			SET_CONDITION_CODES(REG_FP[dst]);
+			USE_CYCLES(497);
+			break;
+		}
+		case 0x11:		// FTWOTOX
+		{
+			REG_FP[dst] = double_to_fx80(exp2(fx80_to_double(source)));
+			SET_CONDITION_CODES(REG_FP[dst]);
+			USE_CYCLES(567);
+			break;
+		}
+		case 0x12:		// FTENTOX
+		{
+			REG_FP[dst] = double_to_fx80(pow(10.0, fx80_to_double(source)));
+			SET_CONDITION_CODES(REG_FP[dst]);
+			USE_CYCLES(567);
+			break;
+		}
+		case 0x14:		// FLOGN
+		{
+			REG_FP[dst] = double_to_fx80(log(fx80_to_double(source)));
+			SET_CONDITION_CODES(REG_FP[dst]);
+			USE_CYCLES(525);
+			break;
+		}
+		case 0x15:		// FLOG10
+		{
+			REG_FP[dst] = double_to_fx80(log10(fx80_to_double(source)));
+			SET_CONDITION_CODES(REG_FP[dst]);
+			USE_CYCLES(581);
+			break;
+		}
+		case 0x16:		// FLOG2
+		{
+			REG_FP[dst] = double_to_fx80(log2(fx80_to_double(source)));
+			SET_CONDITION_CODES(REG_FP[dst]);
+			USE_CYCLES(581);
+			break;
+		}
 		case 0x18:		// FABS
 		{
 			REG_FP[dst] = source;
@@ -1220,6 +1373,13 @@ static void fpgen_rm_reg(uint16 w2)
 			USE_CYCLES(3);
 			break;
 		}
+		case 0x19:		// FCOSH
+		{
+			REG_FP[dst] = double_to_fx80(cosh(fx80_to_double(source)));
+			SET_CONDITION_CODES(REG_FP[dst]);
+			USE_CYCLES(607);
+			break;
+		}
 		case 0x1a:		// FNEG
 		{
 			REG_FP[dst] = source;
@@ -1228,6 +1388,20 @@ static void fpgen_rm_reg(uint16 w2)
 			USE_CYCLES(3);
 			break;
 		}
+		case 0x1c:		// FACOS
+		{
+			REG_FP[dst] = double_to_fx80(acos(fx80_to_double(source)));
+			SET_CONDITION_CODES(REG_FP[dst]);
+			USE_CYCLES(625);
+			break;
+		}
+		case 0x1d:		// FCOS
+		{
+			REG_FP[dst] = double_to_fx80(cos(fx80_to_double(source)));
+			SET_CONDITION_CODES(REG_FP[dst]);
+			USE_CYCLES(391);
+			break;
+		}
 		case 0x1e:		// FGETEXP
 		{
 			sint16 temp;
@@ -1275,6 +1449,23 @@ static void fpgen_rm_reg(uint16 w2)
 			USE_CYCLES(9);
 			break;
 		}
+		case 0x30:		// FSINCOS
+		case 0x31:
+		case 0x32:
+		case 0x33:
+		case 0x34:
+		case 0x35:
+		case 0x36:
+		case 0x37:
+		{
+			// double precision like the other transcendentals, see above
+			double temp = fx80_to_double(source);
+			REG_FP[w2 & 0x7] = double_to_fx80(cos(temp));
+			REG_FP[dst] = double_to_fx80(sin(temp));
+			SET_CONDITION_CODES(REG_FP[dst]);	// FPCC reflects the sine result
+			USE_CYCLES(451);
+			break;
+		}
 		case 0x38:		// FCMP
 		{
 			floatx80 res;
@@ -1370,7 +1561,7 @@ static void fmove_fpcr(uint16 w2)
 	if (dir)	// From system control reg to <ea>
 	{
 		if (reg & 4) WRITE_EA_32(ea, REG_FPCR);
-		if (reg & 2) WRITE_EA_32(ea, REG_FPSR);
+		if (reg & 2) WRITE_EA_32(ea, GET_FPSR());
 		if (reg & 1) WRITE_EA_32(ea, REG_FPIAR);
 	}
 	else		// From <ea> to system control reg
@@ -1381,7 +1572,11 @@ static void fmove_fpcr(uint16 w2)
 		  // JFF: need to update rounding mode from softfloat module
 		  float_rounding_mode = (REG_FPCR >> 4) & 0x3;
 		}
-		if (reg & 2) REG_FPSR = READ_EA_32(ea);
+		if (reg & 2)
+		{
+			REG_FPSR = READ_EA_32(ea);
+			m68ki_cpu.fpcc_pending = 0;
+		}
 		if (reg & 1) REG_FPIAR = READ_EA_32(ea);
 	}
 
@@ -1613,6 +1808,19 @@ void m68040_fpu_op0()
 
 static void perform_fsave(uint32 addr, int inc)
 {
+	// the frame occupies addr..addr+27 going up, or addr-24..addr+3 going down
+	uint8 *p = m68ki_direct_ptr(inc ? addr : addr-24, 28, FLAG_S | FUNCTION_CODE_USER_DATA);
+
+	if (p != NULL)
+	{
+		m68ki_trace_buffer_write(inc ? addr : addr-24, 0x1f180000, 4); /* auto-disable (see m68kcpu.h) */
+		m68ki_trace_buffer_write(inc ? addr+24 : addr, 0x70000000, 4);
+		memset(p+4, 0, 20);
+		m68ki_host_write_32(p, 0x1f180000);
+		m68ki_host_write_32(p+24, 0x70000000);
+		return;
+	}
+
 	if (inc)
 	{
 		// 68881 IDLE, version 0x1f
@@ -1644,6 +1852,7 @@ static void do_frestore_null()
 	REG_FPCR = 0;
 	REG_FPSR = 0;
 	REG_FPIAR = 0;
+	m68ki_cpu.fpcc_pending = 0;
 	for (i = 0; i < 8; i++)
 	{
 		REG_FP[i].high = 0x7fff;
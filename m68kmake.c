@@ -40,11 +40,18 @@
  * It requires an input file to function (default m68k_in.c), but you can
  * specify your own like so:
  *
- * m68kmake <output path> <input file>
+ * m68kmake <output path> <input file> [profile file]
  *
  * where output path is the path where the output files should be placed, and
  * input file is the file to use for input.
  *
+ * The optional profile file holds per-handler execution counts, as written by
+ * m68k_write_handler_profile() when M68K_PROFILE_HANDLERS is on.  When one is
+ * given, the handlers that account for most of the executed instructions are
+ * written first and marked M68KI_HOT, and the ones that never ran are written
+ * last and marked M68KI_COLD, so that the hot ones share as few cache lines
+ * and pages as possible.
+ *
  * If you modify the input file greatly from its released form, you may have
  * to tweak the configuration section a bit since I'm using static allocation
  * to keep things simple.
@@ -88,6 +95,7 @@ static const char g_version[] = "4.60";
 #define EA_ALLOWED_LENGTH                11	/* Max length of ea allowed str */
 #define MAX_OPCODE_INPUT_TABLE_LENGTH  1000	/* Max length of opcode handler tbl */
 #define MAX_OPCODE_OUTPUT_TABLE_LENGTH 3000	/* Max length of opcode handler tbl */
+#define HOT_HANDLER_COVERAGE           0.99	/* Share of profiled instructions run by hot handlers */
 
 /* Default filenames */
 #define FILENAME_INPUT      "m68k_in.c"
@@ -188,9 +196,56 @@ typedef struct
 	char cpu_mode[NUM_CPUS];              /* User or supervisor mode */
 	char cpus[NUM_CPUS+1];                /* Allowed CPUs */
 	unsigned char cycles[NUM_CPUS];       /* cycles for 000, 010, 020, 030, 040 */
+	char mnemonic[MAX_NAME_LENGTH];       /* mnemonic of the generated handler */
+	unsigned char length;                 /* instruction length in words */
+	unsigned int info_flags;              /* OPINFO_xxx properties */
 } opcode_struct;
 
 
+/* Opcode properties written to the opcode info table as M68K_OPINFO_xxx */
+enum
+{
+	OPINFO_READS_MEMORY    = 0x0001,
+	OPINFO_WRITES_MEMORY   = 0x0002,
+	OPINFO_CHANGES_PC      = 0x0004,
+	OPINFO_ENDS_BLOCK      = 0x0008,
+	OPINFO_ACCESSES_SR     = 0x0010,
+	OPINFO_PRIVILEGED      = 0x0020,
+	OPINFO_MAY_TRAP        = 0x0040,
+	OPINFO_VARIABLE_LENGTH = 0x0080,
+	OPINFO_CONDITIONAL     = 0x0100,
+	NUM_OPINFO_FLAGS       = 9
+};
+
+
+/* Where a generated handler is placed in the output */
+enum
+{
+	PLACE_HOT,	/* Among the handlers that ran most of the profile */
+	PLACE_WARM,	/* Ran, but not often enough to be hot */
+	PLACE_COLD	/* Never ran in the profile */
+};
+
+
+/* Position of a generated handler in g_handler_file and its profile data */
+typedef struct
+{
+	long start;				/* Offset of the handler in g_handler_file */
+	long end;				/* Offset just past it */
+	unsigned long count;	/* Times it ran in the profile */
+	int placement;			/* PLACE_xxx */
+} handler_layout_struct;
+
+
+/* An entry read from the profile file */
+typedef struct
+{
+	char name[MAX_NAME_LENGTH];
+	unsigned long count;
+	int used;
+} profile_struct;
+
+
 /* All modifications necessary for a specific EA mode of an instruction */
 typedef struct
 {
@@ -231,13 +286,28 @@ opcode_struct* find_opcode(char* name, int size, char* spec_proc, char* spec_ea)
 opcode_struct* find_illegal_opcode(void);
 int extract_opcode_info(char* src, char* name, int* size, char* spec_proc, char* spec_ea);
 void add_replace_string(replace_struct* replace, char* search_str, char* replace_str);
+int body_uses_flags(body_struct* body);
+void replace_directives(char* output, replace_struct* replace);
+void get_opcode_info(body_struct* body, replace_struct* replace, opcode_struct* op);
 void write_body(FILE* filep, body_struct* body, replace_struct* replace);
 void get_base_name(char* base_name, opcode_struct* op);
 void write_function_name(FILE* filep, char* base_name);
 void add_opcode_output_table_entry(opcode_struct* op, char* name);
 static int DECL_SPEC compare_nof_true_bits(const void* aptr, const void* bptr);
+static int DECL_SPEC compare_handler_count(const void* aptr, const void* bptr);
+static int DECL_SPEC compare_handler_placement(const void* aptr, const void* bptr);
+void set_opcode_table_entry(opcode_struct* op, int instr);
+void expand_opcode_output_table(void);
+void write_jump_table(FILE* filep, const char* suffix);
+void write_index_table(FILE* filep);
+void write_handler_table(FILE* filep, const char* suffix);
+const char* get_opcode_ea(opcode_struct* op);
+void write_opcode_info_entry(FILE* filep, opcode_struct* op);
 void print_opcode_output_table(FILE* filep);
-void write_table_entry(FILE* filep, opcode_struct* op);
+void read_profile(const char* filename);
+void layout_handlers(void);
+void copy_handlers(FILE* filep, FILE* handler_file, const char* suffix);
+void write_specialized_handlers(FILE* filep, FILE* handler_file);
 void set_opcode_struct(opcode_struct* src, opcode_struct* dst, int ea_mode);
 void generate_opcode_handler(FILE* filep, body_struct* body, replace_struct* replace, opcode_struct* opinfo, int ea_mode);
 void generate_opcode_ea_variants(FILE* filep, body_struct* body, replace_struct* replace, opcode_struct* op);
@@ -255,10 +325,14 @@ void read_insert(char* insert);
 /* Name of the input file */
 char g_input_filename[M68K_MAX_PATH] = FILENAME_INPUT;
 
+/* Name of the profile file, if any */
+char g_profile_filename[M68K_MAX_PATH] = "";
+
 /* File handles */
 FILE* g_input_file = NULL;
 FILE* g_prototype_file = NULL;
 FILE* g_table_file = NULL;
+FILE* g_handler_file = NULL; /* Scratch copy of the generated opcode handlers */
 
 int g_num_functions = 0;  /* Number of functions processed */
 int g_num_primitives = 0; /* Number of function primitives read */
@@ -270,6 +344,19 @@ opcode_struct g_opcode_input_table[MAX_OPCODE_INPUT_TABLE_LENGTH];
 opcode_struct g_opcode_output_table[MAX_OPCODE_OUTPUT_TABLE_LENGTH];
 int g_opcode_output_table_length = 0;
 
+/* Generated handlers in the order they were generated, and the order in
+ * which they are written to the output.
+ */
+handler_layout_struct g_handler_layout[MAX_OPCODE_OUTPUT_TABLE_LENGTH];
+int g_handler_order[MAX_OPCODE_OUTPUT_TABLE_LENGTH];
+
+profile_struct g_profile[MAX_OPCODE_OUTPUT_TABLE_LENGTH];
+int g_profile_length = 0;
+
+/* Fully expanded opcode tables: handler index (-1 = illegal) and cycles */
+int g_opcode_jump_table[0x10000];
+unsigned char g_opcode_cycle_table[NUM_CPUS][0x10000];
+
 const ea_info_struct g_ea_info_table[13] =
 {/* fname    ea        mask  match */
 	{"",     "",       0x00, 0x00}, /* EA_MODE_NONE */
@@ -288,6 +375,66 @@ const ea_info_struct g_ea_info_table[13] =
 };
 
 
+/* CPU models that get their own handler set with CPU_TYPE fixed at compile
+ * time.  The remaining models run the generic handlers.
+ */
+const char *const g_cpu_set_table[][2] =
+{/* suffix  CPU_TYPE */
+	{"000", "CPU_TYPE_000"},
+	{"010", "CPU_TYPE_010"},
+	{"020", "CPU_TYPE_020"},
+	{"030", "CPU_TYPE_030"},
+	{"040", "CPU_TYPE_040"},
+};
+
+#define NUM_CPU_SETS (int)(sizeof(g_cpu_set_table) / sizeof(g_cpu_set_table[0]))
+
+
+/* Names of the OPINFO_xxx flags in m68k.h */
+const char *const g_opinfo_flag_names[NUM_OPINFO_FLAGS] =
+{
+	"M68K_OPINFO_READS_MEMORY",
+	"M68K_OPINFO_WRITES_MEMORY",
+	"M68K_OPINFO_CHANGES_PC",
+	"M68K_OPINFO_ENDS_BLOCK",
+	"M68K_OPINFO_ACCESSES_SR",
+	"M68K_OPINFO_PRIVILEGED",
+	"M68K_OPINFO_MAY_TRAP",
+	"M68K_OPINFO_VARIABLE_LENGTH",
+	"M68K_OPINFO_CONDITIONAL",
+};
+
+/* Effective address mode of a handler by its spec_ea */
+const char *const g_opinfo_ea_table[][2] =
+{
+	{"d",    "M68K_OPINFO_EA_DN"},
+	{"a",    "M68K_OPINFO_EA_AN"},
+	{"a7",   "M68K_OPINFO_EA_AN"},
+	{"ai",   "M68K_OPINFO_EA_AI"},
+	{"pi",   "M68K_OPINFO_EA_PI"},
+	{"pi7",  "M68K_OPINFO_EA_PI"},
+	{"pd",   "M68K_OPINFO_EA_PD"},
+	{"pd7",  "M68K_OPINFO_EA_PD"},
+	{"di",   "M68K_OPINFO_EA_DI"},
+	{"ix",   "M68K_OPINFO_EA_IX"},
+	{"aw",   "M68K_OPINFO_EA_AW"},
+	{"al",   "M68K_OPINFO_EA_AL"},
+	{"pcdi", "M68K_OPINFO_EA_PCDI"},
+	{"pcix", "M68K_OPINFO_EA_PCIX"},
+	{"i",    "M68K_OPINFO_EA_I"},
+	{NULL,   NULL}
+};
+
+/* Mnemonics that always or conditionally take an exception */
+const char *const g_trap_mnemonics[] =
+{
+	"illegal", "1010", "1111", "bkpt", "chk", "trap", "trapv", "trapt",
+	"trapf", "traphi", "trapls", "trapcc", "trapcs", "trapne", "trapeq",
+	"trapvc", "trapvs", "trappl", "trapmi", "trapge", "traplt", "trapgt",
+	"traple", NULL
+};
+
+
 const char *const g_cc_table[16][2] =
 {
 	{ "t",  "T"}, /* 0000 */
@@ -731,40 +878,199 @@ void add_replace_string(replace_struct* replace, char* search_str, char* replace
 	strcpy(replace->replace[replace->length++][1], replace_str);
 }
 
-/* Write a function body while replacing any selected strings */
-void write_body(FILE* filep, body_struct* body, replace_struct* replace)
+/* Check if a function body reads or writes the N, Z, V or C flags directly */
+int body_uses_flags(body_struct* body)
 {
+	static const char* const flag_tokens[] =
+	{
+		"FLAG_N", "FLAG_Z", "FLAG_V", "FLAG_C",
+		"NFLAG_AS_1", "ZFLAG_AS_1", "VFLAG_AS_1", "CFLAG_AS_1",
+		"COND_", ID_OPHANDLER_CC, ID_OPHANDLER_NOT_CC
+	};
 	int i;
+	unsigned int j;
+
+	for(i=0;i<body->length;i++)
+		for(j=0;j<sizeof(flag_tokens)/sizeof(flag_tokens[0]);j++)
+			if(strstr(body->body[i], flag_tokens[j]) != NULL)
+				return 1;
+	return 0;
+}
+
+/* Replace the M68KMAKE directives in a line of a function body */
+void replace_directives(char* output, replace_struct* replace)
+{
 	int j;
 	char* ptr;
-	char output[MAX_LINE_LENGTH+1];
 	char temp_buff[MAX_LINE_LENGTH+1];
 	int found;
 
+	/* Check for the base directive header */
+	if(strstr(output, ID_BASE) == NULL)
+		return;
+
+	/* Search for any text we need to replace */
+	found = 0;
+	for(j=0;j<replace->length;j++)
+	{
+		ptr = strstr(output, replace->replace[j][0]);
+		if(ptr)
+		{
+			/* We found something to replace */
+			found = 1;
+			strcpy(temp_buff, ptr+strlen(replace->replace[j][0]));
+			strcpy(ptr, replace->replace[j][1]);
+			strcat(ptr, temp_buff);
+		}
+	}
+	/* Found a directive with no matching replace string */
+	if(!found)
+		error_exit("Unknown " ID_BASE " directive [%s]", output);
+}
+
+/* Work out the instruction length and the OPINFO_xxx properties of an
+ * opcode handler from the identifiers used in its body.
+ * Only the first branch of any #if/#else in the body is looked at, and a
+ * "REG_PC += n" is taken to skip over the immediate operand on the path that
+ * doesn't read it, unless nothing else reads one.
+ */
+void get_opcode_info(body_struct* body, replace_struct* replace, opcode_struct* op)
+{
+	char line[MAX_LINE_LENGTH+1];
+	char token[MAX_LINE_LENGTH+1];
+	char* ptr;
+	int writes_sr = 0;
+	int imm_words = 0;
+	int skip_words = 0;
+	int pp_depth = 0;
+	int pp_skip = 0;
+	int length;
+	int i;
+
+	op->length = 1;
+	op->info_flags = 0;
+
 	for(i=0;i<body->length;i++)
 	{
-		strcpy(output, body->body[i]);
-		/* Check for the base directive header */
-		if(strstr(output, ID_BASE) != NULL)
+		strcpy(line, body->body[i]);
+		for(ptr = line;isspace((unsigned char)*ptr);ptr++)
+			;
+		if(*ptr == '#')
 		{
-			/* Search for any text we need to replace */
-			found = 0;
-			for(j=0;j<replace->length;j++)
+			if(strncmp(ptr, "#if", 3) == 0)
+				pp_depth++;
+			else if(strncmp(ptr, "#else", 5) == 0 || strncmp(ptr, "#elif", 5) == 0)
 			{
-				ptr = strstr(output, replace->replace[j][0]);
-				if(ptr)
-				{
-					/* We found something to replace */
-					found = 1;
-					strcpy(temp_buff, ptr+strlen(replace->replace[j][0]));
-					strcpy(ptr, replace->replace[j][1]);
-					strcat(ptr, temp_buff);
-				}
+				if(pp_skip == 0)
+					pp_skip = pp_depth;
 			}
-			/* Found a directive with no matching replace string */
-			if(!found)
-				error_exit("Unknown " ID_BASE " directive [%s]", output);
+			else if(strncmp(ptr, "#endif", 6) == 0)
+			{
+				if(pp_skip == pp_depth)
+					pp_skip = 0;
+				pp_depth--;
+			}
+			continue;
+		}
+		if(pp_skip)
+			continue;
+		if((ptr = strstr(line, "REG_PC += ")) != NULL && atoi(ptr+10)/2 > skip_words)
+			skip_words = atoi(ptr+10)/2;
+		replace_directives(line, replace);
+		for(ptr = line;*ptr;)
+		{
+			if(!isalpha((unsigned char)*ptr) && *ptr != '_')
+			{
+				ptr++;
+				continue;
+			}
+			for(length=0;isalnum((unsigned char)ptr[length]) || ptr[length] == '_';length++)
+				token[length] = ptr[length];
+			token[length] = 0;
+			ptr += length;
+
+			/* Extension words */
+			if(strcmp(token, "OPER_I_8") == 0 || strcmp(token, "OPER_I_16") == 0)
+				imm_words += 1;
+			else if(strcmp(token, "OPER_I_32") == 0)
+				imm_words += 2;
+			else if(strncmp(token, "EA_", 3) == 0 || strncmp(token, "OPER_", 5) == 0)
+			{
+				if(strstr(token, "_AL_") != NULL)
+					op->length += 2;
+				else if(strstr(token, "_DI_") || strstr(token, "_IX_") || strstr(token, "_AW_") ||
+						strstr(token, "PCDI") || strstr(token, "PCIX"))
+					op->length += 1;
+				if(strstr(token, "_IX_") || strstr(token, "PCIX"))
+					op->info_flags |= OPINFO_VARIABLE_LENGTH;
+				if(token[0] == 'O')
+					op->info_flags |= OPINFO_READS_MEMORY;
+			}
+			/* Memory accesses */
+			else if(strncmp(token, "m68ki_read_", 11) == 0 || strncmp(token, "m68ki_pull_", 11) == 0)
+				op->info_flags |= OPINFO_READS_MEMORY;
+			else if(strncmp(token, "m68ki_write_", 12) == 0 || strncmp(token, "m68ki_push_", 11) == 0)
+				op->info_flags |= OPINFO_WRITES_MEMORY;
+			/* Control flow */
+			else if(strncmp(token, "m68ki_jump", 10) == 0 || strncmp(token, "m68ki_branch_", 13) == 0)
+				op->info_flags |= OPINFO_CHANGES_PC;
+			else if(strcmp(token, "m68ki_stats_branch_taken") == 0)
+				op->info_flags |= OPINFO_CHANGES_PC | OPINFO_CONDITIONAL;
+			else if(strncmp(token, "m68ki_exception_", 16) == 0)
+				op->info_flags |= OPINFO_MAY_TRAP;
+			else if(strcmp(token, "STOP_LEVEL_STOP") == 0)
+				op->info_flags |= OPINFO_ENDS_BLOCK;
+			/* Status register */
+			else if(strcmp(token, "m68ki_get_sr") == 0)
+				op->info_flags |= OPINFO_ACCESSES_SR;
+			else if(strncmp(token, "m68ki_set_sr", 12) == 0)
+			{
+				op->info_flags |= OPINFO_ACCESSES_SR;
+				writes_sr = 1;
+			}
+			/* The FPU and PMMU decode the rest of the instruction themselves */
+			else if(strcmp(token, "m68040_fpu_op0") == 0 || strcmp(token, "m68040_fpu_op1") == 0 ||
+					strcmp(token, "m68881_mmu_ops") == 0)
+				op->info_flags |= OPINFO_READS_MEMORY | OPINFO_WRITES_MEMORY | OPINFO_MAY_TRAP | OPINFO_VARIABLE_LENGTH;
+		}
+	}
+
+	op->length += imm_words > skip_words ? imm_words : skip_words;
+
+	/* Coprocessor instructions carry extension words the coprocessor defines */
+	if(strncmp(op->mnemonic, "cp", 2) == 0)
+		op->info_flags |= OPINFO_VARIABLE_LENGTH;
+
+	for(i=0;i<NUM_CPUS;i++)
+		if(op->cpu_mode[i] == 'S')
+			op->info_flags |= OPINFO_PRIVILEGED | OPINFO_MAY_TRAP;
+	for(i=0;g_trap_mnemonics[i] != NULL;i++)
+		if(strcmp(op->mnemonic, g_trap_mnemonics[i]) == 0)
+			op->info_flags |= OPINFO_ENDS_BLOCK | OPINFO_MAY_TRAP;
+	if((op->info_flags & OPINFO_CHANGES_PC) || writes_sr)
+		op->info_flags |= OPINFO_ENDS_BLOCK;
+}
+
+/* Write a function body while replacing any selected strings */
+void write_body(FILE* filep, body_struct* body, replace_struct* replace)
+{
+	int i;
+	char output[MAX_LINE_LENGTH+1];
+	int sync_flags = body_uses_flags(body);
+
+	for(i=0;i<body->length;i++)
+	{
+		strcpy(output, body->body[i]);
+		/* Handlers that touch the flags directly need any lazily recorded
+		 * flag state computed first.
+		 */
+		if(sync_flags && output[0] == '{')
+		{
+			fprintf(filep, "%s\n\tm68ki_flags_sync();\n", output);
+			sync_flags = 0;
+			continue;
 		}
+		replace_directives(output, replace);
 		fprintf(filep, "%s\n", output);
 	}
 	fprintf(filep, "\n\n");
@@ -791,12 +1097,13 @@ void write_function_name(FILE* filep, char* base_name)
 void add_opcode_output_table_entry(opcode_struct* op, char* name)
 {
 	opcode_struct* ptr;
-	if(g_opcode_output_table_length > MAX_OPCODE_OUTPUT_TABLE_LENGTH)
+	if(g_opcode_output_table_length >= MAX_OPCODE_OUTPUT_TABLE_LENGTH)
 		error_exit("Opcode output table overflow");
 
 	ptr = g_opcode_output_table + g_opcode_output_table_length++;
 
 	*ptr = *op;
+	strcpy(ptr->mnemonic, op->name);
 	strcpy(ptr->name, name);
 	ptr->bits = num_bits(ptr->op_mask);
 }
@@ -816,31 +1123,390 @@ static int DECL_SPEC compare_nof_true_bits(const void* aptr, const void* bptr)
 	return a->op_match - b->op_match;
 }
 
+/*
+ * Comparison function for qsort()
+ * Sorts g_handler_order by descending profile count, keeping the generated
+ * order for equal counts
+ */
+static int DECL_SPEC compare_handler_count(const void* aptr, const void* bptr)
+{
+	const int *a = aptr, *b = bptr;
+	if(g_handler_layout[*a].count != g_handler_layout[*b].count)
+		return g_handler_layout[*a].count < g_handler_layout[*b].count ? 1 : -1;
+	return *a - *b;
+}
+
+/*
+ * Comparison function for qsort()
+ * Sorts g_handler_order by placement, keeping the generated order within
+ * each placement
+ */
+static int DECL_SPEC compare_handler_placement(const void* aptr, const void* bptr)
+{
+	const int *a = aptr, *b = bptr;
+	if(g_handler_layout[*a].placement != g_handler_layout[*b].placement)
+		return g_handler_layout[*a].placement - g_handler_layout[*b].placement;
+	return *a - *b;
+}
+
+/* Point one opcode at a handler in the expanded tables */
+void set_opcode_table_entry(opcode_struct* op, int instr)
+{
+	int k;
+
+	g_opcode_jump_table[instr] = op - g_opcode_output_table;
+	for(k=0;k<NUM_CPUS;k++)
+		g_opcode_cycle_table[k][instr] = op->cycles[k];
+}
+
+/* Expand the sorted handler table into one entry per opcode.
+ * Handlers with more significant bits come later and override the
+ * more general ones before them.
+ */
+void expand_opcode_output_table(void)
+{
+	opcode_struct* op = g_opcode_output_table;
+	opcode_struct* end = g_opcode_output_table + g_opcode_output_table_length;
+	int cycle_cost;
+	int instr;
+	int i;
+	int j;
+	int k;
+
+	for(i = 0; i < 0x10000; i++)
+	{
+		/* default to illegal */
+		g_opcode_jump_table[i] = -1;
+		for(k=0;k<NUM_CPUS;k++)
+			g_opcode_cycle_table[k][i] = 0;
+	}
+
+	for(;op < end && op->op_mask != 0xff00;op++)
+		for(i = 0;i < 0x10000;i++)
+			if((i & op->op_mask) == op->op_match)
+				set_opcode_table_entry(op, i);
+	for(;op < end && op->op_mask == 0xff00;op++)
+		for(i = 0;i <= 0xff;i++)
+			set_opcode_table_entry(op, op->op_match | i);
+	for(;op < end && op->op_mask == 0xf1f8;op++)
+	{
+		for(i = 0;i < 8;i++)
+		{
+			for(j = 0;j < 8;j++)
+			{
+				instr = op->op_match | (i << 9) | j;
+				set_opcode_table_entry(op, instr);
+				/* On the 68000 and 68010, shifts by an immediate count take
+				 * 2 extra cycles per bit shifted.
+				 */
+				if((instr & 0xf000) == 0xe000 && (!(instr & 0x20)))
+				{
+					cycle_cost = ((((i-1)&7)+1)<<1);
+					g_opcode_cycle_table[CPU_TYPE_000][instr] += cycle_cost;
+					g_opcode_cycle_table[CPU_TYPE_010][instr] += cycle_cost;
+				}
+			}
+		}
+	}
+	for(;op < end && op->op_mask == 0xfff0;op++)
+		for(i = 0;i <= 0x0f;i++)
+			set_opcode_table_entry(op, op->op_match | i);
+	for(;op < end && op->op_mask == 0xf1ff;op++)
+		for(i = 0;i <= 0x07;i++)
+			set_opcode_table_entry(op, op->op_match | (i << 9));
+	for(;op < end && op->op_mask == 0xfff8;op++)
+		for(i = 0;i <= 0x07;i++)
+			set_opcode_table_entry(op, op->op_match | i);
+	for(;op < end && op->op_mask == 0xffff;op++)
+		set_opcode_table_entry(op, op->op_match);
+}
+
+/* Write an expanded opcode handler jump table.
+ * A non-empty suffix selects the handler set for that CPU model.
+ */
+void write_jump_table(FILE* filep, const char* suffix)
+{
+	const char* name;
+	int i;
+
+	fprintf(filep, "void (*const m68ki_instruction_jump_table%s%s[0x10000])(void) =\n{\n", *suffix ? "_" : "", suffix);
+	for(i=0;i<0x10000;i++)
+	{
+		name = g_opcode_jump_table[i] < 0 ? "m68k_op_illegal" : g_opcode_output_table[g_opcode_jump_table[i]].name;
+		if((i & 3) == 0)
+			fprintf(filep, "\t/* %04x */", i);
+		fprintf(filep, " %s%s%s,", name, *suffix ? "_" : "", suffix);
+		if((i & 3) == 3)
+			fprintf(filep, "\n");
+	}
+	fprintf(filep, "};\n\n");
+}
+
+/* Write the 16-bit handler index of every opcode, used for the opcode info
+ * table and the compact dispatch.  Index 0 is the illegal instruction
+ * handler, index n the n-1th entry of the output table.
+ */
+void write_index_table(FILE* filep)
+{
+	int i;
+
+	fprintf(filep, "const unsigned short m68ki_instruction_index_table[0x10000] =\n{\n");
+	for(i=0;i<0x10000;i++)
+	{
+		if((i & 15) == 0)
+			fprintf(filep, "\t/* %04x */", i);
+		fprintf(filep, " %4d,", g_opcode_jump_table[i] + 1);
+		if((i & 15) == 15)
+			fprintf(filep, "\n");
+	}
+	fprintf(filep, "};\n\n");
+}
+
+/* Write the handler array that m68ki_instruction_index_table indexes */
+void write_handler_table(FILE* filep, const char* suffix)
+{
+	const char* sep = *suffix ? "_" : "";
+	int i;
+
+	fprintf(filep, "void (*const m68ki_instruction_handler_table%s%s[%d])(void) =\n{\n", sep, suffix, g_opcode_output_table_length + 1);
+	fprintf(filep, "\tm68k_op_illegal%s%s,\n", sep, suffix);
+	for(i=0;i<g_opcode_output_table_length;i++)
+		fprintf(filep, "\t%s%s%s,\n", g_opcode_output_table[i].name, sep, suffix);
+	fprintf(filep, "};\n\n");
+}
+
+/* Get the M68K_OPINFO_EA_xxx mode of a handler.  The memory to memory
+ * forms (abcd, addx, ... -(Ay),-(Ax) and cmpm (Ay)+,(Ax)+) have theirs in
+ * the opcode rather than in an effective address field.
+ */
+const char* get_opcode_ea(opcode_struct* op)
+{
+	int i;
+
+	if(strcmp(op->spec_proc, "mm") == 0)
+		return "M68K_OPINFO_EA_PD";
+	if(strcmp(op->mnemonic, "cmpm") == 0)
+		return "M68K_OPINFO_EA_PI";
+	for(i=0;g_opinfo_ea_table[i][0] != NULL;i++)
+		if(strcmp(op->spec_ea, g_opinfo_ea_table[i][0]) == 0)
+			return g_opinfo_ea_table[i][1];
+	return "M68K_OPINFO_EA_NONE";
+}
+
+/* Write an entry of the opcode info table */
+void write_opcode_info_entry(FILE* filep, opcode_struct* op)
+{
+	int cpus = 0;
+	int flags = 0;
+	int i;
+
+	for(i=0;i<NUM_CPUS;i++)
+		if(op->cpus[i] != UNSPECIFIED_CH)
+			cpus |= 1 << i;
+
+	fprintf(filep, "\t{\"%s\", \"%s\", %d, %d, %s, 0x%02x, ", op->mnemonic, op->name, op->size, op->length, get_opcode_ea(op), cpus);
+	for(i=0;i<NUM_OPINFO_FLAGS;i++)
+		if(op->info_flags & (1 << i))
+			fprintf(filep, "%s%s", flags++ ? " | " : "", g_opinfo_flag_names[i]);
+	fprintf(filep, "%s},\n", flags ? "" : "0");
+}
+
+/* Write the expanded opcode handler jump tables and cycle tables */
 void print_opcode_output_table(FILE* filep)
 {
 	int i;
+	int k;
+
 	qsort((void *)g_opcode_output_table, g_opcode_output_table_length, sizeof(g_opcode_output_table[0]), compare_nof_true_bits);
+	expand_opcode_output_table();
 
+	fprintf(filep, "/* Opcode to handler index table */\n");
+	write_index_table(filep);
+
+	fprintf(filep, "/* Opcode handler information by index */\n");
+	fprintf(filep, "const m68k_opcode_info m68ki_opcode_info_table[%d] =\n{\n", g_opcode_output_table_length + 1);
+	fprintf(filep, "\t{\"illegal\", \"m68k_op_illegal\", 0, 1, M68K_OPINFO_EA_NONE, 0x%02x, M68K_OPINFO_ENDS_BLOCK | M68K_OPINFO_MAY_TRAP},\n", (1 << NUM_CPUS) - 1);
 	for(i=0;i<g_opcode_output_table_length;i++)
-		write_table_entry(filep, g_opcode_output_table+i);
+		write_opcode_info_entry(filep, g_opcode_output_table+i);
+	fprintf(filep, "};\n\n");
+
+	fprintf(filep, "#if M68K_COMPACT_DISPATCH\n\n");
+	fprintf(filep, "/* Opcode handlers by index */\n");
+	write_handler_table(filep, "");
+	for(i=0;i<NUM_CPU_SETS;i++)
+	{
+		fprintf(filep, "#if M68K_SPECIALIZE_%s\n", g_cpu_set_table[i][0]);
+		write_handler_table(filep, g_cpu_set_table[i][0]);
+		fprintf(filep, "#endif /* M68K_SPECIALIZE_%s */\n\n", g_cpu_set_table[i][0]);
+	}
+
+	fprintf(filep, "#else\n\n");
+	fprintf(filep, "/* Opcode handler jump table */\n");
+	write_jump_table(filep, "");
+	for(i=0;i<NUM_CPU_SETS;i++)
+	{
+		fprintf(filep, "#if M68K_SPECIALIZE_%s\n", g_cpu_set_table[i][0]);
+		write_jump_table(filep, g_cpu_set_table[i][0]);
+		fprintf(filep, "#endif /* M68K_SPECIALIZE_%s */\n\n", g_cpu_set_table[i][0]);
+	}
+
+	fprintf(filep, "#endif /* M68K_COMPACT_DISPATCH */\n\n");
+
+	fprintf(filep, "/* Cycles used by CPU type */\n");
+	fprintf(filep, "const unsigned char m68ki_cycles[%d][0x10000] =\n{\n", NUM_CPUS);
+	for(k=0;k<NUM_CPUS;k++)
+	{
+		fprintf(filep, "\t{\n");
+		for(i=0;i<0x10000;i++)
+		{
+			if((i & 15) == 0)
+				fprintf(filep, "\t\t/* %04x */", i);
+			fprintf(filep, " %3d,", g_opcode_cycle_table[k][i]);
+			if((i & 15) == 15)
+				fprintf(filep, "\n");
+		}
+		fprintf(filep, "\t},\n");
+	}
+	fprintf(filep, "};\n\n");
 }
 
-/* Write an entry in the opcode handler table */
-void write_table_entry(FILE* filep, opcode_struct* op)
+/* Read a profile file of "<count> <handler name>" lines */
+void read_profile(const char* filename)
 {
+	FILE* filep;
+	char line[MAX_LINE_LENGTH+1];
+	char name[MAX_LINE_LENGTH+1];
+	char* ptr;
+	unsigned long count;
+	int line_number = 0;
+
+	if((filep = fopen(filename, "rt")) == NULL)
+		perror_exit("can't open %s for input", filename);
+
+	while(fgets(line, sizeof(line), filep) != NULL)
+	{
+		line_number++;
+		ptr = line + skip_spaces(line);
+		if(*ptr == 0 || *ptr == '\n' || *ptr == '#')
+			continue;
+		if(sscanf(line, "%lu %200s", &count, name) != 2 || strlen(name) >= MAX_NAME_LENGTH)
+			error_exit("%s:%d: invalid profile entry", filename, line_number);
+		if(g_profile_length >= MAX_OPCODE_OUTPUT_TABLE_LENGTH)
+			error_exit("%s: too many profile entries", filename);
+		strcpy(g_profile[g_profile_length].name, name);
+		g_profile[g_profile_length].count = count;
+		g_profile[g_profile_length].used = 0;
+		g_profile_length++;
+	}
+	fclose(filep);
+}
+
+/* Work out the order in which the generated handlers are written.  Without
+ * a profile this is the order they were generated in.
+ */
+void layout_handlers(void)
+{
+	double total = 0;
+	double covered = 0;
+	double hot = 0;
+	int unused = 0;
+	int num_hot = 0;
 	int i;
+	int j;
 
-	fprintf(filep, "\t{%-28s, 0x%04x, 0x%04x, {",
-		op->name, op->op_mask, op->op_match);
+	for(i=0;i<g_opcode_output_table_length;i++)
+	{
+		g_handler_order[i] = i;
+		g_handler_layout[i].count = 0;
+		g_handler_layout[i].placement = PLACE_WARM;
+	}
+	if(g_profile_length == 0)
+		return;
 
-	for(i=0;i<NUM_CPUS;i++)
+	for(i=0;i<g_profile_length;i++)
+	{
+		for(j=0;j<g_opcode_output_table_length;j++)
+			if(strcmp(g_profile[i].name, g_opcode_output_table[j].name) == 0)
+			{
+				g_handler_layout[j].count += g_profile[i].count;
+				g_profile[i].used = 1;
+				break;
+			}
+		if(!g_profile[i].used)
+			unused++;
+		total += g_profile[i].count;
+	}
+	if(unused)
+		printf("Warning: %d profile entries match no opcode handler\n", unused);
+
+	qsort((void *)g_handler_order, g_opcode_output_table_length, sizeof(g_handler_order[0]), compare_handler_count);
+	for(i=0;i<g_opcode_output_table_length;i++)
 	{
-		fprintf(filep, "%3d", op->cycles[i]);
-		if(i < NUM_CPUS-1)
-			fprintf(filep, ", ");
+		handler_layout_struct* layout = g_handler_layout + g_handler_order[i];
+		if(layout->count == 0)
+			layout->placement = PLACE_COLD;
+		else if(covered < total * HOT_HANDLER_COVERAGE)
+		{
+			layout->placement = PLACE_HOT;
+			hot += layout->count;
+			num_hot++;
+		}
+		covered += layout->count;
 	}
 
-	fprintf(filep, "}},\n");
+	/* Keep the handlers after the hot ones in their generated order */
+	qsort((void *)(g_handler_order + num_hot), g_opcode_output_table_length - num_hot, sizeof(g_handler_order[0]), compare_handler_placement);
+	printf("Profile: %d hot handlers ran %.1f%% of %.0f instructions\n", num_hot,
+		total > 0 ? 100.0 * hot / total : 0.0, total);
+}
+
+/* Copy the generated opcode handlers in g_handler_order, appending a suffix
+ * to their names.
+ */
+void copy_handlers(FILE* filep, FILE* handler_file, const char* suffix)
+{
+	static const char* const placement_attr[] = {"M68KI_HOT\n", "", "M68KI_COLD\n"};
+	char line[MAX_LINE_LENGTH*4+1];
+	char* ptr;
+	int line_start;
+	int i;
+
+	for(i=0;i<g_opcode_output_table_length;i++)
+	{
+		handler_layout_struct* layout = g_handler_layout + g_handler_order[i];
+
+		fseek(handler_file, layout->start, SEEK_SET);
+		fputs(placement_attr[layout->placement], filep);
+		for(line_start = 1;ftell(handler_file) < layout->end && fgets(line, sizeof(line), handler_file) != NULL;)
+		{
+			if(line_start && *suffix && strncmp(line, "static void m68k_op_", 20) == 0
+				&& (ptr = strstr(line, "(void)")) != NULL)
+			{
+				*ptr = 0;
+				fprintf(filep, "%s_%s(void)%s", line, suffix, ptr+6);
+			}
+			else
+				fputs(line, filep);
+			line_start = strchr(line, '\n') != NULL;
+		}
+	}
+}
+
+/* Write one copy of the opcode handlers per CPU model in g_cpu_set_table,
+ * each compiled with CPU_TYPE fixed so that the CPU type checks fold away.
+ */
+void write_specialized_handlers(FILE* filep, FILE* handler_file)
+{
+	int i;
+
+	for(i=0;i<NUM_CPU_SETS;i++)
+	{
+		fprintf(filep, "#if M68K_SPECIALIZE_%s\n\n", g_cpu_set_table[i][0]);
+		fprintf(filep, "#undef CPU_TYPE\n#define CPU_TYPE %s\n\n\n", g_cpu_set_table[i][1]);
+		copy_handlers(filep, handler_file, g_cpu_set_table[i][0]);
+		fprintf(filep, "#undef CPU_TYPE\n#define CPU_TYPE m68ki_cpu.cpu_type\n\n");
+		fprintf(filep, "#endif /* M68K_SPECIALIZE_%s */\n\n\n", g_cpu_set_table[i][0]);
+	}
 }
 
 /* Fill out an opcode struct with a specific addressing mode of the source opcode struct */
@@ -869,6 +1535,7 @@ void generate_opcode_handler(FILE* filep, body_struct* body, replace_struct* rep
 	set_opcode_struct(opinfo, op, ea_mode);
 	get_base_name(str, op);
 	add_opcode_output_table_entry(op, str);
+	g_handler_layout[g_opcode_output_table_length - 1].start = ftell(filep);
 	write_function_name(filep, str);
 
 	/* Add any replace strings needed */
@@ -889,7 +1556,9 @@ void generate_opcode_handler(FILE* filep, body_struct* body, replace_struct* rep
 	}
 
 	/* Now write the function body with the selected replace strings */
+	get_opcode_info(body, replace, g_opcode_output_table + g_opcode_output_table_length - 1);
 	write_body(filep, body, replace);
+	g_handler_layout[g_opcode_output_table_length - 1].end = ftell(filep);
 	g_num_functions++;
 	free(op);
 }
@@ -1252,8 +1921,13 @@ int main(int argc, char **argv)
 			strcat(output_path, "/");
 		if(argc > 2)
 			strcpy(g_input_filename, argv[2]);
+		if(argc > 3)
+			strcpy(g_profile_filename, argv[3]);
 	}
 
+	if(*g_profile_filename)
+		read_profile(g_profile_filename);
+
 
 	/* Open the files we need */
 	sprintf(filename, "%s%s", output_path, FILENAME_PROTOTYPE);
@@ -1351,10 +2025,20 @@ int main(int argc, char **argv)
 			if(ophandler_body_read)
 				error_exit("Duplicate opcode handler section");
 
+			if((g_handler_file = tmpfile()) == NULL)
+				perror_exit("Unable to create temporary handler file\n");
+
 			fprintf(g_table_file, "%s\n\n", ophandler_header_insert);
-			process_opcode_handlers(g_table_file);
+			process_opcode_handlers(g_handler_file);
+			layout_handlers();
+			fprintf(g_prototype_file, "/* Number of generated opcode handlers, not counting m68k_op_illegal */\n");
+			fprintf(g_prototype_file, "#define M68KI_NUM_OPCODE_HANDLERS %d\n\n", g_opcode_output_table_length);
+			copy_handlers(g_table_file, g_handler_file, "");
+			write_specialized_handlers(g_table_file, g_handler_file);
 			fprintf(g_table_file, "%s\n\n", ophandler_footer_insert);
 
+			fclose(g_handler_file);
+
 			ophandler_body_read = 1;
 		}
 		else if(strcmp(section_id, ID_END) == 0)
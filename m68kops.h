@@ -0,0 +1,35 @@
+#ifndef M68KOPS__HEADER
+#define M68KOPS__HEADER
+
+/* ======================================================================== */
+/* ============================ OPCODE HANDLERS =========================== */
+/* ======================================================================== */
+
+
+/* Number of generated opcode handlers, not counting m68k_op_illegal */
+#define M68KI_NUM_OPCODE_HANDLERS 1967
+
+/* Opcode handler jump and cycle tables */
+extern void (*const m68ki_instruction_jump_table[0x10000])(void); /* opcode handler jump table */
+extern void (*const m68ki_instruction_jump_table_000[0x10000])(void);
+extern void (*const m68ki_instruction_jump_table_010[0x10000])(void);
+extern void (*const m68ki_instruction_jump_table_020[0x10000])(void);
+extern void (*const m68ki_instruction_jump_table_030[0x10000])(void);
+extern void (*const m68ki_instruction_jump_table_040[0x10000])(void);
+extern const unsigned short m68ki_instruction_index_table[0x10000]; /* opcode to handler index */
+extern void (*const m68ki_instruction_handler_table[])(void);
+extern void (*const m68ki_instruction_handler_table_000[])(void);
+extern void (*const m68ki_instruction_handler_table_010[])(void);
+extern void (*const m68ki_instruction_handler_table_020[])(void);
+extern void (*const m68ki_instruction_handler_table_030[])(void);
+extern void (*const m68ki_instruction_handler_table_040[])(void);
+extern const unsigned char m68ki_cycles[][0x10000];
+
+
+/* ======================================================================== */
+/* ============================== END OF FILE ============================= */
+/* ======================================================================== */
+
+#endif /* M68KOPS__HEADER */
+
+
@@ -53,6 +53,24 @@ typedef sint64 sbits64;
 *----------------------------------------------------------------------------*/
 #define LIT64( a ) a##ULL
 
+/*----------------------------------------------------------------------------
+| The macro `SOFTFLOAT_INT128' is defined when the compiler provides a native
+| 128-bit unsigned integer type, which is then used by `softfloat-macros' in
+| place of the portable 64-bit arithmetic.  The macro `SOFTFLOAT_BUILTIN_CLZ'
+| is defined when the compiler provides `__builtin_clz' and `__builtin_clzll'.
+| Results are bit-exact either way.  Define `SOFTFLOAT_PORTABLE' to force the
+| portable routines.
+*----------------------------------------------------------------------------*/
+#ifndef SOFTFLOAT_PORTABLE
+#if defined(__SIZEOF_INT128__)
+#define SOFTFLOAT_INT128
+__extension__ typedef unsigned __int128 bits128;
+#endif
+#if defined(__GNUC__)
+#define SOFTFLOAT_BUILTIN_CLZ
+#endif
+#endif /* SOFTFLOAT_PORTABLE */
+
 /*----------------------------------------------------------------------------
 | The macro `INLINE' can be used before functions that should be inlined.  If
 | a compiler does not support explicit inlining, this macro should be defined
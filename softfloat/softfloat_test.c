@@ -0,0 +1,246 @@
+/* Differential test of the SoftFloat backends.
+ *
+ * mamesf.h picks native 128-bit arithmetic (SOFTFLOAT_INT128) and the clz
+ * builtins (SOFTFLOAT_BUILTIN_CLZ) when the compiler has them, and the
+ * original limb arithmetic when SOFTFLOAT_PORTABLE is defined.  Both must
+ * give bit-exact results.  This program feeds the same pseudo random
+ * operands through the primitives of softfloat-macros and through the
+ * float64 and floatx80 operations in every rounding mode, and prints a hash
+ * of the results and exception flags of each.  "make softfloat_test" builds
+ * it with and without SOFTFLOAT_PORTABLE and compares the two outputs.
+ *
+ * Usage: softfloat_test [iterations [seed]]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../m68kcpu.h"
+
+#define DEFAULT_ITERATIONS 200000
+#define DEFAULT_SEED       0x2545f4914f6cdd1dULL
+
+static unsigned long long g_state;
+
+
+/* xorshift64*, the same sequence on every host */
+static bits64 random64(void)
+{
+	g_state ^= g_state >> 12;
+	g_state ^= g_state << 25;
+	g_state ^= g_state >> 27;
+	return g_state * 0x2545f4914f6cdd1dULL;
+}
+
+/* Mostly small shift counts and leading zeros, where the backends differ */
+static bits64 random_bits(void)
+{
+	bits64 value = random64();
+
+	switch(random64() & 3)
+	{
+		case 0:
+			return value >> (random64() & 63);
+		case 1:
+			return value << (random64() & 63);
+		default:
+			return value;
+	}
+}
+
+/* FNV-1a over the bytes of value */
+static bits64 hash(bits64 h, bits64 value)
+{
+	int i;
+
+	for(i = 0; i < 8; i++)
+	{
+		h ^= (value >> (i * 8)) & 0xff;
+		h *= 0x100000001b3ULL;
+	}
+	return h;
+}
+
+static float64 random_float64(void)
+{
+	bits64 sign = random64() & LIT64(0x8000000000000000);
+	bits64 exponent;
+
+	switch(random64() & 7)
+	{
+		case 0:
+			exponent = 0;                           /* zero and denormals */
+			break;
+		case 1:
+			exponent = 0x7ff;                       /* infinities and NaNs */
+			break;
+		case 2:
+			exponent = (random64() & 1) ? 1 + (random64() & 63) : 0x7fe - (random64() & 63);
+			break;
+		default:
+			exponent = 0x3ff - 64 + (random64() & 127);
+	}
+	return sign | (exponent << 52) | (random_bits() & LIT64(0x000fffffffffffff));
+}
+
+static floatx80 random_floatx80(void)
+{
+	floatx80 x;
+	bits16 sign = (random64() & 1) ? 0x8000 : 0;
+	bits16 exponent;
+
+	switch(random64() & 7)
+	{
+		case 0:
+			exponent = 0;
+			break;
+		case 1:
+			exponent = 0x7fff;
+			break;
+		case 2:
+			exponent = (random64() & 1) ? 1 + (random64() & 127) : 0x7ffe - (random64() & 127);
+			break;
+		default:
+			exponent = 0x3fff - 128 + (random64() & 255);
+	}
+	x.high = sign | exponent;
+	x.low = random_bits();
+	/* SoftFloat does not handle unnormals (floatx80_sqrt() never returns) */
+	if(exponent != 0)
+		x.low |= LIT64(0x8000000000000000);
+	return x;
+}
+
+static void report(const char* name, bits64 h)
+{
+	printf("%-22s %016llx\n", name, (unsigned long long)h);
+}
+
+static void test_primitives(int iterations)
+{
+	bits64 h_mul = 0xcbf29ce484222325ULL;
+	bits64 h_add = h_mul, h_sub = h_mul, h_shift = h_mul, h_clz = h_mul;
+	bits64 h_div = h_mul, h_192 = h_mul, h_256 = h_mul;
+	bits64 a0, a1, b0, b1, z0, z1, z2, z3;
+	int i;
+
+	for(i = 0; i < iterations; i++)
+	{
+		a0 = random_bits();
+		a1 = random_bits();
+		b0 = random_bits();
+		b1 = random_bits();
+
+		mul64To128(a1, b1, &z0, &z1);
+		h_mul = hash(hash(h_mul, z0), z1);
+		add128(a0, a1, b0, b1, &z0, &z1);
+		h_add = hash(hash(h_add, z0), z1);
+		sub128(a0, a1, b0, b1, &z0, &z1);
+		h_sub = hash(hash(h_sub, z0), z1);
+		shortShift128Left(a0, a1, random64() & 63, &z0, &z1);
+		h_shift = hash(hash(h_shift, z0), z1);
+		h_clz = hash(hash(h_clz, countLeadingZeros32((bits32)a0)), countLeadingZeros64(a1));
+
+		/* estimateDiv128To64 wants the divisor normalized and a0 < b */
+		b0 |= LIT64(0x8000000000000000);
+		h_div = hash(h_div, estimateDiv128To64(a0 < b0 ? a0 : a0 >> 1, a1, b0));
+
+		mul128By64To192(a0, a1, b0, &z0, &z1, &z2);
+		h_192 = hash(hash(hash(h_192, z0), z1), z2);
+		mul128To256(a0, a1, b0, b1, &z0, &z1, &z2, &z3);
+		h_256 = hash(hash(hash(hash(h_256, z0), z1), z2), z3);
+	}
+	report("mul64To128", h_mul);
+	report("add128", h_add);
+	report("sub128", h_sub);
+	report("shortShift128Left", h_shift);
+	report("countLeadingZeros", h_clz);
+	report("estimateDiv128To64", h_div);
+	report("mul128By64To192", h_192);
+	report("mul128To256", h_256);
+}
+
+static bits64 hash_floatx80(bits64 h, floatx80 x)
+{
+	return hash(hash(h, x.high), x.low);
+}
+
+static void test_operations(int iterations, int mode)
+{
+	static const char* const mode_names[] = {"nearest", "zero", "down", "up"};
+	bits64 h_64 = 0xcbf29ce484222325ULL;
+	bits64 h_80 = h_64, h_convert = h_64;
+	float64 a, b;
+	floatx80 x, y;
+	char name[40];
+	int i;
+
+	float_rounding_mode = mode;
+	float_exception_flags = 0;
+	for(i = 0; i < iterations; i++)
+	{
+		a = random_float64();
+		b = random_float64();
+		h_64 = hash(h_64, float64_add(a, b));
+		h_64 = hash(h_64, float64_sub(a, b));
+		h_64 = hash(h_64, float64_mul(a, b));
+		h_64 = hash(h_64, float64_div(a, b));
+		h_64 = hash(h_64, float64_rem(a, b));
+		h_64 = hash(h_64, float64_sqrt(a));
+		h_64 = hash(h_64, float_exception_flags);
+		float_exception_flags = 0;
+
+		x = random_floatx80();
+		y = random_floatx80();
+		h_80 = hash_floatx80(h_80, floatx80_add(x, y));
+		h_80 = hash_floatx80(h_80, floatx80_sub(x, y));
+		h_80 = hash_floatx80(h_80, floatx80_mul(x, y));
+		h_80 = hash_floatx80(h_80, floatx80_div(x, y));
+		h_80 = hash_floatx80(h_80, floatx80_rem(x, y));
+		h_80 = hash_floatx80(h_80, floatx80_sqrt(x));
+		h_80 = hash(h_80, float_exception_flags);
+		float_exception_flags = 0;
+
+		h_convert = hash_floatx80(h_convert, float64_to_floatx80(a));
+		h_convert = hash(h_convert, floatx80_to_float64(x));
+		h_convert = hash(h_convert, (bits64)floatx80_to_int64(x));
+		h_convert = hash(h_convert, (bits64)float64_to_int64(a));
+		h_convert = hash(h_convert, float_exception_flags);
+		float_exception_flags = 0;
+	}
+	sprintf(name, "float64 %s", mode_names[mode]);
+	report(name, h_64);
+	sprintf(name, "floatx80 %s", mode_names[mode]);
+	report(name, h_80);
+	sprintf(name, "convert %s", mode_names[mode]);
+	report(name, h_convert);
+}
+
+int main(int argc, char* argv[])
+{
+	int iterations = argc > 1 ? atoi(argv[1]) : DEFAULT_ITERATIONS;
+	int mode;
+
+	g_state = argc > 2 ? strtoull(argv[2], NULL, 0) : DEFAULT_SEED;
+	if(iterations <= 0 || g_state == 0)
+	{
+		fprintf(stderr, "Usage: %s [iterations [seed]]\n", argv[0]);
+		return 1;
+	}
+
+	/* On stderr, so that the outputs of both backends compare equal */
+#ifdef SOFTFLOAT_INT128
+	fprintf(stderr, "backend: int128%s\n",
+#else
+	fprintf(stderr, "backend: portable%s\n",
+#endif
+#ifdef SOFTFLOAT_BUILTIN_CLZ
+		   ", builtin clz");
+#else
+		   "");
+#endif
+
+	test_primitives(iterations);
+	for(mode = float_round_nearest_even; mode <= float_round_up; mode++)
+		test_operations(iterations, mode);
+	return 0;
+}